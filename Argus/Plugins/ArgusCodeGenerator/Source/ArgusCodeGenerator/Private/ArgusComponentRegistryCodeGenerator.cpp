@@ -2,6 +2,7 @@
 
 #include "ArgusComponentRegistryCodeGenerator.h"
 #include "Misc/Paths.h"
+#include "TypeInfo.h"
 #include <filesystem>
 #include <fstream>
 #include <regex>
@@ -21,6 +22,9 @@ const char* ArgusComponentRegistryCodeGenerator::s_removeComponentCppTemplateDyn
 const char* ArgusComponentRegistryCodeGenerator::s_componentCppTemplateFlushFilename = "ComponentCppTemplateFlush.txt";
 const char* ArgusComponentRegistryCodeGenerator::s_componentCppTemplateResetFilename = "ComponentCppTemplateReset.txt";
 const char* ArgusComponentRegistryCodeGenerator::s_componentCppTemplateSerializeFilename = "ComponentCppTemplateSerialize.txt";
+const char* ArgusComponentRegistryCodeGenerator::s_componentCppTemplateBulkSerializeFilename = "ComponentCppTemplateBulkSerialize.txt";
+const char* ArgusComponentRegistryCodeGenerator::s_componentCppTemplateBulkCopyFilename = "ComponentCppTemplateBulkCopy.txt";
+const char* ArgusComponentRegistryCodeGenerator::s_componentCppTemplateBulkSerializeCopyFilename = "ComponentCppTemplateBulkSerializeCopy.txt";
 const char* ArgusComponentRegistryCodeGenerator::s_dynamicAllocComponentCppTemplateSerializeFilename = "DynamicAllocComponentCppTemplateSerialize.txt";
 const char* ArgusComponentRegistryCodeGenerator::s_dynamicAllocComponentCppTemplateResetFilename = "DynamicAllocComponentCppTemplateReset.txt";
 const char* ArgusComponentRegistryCodeGenerator::s_debugStringLinesTemplateFilename = "AppendDebugStringCppTemplate.txt";
@@ -44,6 +48,8 @@ void ArgusComponentRegistryCodeGenerator::GenerateComponentRegistryCode(const Ar
 	params.inDynamicAllocComponentNames = parsedComponentData.m_dynamicAllocComponentNames;
 	params.inIncludeStatements = parsedComponentData.m_componentRegistryIncludeStatements;
 	params.inDynamicAllocIncludeStatements = parsedComponentData.m_dynamicAllocComponentRegistryIncludeStatements;
+	params.inComponentVariableData = parsedComponentData.m_componentVariableData;
+	params.inComponentInfo = parsedComponentData.m_componentInfo;
 
 	// Construct a directory path to component registry templates
 	const char* cStrTemplateDirectory = ARGUS_FSTRING_TO_CHAR(ArgusCodeGeneratorUtil::GetTemplateDirectory(s_componentRegistryTemplateDirectorySuffix));
@@ -60,6 +66,9 @@ void ArgusComponentRegistryCodeGenerator::GenerateComponentRegistryCode(const Ar
 	params.componentCppTemplateResetFilePath = std::string(cStrTemplateDirectory).append(s_componentCppTemplateResetFilename);
 	params.componentCppTemplateFlushFilePath = std::string(cStrTemplateDirectory).append(s_componentCppTemplateFlushFilename);
 	params.componentCppTemplateSerializeFilePath = std::string(cStrTemplateDirectory).append(s_componentCppTemplateSerializeFilename);
+	params.componentCppTemplateBulkSerializeFilePath = std::string(cStrTemplateDirectory).append(s_componentCppTemplateBulkSerializeFilename);
+	params.componentCppTemplateBulkCopyFilePath = std::string(cStrTemplateDirectory).append(s_componentCppTemplateBulkCopyFilename);
+	params.componentCppTemplateBulkSerializeCopyFilePath = std::string(cStrTemplateDirectory).append(s_componentCppTemplateBulkSerializeCopyFilename);
 	params.dynamicAllocComponentCppTemplateSerializeFilePath = std::string(cStrTemplateDirectory).append(s_dynamicAllocComponentCppTemplateSerializeFilename);
 	params.dynamicAllocComponentCppTemplateResetFilePath = std::string(cStrTemplateDirectory).append(s_dynamicAllocComponentCppTemplateResetFilename);
 	params.debugStringLinesTemplateFilePath = std::string(cStrTemplateDirectory).append(s_debugStringLinesTemplateFilename);
@@ -143,6 +152,14 @@ bool ArgusComponentRegistryCodeGenerator::ParseComponentRegistryHeaderTemplateWi
 		{
 			outFileContents.push_back(std::regex_replace(headerLineText, std::regex("%%%%%"), std::to_string(params.inComponentNames.size() + params.inDynamicAllocComponentNames.size())));
 		}
+		else if (headerLineText.find("$$$$$") != std::string::npos)
+		{
+			outFileContents.push_back(std::regex_replace(headerLineText, std::regex("\\$\\$\\$\\$\\$"), std::to_string(params.inComponentNames.size())));
+		}
+		else if (headerLineText.find("=====") != std::string::npos)
+		{
+			outFileContents.push_back(std::regex_replace(headerLineText, std::regex("====="), std::to_string(GetBulkComponentsLayoutHash(params))));
+		}
 		else if (headerLineText.find("#####") != std::string::npos)
 		{
 			for (std::string parsedLine : parsedLines)
@@ -208,7 +225,13 @@ bool ArgusComponentRegistryCodeGenerator::ParseComponentRegistryCppTemplateWithR
 
 	// Parse serialization logic into one section
 	std::vector<std::string> parsedSerializationLines = std::vector<std::string>();
-	didSucceed &= ArgusCodeGeneratorUtil::ParseComponentSpecificTemplate(params.componentCppTemplateSerializeFilePath, params.inComponentNames, parsedSerializationLines);
+	didSucceed &= ParseComponentSerializationLines(params, parsedSerializationLines);
+
+	// Parse copying and serializing copies of bulk serialized components into their own sections
+	std::vector<std::string> parsedBulkCopyLines = std::vector<std::string>();
+	std::vector<std::string> parsedBulkSerializeCopyLines = std::vector<std::string>();
+	didSucceed &= ParseBulkComponentLines(params, params.componentCppTemplateBulkCopyFilePath, parsedBulkCopyLines);
+	didSucceed &= ParseBulkComponentLines(params, params.componentCppTemplateBulkSerializeCopyFilePath, parsedBulkSerializeCopyLines);
 
 	// Parse dynamic alloc serialization logic into one section
 	std::vector<std::string> parsedDynamicSerializationLines = std::vector<std::string>();
@@ -325,6 +348,20 @@ bool ArgusComponentRegistryCodeGenerator::ParseComponentRegistryCppTemplateWithR
 				outFileContents.push_back(parsedLine);
 			}
 		}
+		else if (cppLineText.find("=====") != std::string::npos)
+		{
+			for (std::string parsedLine : parsedBulkCopyLines)
+			{
+				outFileContents.push_back(parsedLine);
+			}
+		}
+		else if (cppLineText.find("+++++") != std::string::npos)
+		{
+			for (std::string parsedLine : parsedBulkSerializeCopyLines)
+			{
+				outFileContents.push_back(parsedLine);
+			}
+		}
 		else
 		{
 			outFileContents.push_back(cppLineText);
@@ -367,4 +404,156 @@ bool ArgusComponentRegistryCodeGenerator::ParseComponentSizeTestsTemplateWithRep
 	}
 	inTestsStream.close();
 	return didSucceed;
+}
+
+bool ArgusComponentRegistryCodeGenerator::ParseComponentSerializationLines(const ParseComponentTemplateParams& params, std::vector<std::string>& outFileContents)
+{
+	bool didSucceed = true;
+
+	// Each component type becomes one case of ArgusComponentRegistry::SerializeComponentType, keyed by its index in inComponentNames.
+	for (int i = 0; i < params.inComponentNames.size(); ++i)
+	{
+		const std::vector<std::string> componentName = std::vector<std::string>(1, params.inComponentNames[i]);
+		std::vector<std::string> parsedLines = std::vector<std::string>();
+		if (i >= params.inComponentVariableData.size() || i >= params.inComponentInfo.size() || !IsComponentTriviallySerializable(params.inComponentVariableData[i], params.inComponentInfo[i]))
+		{
+			didSucceed &= ArgusCodeGeneratorUtil::ParseComponentSpecificTemplate(params.componentCppTemplateSerializeFilePath, componentName, parsedLines);
+		}
+		else
+		{
+			std::vector<std::string> parsedBulkLines = std::vector<std::string>();
+			didSucceed &= ArgusCodeGeneratorUtil::ParseComponentSpecificTemplate(params.componentCppTemplateBulkSerializeFilePath, componentName, parsedBulkLines);
+
+			const std::string layoutHash = std::to_string(GetComponentLayoutHash(params.inComponentNames[i], params.inComponentVariableData[i]));
+			for (std::string parsedLine : parsedBulkLines)
+			{
+				parsedLines.push_back(std::regex_replace(parsedLine, std::regex("@@@@@"), layoutHash));
+			}
+		}
+
+		outFileContents.push_back(std::string("\t\tcase ").append(std::to_string(i)).append(":"));
+		for (std::string parsedLine : parsedLines)
+		{
+			outFileContents.push_back(std::string("\t\t").append(parsedLine));
+		}
+		outFileContents.push_back("\t\t\tbreak;");
+	}
+
+	return didSucceed;
+}
+
+bool ArgusComponentRegistryCodeGenerator::ParseBulkComponentLines(const ParseComponentTemplateParams& params, const std::string& templateFilePath, std::vector<std::string>& outFileContents)
+{
+	bool didSucceed = true;
+
+	// Only bulk serialized component types get a case, keyed by their index in inComponentNames. Every other type falls through to the default case.
+	for (int i = 0; i < params.inComponentNames.size(); ++i)
+	{
+		if (i >= params.inComponentVariableData.size() || i >= params.inComponentInfo.size() || !IsComponentTriviallySerializable(params.inComponentVariableData[i], params.inComponentInfo[i]))
+		{
+			continue;
+		}
+
+		const std::vector<std::string> componentName = std::vector<std::string>(1, params.inComponentNames[i]);
+		std::vector<std::string> parsedLines = std::vector<std::string>();
+		didSucceed &= ArgusCodeGeneratorUtil::ParseComponentSpecificTemplate(templateFilePath, componentName, parsedLines);
+
+		const std::string layoutHash = std::to_string(GetComponentLayoutHash(params.inComponentNames[i], params.inComponentVariableData[i]));
+		outFileContents.push_back(std::string("\t\tcase ").append(std::to_string(i)).append(":"));
+		for (std::string parsedLine : parsedLines)
+		{
+			outFileContents.push_back(std::string("\t\t").append(std::regex_replace(parsedLine, std::regex("@@@@@"), layoutHash)));
+		}
+		outFileContents.push_back("\t\t\tbreak;");
+	}
+
+	return didSucceed;
+}
+
+bool ArgusComponentRegistryCodeGenerator::IsComponentTriviallySerializable(const std::vector<ArgusCodeGeneratorUtil::ParsedVariableData>& variableData, const ArgusCodeGeneratorUtil::PerComponentData& componentInfo)
+{
+	// A raw copy would also overwrite transient fields and the private state behind observables, so those components keep per field serialization.
+	if (componentInfo.m_hasObservables || variableData.empty())
+	{
+		return false;
+	}
+
+	for (int i = 0; i < variableData.size(); ++i)
+	{
+		if (variableData[i].m_propertyMacro.find(ArgusCodeGeneratorUtil::s_propertyTransientDelimiter) != std::string::npos)
+		{
+			return false;
+		}
+
+		const TypeInfo typeInfo = TypeInfo(variableData[i]);
+		if (typeInfo.m_containerType != ContainerType::NoContainer && typeInfo.m_containerType != ContainerType::CArray)
+		{
+			return false;
+		}
+
+		switch (typeInfo.m_underlyingType)
+		{
+			case UnderlyingType::Bool:
+			case UnderlyingType::Float:
+			case UnderlyingType::Integer:
+			case UnderlyingType::Vector:
+			case UnderlyingType::Vector2:
+			case UnderlyingType::Enum:
+			case UnderlyingType::Bitmask:
+			case UnderlyingType::StaticData:
+			case UnderlyingType::TimerHandle:
+				break;
+			default:
+				return false;
+		}
+	}
+
+	return true;
+}
+
+uint32 ArgusComponentRegistryCodeGenerator::GetComponentLayoutHash(const std::string& componentName, const std::vector<ArgusCodeGeneratorUtil::ParsedVariableData>& variableData)
+{
+	std::string layoutString = componentName;
+	for (int i = 0; i < variableData.size(); ++i)
+	{
+		const TypeInfo typeInfo = TypeInfo(variableData[i]);
+		layoutString.append(typeInfo.m_cleanTypeName).append(" ").append(typeInfo.m_cleanVariableName);
+		if (!typeInfo.m_staticSize.empty())
+		{
+			layoutString.append("[").append(typeInfo.m_staticSize).append("]");
+		}
+		layoutString.append(";");
+	}
+
+	return GetStringHash(layoutString);
+}
+
+uint32 ArgusComponentRegistryCodeGenerator::GetBulkComponentsLayoutHash(const ParseComponentTemplateParams& params)
+{
+	// Covers which types are bulk serialized, at which index, and each of their layouts. Any change to those makes older saves unreadable.
+	std::string layoutString = "";
+	for (int i = 0; i < params.inComponentNames.size(); ++i)
+	{
+		if (i >= params.inComponentVariableData.size() || i >= params.inComponentInfo.size() || !IsComponentTriviallySerializable(params.inComponentVariableData[i], params.inComponentInfo[i]))
+		{
+			continue;
+		}
+
+		layoutString.append(std::to_string(i)).append(":").append(std::to_string(GetComponentLayoutHash(params.inComponentNames[i], params.inComponentVariableData[i]))).append(";");
+	}
+
+	return GetStringHash(layoutString);
+}
+
+uint32 ArgusComponentRegistryCodeGenerator::GetStringHash(const std::string& string)
+{
+	// FNV-1a, so that the hash is stable regardless of which compiler runs the generator.
+	uint32 hash = 2166136261u;
+	for (const char character : string)
+	{
+		hash ^= static_cast<uint8>(character);
+		hash *= 16777619u;
+	}
+
+	return hash;
 }
\ No newline at end of file
@@ -27,6 +27,9 @@ public:
 	static const char* s_componentCppTemplateFlushFilename;
 	static const char* s_componentCppTemplateResetFilename;
 	static const char* s_componentCppTemplateSerializeFilename;
+	static const char* s_componentCppTemplateBulkSerializeFilename;
+	static const char* s_componentCppTemplateBulkCopyFilename;
+	static const char* s_componentCppTemplateBulkSerializeCopyFilename;
 	static const char* s_dynamicAllocComponentCppTemplateSerializeFilename;
 	static const char* s_dynamicAllocComponentCppTemplateResetFilename;
 	static const char* s_debugStringLinesTemplateFilename;	
@@ -54,6 +57,9 @@ private:
 		std::string componentCppTemplateFlushFilePath = "";
 		std::string componentCppTemplateResetFilePath = "";
 		std::string componentCppTemplateSerializeFilePath = "";
+		std::string componentCppTemplateBulkSerializeFilePath = "";
+		std::string componentCppTemplateBulkCopyFilePath = "";
+		std::string componentCppTemplateBulkSerializeCopyFilePath = "";
 		std::string dynamicAllocComponentCppTemplateSerializeFilePath = "";
 		std::string dynamicAllocComponentCppTemplateResetFilePath = "";
 		std::string debugStringLinesTemplateFilePath = "";
@@ -65,8 +71,16 @@ private:
 		std::vector<std::string> inDynamicAllocComponentNames = std::vector<std::string>();
 		std::vector<std::string> inIncludeStatements = std::vector<std::string>();
 		std::vector<std::string> inDynamicAllocIncludeStatements = std::vector<std::string>();
+		std::vector< std::vector<ArgusCodeGeneratorUtil::ParsedVariableData> > inComponentVariableData;
+		std::vector<ArgusCodeGeneratorUtil::PerComponentData> inComponentInfo;
 	};
 	static bool ParseComponentRegistryHeaderTemplateWithReplacements(const ParseComponentTemplateParams& params, std::vector<std::string>& outFileContents);
 	static bool ParseComponentRegistryCppTemplateWithReplacements(const ParseComponentTemplateParams& params, std::vector<std::string>& outFileContents);
 	static bool ParseComponentSizeTestsTemplateWithReplacements(const ParseComponentTemplateParams& params, std::vector<std::string>& outFileContents);
+	static bool ParseComponentSerializationLines(const ParseComponentTemplateParams& params, std::vector<std::string>& outFileContents);
+	static bool ParseBulkComponentLines(const ParseComponentTemplateParams& params, const std::string& templateFilePath, std::vector<std::string>& outFileContents);
+	static bool IsComponentTriviallySerializable(const std::vector<ArgusCodeGeneratorUtil::ParsedVariableData>& variableData, const ArgusCodeGeneratorUtil::PerComponentData& componentInfo);
+	static uint32 GetComponentLayoutHash(const std::string& componentName, const std::vector<ArgusCodeGeneratorUtil::ParsedVariableData>& variableData);
+	static uint32 GetBulkComponentsLayoutHash(const ParseComponentTemplateParams& params);
+	static uint32 GetStringHash(const std::string& string);
 };
\ No newline at end of file
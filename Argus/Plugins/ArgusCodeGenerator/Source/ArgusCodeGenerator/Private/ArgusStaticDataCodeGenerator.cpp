@@ -13,6 +13,7 @@ const char* ArgusStaticDataCodeGenerator::s_argusStaticDataTemplateFileName = "A
 const char* ArgusStaticDataCodeGenerator::s_argusStaticDataCppTemplateFileName = "ArgusStaticDataCppTemplate.txt";
 const char* ArgusStaticDataCodeGenerator::s_argusStaticDataPerRecordTemplateFileName = "ArgusStaticDataPerRecordTemplate.txt";
 const char* ArgusStaticDataCodeGenerator::s_argusStaticDataPerRecordEditorTemplateFileName = "ArgusStaticDataPerRecordEditorTemplate.txt";
+const char* ArgusStaticDataCodeGenerator::s_argusStaticDataCppPerRecordTemplateFileName = "ArgusStaticDataCppPerRecordTemplate.txt";
 const char* ArgusStaticDataCodeGenerator::s_argusStaticDatabaseHeaderTemplateFileName = "ArgusStaticDatabaseHeaderTemplate.txt";
 const char* ArgusStaticDataCodeGenerator::s_argusStaticDatabaseHeaderPerRecordTemplateFileName = "ArgusStaticDatabaseHeaderPerRecordTemplate.txt";
 const char* ArgusStaticDataCodeGenerator::s_argusStaticDatabaseHeaderFileName = "ArgusStaticDatabase.h";
@@ -69,6 +70,7 @@ bool ArgusStaticDataCodeGenerator::GenerateStaticDataCode(const ArgusCodeGenerat
 
 	ParseTemplateParams parseArgusStaticDataCppTemplateParams;
 	parseArgusStaticDataCppTemplateParams.m_templateFilePath = std::string(cStrTemplateDirectory).append(s_argusStaticDataCppTemplateFileName);
+	parseArgusStaticDataCppTemplateParams.m_perRecordTemplateFilePath = std::string(cStrTemplateDirectory).append(s_argusStaticDataCppPerRecordTemplateFileName);
 	parseArgusStaticDataCppTemplateParams.m_perRecordEditorTemplateFilePath = std::string(cStrTemplateDirectory).append(s_argusStaticDataPerRecordEditorTemplateFileName);
 
 	ParseTemplateParams parseRecordDatabaseHeaderTemplateParams;
@@ -204,6 +206,10 @@ bool ArgusStaticDataCodeGenerator::ParseArgusStaticDataCppTemplate(const ArgusCo
 				outParsedFileContents.back().m_lines.push_back(ArgusCodeGeneratorUtil::MakeIncludeStatement(headerFilePaths[i]));
 			}
 		}
+		else if (templateLineText.find("&&&&&") != std::string::npos)
+		{
+			ParsePerRecordTemplate(parsedStaticDataRecords, templateParams, outParsedFileContents.back());
+		}
 		else if (templateLineText.find("@@@@@") != std::string::npos)
 		{
 			ParsePerRecordEditorTemplate(parsedStaticDataRecords, templateParams, outParsedFileContents.back());
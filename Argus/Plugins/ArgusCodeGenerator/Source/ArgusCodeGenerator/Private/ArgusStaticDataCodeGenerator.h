@@ -17,6 +17,7 @@ private:
 	static const char* s_argusStaticDataCppTemplateFileName;
 	static const char* s_argusStaticDataPerRecordTemplateFileName;
 	static const char* s_argusStaticDataPerRecordEditorTemplateFileName;
+	static const char* s_argusStaticDataCppPerRecordTemplateFileName;
 	static const char* s_argusStaticDataFileName;
 	static const char* s_argusStaticDataCppFileName;
 	static const char* s_argusStaticDatabaseHeaderTemplateFileName;
@@ -267,7 +267,11 @@ void ComponentImplementationGenerator::GeneratePerVariableResetText(const std::v
 		const TypeInfo typeInfo = TypeInfo(parsedVariableData[i]);
 
 		if (typeInfo.m_containerType == ContainerType::Array || typeInfo.m_containerType == ContainerType::BitArray || typeInfo.m_containerType == ContainerType::Deque || typeInfo.m_containerType == ContainerType::Set ||
-			typeInfo.m_underlyingType == UnderlyingType::ResourceSet || typeInfo.m_underlyingType == UnderlyingType::TimerHandle || typeInfo.m_underlyingType == UnderlyingType::Observers)
+			typeInfo.m_underlyingType == UnderlyingType::ResourceSet || typeInfo.m_underlyingType == UnderlyingType::TimerHandle || typeInfo.m_underlyingType == UnderlyingType::Observers ||
+			typeInfo.m_underlyingType == UnderlyingType::TimingWheel || typeInfo.m_underlyingType == UnderlyingType::EntityRoleIndex ||
+			typeInfo.m_underlyingType == UnderlyingType::InfluenceMap || typeInfo.m_underlyingType == UnderlyingType::ScoutingDistanceField ||
+			typeInfo.m_underlyingType == UnderlyingType::PlacementOccupancyGrid || typeInfo.m_underlyingType == UnderlyingType::RandomStream ||
+			typeInfo.m_underlyingType == UnderlyingType::ObstacleORCALinesCacheKey || typeInfo.m_underlyingType == UnderlyingType::AvoidanceGroupUnionFind)
 		{
 			outParsedVariableContents.push_back(std::vformat("\t{}.Reset();", std::make_format_args(typeInfo.m_cleanVariableName)));
 			continue;
@@ -336,6 +340,7 @@ void ComponentImplementationGenerator::GeneratePerVariableSerializeText(const st
 				case UnderlyingType::ResourceSet:
 				case UnderlyingType::TimerHandle:
 				case UnderlyingType::NavAgentSelector:
+				case UnderlyingType::RandomStream:
 					outParsedVariableContents.push_back(std::vformat("\t{}.Serialize(archive);", std::make_format_args(typeInfo.m_cleanVariableName)));
 					break;
 				default:
@@ -491,7 +496,7 @@ bool ComponentImplementationGenerator::PopulateAtomicFormattingFunction(Underlyi
 			functionToPopulate = FormatImGuiRecordField;
 			break;
 		case UnderlyingType::Integer:
-			functionToPopulate = FormatImGuiIntField;
+			functionToPopulate = cleanType.starts_with("uint32") ? FormatImGuiUnsignedIntField : FormatImGuiIntField;
 			break;
 		case UnderlyingType::Bool:
 			functionToPopulate = FormatImGuiBoolField;
@@ -674,6 +679,11 @@ void ComponentImplementationGenerator::FormatImGuiIntField(const std::string& va
 	outParsedVariableContents.push_back(std::vformat("{}\t\tImGui::Text(\"%d\", {});", std::make_format_args(prefix, variableName)));
 }
 
+void ComponentImplementationGenerator::FormatImGuiUnsignedIntField(const std::string& variableName, const std::string& extraData, const std::string& prefix, std::vector<std::string>& outParsedVariableContents)
+{
+	outParsedVariableContents.push_back(std::vformat("{}\t\tImGui::Text(\"%u\", {});", std::make_format_args(prefix, variableName)));
+}
+
 void ComponentImplementationGenerator::FormatImGuiBitmaskField(const std::string& variableName, const std::string& extraData, const std::string& prefix, std::vector<std::string>& outParsedVariableContents)
 {
 	const size_t size = extraData.length();
@@ -206,6 +206,38 @@ UnderlyingType TypeInfo::DetermineType(const std::string& typeString, const std:
 	{
 		output = UnderlyingType::NavAgentSelector;
 	}
+	else if (typeString.find("TimingWheel") != std::string::npos)
+	{
+		output = UnderlyingType::TimingWheel;
+	}
+	else if (typeString.find("EntityRoleIndex") != std::string::npos)
+	{
+		output = UnderlyingType::EntityRoleIndex;
+	}
+	else if (typeString.find("InfluenceMap") != std::string::npos)
+	{
+		output = UnderlyingType::InfluenceMap;
+	}
+	else if (typeString.find("ScoutingDistanceField") != std::string::npos)
+	{
+		output = UnderlyingType::ScoutingDistanceField;
+	}
+	else if (typeString.find("PlacementOccupancyGrid") != std::string::npos)
+	{
+		output = UnderlyingType::PlacementOccupancyGrid;
+	}
+	else if (typeString.find("ArgusRandomStream") != std::string::npos)
+	{
+		output = UnderlyingType::RandomStream;
+	}
+	else if (typeString.find("ObstacleORCALinesCacheKey") != std::string::npos)
+	{
+		output = UnderlyingType::ObstacleORCALinesCacheKey;
+	}
+	else if (typeString.find("AvoidanceGroupUnionFind") != std::string::npos)
+	{
+		output = UnderlyingType::AvoidanceGroupUnionFind;
+	}
 
 	return output;
 }
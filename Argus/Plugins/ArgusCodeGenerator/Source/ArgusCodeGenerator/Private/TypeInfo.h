@@ -29,7 +29,15 @@ enum UnderlyingType : uint8
 	Enum,
 	Observers,
 	ConstructionData,
-	NavAgentSelector
+	NavAgentSelector,
+	TimingWheel,
+	EntityRoleIndex,
+	InfluenceMap,
+	ScoutingDistanceField,
+	PlacementOccupancyGrid,
+	RandomStream,
+	ObstacleORCALinesCacheKey,
+	AvoidanceGroupUnionFind
 };
 
 enum ContainerType : uint8
@@ -0,0 +1,106 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusBakedObstacles.h"
+#include "ArgusLogging.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/SoftObjectPtr.h"
+
+static_assert(std::is_trivially_copyable_v<ObstaclePoint>, "ObstaclePoint must stay trivially copyable to be baked as raw bytes.");
+
+FString UArgusBakedObstacles::GetPackageNameForWorld(const UWorld* worldPointer)
+{
+	if (!worldPointer)
+	{
+		return FString();
+	}
+
+	const FString mapPackageName = UWorld::RemovePIEPrefix(worldPointer->GetOutermost()->GetName());
+	return FString::Printf(TEXT("/Game/BakedData/Obstacles/%s_BakedObstacles"), *FPackageName::GetShortName(mapPackageName));
+}
+
+UArgusBakedObstacles* UArgusBakedObstacles::LoadForWorld(const UWorld* worldPointer)
+{
+	const FString packageName = GetPackageNameForWorld(worldPointer);
+	if (packageName.IsEmpty() || !FPackageName::DoesPackageExist(packageName))
+	{
+		return nullptr;
+	}
+
+	const FSoftObjectPath objectPath = FSoftObjectPath(FString::Printf(TEXT("%s.%s"), *packageName, *FPackageName::GetShortName(packageName)));
+	return TSoftObjectPtr<UArgusBakedObstacles>(objectPath).LoadSynchronous();
+}
+
+bool UArgusBakedObstacles::IsBakeValid(uint32 sourceHash) const
+{
+	return m_sourceHash == sourceHash && m_bakedObstacleBytes.Num() > 0;
+}
+
+bool UArgusBakedObstacles::PopulateObstacles(ObstaclesContainer& outObstacles) const
+{
+	ARGUS_TRACE(UArgusBakedObstacles::PopulateObstacles);
+
+	outObstacles.Reset();
+
+	FMemoryReader reader = FMemoryReader(m_bakedObstacleBytes);
+	uint32 bakeVersion = 0u;
+	uint32 obstaclePointSize = 0u;
+	int32 numObstacles = 0;
+	reader << bakeVersion;
+	reader << obstaclePointSize;
+	reader << numObstacles;
+
+	if (bakeVersion != k_bakeVersion || obstaclePointSize != sizeof(ObstaclePoint) || numObstacles != m_numBakedObstacles)
+	{
+		ARGUS_LOG(ArgusECSLog, Warning, TEXT("[%s] %s %s was baked with an incompatible layout."), ARGUS_FUNCNAME, ARGUS_NAMEOF(UArgusBakedObstacles), *GetName());
+		return false;
+	}
+
+	outObstacles.SetNum(numObstacles);
+	for (int32 i = 0; i < numObstacles; ++i)
+	{
+		int32 numObstaclePoints = 0;
+		reader << numObstaclePoints;
+		reader << outObstacles[i].m_floorHeight;
+
+		if (reader.IsError() || numObstaclePoints < 0 || (reader.TotalSize() - reader.Tell()) < (static_cast<int64>(numObstaclePoints) * sizeof(ObstaclePoint)))
+		{
+			ARGUS_LOG(ArgusECSLog, Warning, TEXT("[%s] %s %s is truncated."), ARGUS_FUNCNAME, ARGUS_NAMEOF(UArgusBakedObstacles), *GetName());
+			outObstacles.Reset();
+			return false;
+		}
+
+		outObstacles[i].SetNumUninitialized(numObstaclePoints);
+		reader.Serialize(outObstacles[i].GetData(), numObstaclePoints * sizeof(ObstaclePoint));
+	}
+
+	return !reader.IsError();
+}
+
+void UArgusBakedObstacles::BakeObstacles(uint32 sourceHash, const ObstaclesContainer& obstacles)
+{
+	ARGUS_TRACE(UArgusBakedObstacles::BakeObstacles);
+
+	m_sourceHash = sourceHash;
+	m_numBakedObstacles = obstacles.Num();
+	m_bakedObstacleBytes.Reset();
+
+	FMemoryWriter writer = FMemoryWriter(m_bakedObstacleBytes);
+	uint32 bakeVersion = k_bakeVersion;
+	uint32 obstaclePointSize = sizeof(ObstaclePoint);
+	int32 numObstacles = m_numBakedObstacles;
+	writer << bakeVersion;
+	writer << obstaclePointSize;
+	writer << numObstacles;
+
+	for (int32 i = 0; i < numObstacles; ++i)
+	{
+		int32 numObstaclePoints = obstacles[i].Num();
+		float floorHeight = obstacles[i].m_floorHeight;
+		writer << numObstaclePoints;
+		writer << floorHeight;
+		writer.Serialize(const_cast<ObstaclePoint*>(obstacles[i].GetData()), numObstaclePoints * sizeof(ObstaclePoint));
+	}
+}
@@ -0,0 +1,36 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ComponentDependencies/ObstaclePoint.h"
+#include "Engine/DataAsset.h"
+#include "ArgusBakedObstacles.generated.h"
+
+class UWorld;
+
+UCLASS()
+class ARGUS_API UArgusBakedObstacles : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr uint32 k_bakeVersion = 2u;
+
+	static FString GetPackageNameForWorld(const UWorld* worldPointer);
+	static UArgusBakedObstacles* LoadForWorld(const UWorld* worldPointer);
+
+	bool IsBakeValid(uint32 sourceHash) const;
+	bool PopulateObstacles(ObstaclesContainer& outObstacles) const;
+	void BakeObstacles(uint32 sourceHash, const ObstaclesContainer& obstacles);
+
+protected:
+	UPROPERTY(VisibleAnywhere)
+	uint32 m_sourceHash = 0u;
+
+	UPROPERTY(VisibleAnywhere)
+	int32 m_numBakedObstacles = 0;
+
+	UPROPERTY()
+	TArray<uint8> m_bakedObstacleBytes;
+};
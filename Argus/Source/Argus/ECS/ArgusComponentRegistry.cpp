@@ -1188,190 +1188,286 @@ uint16 ArgusComponentRegistry::GetOwningEntityIdForComponentMember(const void* m
 	return ArgusECSConstants::k_maxEntities;
 }
 
-void ArgusComponentRegistry::Serialize(FArchive& archive)
+template<typename ArgusComponent>
+void ArgusComponentRegistry::SerializeComponentsPerField(FArchive& archive, TBitArray<ArgusContainerAllocator<ArgusECSConstants::k_numBitBuckets> >& isComponentActive, ArgusComponent* components, TArray<int32>* outSlotSizes)
 {
-	ARGUS_TRACE(ArgusComponentRegistry::Serialize);
-
-	int32 currentIndex = 0;
-	
-	// Serialize statically allocated components
-	s_isAbilityComponentActive.Serialize(archive);
-	currentIndex = s_isAbilityComponentActive.FindFrom(true, 0);
-	while (s_isAbilityComponentActive.IsValidIndex(currentIndex))
-	{
-		s_AbilityComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isAbilityComponentActive.FindFrom(true, currentIndex + 1);
-	}
-	s_isArgusDecalComponentActive.Serialize(archive);
-	currentIndex = s_isArgusDecalComponentActive.FindFrom(true, 0);
-	while (s_isArgusDecalComponentActive.IsValidIndex(currentIndex))
-	{
-		s_ArgusDecalComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isArgusDecalComponentActive.FindFrom(true, currentIndex + 1);
-	}
-	s_isAvoidanceGroupingComponentActive.Serialize(archive);
-	currentIndex = s_isAvoidanceGroupingComponentActive.FindFrom(true, 0);
-	while (s_isAvoidanceGroupingComponentActive.IsValidIndex(currentIndex))
-	{
-		s_AvoidanceGroupingComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isAvoidanceGroupingComponentActive.FindFrom(true, currentIndex + 1);
-	}
-	s_isCarrierComponentActive.Serialize(archive);
-	currentIndex = s_isCarrierComponentActive.FindFrom(true, 0);
-	while (s_isCarrierComponentActive.IsValidIndex(currentIndex))
-	{
-		s_CarrierComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isCarrierComponentActive.FindFrom(true, currentIndex + 1);
-	}
-	s_isCombatComponentActive.Serialize(archive);
-	currentIndex = s_isCombatComponentActive.FindFrom(true, 0);
-	while (s_isCombatComponentActive.IsValidIndex(currentIndex))
-	{
-		s_CombatComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isCombatComponentActive.FindFrom(true, currentIndex + 1);
-	}
-	s_isConstructionComponentActive.Serialize(archive);
-	currentIndex = s_isConstructionComponentActive.FindFrom(true, 0);
-	while (s_isConstructionComponentActive.IsValidIndex(currentIndex))
-	{
-		s_ConstructionComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isConstructionComponentActive.FindFrom(true, currentIndex + 1);
-	}
-	s_isFacingComponentActive.Serialize(archive);
-	currentIndex = s_isFacingComponentActive.FindFrom(true, 0);
-	while (s_isFacingComponentActive.IsValidIndex(currentIndex))
-	{
-		s_FacingComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isFacingComponentActive.FindFrom(true, currentIndex + 1);
-	}
-	s_isFlockingComponentActive.Serialize(archive);
-	currentIndex = s_isFlockingComponentActive.FindFrom(true, 0);
-	while (s_isFlockingComponentActive.IsValidIndex(currentIndex))
-	{
-		s_FlockingComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isFlockingComponentActive.FindFrom(true, currentIndex + 1);
-	}
-	s_isFogOfWarLocationComponentActive.Serialize(archive);
-	currentIndex = s_isFogOfWarLocationComponentActive.FindFrom(true, 0);
-	while (s_isFogOfWarLocationComponentActive.IsValidIndex(currentIndex))
-	{
-		s_FogOfWarLocationComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isFogOfWarLocationComponentActive.FindFrom(true, currentIndex + 1);
-	}
-	s_isHealthComponentActive.Serialize(archive);
-	currentIndex = s_isHealthComponentActive.FindFrom(true, 0);
-	while (s_isHealthComponentActive.IsValidIndex(currentIndex))
-	{
-		s_HealthComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isHealthComponentActive.FindFrom(true, currentIndex + 1);
-	}
-	s_isIdentityComponentActive.Serialize(archive);
-	currentIndex = s_isIdentityComponentActive.FindFrom(true, 0);
-	while (s_isIdentityComponentActive.IsValidIndex(currentIndex))
-	{
-		s_IdentityComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isIdentityComponentActive.FindFrom(true, currentIndex + 1);
-	}
-	s_isLODComponentActive.Serialize(archive);
-	currentIndex = s_isLODComponentActive.FindFrom(true, 0);
-	while (s_isLODComponentActive.IsValidIndex(currentIndex))
-	{
-		s_LODComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isLODComponentActive.FindFrom(true, currentIndex + 1);
-	}
-	s_isNavigationComponentActive.Serialize(archive);
-	currentIndex = s_isNavigationComponentActive.FindFrom(true, 0);
-	while (s_isNavigationComponentActive.IsValidIndex(currentIndex))
-	{
-		s_NavigationComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isNavigationComponentActive.FindFrom(true, currentIndex + 1);
-	}
-	s_isNearbyEntitiesComponentActive.Serialize(archive);
-	currentIndex = s_isNearbyEntitiesComponentActive.FindFrom(true, 0);
-	while (s_isNearbyEntitiesComponentActive.IsValidIndex(currentIndex))
-	{
-		s_NearbyEntitiesComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isNearbyEntitiesComponentActive.FindFrom(true, currentIndex + 1);
-	}
-	s_isNearbyObstaclesComponentActive.Serialize(archive);
-	currentIndex = s_isNearbyObstaclesComponentActive.FindFrom(true, 0);
-	while (s_isNearbyObstaclesComponentActive.IsValidIndex(currentIndex))
-	{
-		s_NearbyObstaclesComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isNearbyObstaclesComponentActive.FindFrom(true, currentIndex + 1);
-	}
-	s_isObserversComponentActive.Serialize(archive);
-	currentIndex = s_isObserversComponentActive.FindFrom(true, 0);
-	while (s_isObserversComponentActive.IsValidIndex(currentIndex))
+	const int64 headerStart = archive.Tell();
+	isComponentActive.Serialize(archive);
+	if (outSlotSizes)
 	{
-		s_ObserversComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isObserversComponentActive.FindFrom(true, currentIndex + 1);
+		outSlotSizes->Reset();
+		outSlotSizes->SetNumZeroed(isComponentActive.Num() + 1);
+		(*outSlotSizes)[0] = static_cast<int32>(archive.Tell() - headerStart);
 	}
-	s_isPassengerComponentActive.Serialize(archive);
-	currentIndex = s_isPassengerComponentActive.FindFrom(true, 0);
-	while (s_isPassengerComponentActive.IsValidIndex(currentIndex))
-	{
-		s_PassengerComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isPassengerComponentActive.FindFrom(true, currentIndex + 1);
-	}
-	s_isResourceComponentActive.Serialize(archive);
-	currentIndex = s_isResourceComponentActive.FindFrom(true, 0);
-	while (s_isResourceComponentActive.IsValidIndex(currentIndex))
+
+	for (TConstSetBitIterator<ArgusContainerAllocator<ArgusECSConstants::k_numBitBuckets> > iterator(isComponentActive); iterator; ++iterator)
 	{
-		s_ResourceComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isResourceComponentActive.FindFrom(true, currentIndex + 1);
+		const int64 componentStart = archive.Tell();
+		components[iterator.GetIndex()].Serialize(archive);
+		if (outSlotSizes)
+		{
+			(*outSlotSizes)[iterator.GetIndex() + 1] = static_cast<int32>(archive.Tell() - componentStart);
+		}
 	}
-	s_isResourceExtractionComponentActive.Serialize(archive);
-	currentIndex = s_isResourceExtractionComponentActive.FindFrom(true, 0);
-	while (s_isResourceExtractionComponentActive.IsValidIndex(currentIndex))
+}
+
+template<typename ArgusComponent>
+void ArgusComponentRegistry::SerializeComponentsInBulk(FArchive& archive, TBitArray<ArgusContainerAllocator<ArgusECSConstants::k_numBitBuckets> >& isComponentActive, ArgusComponent* components, uint32 layoutHash, TArray<int32>* outSlotSizes)
+{
+	static_assert(std::is_trivially_copyable_v<ArgusComponent>, "Only trivially copyable components can be serialized in bulk.");
+
+	const int64 headerStart = archive.Tell();
+	uint32 serializedLayoutHash = layoutHash;
+	uint32 serializedComponentSize = sizeof(ArgusComponent);
+	archive << serializedLayoutHash;
+	archive << serializedComponentSize;
+	isComponentActive.Serialize(archive);
+
+	int32 numActiveComponents = isComponentActive.CountSetBits();
+	const int64 numSerializedBytes = static_cast<int64>(numActiveComponents) * serializedComponentSize;
+
+	// Active components are packed into one contiguous block so the whole type is written with a single copy.
+	TArray<ArgusComponent> packedComponents;
+	if (archive.IsLoading())
 	{
-		s_ResourceExtractionComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isResourceExtractionComponentActive.FindFrom(true, currentIndex + 1);
+		if (serializedLayoutHash != layoutHash || serializedComponentSize != sizeof(ArgusComponent))
+		{
+			// Saves from another layout are meant to be rejected by the bulk layout hash in their header. Anything that gets past that fails the load here
+			// rather than leaving active components at their default values.
+			ARGUS_LOG(ArgusECSLog, Error, TEXT("[%s] Saved layout of %d components no longer matches the current layout. The load cannot continue."), ARGUS_FUNCNAME, numActiveComponents);
+			isComponentActive.SetRange(0, isComponentActive.Num(), false);
+			archive.SetError();
+			return;
+		}
+
+		packedComponents.SetNumUninitialized(numActiveComponents);
+		archive.Serialize(packedComponents.GetData(), numSerializedBytes);
+
+		int32 packedIndex = 0;
+		for (TConstSetBitIterator<ArgusContainerAllocator<ArgusECSConstants::k_numBitBuckets> > iterator(isComponentActive); iterator; ++iterator)
+		{
+			FMemory::Memcpy(&components[iterator.GetIndex()], &packedComponents[packedIndex++], sizeof(ArgusComponent));
+		}
 	}
-	s_isSpawningComponentActive.Serialize(archive);
-	currentIndex = s_isSpawningComponentActive.FindFrom(true, 0);
-	while (s_isSpawningComponentActive.IsValidIndex(currentIndex))
+	else
 	{
-		s_SpawningComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isSpawningComponentActive.FindFrom(true, currentIndex + 1);
+		if (outSlotSizes)
+		{
+			outSlotSizes->Reset();
+			outSlotSizes->SetNumZeroed(isComponentActive.Num() + 1);
+			(*outSlotSizes)[0] = static_cast<int32>(archive.Tell() - headerStart);
+		}
+
+		packedComponents.Reserve(numActiveComponents);
+		for (TConstSetBitIterator<ArgusContainerAllocator<ArgusECSConstants::k_numBitBuckets> > iterator(isComponentActive); iterator; ++iterator)
+		{
+			packedComponents.Add(components[iterator.GetIndex()]);
+			if (outSlotSizes)
+			{
+				(*outSlotSizes)[iterator.GetIndex() + 1] = sizeof(ArgusComponent);
+			}
+		}
+
+		archive.Serialize(packedComponents.GetData(), numSerializedBytes);
 	}
-	s_isTargetingComponentActive.Serialize(archive);
-	currentIndex = s_isTargetingComponentActive.FindFrom(true, 0);
-	while (s_isTargetingComponentActive.IsValidIndex(currentIndex))
+}
+
+template<typename ArgusComponent>
+void ArgusComponentRegistry::CopyComponentsForBulkSerialization(const TBitArray<ArgusContainerAllocator<ArgusECSConstants::k_numBitBuckets> >& isComponentActive, const ArgusComponent* components, ArgusComponentTypeCopy& outComponentTypeCopy)
+{
+	static_assert(std::is_trivially_copyable_v<ArgusComponent>, "Only trivially copyable components can be serialized in bulk.");
+	static_assert(alignof(ArgusComponent) <= ArgusComponentTypeCopy::k_alignment, "Copied components would be misaligned.");
+
+	outComponentTypeCopy.m_isComponentActive = isComponentActive;
+	outComponentTypeCopy.m_componentBytes.SetNumUninitialized(sizeof(ArgusComponent) * ArgusECSConstants::k_maxEntities);
+	FMemory::Memcpy(outComponentTypeCopy.m_componentBytes.GetData(), components, outComponentTypeCopy.m_componentBytes.Num());
+}
+
+void ArgusComponentRegistry::Serialize(FArchive& archive)
+{
+	ARGUS_TRACE(ArgusComponentRegistry::Serialize);
+
+	for (uint32 i = 0u; i < k_numStaticComponentTypes; ++i)
 	{
-		s_TargetingComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isTargetingComponentActive.FindFrom(true, currentIndex + 1);
+		SerializeComponentType(archive, i);
 	}
-	s_isTaskComponentActive.Serialize(archive);
-	currentIndex = s_isTaskComponentActive.FindFrom(true, 0);
-	while (s_isTaskComponentActive.IsValidIndex(currentIndex))
-	{
-		s_TaskComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isTaskComponentActive.FindFrom(true, currentIndex + 1);
+
+	SerializeDynamicAllocComponents(archive);
+}
+
+void ArgusComponentRegistry::SerializeComponentType(FArchive& archive, uint32 componentTypeIndex, TArray<int32>* outSlotSizes)
+{
+	switch (componentTypeIndex)
+	{
+		case 0:
+			SerializeComponentsPerField<AbilityComponent>(archive, s_isAbilityComponentActive, s_AbilityComponents, outSlotSizes);
+			break;
+		case 1:
+			SerializeComponentsInBulk<ArgusDecalComponent>(archive, s_isArgusDecalComponentActive, s_ArgusDecalComponents, 2966401797u, outSlotSizes);
+			break;
+		case 2:
+			SerializeComponentsPerField<AvoidanceGroupingComponent>(archive, s_isAvoidanceGroupingComponentActive, s_AvoidanceGroupingComponents, outSlotSizes);
+			break;
+		case 3:
+			SerializeComponentsPerField<CarrierComponent>(archive, s_isCarrierComponentActive, s_CarrierComponents, outSlotSizes);
+			break;
+		case 4:
+			SerializeComponentsInBulk<CombatComponent>(archive, s_isCombatComponentActive, s_CombatComponents, 1635221548u, outSlotSizes);
+			break;
+		case 5:
+			SerializeComponentsInBulk<ConstructionComponent>(archive, s_isConstructionComponentActive, s_ConstructionComponents, 604652831u, outSlotSizes);
+			break;
+		case 6:
+			SerializeComponentsPerField<FacingComponent>(archive, s_isFacingComponentActive, s_FacingComponents, outSlotSizes);
+			break;
+		case 7:
+			SerializeComponentsInBulk<FlockingComponent>(archive, s_isFlockingComponentActive, s_FlockingComponents, 2552469058u, outSlotSizes);
+			break;
+		case 8:
+			SerializeComponentsInBulk<FogOfWarLocationComponent>(archive, s_isFogOfWarLocationComponentActive, s_FogOfWarLocationComponents, 3347196209u, outSlotSizes);
+			break;
+		case 9:
+			SerializeComponentsInBulk<HealthComponent>(archive, s_isHealthComponentActive, s_HealthComponents, 3239073965u, outSlotSizes);
+			break;
+		case 10:
+			SerializeComponentsInBulk<IdentityComponent>(archive, s_isIdentityComponentActive, s_IdentityComponents, 2863098759u, outSlotSizes);
+			break;
+		case 11:
+			SerializeComponentsPerField<LODComponent>(archive, s_isLODComponentActive, s_LODComponents, outSlotSizes);
+			break;
+		case 12:
+			SerializeComponentsPerField<NavigationComponent>(archive, s_isNavigationComponentActive, s_NavigationComponents, outSlotSizes);
+			break;
+		case 13:
+			SerializeComponentsPerField<NearbyEntitiesComponent>(archive, s_isNearbyEntitiesComponentActive, s_NearbyEntitiesComponents, outSlotSizes);
+			break;
+		case 14:
+			SerializeComponentsPerField<NearbyObstaclesComponent>(archive, s_isNearbyObstaclesComponentActive, s_NearbyObstaclesComponents, outSlotSizes);
+			break;
+		case 15:
+			SerializeComponentsPerField<ObserversComponent>(archive, s_isObserversComponentActive, s_ObserversComponents, outSlotSizes);
+			break;
+		case 16:
+			SerializeComponentsPerField<PassengerComponent>(archive, s_isPassengerComponentActive, s_PassengerComponents, outSlotSizes);
+			break;
+		case 17:
+			SerializeComponentsPerField<ResourceComponent>(archive, s_isResourceComponentActive, s_ResourceComponents, outSlotSizes);
+			break;
+		case 18:
+			SerializeComponentsInBulk<ResourceExtractionComponent>(archive, s_isResourceExtractionComponentActive, s_ResourceExtractionComponents, 3282699855u, outSlotSizes);
+			break;
+		case 19:
+			SerializeComponentsPerField<SpawningComponent>(archive, s_isSpawningComponentActive, s_SpawningComponents, outSlotSizes);
+			break;
+		case 20:
+			SerializeComponentsPerField<TargetingComponent>(archive, s_isTargetingComponentActive, s_TargetingComponents, outSlotSizes);
+			break;
+		case 21:
+			SerializeComponentsPerField<TaskComponent>(archive, s_isTaskComponentActive, s_TaskComponents, outSlotSizes);
+			break;
+		case 22:
+			SerializeComponentsPerField<TimerComponent>(archive, s_isTimerComponentActive, s_TimerComponents, outSlotSizes);
+			break;
+		case 23:
+			SerializeComponentsInBulk<TransformComponent>(archive, s_isTransformComponentActive, s_TransformComponents, 599365598u, outSlotSizes);
+			break;
+		case 24:
+			SerializeComponentsInBulk<VelocityComponent>(archive, s_isVelocityComponentActive, s_VelocityComponents, 2940006284u, outSlotSizes);
+			break;
+		default:
+			break;
 	}
-	s_isTimerComponentActive.Serialize(archive);
-	currentIndex = s_isTimerComponentActive.FindFrom(true, 0);
-	while (s_isTimerComponentActive.IsValidIndex(currentIndex))
-	{
-		s_TimerComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isTimerComponentActive.FindFrom(true, currentIndex + 1);
+}
+
+bool ArgusComponentRegistry::CopyComponentType(uint32 componentTypeIndex, ArgusComponentTypeCopy& outComponentTypeCopy)
+{
+	outComponentTypeCopy.m_isComponentActive.Reset();
+	outComponentTypeCopy.m_componentBytes.Reset();
+	switch (componentTypeIndex)
+	{
+		case 1:
+			CopyComponentsForBulkSerialization<ArgusDecalComponent>(s_isArgusDecalComponentActive, s_ArgusDecalComponents, outComponentTypeCopy);
+			break;
+		case 4:
+			CopyComponentsForBulkSerialization<CombatComponent>(s_isCombatComponentActive, s_CombatComponents, outComponentTypeCopy);
+			break;
+		case 5:
+			CopyComponentsForBulkSerialization<ConstructionComponent>(s_isConstructionComponentActive, s_ConstructionComponents, outComponentTypeCopy);
+			break;
+		case 7:
+			CopyComponentsForBulkSerialization<FlockingComponent>(s_isFlockingComponentActive, s_FlockingComponents, outComponentTypeCopy);
+			break;
+		case 8:
+			CopyComponentsForBulkSerialization<FogOfWarLocationComponent>(s_isFogOfWarLocationComponentActive, s_FogOfWarLocationComponents, outComponentTypeCopy);
+			break;
+		case 9:
+			CopyComponentsForBulkSerialization<HealthComponent>(s_isHealthComponentActive, s_HealthComponents, outComponentTypeCopy);
+			break;
+		case 10:
+			CopyComponentsForBulkSerialization<IdentityComponent>(s_isIdentityComponentActive, s_IdentityComponents, outComponentTypeCopy);
+			break;
+		case 18:
+			CopyComponentsForBulkSerialization<ResourceExtractionComponent>(s_isResourceExtractionComponentActive, s_ResourceExtractionComponents, outComponentTypeCopy);
+			break;
+		case 23:
+			CopyComponentsForBulkSerialization<TransformComponent>(s_isTransformComponentActive, s_TransformComponents, outComponentTypeCopy);
+			break;
+		case 24:
+			CopyComponentsForBulkSerialization<VelocityComponent>(s_isVelocityComponentActive, s_VelocityComponents, outComponentTypeCopy);
+			break;
+		default:
+			break;
 	}
-	s_isTransformComponentActive.Serialize(archive);
-	currentIndex = s_isTransformComponentActive.FindFrom(true, 0);
-	while (s_isTransformComponentActive.IsValidIndex(currentIndex))
+
+	return !outComponentTypeCopy.m_componentBytes.IsEmpty();
+}
+
+void ArgusComponentRegistry::SerializeComponentTypeCopy(FArchive& archive, uint32 componentTypeIndex, ArgusComponentTypeCopy& componentTypeCopy, TArray<int32>* outSlotSizes)
+{
+	if (!archive.IsSaving() || componentTypeCopy.m_componentBytes.IsEmpty())
 	{
-		s_TransformComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isTransformComponentActive.FindFrom(true, currentIndex + 1);
+		return;
 	}
-	s_isVelocityComponentActive.Serialize(archive);
-	currentIndex = s_isVelocityComponentActive.FindFrom(true, 0);
-	while (s_isVelocityComponentActive.IsValidIndex(currentIndex))
-	{
-		s_VelocityComponents[currentIndex].Serialize(archive);
-		currentIndex = s_isVelocityComponentActive.FindFrom(true, currentIndex + 1);
+
+	switch (componentTypeIndex)
+	{
+		case 1:
+			SerializeComponentsInBulk<ArgusDecalComponent>(archive, componentTypeCopy.m_isComponentActive, reinterpret_cast<ArgusDecalComponent*>(componentTypeCopy.m_componentBytes.GetData()), 2966401797u, outSlotSizes);
+			break;
+		case 4:
+			SerializeComponentsInBulk<CombatComponent>(archive, componentTypeCopy.m_isComponentActive, reinterpret_cast<CombatComponent*>(componentTypeCopy.m_componentBytes.GetData()), 1635221548u, outSlotSizes);
+			break;
+		case 5:
+			SerializeComponentsInBulk<ConstructionComponent>(archive, componentTypeCopy.m_isComponentActive, reinterpret_cast<ConstructionComponent*>(componentTypeCopy.m_componentBytes.GetData()), 604652831u, outSlotSizes);
+			break;
+		case 7:
+			SerializeComponentsInBulk<FlockingComponent>(archive, componentTypeCopy.m_isComponentActive, reinterpret_cast<FlockingComponent*>(componentTypeCopy.m_componentBytes.GetData()), 2552469058u, outSlotSizes);
+			break;
+		case 8:
+			SerializeComponentsInBulk<FogOfWarLocationComponent>(archive, componentTypeCopy.m_isComponentActive, reinterpret_cast<FogOfWarLocationComponent*>(componentTypeCopy.m_componentBytes.GetData()), 3347196209u, outSlotSizes);
+			break;
+		case 9:
+			SerializeComponentsInBulk<HealthComponent>(archive, componentTypeCopy.m_isComponentActive, reinterpret_cast<HealthComponent*>(componentTypeCopy.m_componentBytes.GetData()), 3239073965u, outSlotSizes);
+			break;
+		case 10:
+			SerializeComponentsInBulk<IdentityComponent>(archive, componentTypeCopy.m_isComponentActive, reinterpret_cast<IdentityComponent*>(componentTypeCopy.m_componentBytes.GetData()), 2863098759u, outSlotSizes);
+			break;
+		case 18:
+			SerializeComponentsInBulk<ResourceExtractionComponent>(archive, componentTypeCopy.m_isComponentActive, reinterpret_cast<ResourceExtractionComponent*>(componentTypeCopy.m_componentBytes.GetData()), 3282699855u, outSlotSizes);
+			break;
+		case 23:
+			SerializeComponentsInBulk<TransformComponent>(archive, componentTypeCopy.m_isComponentActive, reinterpret_cast<TransformComponent*>(componentTypeCopy.m_componentBytes.GetData()), 599365598u, outSlotSizes);
+			break;
+		case 24:
+			SerializeComponentsInBulk<VelocityComponent>(archive, componentTypeCopy.m_isComponentActive, reinterpret_cast<VelocityComponent*>(componentTypeCopy.m_componentBytes.GetData()), 2940006284u, outSlotSizes);
+			break;
+		default:
+			break;
 	}
+}
 
-	// Serialize dynamically allocated components
+void ArgusComponentRegistry::SerializeDynamicAllocComponents(FArchive& archive)
+{
 	int32 numComponents = 0;
 	numComponents = s_AssetLoadingComponents.Num();
 	archive << numComponents;
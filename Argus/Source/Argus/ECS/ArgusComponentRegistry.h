@@ -54,6 +54,15 @@
 
 class FArchive;
 
+// Raw copy of a bulk serialized component type's storage. Lets the type be written to an archive later, from any thread, without touching the live components.
+struct ArgusComponentTypeCopy
+{
+	static constexpr uint32 k_alignment = 16u;
+
+	TBitArray<ArgusContainerAllocator<ArgusECSConstants::k_numBitBuckets> > m_isComponentActive;
+	TArray<uint8, TAlignedHeapAllocator<k_alignment> > m_componentBytes;
+};
+
 class ArgusComponentRegistry
 {
 public:
@@ -81,11 +90,36 @@ public:
 	
 	static void Serialize(FArchive& archive);
 
+	// Each statically allocated component type only touches its own storage, so different types can be serialized from different threads.
+	// When saving, outSlotSizes receives the bytes written for the type's header followed by the bytes written for each entity id, zero for
+	// entities without the component. That lets two captures be compared entity by entity.
+	static void SerializeComponentType(FArchive& archive, uint32 componentTypeIndex, TArray<int32>* outSlotSizes = nullptr);
+
+	// Bulk serialized types can be copied with a single memcpy and saved from the copy later, writing the same bytes SerializeComponentType would.
+	// CopyComponentType returns false for per field types, which have to be serialized in place.
+	static bool CopyComponentType(uint32 componentTypeIndex, ArgusComponentTypeCopy& outComponentTypeCopy);
+	static void SerializeComponentTypeCopy(FArchive& archive, uint32 componentTypeIndex, ArgusComponentTypeCopy& componentTypeCopy, TArray<int32>* outSlotSizes = nullptr);
+	static void SerializeDynamicAllocComponents(FArchive& archive);
+
 #if !UE_BUILD_SHIPPING
 	static void DrawComponentsDebug(uint16 entityId);
 #endif //!UE_BUILD_SHIPPING
 
 	static constexpr uint32 k_numComponentTypes = 38;
+	static constexpr uint32 k_numStaticComponentTypes = 25;
+
+	// Combined layout hash of every bulk serialized component type. Saves store it, since bulk data from any other layout can't be read back.
+	static constexpr uint32 k_bulkComponentsLayoutHash = 3206020810u;
+
+private:
+	template<typename ArgusComponent>
+	static void SerializeComponentsPerField(FArchive& archive, TBitArray<ArgusContainerAllocator<ArgusECSConstants::k_numBitBuckets> >& isComponentActive, ArgusComponent* components, TArray<int32>* outSlotSizes);
+	template<typename ArgusComponent>
+	static void SerializeComponentsInBulk(FArchive& archive, TBitArray<ArgusContainerAllocator<ArgusECSConstants::k_numBitBuckets> >& isComponentActive, ArgusComponent* components, uint32 layoutHash, TArray<int32>* outSlotSizes);
+	template<typename ArgusComponent>
+	static void CopyComponentsForBulkSerialization(const TBitArray<ArgusContainerAllocator<ArgusECSConstants::k_numBitBuckets> >& isComponentActive, const ArgusComponent* components, ArgusComponentTypeCopy& outComponentTypeCopy);
+
+public:
 
 	// Begin component specific template specifiers.
 	
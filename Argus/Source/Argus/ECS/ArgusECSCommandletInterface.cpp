@@ -3,7 +3,11 @@
 #include "ArgusECSCommandletInterface.h"
 
 #if WITH_EDITOR
+#include "ArgusBakedObstacles.h"
 #include "ArgusEntity.h"
+#include "ArgusEntityTemplate.h"
+#include "ArgusLogging.h"
+#include "Systems/SpatialPartitioningSystems.h"
 
 void ArgusECSCommandletInterface::InitializeECSForCommandlet()
 {
@@ -17,4 +21,28 @@ void ArgusECSCommandletInterface::TeardownECSForCommandlet()
 	ArgusEntity::FlushAllEntities();
 }
 
+bool ArgusECSCommandletInterface::BakeAvoidanceObstacles(const UArgusEntityTemplate* singletonEntityTemplate, const ARecastNavMesh* navMesh, UArgusBakedObstacles* outBakedObstacles)
+{
+	ARGUS_RETURN_ON_NULL_BOOL(singletonEntityTemplate, ArgusECSLog);
+	ARGUS_RETURN_ON_NULL_BOOL(navMesh, ArgusECSLog);
+	ARGUS_RETURN_ON_NULL_BOOL(outBakedObstacles, ArgusECSLog);
+
+	ArgusEntity singletonEntity = ArgusEntity::GetSingletonEntity();
+	ARGUS_RETURN_ON_INVALID_ENTITY_VALUE(singletonEntity, ArgusECSLog, false);
+
+	// The obstacle settings live on the singleton, so it needs to look exactly like it will at runtime for the bake to match.
+	singletonEntityTemplate->PopulateEntity(singletonEntity);
+	const SpatialPartitioningComponent* spatialPartitioningComponent = singletonEntity.GetOrAddComponent<SpatialPartitioningComponent>();
+	ARGUS_RETURN_ON_NULL_BOOL(spatialPartitioningComponent, ArgusECSLog);
+
+	ObstaclesContainer obstacles;
+	if (!SpatialPartitioningSystems::BuildAvoidanceObstacles(spatialPartitioningComponent, navMesh, obstacles))
+	{
+		return false;
+	}
+
+	outBakedObstacles->BakeObstacles(SpatialPartitioningSystems::GetAvoidanceObstaclesSourceHash(spatialPartitioningComponent, navMesh), obstacles);
+	return true;
+}
+
 #endif //WITH_EDITOR
@@ -5,10 +5,15 @@
 #include "CoreMinimal.h"
 
 #if WITH_EDITOR
+class ARecastNavMesh;
+class UArgusBakedObstacles;
+class UArgusEntityTemplate;
+
 class ARGUS_API ArgusECSCommandletInterface
 {
 public:
 	static void InitializeECSForCommandlet();
 	static void TeardownECSForCommandlet();
+	static bool BakeAvoidanceObstacles(const UArgusEntityTemplate* singletonEntityTemplate, const ARecastNavMesh* navMesh, UArgusBakedObstacles* outBakedObstacles);
 };
 #endif //WITH_EDITOR
\ No newline at end of file
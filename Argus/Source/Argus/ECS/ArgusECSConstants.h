@@ -16,6 +16,14 @@ namespace ArgusECSConstants
 	static constexpr uint16 k_avoidanceObstaclePreAllocatedAmount = 500u;
 	static constexpr float k_avoidanceObstacleQueryRadiusMultiplier = 1.5f;
 	static constexpr float k_avoidanceObstacleCutoffBias = 0.99f;
+	static constexpr float k_avoidanceObstacleCacheLocationQuantization = 1.0f;
+	static constexpr float k_avoidanceObstacleCacheVelocityQuantization = 1.0f;
+	static constexpr uint16 k_avoidanceGroupSleepSettledFrames = 30u;
+	static constexpr float k_avoidanceGroupSleepFacingTolerance = 0.01f;
+
+	// Entities in view drop from full to half rate past the first distance. Entities out of view drop from half to quarter rate past the second one.
+	static constexpr float k_simulationLODInViewHalfRateDistance = 10000.0f;
+	static constexpr float k_simulationLODOutOfViewQuarterRateDistance = 5000.0f;
 
 	static constexpr float k_navigationAgentDefaultHeight = 100.0f;
 	static constexpr float k_avoidanceEpsilonValue = 0.00001f;
@@ -31,8 +39,14 @@ namespace ArgusECSConstants
 
 	static constexpr float k_resourceSinkBufferDistanceAdjustment = 5.0f;
 
+	// How long (in seconds) a revealed area can go without a friendly entity in it before team commanders will send scouts back to it.
+	static constexpr float k_teamCommanderStaleAreaExplorationAge = 90.0f;
+
 	static constexpr int32 k_numEntityAbilities = 4;
 
+	// A power of two so that whole second durations land exactly on a tick.
+	static constexpr float k_timerTicksPerSecond = 128.0f;
+
 #if !UE_BUILD_SHIPPING
 	static constexpr float k_debugDrawLineWidth = 3.0f;
 	static constexpr float k_debugDrawHeightAdjustment = 5.0f;
@@ -317,6 +317,10 @@ void ArgusECSDebugger::DrawWindowForEntity(uint16 entityId)
 
 	if (hasRevealedAreas)
 	{
+		if (const TeamCommanderComponent* teamCommanderComponent = entity.GetComponent<TeamCommanderComponent>())
+		{
+			ImGui::Text("Last update slice: %.1f / %.1f us, slow slices: %u", teamCommanderComponent->m_lastUpdateSliceMicroseconds, ArgusCVars::CVarTeamCommanderSlowSliceMicroseconds.GetValueOnGameThread(), teamCommanderComponent->m_slowUpdateSliceCount);
+		}
 		ImGui::Checkbox("Show Revealed Areas debug", &s_teamEntityShowRevealedAreaDebug[offset]);
 		if (s_teamEntityShowRevealedAreaDebug[offset])
 		{
@@ -29,12 +29,16 @@ void ArgusEntity::Serialize(FArchive& archive)
 {
 	ARGUS_TRACE(ArgusEntity::Serialize);
 
+	SerializeEntityIds(archive);
+	ArgusComponentRegistry::Serialize(archive);
+}
+
+void ArgusEntity::SerializeEntityIds(FArchive& archive)
+{
 	archive << s_lowestTakenEntityId;
 	archive << s_highestTakenEntityId;
 	archive << s_teamsForIteration;
 	s_takenEntityIds.Serialize(archive);
-
-	ArgusComponentRegistry::Serialize(archive);
 }
 
 bool ArgusEntity::DoesEntityExist(uint16 id)
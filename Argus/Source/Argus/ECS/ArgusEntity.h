@@ -19,6 +19,7 @@ public:
 	static int32			FindFromEntityBitArray(bool status, int32 index) { return s_takenEntityIds.FindFrom(status, index); }
 	static void				FlushAllEntities();
 	static void				Serialize(FArchive& archive);
+	static void				SerializeEntityIds(FArchive& archive);
 	static bool				DoesEntityExist(uint16 id);
 	static bool				IsReservedEntityId(uint16 id);
 	static uint16			GetHighestNonReservedEntityId();
@@ -3,6 +3,7 @@
 #include "ArgusEntityTemplate.h"
 #include "ArgusLogging.h"
 #include "ArgusStaticData.h"
+#include "DataComponentDefinitions/AbilityComponentData.h"
 #include "DataComponentDefinitions/CarrierComponentData.h"
 #include "DataComponentDefinitions/ComponentData.h"
 #include "DataComponentDefinitions/CombatComponentData.h"
@@ -10,6 +11,7 @@
 #include "DataComponentDefinitions/ResourceExtractionComponentData.h"
 #include "DataComponentDefinitions/TaskComponentData.h"
 #include "RecordDefinitions/ResourceSetRecord.h"
+#include "Systems/SpatialPartitioningSystems.h"
 
 void UArgusEntityTemplate::AsyncLoadComponents(const TFunction<void()> onCompleteCallback) const
 {
@@ -39,19 +41,64 @@ void UArgusEntityTemplate::AsyncLoadComponents(const TFunction<void()> onComplet
 ArgusEntity UArgusEntityTemplate::MakeEntity() const
 {
 	ArgusEntity entity = ArgusEntity::CreateEntity(static_cast<uint16>(m_entityPriority));
-	CacheComponents();
-	PopulateEntity(entity);
+	InstantiateSpawnRecipe(entity);
 	return entity;
 }
 
 ArgusEntity UArgusEntityTemplate::MakeEntity(uint16 entityId) const
 {
 	ArgusEntity entity = ArgusEntity::CreateEntity(entityId);
-	CacheComponents();
-	PopulateEntity(entity);
+	InstantiateSpawnRecipe(entity);
 	return entity;
 }
 
+void UArgusEntityTemplate::MakeEntities(int32 numEntities, TArray<ArgusEntity>& outEntities) const
+{
+	ARGUS_TRACE(UArgusEntityTemplate::MakeEntities);
+	ARGUS_MEMORY_TRACE(ArgusComponentData);
+
+	if (!m_spawnRecipe.m_isCompiled)
+	{
+		CacheComponents();
+	}
+
+	const int32 firstNewEntityIndex = outEntities.Num();
+	outEntities.Reserve(firstNewEntityIndex + numEntities);
+
+	// Each reserved ID is the lowest untaken ID above the previous one, so the whole batch is reserved in a single pass over the taken IDs.
+	uint16 nextLowestEntityId = static_cast<uint16>(m_entityPriority);
+	for (int32 i = 0; i < numEntities; ++i)
+	{
+		ArgusEntity entity = ArgusEntity::CreateEntity(nextLowestEntityId);
+		if (!entity)
+		{
+			ARGUS_LOG(ArgusECSLog, Error, TEXT("[%s] Ran out of %s IDs after making %d of %d entities."), ARGUS_FUNCNAME, ARGUS_NAMEOF(ArgusEntity), i, numEntities);
+			break;
+		}
+		outEntities.Add(entity);
+
+		if (entity.GetId() >= (ArgusECSConstants::k_maxEntities - 1))
+		{
+			break;
+		}
+		nextLowestEntityId = entity.GetId() + 1u;
+	}
+
+	// Instantiate one component type across the whole batch at a time so each pass stays within a single component array.
+	for (const UComponentData* componentData : m_spawnRecipe.m_componentData)
+	{
+		for (int32 i = firstNewEntityIndex; i < outEntities.Num(); ++i)
+		{
+			componentData->InstantiateComponentForEntity(outEntities[i]);
+		}
+	}
+
+	for (int32 i = firstNewEntityIndex; i < outEntities.Num(); ++i)
+	{
+		SetInitialTaskAndTeamStateFromData(outEntities[i]);
+	}
+}
+
 ArgusEntity UArgusEntityTemplate::MakeEntityAsync(const TFunction<void(ArgusEntity)> onCompleteCallback) const
 {
 	ArgusEntity entity = ArgusEntity::CreateEntity(static_cast<uint16>(m_entityPriority));
@@ -117,21 +164,7 @@ void UArgusEntityTemplate::ReinitializeComponentsForEntityPostLoad(ArgusEntity e
 
 void UArgusEntityTemplate::SetInitialStateFromData(ArgusEntity entity) const
 {
-	if (const IdentityComponent* identityComponent = entity.GetComponent<IdentityComponent>())
-	{
-		ArgusEntity::RegisterTeam(identityComponent->m_team);
-	}
-
-	if (const ConstructionComponent* constructionComponent = entity.GetComponent<ConstructionComponent>())
-	{
-		if (TaskComponent* taskComponent = entity.GetComponent<TaskComponent>())
-		{
-			if (constructionComponent->m_currentWorkSeconds != 0.0f)
-			{
-				taskComponent->m_constructionState = EConstructionState::BeingConstructed;
-			}
-		}
-	}
+	SetInitialTaskAndTeamStateFromData(entity);
 
 	if (const AbilityComponent* abilityComponent = entity.GetComponent<AbilityComponent>())
 	{
@@ -168,6 +201,28 @@ void UArgusEntityTemplate::SetInitialStateFromData(ArgusEntity entity) const
 	}
 }
 
+void UArgusEntityTemplate::SetInitialTaskAndTeamStateFromData(ArgusEntity entity) const
+{
+	if (const IdentityComponent* identityComponent = entity.GetComponent<IdentityComponent>())
+	{
+		ArgusEntity::RegisterTeam(identityComponent->m_team);
+	}
+
+	if (const ConstructionComponent* constructionComponent = entity.GetComponent<ConstructionComponent>())
+	{
+		if (TaskComponent* taskComponent = entity.GetComponent<TaskComponent>())
+		{
+			if (constructionComponent->m_currentWorkSeconds != 0.0f)
+			{
+				taskComponent->m_constructionState = EConstructionState::BeingConstructed;
+			}
+		}
+	}
+
+	// Deferred until the next spatial partitioning pass, so team or construction state assigned right after the entity is made still gets picked up.
+	SpatialPartitioningSystems::RequestEntityRoleIndexUpdate(entity);
+}
+
 bool UArgusEntityTemplate::DoesTemplateSatisfyEntityCategory(FEntityCategory entityCategory) const
 {
 	ARGUS_TRACE(UArgusEntityTemplate::DoesTemplateSatisfyEntityCategory);
@@ -266,6 +321,10 @@ void UArgusEntityTemplate::CacheComponents() const
 
 	if (!needsUpdating)
 	{
+		if (!m_spawnRecipe.m_isCompiled)
+		{
+			CompileSpawnRecipe();
+		}
 		return;
 	}
 
@@ -278,6 +337,89 @@ void UArgusEntityTemplate::CacheComponents() const
 			loadedComponent->OnComponentDataLoaded();
 		}
 	}
+
+	CompileSpawnRecipe();
+}
+
+void UArgusEntityTemplate::CompileSpawnRecipe() const
+{
+	ARGUS_TRACE(UArgusEntityTemplate::CompileSpawnRecipe);
+
+	m_spawnRecipe.m_componentData.Reset();
+	m_spawnRecipe.m_abilityRecordIds.Reset();
+	m_spawnRecipe.m_resourceSetRecordIds.Reset();
+	m_spawnRecipe.m_componentData.Reserve(m_loadedComponentData.Num());
+
+	for (const TPair<UClass*, TObjectPtr<const UComponentData>>& keyValuePair : m_loadedComponentData)
+	{
+		const UComponentData* componentData = keyValuePair.Value.Get();
+		if (!componentData)
+		{
+			ARGUS_LOG(ArgusECSLog, Error, TEXT("[%s] Attempting to compile a spawn recipe from a template that has a deleted component."), ARGUS_FUNCNAME);
+			continue;
+		}
+
+		m_spawnRecipe.m_componentData.Add(componentData);
+	}
+
+	if (const UAbilityComponentData* abilityComponentData = GetComponentFromTemplate<UAbilityComponentData>())
+	{
+		const uint32 abilityIds[] =
+		{
+			abilityComponentData->m_ability0IdReference.GetId(),
+			abilityComponentData->m_ability1IdReference.GetId(),
+			abilityComponentData->m_ability2IdReference.GetId(),
+			abilityComponentData->m_ability3IdReference.GetId()
+		};
+		for (const uint32 abilityId : abilityIds)
+		{
+			if (abilityId > 0u)
+			{
+				m_spawnRecipe.m_abilityRecordIds.AddUnique(abilityId);
+			}
+		}
+	}
+
+	if (const UResourceComponentData* resourceComponentData = GetComponentFromTemplate<UResourceComponentData>())
+	{
+		m_spawnRecipe.m_resourceSetRecordIds.AddUnique(resourceComponentData->m_resourceCapacityRecordIdReference.GetId());
+	}
+
+	if (const UResourceExtractionComponentData* resourceExtractionComponentData = GetComponentFromTemplate<UResourceExtractionComponentData>())
+	{
+		m_spawnRecipe.m_resourceSetRecordIds.AddUnique(resourceExtractionComponentData->m_resourcesToExtractRecordIdReference.GetId());
+	}
+
+	// Records are shared by every entity the recipe makes, so they only need to be requested once here instead of on every spawn.
+	for (const uint32 abilityRecordId : m_spawnRecipe.m_abilityRecordIds)
+	{
+		ArgusStaticData::AsyncPreLoadRecord<UAbilityRecord>(abilityRecordId);
+	}
+	for (const uint32 resourceSetRecordId : m_spawnRecipe.m_resourceSetRecordIds)
+	{
+		ArgusStaticData::AsyncPreLoadRecord<UResourceSetRecord>(resourceSetRecordId);
+	}
+
+	m_spawnRecipe.m_isCompiled = true;
+}
+
+void UArgusEntityTemplate::InstantiateSpawnRecipe(ArgusEntity entity) const
+{
+	ARGUS_MEMORY_TRACE(ArgusComponentData);
+
+	ARGUS_RETURN_ON_INVALID_ENTITY(entity, ArgusECSLog);
+
+	if (!m_spawnRecipe.m_isCompiled)
+	{
+		CacheComponents();
+	}
+
+	for (const UComponentData* componentData : m_spawnRecipe.m_componentData)
+	{
+		componentData->InstantiateComponentForEntity(entity);
+	}
+
+	SetInitialTaskAndTeamStateFromData(entity);
 }
 
 #if WITH_EDITOR
@@ -295,6 +437,8 @@ void UArgusEntityTemplate::PostEditChangeProperty(FPropertyChangedEvent& propert
 		return;
 	}
 
+	m_spawnRecipe.m_isCompiled = false;
+
 	const int32 arrayIndex = propertyChangedEvent.GetArrayIndex(propertyName);
 	const UComponentData* modifiedComponent = m_componentData[arrayIndex].LoadSynchronous();
 	if (modifiedComponent)
@@ -20,6 +20,7 @@ public:
 	void AsyncLoadComponents(const TFunction<void()> onCompleteCallback = nullptr) const;
 	ArgusEntity MakeEntity() const;
 	ArgusEntity MakeEntity(uint16 entityId) const;
+	void MakeEntities(int32 numEntities, TArray<ArgusEntity>& outEntities) const;
 	ArgusEntity MakeEntityAsync(const TFunction<void(ArgusEntity)> onCompleteCallback = nullptr) const;
 	void PopulateEntity(ArgusEntity entity) const;
 	void ReinitializeComponentsForEntityPostLoad(ArgusEntity entity) const;
@@ -59,11 +60,26 @@ private:
 
 	mutable ArgusMap<FEntityCategory, bool, ArgusSetAllocator<14u> > m_isEntityCategorySatisfiedByTemplate;
 
+	// Everything MakeEntity needs, resolved once per template rather than once per spawned entity.
+	struct SpawnRecipe
+	{
+		TArray<const UComponentData*> m_componentData;
+		TArray<uint32> m_abilityRecordIds;
+		TArray<uint32> m_resourceSetRecordIds;
+		bool m_isCompiled = false;
+	};
+	mutable SpawnRecipe m_spawnRecipe;
+
 	void CacheComponents() const;
+	void CompileSpawnRecipe() const;
+	void InstantiateSpawnRecipe(ArgusEntity entity) const;
+	void SetInitialTaskAndTeamStateFromData(ArgusEntity entity) const;
 
 #if WITH_AUTOMATION_TESTS
 	friend class ArgusEntityTemplateInstantiateEntityTest;
+	friend class ArgusEntityTemplateMakeEntitiesTest;
 	friend class SpawningSystemsSpawnEntityTest;
+	friend class SpawningSystemsSpawnEntitiesTest;
 #endif //WITH_AUTOMATION_TESTS
 #if WITH_EDITOR
 	friend class UAbilityRecord;
@@ -142,6 +142,16 @@ namespace ArgusIterators
 
 	template <typename SystemsArgs, uint8 ChunkCount, typename Function>
 	static void IterateSystemsArgsParallel(Function&& perSystemsArgsFunction)
+	{
+		IterateSystemsArgsParallelWithChunkIndex<SystemsArgs, ChunkCount>([&perSystemsArgsFunction](SystemsArgs& systemsArgs, uint8)
+		{
+			perSystemsArgsFunction(systemsArgs);
+		});
+	}
+
+	// Also passes the chunk index so that callers can give each chunk its own output buffer.
+	template <typename SystemsArgs, uint8 ChunkCount, typename Function>
+	static void IterateSystemsArgsParallelWithChunkIndex(Function&& perSystemsArgsFunction)
 	{
 		TArray<UE::Tasks::FTask, TInlineAllocator<ChunkCount>> chunkTasks;
 
@@ -150,20 +160,19 @@ namespace ArgusIterators
 		const uint16 difference = upperBound - rollingBound;
 		const uint16 increment = difference / ChunkCount;
 
-		for (uint8 i = 1u; i < ChunkCount; ++i)
+		for (uint8 i = 0u; i < ChunkCount; ++i)
 		{
-			chunkTasks.Add(UE::Tasks::Launch(ARGUS_NAMEOF(ArgusIterators::IterateSystemsArgsParallel), [rollingBound, increment, &perSystemsArgsFunction]()
+			const int32 chunkUpperBound = (i == ChunkCount - 1u) ? upperBound : rollingBound + (increment - 1u);
+			chunkTasks.Add(UE::Tasks::Launch(ARGUS_NAMEOF(ArgusIterators::IterateSystemsArgsParallelWithChunkIndex), [rollingBound, chunkUpperBound, i, &perSystemsArgsFunction]()
 			{
-				IterateSystemArgRange<SystemsArgs>(rollingBound, rollingBound + (increment - 1u), perSystemsArgsFunction);
+				IterateSystemArgRange<SystemsArgs>(rollingBound, chunkUpperBound, [i, &perSystemsArgsFunction](SystemsArgs& systemsArgs)
+				{
+					perSystemsArgsFunction(systemsArgs, i);
+				});
 			}));
 			rollingBound += increment;
 		}
 
-		chunkTasks.Add(UE::Tasks::Launch(ARGUS_NAMEOF(ArgusIterators::IterateSystemsArgsParallel), [rollingBound, upperBound, &perSystemsArgsFunction]()
-		{
-			IterateSystemArgRange<SystemsArgs>(rollingBound, upperBound, perSystemsArgsFunction);
-		}));
-
 		UE::Tasks::Wait(chunkTasks);
 	}
 
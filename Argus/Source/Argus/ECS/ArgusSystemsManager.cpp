@@ -13,6 +13,7 @@
 #include "Systems/DecalSystems.h"
 #include "Systems/FlockingSystems.h"
 #include "Systems/FogOfWarSystems.h"
+#include "Systems/LODSystems.h"
 #include "Systems/NavigationSystems.h"
 #include "Systems/ResourceSystems.h"
 #include "Systems/SpatialPartitioningSystems.h"
@@ -54,6 +55,7 @@ void ArgusSystemsManager::InitializePostLoad(UWorld* worldPointer, const UArgusE
 	}
 
 	FogOfWarSystems::InitializeSystemsPostLoad();
+	TimerSystems::InitializeSystemsPostLoad();
 
 	SpatialPartitioningComponent* spatialPartitioningComponent = ArgusEntity::GetSingletonEntity().GetComponent<SpatialPartitioningComponent>();
 	ARGUS_RETURN_ON_NULL(spatialPartitioningComponent, ArgusECSLog);
@@ -88,6 +90,7 @@ void ArgusSystemsManager::RunSystems(UWorld* worldPointer, float deltaTime)
 	bool didEntityPositionChangeThisFrame = false;
 
 	UpdateSingletonComponents(worldPointer);
+	LODSystems::RunSystems(deltaTime);
 	TimerSystems::RunSystems(deltaTime);
 	TaskSystems::RunSystems(deltaTime);
 	TeamCommanderSystems::RunSystems(deltaTime);
@@ -169,6 +172,11 @@ void ArgusSystemsManager::SetInitialSingletonState(UWorld* worldPointer, ETeam a
 	InputInterfaceComponent* inputInterfaceComponent = singletonEntity.GetComponent<InputInterfaceComponent>();
 	ARGUS_RETURN_ON_NULL(inputInterfaceComponent, ArgusECSLog);
 
+	// Only a new game picks a seed. Loads and replays restore the stream from the save.
+	WorldReferenceComponent* worldReferenceComponent = singletonEntity.GetComponent<WorldReferenceComponent>();
+	ARGUS_RETURN_ON_NULL(worldReferenceComponent, ArgusECSLog);
+	worldReferenceComponent->m_randomStream.Initialize(FMath::Rand());
+
 	inputInterfaceComponent->m_activePlayerTeam = activePlayerTeam;
 	inputInterfaceComponent->m_controlGroups.SetNumZeroed(inputInterfaceComponent->m_numControlGroups);
 	inputInterfaceComponent->m_selectedActorsDisplayState = ESelectedActorsDisplayState::ChangedThisFrame;
@@ -224,6 +232,7 @@ void ArgusSystemsManager::InitializeTeamComponents()
 		ARGUS_RETURN_ON_NULL(teamCommanderComponent, ArgusECSLog);
 
 		TeamCommanderSystems::InitializeRevealedAreas(teamCommanderComponent);
+		TeamCommanderSystems::InitializeUpdateSchedule(teamCommanderComponent, i - 1u);
 	}
 
 	TeamCommanderSystems::PerformInitialUpdate();
@@ -240,4 +249,6 @@ void ArgusSystemsManager::UpdateSingletonComponents(UWorld* worldPointer)
 	ARGUS_RETURN_ON_NULL(worldReferenceComponent, ArgusECSLog);
 
 	worldReferenceComponent->m_worldPointer = worldPointer;
+	worldReferenceComponent->m_simulationFrameIndex++;
+	worldReferenceComponent->m_randomStream.Advance();
 }
@@ -38,5 +38,12 @@ struct AvoidanceGroupingComponent
 	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
 	uint16 m_numberOfIdleEntities = 0u;
 
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	uint16 m_numberOfSettledFrames = 0u;
+
+	// Only meaningful on the group leader. Sleeping groups are skipped by avoidance, flocking and transform updates.
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	bool m_isGroupSleeping = false;
+
 	EAvoidancePriority m_avoidancePriority = EAvoidancePriority::Lowest;
 };
\ No newline at end of file
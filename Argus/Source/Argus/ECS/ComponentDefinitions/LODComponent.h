@@ -5,6 +5,16 @@
 #include "ArgusMacros.h"
 #include "CoreMinimal.h"
 
+#include "LODComponent.generated.h"
+
+UENUM()
+enum class ESimulationLOD : uint8
+{
+	FullRate,
+	HalfRate,
+	QuarterRate
+};
+
 struct LODComponent
 {
 	ARGUS_COMPONENT_SHARED;
@@ -15,6 +25,20 @@ struct LODComponent
 	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
 	bool m_bWasInViewFrustrum = false;
 
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	ESimulationLOD m_simulationLOD = ESimulationLOD::FullRate;
+
+	// Time that has passed since the last frame this entity's reduced rate simulation ran.
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	float m_accumulatedSimulationDeltaTime = 0.0f;
+
+	// The deltaTime that reduced rate simulation should use on frames where m_shouldUpdateSimulationThisFrame is true.
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	float m_simulationDeltaTime = 0.0f;
+
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	bool m_shouldUpdateSimulationThisFrame = true;
+
 	bool DidInViewFrustrumStatusChange() const
 	{
 		return m_bIsInViewFrustrum != m_bWasInViewFrustrum;
@@ -25,4 +49,17 @@ struct LODComponent
 		m_bWasInViewFrustrum = m_bIsInViewFrustrum;
 		m_bIsInViewFrustrum = false;
 	}
+
+	uint32 GetSimulationFrameInterval() const
+	{
+		switch (m_simulationLOD)
+		{
+			case ESimulationLOD::HalfRate:
+				return 2u;
+			case ESimulationLOD::QuarterRate:
+				return 4u;
+			default:
+				return 1u;
+		}
+	}
 };
@@ -15,6 +15,10 @@ struct NearbyEntitiesComponent
 	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
 	ArgusEntityKDTreeRangeOutput m_nearbyFlyingEntities;
 
+	// Set by spatial partitioning when the set of entities in sight changes, and cleared once task systems have had a chance to react to it.
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	bool m_hasSightRangeChanged = false;
+
 	const ArgusEntityKDTreeRangeOutput& GetNearbyEntities(bool shouldGetFlying) const
 	{
 		return shouldGetFlying ? m_nearbyFlyingEntities : m_nearbyEntities;
@@ -45,4 +49,24 @@ struct NearbyEntitiesComponent
 			}
 		}
 	}
+
+	template <typename Function>
+	void IterateNearestHostileEntityIds(bool iterateGrounded, bool iterateFlying, Function&& perEntityIdFunction) const
+	{
+		const uint16 groundedEntityId = iterateGrounded ? m_nearbyEntities.GetNearestHostileEntityId() : ArgusECSConstants::k_maxEntities;
+		const uint16 flyingEntityId = iterateFlying ? m_nearbyFlyingEntities.GetNearestHostileEntityId() : ArgusECSConstants::k_maxEntities;
+		const bool flyingIsCloser = m_nearbyFlyingEntities.GetNearestHostileDistanceSquared() < m_nearbyEntities.GetNearestHostileDistanceSquared();
+
+		const uint16 firstEntityId = flyingIsCloser ? flyingEntityId : groundedEntityId;
+		const uint16 secondEntityId = flyingIsCloser ? groundedEntityId : flyingEntityId;
+		if (firstEntityId != ArgusECSConstants::k_maxEntities && perEntityIdFunction(firstEntityId))
+		{
+			return;
+		}
+
+		if (secondEntityId != ArgusECSConstants::k_maxEntities)
+		{
+			perEntityIdFunction(secondEntityId);
+		}
+	}
 };
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ArgusMacros.h"
+#include "ComponentDependencies/ObstacleORCALinesCacheKey.h"
 #include "ComponentDependencies/ObstaclePointKDTree.h"
 #include "CoreMinimal.h"
 
@@ -12,4 +13,17 @@ struct NearbyObstaclesComponent
 
 	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
 	ObstaclePointKDTreeRangeOutput m_obstacleIndicies;
+
+	// Obstacle ORCA lines from the last frame they were calculated, reused while m_cachedObstacleORCALinesKey still matches.
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	TArray<FVector2D, ArgusContainerAllocator<20u> > m_cachedObstacleORCALinePoints;
+
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	TArray<FVector2D, ArgusContainerAllocator<20u> > m_cachedObstacleORCALineDirections;
+
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	ObstacleORCALinesCacheKey m_cachedObstacleORCALinesKey;
+
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	bool m_hasCachedObstacleORCALines = false;
 };
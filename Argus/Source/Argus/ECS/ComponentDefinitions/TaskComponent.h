@@ -40,6 +40,15 @@ struct TaskComponent
 	ARGUS_COMP_NO_DATA
 	ETeamCommanderDirective m_directiveFromTeamCommander = ETeamCommanderDirective::Count;
 
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	bool m_wasIdleLastUpdate = false;
+
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	EFlightState m_flightStateLastUpdate = EFlightState::Grounded;
+
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	uint16 m_updatesUntilIdleRescan = 0u;
+
 	bool IsExecutingMoveTask() const
 	{
 		return m_movementState == EMovementState::MoveToLocation || m_movementState == EMovementState::MoveToEntity;
@@ -3,6 +3,7 @@
 #include "ArgusEntityKDTree.h"
 #include "ArgusIterators.h"
 #include "ArgusLogging.h"
+#include "ComponentDefinitions/IdentityComponent.h"
 #include "ComponentDefinitions/TransformComponent.h"
 #include "Systems/IdentitySystems.h"
 
@@ -25,12 +26,16 @@ void ArgusEntityKDTreeNode::Populate(ArgusEntity entityToRepresent)
 	m_worldSpaceLocation = transformComponent->m_location;
 	m_entityId = entityToRepresent.GetId();
 	m_radius = transformComponent->m_radius;
+
+	const IdentityComponent* identityComponent = entityToRepresent.GetComponent<IdentityComponent>();
+	m_team = identityComponent ? identityComponent->m_team : ETeam::None;
 }
 
 void ArgusEntityKDTreeNode::Reset()
 {
 	m_worldSpaceLocation = FVector::ZeroVector;
 	m_entityId = ArgusECSConstants::k_maxEntities;
+	m_team = ETeam::None;
 	m_leftChild = nullptr;
 	m_rightChild = nullptr;
 }
@@ -106,6 +111,16 @@ void ArgusEntityKDTreeRangeOutput::Add(const ArgusEntityKDTreeNode* nodeToAdd, c
 	}
 
 	m_entityIdsWithinSightRange.Add(entityId);
+
+	// Summing hashed ids gives a signature that does not depend on traversal order, so comparing it across frames tells whether anything entered or left sight.
+	m_sightRangeSignature += MurmurFinalize32(entityId);
+
+	// The node already knows its team, so tracking the nearest hostile here is free compared to filtering the sight list again later.
+	if (TeamUtils::IsInTeamMask(nodeToAdd->m_team, thresholds.m_hostileTeamMask) && distFromTargetSquared < m_nearestHostileDistanceSquared && nodeToAddEntity.IsAlive())
+	{
+		m_nearestHostileEntityId = entityId;
+		m_nearestHostileDistanceSquared = distFromTargetSquared;
+	}
 }
 
 void ArgusEntityKDTreeRangeOutput::ConsolidateInArray(TArray<uint16>& allEntities)
@@ -118,6 +133,9 @@ void ArgusEntityKDTreeRangeOutput::ResetAll()
 	m_entityIdsWithinAvoidanceRange.Reset();
 	m_entityIdsWithinGroupExitRange.Reset();
 	m_entityIdsWithinSightRange.Reset();
+	m_nearestHostileEntityId = ArgusECSConstants::k_maxEntities;
+	m_nearestHostileDistanceSquared = FLT_MAX;
+	m_sightRangeSignature = 0u;
 }
 
 bool ArgusEntityKDTreeRangeOutput::FoundAny() const
@@ -4,6 +4,7 @@
 
 #include "ArgusContainerAllocator.h"
 #include "ArgusKDTree.h"
+#include "ComponentDependencies/Teams.h"
 
 class ArgusEntity;
 
@@ -14,6 +15,7 @@ struct ArgusEntityKDTreeNode
 	ArgusEntityKDTreeNode*	m_rightChild = nullptr;
 	float					m_radius = 0.0f;
 	uint16					m_entityId = ArgusECSConstants::k_maxEntities;
+	ETeam					m_team = ETeam::None;
 
 	ArgusEntityKDTreeNode() {};
 
@@ -39,6 +41,7 @@ struct ArgusEntityKDTreeQueryRangeThresholds
 	float m_groupExitRangeThresholdSquared = 0.0f;
 	float m_avoidanceRangeThresholdSquared = 0.0f;
 	uint16 m_seenByEntityId = ArgusECSConstants::k_maxEntities;
+	BITMASK_ETeam m_hostileTeamMask = 0u;
 };
 
 class ArgusEntityKDTreeRangeOutput
@@ -51,11 +54,17 @@ public:
 	const TArray<uint16, ArgusContainerAllocator<20u> >& GetEntityIdsInSightRange() const { return m_entityIdsWithinSightRange; }
 	const TArray<uint16, ArgusContainerAllocator<10u> >& GetEntityIdsInGroupExitRange() const { return m_entityIdsWithinGroupExitRange; }
 	const TArray<uint16, ArgusContainerAllocator<10u> >& GetEntityIdsInAvoidanceRange() const { return m_entityIdsWithinAvoidanceRange; }
+	uint16 GetNearestHostileEntityId() const { return m_nearestHostileEntityId; }
+	float GetNearestHostileDistanceSquared() const { return m_nearestHostileDistanceSquared; }
+	uint32 GetSightRangeSignature() const { return m_sightRangeSignature; }
 
 private:
 	TArray<uint16, ArgusContainerAllocator<20u> > m_entityIdsWithinSightRange;
 	TArray<uint16, ArgusContainerAllocator<10u> > m_entityIdsWithinGroupExitRange;
 	TArray<uint16, ArgusContainerAllocator<10u> > m_entityIdsWithinAvoidanceRange;
+	uint16 m_nearestHostileEntityId = ArgusECSConstants::k_maxEntities;
+	float m_nearestHostileDistanceSquared = FLT_MAX;
+	uint32 m_sightRangeSignature = 0u;
 };
 
 class ArgusEntityKDTree : public ArgusKDTree<	ArgusEntityKDTreeNode, ArgusEntityKDTreeRangeOutput, 
@@ -0,0 +1,34 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusRandomStream.h"
+
+void ArgusRandomStream::Initialize(int32 seed)
+{
+	m_stream.Initialize(seed);
+}
+
+void ArgusRandomStream::Reset()
+{
+	m_stream.Initialize(0);
+}
+
+void ArgusRandomStream::Advance()
+{
+	m_stream.GetUnsignedInt();
+}
+
+void ArgusRandomStream::Serialize(FArchive& archive)
+{
+	int32 seed = m_stream.GetCurrentSeed();
+	archive << seed;
+	if (archive.IsLoading())
+	{
+		m_stream.Initialize(seed);
+	}
+}
+
+FRandomStream ArgusRandomStream::MakeDerivedStream(uint32 salt0, uint32 salt1) const
+{
+	const uint32 seed = HashCombineFast(HashCombineFast(static_cast<uint32>(m_stream.GetCurrentSeed()), salt0), salt1);
+	return FRandomStream(static_cast<int32>(seed));
+}
@@ -0,0 +1,23 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Random numbers for the simulation. The whole state is the current seed, which is saved with the ECS so that loads and replays draw the same values.
+// Systems that run in parallel must not draw from the shared stream, since the order of draws would depend on scheduling. They derive a local stream
+// with MakeDerivedStream instead, which only reads the seed. The shared seed moves forward once per simulation frame in Advance.
+class ArgusRandomStream
+{
+public:
+	void Initialize(int32 seed);
+	void Reset();
+	void Advance();
+	void Serialize(FArchive& archive);
+
+	int32 GetCurrentSeed() const { return m_stream.GetCurrentSeed(); }
+	FRandomStream MakeDerivedStream(uint32 salt0, uint32 salt1) const;
+
+private:
+	FRandomStream m_stream = FRandomStream(0);
+};
@@ -0,0 +1,89 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "AvoidanceGroupUnionFind.h"
+#include "ArgusECSConstants.h"
+#include "ArgusMacros.h"
+
+void AvoidanceGroupUnionFind::Reset()
+{
+	ARGUS_MEMORY_TRACE(ArgusKDTree);
+
+	if (m_parentIds.IsEmpty())
+	{
+		m_parentIds.SetNum(ArgusECSConstants::k_maxEntities);
+		for (int32 i = 0; i < m_parentIds.Num(); ++i)
+		{
+			m_parentIds[i].store(ArgusECSConstants::k_maxEntities);
+		}
+	}
+
+	for (int32 i = 0; i < m_entityIds.Num(); ++i)
+	{
+		m_parentIds[m_entityIds[i]].store(ArgusECSConstants::k_maxEntities);
+	}
+	m_entityIds.Reset();
+}
+
+void AvoidanceGroupUnionFind::AddEntityId(uint16 entityId)
+{
+	ARGUS_MEMORY_TRACE(ArgusKDTree);
+
+	if (entityId >= ArgusECSConstants::k_maxEntities || Contains(entityId))
+	{
+		return;
+	}
+
+	m_parentIds[entityId].store(entityId);
+	m_entityIds.Add(entityId);
+}
+
+bool AvoidanceGroupUnionFind::Contains(uint16 entityId) const
+{
+	if (entityId >= m_parentIds.Num())
+	{
+		return false;
+	}
+
+	return m_parentIds[entityId].load() != ArgusECSConstants::k_maxEntities;
+}
+
+uint16 AvoidanceGroupUnionFind::FindRoot(uint16 entityId)
+{
+	uint16 currentId = entityId;
+	uint16 parentId = m_parentIds[currentId].load();
+	while (parentId != currentId)
+	{
+		// Path halving. Parents only ever move towards lower ids, so losing this exchange to another thread still leaves a valid path to the root.
+		const uint16 grandparentId = m_parentIds[parentId].load();
+		m_parentIds[currentId].compare_exchange_weak(parentId, grandparentId);
+		currentId = grandparentId;
+		parentId = m_parentIds[currentId].load();
+	}
+
+	return currentId;
+}
+
+void AvoidanceGroupUnionFind::Unite(uint16 entityId, uint16 otherEntityId)
+{
+	while (true)
+	{
+		uint16 rootId = FindRoot(entityId);
+		uint16 otherRootId = FindRoot(otherEntityId);
+		if (rootId == otherRootId)
+		{
+			return;
+		}
+
+		if (rootId < otherRootId)
+		{
+			Swap(rootId, otherRootId);
+		}
+
+		// Only succeeds if rootId is still a root. Otherwise another thread linked it first and both roots need to be found again.
+		uint16 expectedParentId = rootId;
+		if (m_parentIds[rootId].compare_exchange_strong(expectedParentId, otherRootId))
+		{
+			return;
+		}
+	}
+}
@@ -0,0 +1,25 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+// Lock free union find used to build avoidance groups. Roots are always the lowest entity id in their set so that group leaders stay stable frame to frame.
+// The parent buffer is allocated once and only the ids added since the last reset are cleared, so ids that were never added keep k_maxEntities as their parent.
+class AvoidanceGroupUnionFind
+{
+public:
+	void Reset();
+	void AddEntityId(uint16 entityId);
+	bool Contains(uint16 entityId) const;
+
+	uint16 FindRoot(uint16 entityId);
+	void Unite(uint16 entityId, uint16 otherEntityId);
+
+	const TArray<uint16>& GetEntityIds() const { return m_entityIds; }
+
+private:
+	TArray<std::atomic<uint16> > m_parentIds;
+	TArray<uint16> m_entityIds;
+};
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "ArgusECSConstants.h"
 #include "CoreMinimal.h"
 #include "CombatInfo.generated.h"
 
@@ -19,4 +20,12 @@ enum class ERangedAttackCapability : uint8
 	FlyingOnly,
 	GroundedAndFlying,
 	Count
+};
+
+struct DamageEvent
+{
+	uint16 m_attackerEntityId = ArgusECSConstants::k_maxEntities;
+	uint16 m_victimEntityId = ArgusECSConstants::k_maxEntities;
+	uint32 m_damageAmount = 0u;
+	bool m_shouldRestartAttackTimer = false;
 };
\ No newline at end of file
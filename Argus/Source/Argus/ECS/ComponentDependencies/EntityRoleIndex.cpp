@@ -0,0 +1,226 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "EntityRoleIndex.h"
+#include "ArgusEntity.h"
+#include "ArgusIterators.h"
+#include "ArgusLogging.h"
+
+static const TArray<uint16> s_emptyEntityIds;
+
+void EntityRoleIndex::Reset()
+{
+	for (uint8 i = 0u; i < NUM_TEAMS; ++i)
+	{
+		for (uint8 j = 0u; j < k_numResourceTypes; ++j)
+		{
+			m_resourceSinkEntityIds[i][j].Reset();
+		}
+		m_inProgressConstructionEntityIds[i].Reset();
+	}
+
+	for (uint8 i = 0u; i < k_numResourceTypes; ++i)
+	{
+		m_resourceSourceEntityIds[i].Reset();
+	}
+	m_allResourceSourceEntityIds.Reset();
+	m_entityIdsToUpdate.Reset();
+	m_shouldRebuild = true;
+}
+
+void EntityRoleIndex::AddEntity(ArgusEntity entity)
+{
+	ARGUS_MEMORY_TRACE(ArgusKDTree);
+
+	if (!entity || !entity.IsAlive())
+	{
+		return;
+	}
+
+	const IdentityComponent* identityComponent = entity.GetComponent<IdentityComponent>();
+	const bool hasTeam = identityComponent && identityComponent->m_team != ETeam::None;
+	const uint16 teamOffset = hasTeam ? ArgusEntity::GetTeamOffset(identityComponent->m_team) : 0u;
+
+	if (hasTeam)
+	{
+		const TaskComponent* taskComponent = entity.GetComponent<TaskComponent>();
+		if (taskComponent && taskComponent->m_constructionState == EConstructionState::BeingConstructed)
+		{
+			m_inProgressConstructionEntityIds[teamOffset].Add(entity.GetId());
+		}
+	}
+
+	const ResourceComponent* resourceComponent = entity.GetComponent<ResourceComponent>();
+	if (!resourceComponent)
+	{
+		return;
+	}
+
+	if (resourceComponent->m_resourceComponentOwnerType == EResourceComponentOwnerType::Source)
+	{
+		m_allResourceSourceEntityIds.Add(entity.GetId());
+	}
+
+	for (uint8 i = 0u; i < k_numResourceTypes; ++i)
+	{
+		if (!resourceComponent->m_currentResources.HasResourceType(static_cast<EResourceType>(i)))
+		{
+			continue;
+		}
+
+		if (resourceComponent->m_resourceComponentOwnerType == EResourceComponentOwnerType::Source)
+		{
+			m_resourceSourceEntityIds[i].Add(entity.GetId());
+		}
+		else if (hasTeam && resourceComponent->m_resourceComponentOwnerType == EResourceComponentOwnerType::Sink)
+		{
+			m_resourceSinkEntityIds[teamOffset][i].Add(entity.GetId());
+		}
+	}
+}
+
+void EntityRoleIndex::RemoveEntityId(uint16 entityId)
+{
+	for (uint8 i = 0u; i < NUM_TEAMS; ++i)
+	{
+		for (uint8 j = 0u; j < k_numResourceTypes; ++j)
+		{
+			m_resourceSinkEntityIds[i][j].RemoveSingle(entityId);
+		}
+		m_inProgressConstructionEntityIds[i].RemoveSingle(entityId);
+	}
+
+	for (uint8 i = 0u; i < k_numResourceTypes; ++i)
+	{
+		m_resourceSourceEntityIds[i].RemoveSingle(entityId);
+	}
+	m_allResourceSourceEntityIds.RemoveSingle(entityId);
+}
+
+void EntityRoleIndex::RequestUpdateEntity(ArgusEntity entity)
+{
+	if (!entity || m_shouldRebuild)
+	{
+		return;
+	}
+
+	m_entityIdsToUpdate.Add(entity.GetId());
+}
+
+void EntityRoleIndex::ProcessDeferredStateChanges()
+{
+	ARGUS_MEMORY_TRACE(ArgusKDTree);
+
+	if (m_shouldRebuild)
+	{
+		Reset();
+		m_shouldRebuild = false;
+		ArgusIterators::IterateEntities([this](ArgusEntity entity)
+		{
+			AddEntity(entity);
+		});
+		return;
+	}
+
+	// Ids are re-bucketed from the entity's current state, so a destroyed entity is only removed, a reused id picks up its new role and duplicate
+	// requests are harmless.
+	for (int32 i = 0; i < m_entityIdsToUpdate.Num(); ++i)
+	{
+		RemoveEntityId(m_entityIdsToUpdate[i]);
+		AddEntity(ArgusEntity::RetrieveEntity(m_entityIdsToUpdate[i]));
+	}
+	m_entityIdsToUpdate.Reset();
+}
+
+const TArray<uint16>& EntityRoleIndex::GetResourceSinkEntityIds(ETeam team, EResourceType resourceType) const
+{
+	if (team == ETeam::None || resourceType == EResourceType::Count)
+	{
+		return s_emptyEntityIds;
+	}
+
+	return m_resourceSinkEntityIds[ArgusEntity::GetTeamOffset(team)][static_cast<uint8>(resourceType)];
+}
+
+const TArray<uint16>& EntityRoleIndex::GetResourceSourceEntityIds(EResourceType resourceType) const
+{
+	if (resourceType == EResourceType::Count)
+	{
+		return s_emptyEntityIds;
+	}
+
+	return m_resourceSourceEntityIds[static_cast<uint8>(resourceType)];
+}
+
+const TArray<uint16>& EntityRoleIndex::GetInProgressConstructionEntityIds(ETeam team) const
+{
+	if (team == ETeam::None)
+	{
+		return s_emptyEntityIds;
+	}
+
+	return m_inProgressConstructionEntityIds[ArgusEntity::GetTeamOffset(team)];
+}
+
+uint16 EntityRoleIndex::FindResourceSinkEntityIdClosestToLocation(ETeam team, const FResourceSet& resourceTypes, const FVector& location, ArgusEntity entityToIgnore, const TFunction<bool(ArgusEntity)>& queryFilter) const
+{
+	uint16 closestEntityId = ArgusECSConstants::k_maxEntities;
+	float closestDistanceSquared = FLT_MAX;
+
+	for (uint8 i = 0u; i < k_numResourceTypes; ++i)
+	{
+		const EResourceType resourceType = static_cast<EResourceType>(i);
+		if (resourceTypes.HasResourceType(resourceType))
+		{
+			UpdateClosestEntityId(GetResourceSinkEntityIds(team, resourceType), location, entityToIgnore, queryFilter, closestEntityId, closestDistanceSquared);
+		}
+	}
+
+	return closestEntityId;
+}
+
+uint16 EntityRoleIndex::FindEntityIdClosestToLocation(const TArray<uint16>& candidateEntityIds, const FVector& location, ArgusEntity entityToIgnore, const TFunction<bool(ArgusEntity)>& queryFilter)
+{
+	uint16 closestEntityId = ArgusECSConstants::k_maxEntities;
+	float closestDistanceSquared = FLT_MAX;
+	UpdateClosestEntityId(candidateEntityIds, location, entityToIgnore, queryFilter, closestEntityId, closestDistanceSquared);
+
+	return closestEntityId;
+}
+
+void EntityRoleIndex::UpdateClosestEntityId(const TArray<uint16>& candidateEntityIds, const FVector& location, ArgusEntity entityToIgnore, const TFunction<bool(ArgusEntity)>& queryFilter, uint16& closestEntityId, float& closestDistanceSquared)
+{
+	for (int32 i = 0; i < candidateEntityIds.Num(); ++i)
+	{
+		const uint16 candidateEntityId = candidateEntityIds[i];
+		if (entityToIgnore && candidateEntityId == entityToIgnore.GetId())
+		{
+			continue;
+		}
+
+		ArgusEntity candidateEntity = ArgusEntity::RetrieveEntity(candidateEntityId);
+		if (!candidateEntity)
+		{
+			continue;
+		}
+
+		const TransformComponent* transformComponent = candidateEntity.GetComponent<TransformComponent>();
+		if (!transformComponent)
+		{
+			continue;
+		}
+
+		const float distanceSquared = FVector::DistSquared(location, transformComponent->m_location);
+		if (distanceSquared >= closestDistanceSquared)
+		{
+			continue;
+		}
+
+		if (queryFilter && !queryFilter(candidateEntity))
+		{
+			continue;
+		}
+
+		closestEntityId = candidateEntityId;
+		closestDistanceSquared = distanceSquared;
+	}
+}
@@ -0,0 +1,47 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#pragma once
+
+#include "ComponentDependencies/ResourceSet.h"
+#include "ComponentDependencies/Teams.h"
+#include "CoreMinimal.h"
+
+class ArgusEntity;
+
+// Flat lists of entity ids bucketed by team and gameplay role so that filtered nearest queries (e.g. finding a deposit sink) only have to look at the
+// handful of entities that can possibly match instead of walking most of the tree. Entities are re-bucketed through deferred update requests whenever
+// something that decides their role changes (spawn, death, team, construction or resource state), and the whole index is only rebuilt after a reset.
+class EntityRoleIndex
+{
+public:
+	void Reset();
+	void AddEntity(ArgusEntity entity);
+	void RemoveEntityId(uint16 entityId);
+
+	void RequestUpdateEntity(ArgusEntity entity);
+	void RequestRebuild() { m_shouldRebuild = true; }
+	void ProcessDeferredStateChanges();
+
+	const TArray<uint16>& GetResourceSinkEntityIds(ETeam team, EResourceType resourceType) const;
+	const TArray<uint16>& GetResourceSourceEntityIds(EResourceType resourceType) const;
+	const TArray<uint16>& GetAllResourceSourceEntityIds() const { return m_allResourceSourceEntityIds; }
+	const TArray<uint16>& GetInProgressConstructionEntityIds(ETeam team) const;
+
+	uint16 FindResourceSinkEntityIdClosestToLocation(ETeam team, const FResourceSet& resourceTypes, const FVector& location, ArgusEntity entityToIgnore, const TFunction<bool(ArgusEntity)>& queryFilter = nullptr) const;
+	static uint16 FindEntityIdClosestToLocation(const TArray<uint16>& candidateEntityIds, const FVector& location, ArgusEntity entityToIgnore, const TFunction<bool(ArgusEntity)>& queryFilter = nullptr);
+
+private:
+	static constexpr uint8 k_numResourceTypes = static_cast<uint8>(EResourceType::Count);
+
+	static void UpdateClosestEntityId(const TArray<uint16>& candidateEntityIds, const FVector& location, ArgusEntity entityToIgnore, const TFunction<bool(ArgusEntity)>& queryFilter, uint16& closestEntityId, float& closestDistanceSquared);
+
+	TArray<uint16> m_resourceSinkEntityIds[NUM_TEAMS][k_numResourceTypes];
+	TArray<uint16> m_resourceSourceEntityIds[k_numResourceTypes];
+
+	// Includes depleted sources, which still take up space on the map.
+	TArray<uint16> m_allResourceSourceEntityIds;
+	TArray<uint16> m_inProgressConstructionEntityIds[NUM_TEAMS];
+
+	TArray<uint16> m_entityIdsToUpdate;
+	bool m_shouldRebuild = true;
+};
@@ -0,0 +1,168 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "InfluenceMap.h"
+#include "ArgusLogging.h"
+#include "Math/VectorRegister.h"
+
+void InfluenceMap::Initialize(int32 areasPerDimension)
+{
+	m_areasPerDimension = FMath::Max(areasPerDimension, 0);
+	m_numAreas = m_areasPerDimension * m_areasPerDimension;
+
+	const int32 paddedNumAreas = Align(m_numAreas, k_vectorWidth);
+	for (uint8 i = 0u; i < k_numLayers; ++i)
+	{
+		m_layers[i].Reset();
+		m_layers[i].SetNumZeroed(paddedNumAreas);
+	}
+	m_pendingFriendlyStrength.Reset();
+	m_pendingFriendlyStrength.SetNumZeroed(paddedNumAreas);
+	m_explorationExpiryHeap.Reset();
+	m_isExplorationExpiryScheduled.Init(false, m_numAreas);
+	m_explorationSeconds = 0.0;
+}
+
+void InfluenceMap::Reset()
+{
+	for (uint8 i = 0u; i < k_numLayers; ++i)
+	{
+		m_layers[i].Reset();
+	}
+	m_pendingFriendlyStrength.Reset();
+	m_explorationExpiryHeap.Reset();
+	m_isExplorationExpiryScheduled.Reset();
+	m_explorationSeconds = 0.0;
+
+	m_areasPerDimension = 0;
+	m_numAreas = 0;
+}
+
+// Enemy strength and resource value are rebuilt from scratch every update, and exploration age keeps counting up (in seconds) until an entity on the team stands in the
+// area again.
+void InfluenceMap::BeginUpdate(float explorationAgeIncrement)
+{
+	ARGUS_TRACE(InfluenceMap::BeginUpdate);
+
+	float* enemyStrength = m_layers[static_cast<uint8>(EInfluenceLayer::EnemyStrength)].GetData();
+	float* resourceValue = m_layers[static_cast<uint8>(EInfluenceLayer::ResourceValue)].GetData();
+	float* explorationAge = m_layers[static_cast<uint8>(EInfluenceLayer::ExplorationAge)].GetData();
+
+	const VectorRegister4Float zero = VectorZeroFloat();
+	const VectorRegister4Float explorationAgeStep = VectorSetFloat1(explorationAgeIncrement);
+
+	m_explorationSeconds += explorationAgeIncrement;
+
+	const int32 paddedNumAreas = m_layers[0].Num();
+	for (int32 blockStart = 0; blockStart < paddedNumAreas; blockStart += k_vectorWidth)
+	{
+		VectorStoreAligned(zero, enemyStrength + blockStart);
+		VectorStoreAligned(zero, resourceValue + blockStart);
+		VectorStoreAligned(VectorAdd(VectorLoadAligned(explorationAge + blockStart), explorationAgeStep), explorationAge + blockStart);
+	}
+}
+
+// Friendly strength fades out geometrically, so folding in each update's stamps with k_strengthStampWeight converges on the number of combatants in an area.
+void InfluenceMap::EndUpdate()
+{
+	ARGUS_TRACE(InfluenceMap::EndUpdate);
+
+	float* friendlyStrength = m_layers[static_cast<uint8>(EInfluenceLayer::FriendlyStrength)].GetData();
+	float* pendingFriendlyStrength = m_pendingFriendlyStrength.GetData();
+
+	const VectorRegister4Float zero = VectorZeroFloat();
+	const VectorRegister4Float strengthDecay = VectorSetFloat1(k_strengthDecay);
+	const VectorRegister4Float strengthStampWeight = VectorSetFloat1(k_strengthStampWeight);
+
+	const int32 paddedNumAreas = m_pendingFriendlyStrength.Num();
+	for (int32 blockStart = 0; blockStart < paddedNumAreas; blockStart += k_vectorWidth)
+	{
+		const VectorRegister4Float decayedStrength = VectorMultiply(VectorLoadAligned(friendlyStrength + blockStart), strengthDecay);
+		VectorStoreAligned(VectorMultiplyAdd(VectorLoadAligned(pendingFriendlyStrength + blockStart), strengthStampWeight, decayedStrength), friendlyStrength + blockStart);
+		VectorStoreAligned(zero, pendingFriendlyStrength + blockStart);
+	}
+}
+
+void InfluenceMap::AccumulateLayer(EInfluenceLayer targetLayer, const InfluenceMap& otherMap, EInfluenceLayer sourceLayer)
+{
+	ARGUS_TRACE(InfluenceMap::AccumulateLayer);
+
+	if (targetLayer == EInfluenceLayer::Count || sourceLayer == EInfluenceLayer::Count)
+	{
+		return;
+	}
+
+	if (otherMap.m_areasPerDimension != m_areasPerDimension)
+	{
+		ARGUS_LOG(ArgusECSLog, Error, TEXT("[%s] Trying to accumulate an %s with mismatched dimensions."), ARGUS_FUNCNAME, ARGUS_NAMEOF(InfluenceMap));
+		return;
+	}
+
+	float* target = m_layers[static_cast<uint8>(targetLayer)].GetData();
+	const float* source = otherMap.m_layers[static_cast<uint8>(sourceLayer)].GetData();
+
+	const int32 paddedNumAreas = m_layers[0].Num();
+	for (int32 blockStart = 0; blockStart < paddedNumAreas; blockStart += k_vectorWidth)
+	{
+		VectorStoreAligned(VectorAdd(VectorLoadAligned(target + blockStart), VectorLoadAligned(source + blockStart)), target + blockStart);
+	}
+}
+
+void InfluenceMap::AddPendingFriendlyStrength(int32 areaIndex, float value)
+{
+	if (!IsValidAreaIndex(areaIndex))
+	{
+		return;
+	}
+
+	m_pendingFriendlyStrength[areaIndex] += value;
+}
+
+void InfluenceMap::ResetExplorationAge(int32 areaIndex)
+{
+	if (!IsValidAreaIndex(areaIndex))
+	{
+		return;
+	}
+
+	m_layers[static_cast<uint8>(EInfluenceLayer::ExplorationAge)][areaIndex] = 0.0f;
+	if (m_isExplorationExpiryScheduled[areaIndex])
+	{
+		return;
+	}
+
+	m_isExplorationExpiryScheduled[areaIndex] = true;
+	ExplorationExpiry expiry;
+	expiry.m_staleAtSeconds = m_explorationSeconds + static_cast<double>(ArgusECSConstants::k_teamCommanderStaleAreaExplorationAge);
+	expiry.m_areaIndex = areaIndex;
+	m_explorationExpiryHeap.HeapPush(expiry);
+}
+
+void InfluenceMap::AddInfluence(EInfluenceLayer layer, int32 areaIndex, float value)
+{
+	if (layer == EInfluenceLayer::Count || !IsValidAreaIndex(areaIndex))
+	{
+		return;
+	}
+
+	m_layers[static_cast<uint8>(layer)][areaIndex] += value;
+}
+
+void InfluenceMap::SetInfluence(EInfluenceLayer layer, int32 areaIndex, float value)
+{
+	if (layer == EInfluenceLayer::Count || !IsValidAreaIndex(areaIndex))
+	{
+		return;
+	}
+
+	m_layers[static_cast<uint8>(layer)][areaIndex] = value;
+}
+
+float InfluenceMap::GetInfluence(EInfluenceLayer layer, int32 areaIndex) const
+{
+	if (layer == EInfluenceLayer::Count || !IsValidAreaIndex(areaIndex))
+	{
+		return 0.0f;
+	}
+
+	return m_layers[static_cast<uint8>(layer)][areaIndex];
+}
@@ -0,0 +1,86 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#pragma once
+
+#include "ArgusECSConstants.h"
+#include "Containers/BitArray.h"
+#include "CoreMinimal.h"
+
+enum class EInfluenceLayer : uint8
+{
+	FriendlyStrength,
+	EnemyStrength,
+	ResourceValue,
+	ExplorationAge,
+	Count
+};
+
+// Per-team float grids laid over the same areas as TeamCommanderComponent::m_revealedAreas. Each layer is a flat, 16 byte aligned array padded to the vector width
+// so that the per AI tick decay and accumulate passes run as straight SIMD loops, while assignment logic reads a single area in O(1). Friendly strength is stamped
+// into a pending buffer and only folded into its layer in EndUpdate, so other commanders never read a half stamped friendly layer. Every area whose exploration age
+// was reset is also kept in a min heap ordered by when it turns stale, so finding the areas that turned stale is not a pass over the whole grid.
+class InfluenceMap
+{
+public:
+	static constexpr int32 k_vectorWidth = 4;
+	static constexpr float k_strengthDecay = 0.5f;
+	static constexpr float k_strengthStampWeight = 1.0f - k_strengthDecay;
+
+	void Initialize(int32 areasPerDimension);
+	void Reset();
+	void BeginUpdate(float explorationAgeIncrement);
+	void EndUpdate();
+	void AccumulateLayer(EInfluenceLayer targetLayer, const InfluenceMap& otherMap, EInfluenceLayer sourceLayer);
+
+	void AddPendingFriendlyStrength(int32 areaIndex, float value);
+	void ResetExplorationAge(int32 areaIndex);
+	void AddInfluence(EInfluenceLayer layer, int32 areaIndex, float value);
+	void SetInfluence(EInfluenceLayer layer, int32 areaIndex, float value);
+	float GetInfluence(EInfluenceLayer layer, int32 areaIndex) const;
+
+	int32 GetAreasPerDimension() const { return m_areasPerDimension; }
+	int32 GetNumAreas() const { return m_numAreas; }
+	bool IsValidAreaIndex(int32 areaIndex) const { return areaIndex >= 0 && areaIndex < m_numAreas; }
+
+	// Calls the function once for every area whose exploration age reached k_teamCommanderStaleAreaExplorationAge since the last call. Areas that were reset again
+	// in the meantime are put back into the heap instead.
+	template <typename Function>
+	void PopAreasThatTurnedStale(Function&& function)
+	{
+		while (!m_explorationExpiryHeap.IsEmpty() && m_explorationExpiryHeap.HeapTop().m_staleAtSeconds <= m_explorationSeconds)
+		{
+			ExplorationExpiry expiry;
+			m_explorationExpiryHeap.HeapPop(expiry, EAllowShrinking::No);
+
+			const float explorationAge = GetInfluence(EInfluenceLayer::ExplorationAge, expiry.m_areaIndex);
+			if (explorationAge < ArgusECSConstants::k_teamCommanderStaleAreaExplorationAge)
+			{
+				expiry.m_staleAtSeconds = m_explorationSeconds + static_cast<double>(ArgusECSConstants::k_teamCommanderStaleAreaExplorationAge - explorationAge);
+				m_explorationExpiryHeap.HeapPush(expiry);
+				continue;
+			}
+
+			m_isExplorationExpiryScheduled[expiry.m_areaIndex] = false;
+			function(expiry.m_areaIndex);
+		}
+	}
+
+private:
+	static constexpr uint8 k_numLayers = static_cast<uint8>(EInfluenceLayer::Count);
+
+	struct ExplorationExpiry
+	{
+		double m_staleAtSeconds = 0.0;
+		int32 m_areaIndex = 0;
+
+		bool operator<(const ExplorationExpiry& other) const { return m_staleAtSeconds < other.m_staleAtSeconds; }
+	};
+
+	TArray<float, TAlignedHeapAllocator<16> > m_layers[k_numLayers];
+	TArray<float, TAlignedHeapAllocator<16> > m_pendingFriendlyStrength;
+	TArray<ExplorationExpiry> m_explorationExpiryHeap;
+	TBitArray<> m_isExplorationExpiryScheduled;
+	double m_explorationSeconds = 0.0;
+	int32 m_areasPerDimension = 0;
+	int32 m_numAreas = 0;
+};
@@ -0,0 +1,55 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ObstacleORCALinesCacheKey.h"
+#include "ArgusECSConstants.h"
+
+void ObstacleORCALinesCacheKey::Populate(const FVector& location, const FVector2D& velocity, float radius, float inverseObstaclePredictionTime, const TArray<ObstacleIndicies, ArgusContainerAllocator<20u> >& obstacleIndicies)
+{
+	const float inverseLocationQuantization = 1.0f / ArgusECSConstants::k_avoidanceObstacleCacheLocationQuantization;
+	const float inverseVelocityQuantization = 1.0f / ArgusECSConstants::k_avoidanceObstacleCacheVelocityQuantization;
+
+	m_quantizedLocation = FIntVector
+	(
+		FMath::FloorToInt32(location.X * inverseLocationQuantization),
+		FMath::FloorToInt32(location.Y * inverseLocationQuantization),
+		FMath::FloorToInt32(location.Z * inverseLocationQuantization)
+	);
+	m_quantizedVelocity = FIntPoint
+	(
+		FMath::FloorToInt32(velocity.X * inverseVelocityQuantization),
+		FMath::FloorToInt32(velocity.Y * inverseVelocityQuantization)
+	);
+	m_radius = radius;
+	m_inverseObstaclePredictionTime = inverseObstaclePredictionTime;
+	m_obstacleIndicies = obstacleIndicies;
+}
+
+void ObstacleORCALinesCacheKey::Reset()
+{
+	m_obstacleIndicies.Reset();
+	m_quantizedLocation = FIntVector::ZeroValue;
+	m_quantizedVelocity = FIntPoint::ZeroValue;
+	m_radius = 0.0f;
+	m_inverseObstaclePredictionTime = 0.0f;
+}
+
+bool ObstacleORCALinesCacheKey::operator==(const ObstacleORCALinesCacheKey& other) const
+{
+	if (m_quantizedLocation != other.m_quantizedLocation || m_quantizedVelocity != other.m_quantizedVelocity ||
+		m_radius != other.m_radius || m_inverseObstaclePredictionTime != other.m_inverseObstaclePredictionTime ||
+		m_obstacleIndicies.Num() != other.m_obstacleIndicies.Num())
+	{
+		return false;
+	}
+
+	for (int32 i = 0; i < m_obstacleIndicies.Num(); ++i)
+	{
+		if (m_obstacleIndicies[i].m_obstacleIndex != other.m_obstacleIndicies[i].m_obstacleIndex ||
+			m_obstacleIndicies[i].m_obstaclePointIndex != other.m_obstacleIndicies[i].m_obstaclePointIndex)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,25 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#pragma once
+
+#include "ComponentDependencies/ObstaclePointKDTree.h"
+#include "CoreMinimal.h"
+
+// Everything the obstacle ORCA lines of an entity depend on. Location and velocity are quantized, so small movements still reuse the cached lines, and
+// every part of the key is compared exactly, so two different states can never share lines.
+class ObstacleORCALinesCacheKey
+{
+public:
+	void Populate(const FVector& location, const FVector2D& velocity, float radius, float inverseObstaclePredictionTime, const TArray<ObstacleIndicies, ArgusContainerAllocator<20u> >& obstacleIndicies);
+	void Reset();
+
+	bool operator==(const ObstacleORCALinesCacheKey& other) const;
+	bool operator!=(const ObstacleORCALinesCacheKey& other) const { return !(*this == other); }
+
+private:
+	TArray<ObstacleIndicies, ArgusContainerAllocator<20u> > m_obstacleIndicies;
+	FIntVector m_quantizedLocation = FIntVector::ZeroValue;
+	FIntPoint m_quantizedVelocity = FIntPoint::ZeroValue;
+	float m_radius = 0.0f;
+	float m_inverseObstaclePredictionTime = 0.0f;
+};
@@ -0,0 +1,225 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "PlacementOccupancyGrid.h"
+#include "ArgusECSConstants.h"
+#include "ArgusLogging.h"
+#include "ArgusMath.h"
+
+template <typename Function>
+void PlacementOccupancyGrid::IterateCellsInCircle(const FVector2D& center, float radius, bool shouldIncludeTouchedCells, Function&& perCellFunction) const
+{
+	int32 centerX, centerY;
+	const bool isCenterInGrid = GetCellCoordinates(center, centerX, centerY);
+	if (isCenterInGrid && perCellFunction((centerY * m_cellsPerDimension) + centerX))
+	{
+		return;
+	}
+
+	const float radiusSquared = FMath::Square(radius);
+	const int32 minX = FMath::Max(FMath::FloorToInt32((center.X - radius + m_validSpaceExtent) / k_cellSize), 0);
+	const int32 maxX = FMath::Min(FMath::FloorToInt32((center.X + radius + m_validSpaceExtent) / k_cellSize), m_cellsPerDimension - 1);
+	const int32 minY = FMath::Max(FMath::FloorToInt32((center.Y - radius + m_validSpaceExtent) / k_cellSize), 0);
+	const int32 maxY = FMath::Min(FMath::FloorToInt32((center.Y + radius + m_validSpaceExtent) / k_cellSize), m_cellsPerDimension - 1);
+	for (int32 yCoordinate = minY; yCoordinate <= maxY; ++yCoordinate)
+	{
+		for (int32 xCoordinate = minX; xCoordinate <= maxX; ++xCoordinate)
+		{
+			if (isCenterInGrid && xCoordinate == centerX && yCoordinate == centerY)
+			{
+				continue;
+			}
+
+			// Touched cells are tested against the point of the cell closest to the circle's center instead of the cell's center.
+			const FVector2D cellCenter = GetCellCenter(xCoordinate, yCoordinate);
+			const FVector2D closestPoint = shouldIncludeTouchedCells ? FVector2D
+			(
+				FMath::Clamp(center.X, cellCenter.X - (k_cellSize * 0.5f), cellCenter.X + (k_cellSize * 0.5f)),
+				FMath::Clamp(center.Y, cellCenter.Y - (k_cellSize * 0.5f), cellCenter.Y + (k_cellSize * 0.5f))
+			) : cellCenter;
+			if (FVector2D::DistSquared(closestPoint, center) > radiusSquared)
+			{
+				continue;
+			}
+
+			if (perCellFunction((yCoordinate * m_cellsPerDimension) + xCoordinate))
+			{
+				return;
+			}
+		}
+	}
+}
+
+void PlacementOccupancyGrid::Initialize(float validSpaceExtent)
+{
+	m_validSpaceExtent = FMath::Max(validSpaceExtent, 0.0f);
+	m_cellsPerDimension = FMath::CeilToInt32(ArgusMath::SafeDivide(m_validSpaceExtent * 2.0f, k_cellSize));
+	const int32 numCells = m_cellsPerDimension * m_cellsPerDimension;
+
+	m_obstacleCells.Init(false, numCells);
+	m_staticEntityCounts.Init(0u, numCells);
+	m_stampedEntityIds.Init(false, ArgusECSConstants::k_maxEntities);
+	m_stampedEntityLocations.Init(FVector2D::ZeroVector, ArgusECSConstants::k_maxEntities);
+	m_stampedEntityRadii.Init(0.0f, ArgusECSConstants::k_maxEntities);
+}
+
+void PlacementOccupancyGrid::Reset()
+{
+	m_obstacleCells.Reset();
+	m_staticEntityCounts.Reset();
+	m_stampedEntityIds.Reset();
+	m_stampedEntityLocations.Reset();
+	m_stampedEntityRadii.Reset();
+	m_validSpaceExtent = 0.0f;
+	m_cellsPerDimension = 0;
+}
+
+void PlacementOccupancyGrid::StampObstacles(const ObstaclesContainer& obstacles)
+{
+	ARGUS_TRACE(PlacementOccupancyGrid::StampObstacles);
+
+	m_obstacleCells.SetRange(0, m_obstacleCells.Num(), false);
+	for (int32 i = 0; i < obstacles.Num(); ++i)
+	{
+		for (int32 j = 0; j < obstacles[i].Num(); ++j)
+		{
+			int32 xCoordinate, yCoordinate;
+			if (GetCellCoordinates(ArgusMath::ToUnrealVector2(obstacles[i][j].m_point), xCoordinate, yCoordinate))
+			{
+				m_obstacleCells[(yCoordinate * m_cellsPerDimension) + xCoordinate] = true;
+			}
+		}
+	}
+}
+
+void PlacementOccupancyGrid::UpdateStaticEntity(uint16 entityId, bool shouldBeStamped, const FVector& location, float radius)
+{
+	if (!m_stampedEntityIds.IsValidIndex(entityId))
+	{
+		return;
+	}
+
+	const FVector2D location2D = FVector2D(location);
+	const bool isStamped = m_stampedEntityIds[entityId];
+	if (isStamped && shouldBeStamped && m_stampedEntityLocations[entityId] == location2D && m_stampedEntityRadii[entityId] == radius)
+	{
+		return;
+	}
+
+	if (isStamped)
+	{
+		StampCircle(m_stampedEntityLocations[entityId], m_stampedEntityRadii[entityId], false);
+		m_stampedEntityIds[entityId] = false;
+	}
+
+	if (shouldBeStamped)
+	{
+		StampCircle(location2D, radius, true);
+		m_stampedEntityIds[entityId] = true;
+		m_stampedEntityLocations[entityId] = location2D;
+		m_stampedEntityRadii[entityId] = radius;
+	}
+}
+
+bool PlacementOccupancyGrid::IsCircleBlocked(const FVector& center, float radius) const
+{
+	bool isBlocked = false;
+	IterateCellsInCircle(FVector2D(center), radius, false, [this, &isBlocked](int32 cellIndex)
+	{
+		isBlocked = m_obstacleCells[cellIndex] || m_staticEntityCounts[cellIndex] > 0u;
+		return isBlocked;
+	});
+
+	return isBlocked;
+}
+
+bool PlacementOccupancyGrid::FindNearestUnblockedLocation(const FVector& center, float radius, float maxSearchDistance, FVector& outLocation, const TFunction<bool(const FVector&)>& locationFilter) const
+{
+	ARGUS_TRACE(PlacementOccupancyGrid::FindNearestUnblockedLocation);
+
+	if (!IsCircleBlocked(center, radius) && (!locationFilter || locationFilter(center)))
+	{
+		outLocation = center;
+		return true;
+	}
+
+	int32 centerX, centerY;
+	if (!GetCellCoordinates(FVector2D(center), centerX, centerY))
+	{
+		return false;
+	}
+
+	// Walk square rings of cells outward. A ring can still hold a closer cell than the best one found in the ring before it, so the search only stops once
+	// a ring's inner edge is further away than the best candidate.
+	const int32 maxRing = FMath::CeilToInt32(ArgusMath::SafeDivide(maxSearchDistance, k_cellSize));
+	const float maxSearchDistanceSquared = FMath::Square(maxSearchDistance);
+	float bestDistanceSquared = FLT_MAX;
+	for (int32 ring = 0; ring <= maxRing; ++ring)
+	{
+		if (FMath::Square(static_cast<float>(ring - 1) * k_cellSize) > bestDistanceSquared)
+		{
+			break;
+		}
+
+		for (int32 yCoordinate = centerY - ring; yCoordinate <= centerY + ring; ++yCoordinate)
+		{
+			const bool isEdgeRow = FMath::Abs(yCoordinate - centerY) == ring;
+			const int32 xStep = isEdgeRow ? 1 : FMath::Max(ring * 2, 1);
+			for (int32 xCoordinate = centerX - ring; xCoordinate <= centerX + ring; xCoordinate += xStep)
+			{
+				if (xCoordinate < 0 || yCoordinate < 0 || xCoordinate >= m_cellsPerDimension || yCoordinate >= m_cellsPerDimension)
+				{
+					continue;
+				}
+
+				const FVector candidate = FVector(GetCellCenter(xCoordinate, yCoordinate), center.Z);
+				const float distanceSquared = FVector::DistSquared2D(candidate, center);
+				if (distanceSquared > maxSearchDistanceSquared || distanceSquared >= bestDistanceSquared)
+				{
+					continue;
+				}
+
+				if (IsCircleBlocked(candidate, radius) || (locationFilter && !locationFilter(candidate)))
+				{
+					continue;
+				}
+
+				bestDistanceSquared = distanceSquared;
+				outLocation = candidate;
+			}
+		}
+	}
+
+	return bestDistanceSquared != FLT_MAX;
+}
+
+bool PlacementOccupancyGrid::GetCellCoordinates(const FVector2D& location, int32& xCoordinate, int32& yCoordinate) const
+{
+	xCoordinate = FMath::FloorToInt32((location.X + m_validSpaceExtent) / k_cellSize);
+	yCoordinate = FMath::FloorToInt32((location.Y + m_validSpaceExtent) / k_cellSize);
+	return xCoordinate >= 0 && yCoordinate >= 0 && xCoordinate < m_cellsPerDimension && yCoordinate < m_cellsPerDimension;
+}
+
+FVector2D PlacementOccupancyGrid::GetCellCenter(int32 xCoordinate, int32 yCoordinate) const
+{
+	return FVector2D
+	(
+		((static_cast<float>(xCoordinate) + 0.5f) * k_cellSize) - m_validSpaceExtent,
+		((static_cast<float>(yCoordinate) + 0.5f) * k_cellSize) - m_validSpaceExtent
+	);
+}
+
+void PlacementOccupancyGrid::StampCircle(const FVector2D& center, float radius, bool shouldAdd)
+{
+	IterateCellsInCircle(center, radius, true, [this, shouldAdd](int32 cellIndex)
+	{
+		if (shouldAdd)
+		{
+			m_staticEntityCounts[cellIndex]++;
+		}
+		else if (m_staticEntityCounts[cellIndex] > 0u)
+		{
+			m_staticEntityCounts[cellIndex]--;
+		}
+		return false;
+	});
+}
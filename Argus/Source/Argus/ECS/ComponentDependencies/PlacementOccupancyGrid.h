@@ -0,0 +1,47 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#pragma once
+
+#include "ComponentDependencies/ObstaclePoint.h"
+#include "Containers/BitArray.h"
+#include "CoreMinimal.h"
+
+// Rasterized grid of everything that blocks construction placement. Obstacle points are stamped once when the obstacles are built, and static entities are
+// stamped and unstamped only when they appear, disappear or move, so validating a footprint only reads the cells under it instead of querying two KD trees.
+// Static entities are stamped into every cell their circle touches, so a footprint that overlaps one is always blocked even when it only covers the edge of
+// a cell. Queries count a cell as covered when its center is inside the circle, and the cell under the circle's center is always covered.
+class PlacementOccupancyGrid
+{
+public:
+	static constexpr float k_cellSize = 25.0f;
+
+	void Initialize(float validSpaceExtent);
+	void Reset();
+	void StampObstacles(const ObstaclesContainer& obstacles);
+	void UpdateStaticEntity(uint16 entityId, bool shouldBeStamped, const FVector& location, float radius);
+
+	bool IsCircleBlocked(const FVector& center, float radius) const;
+	bool FindNearestUnblockedLocation(const FVector& center, float radius, float maxSearchDistance, FVector& outLocation, const TFunction<bool(const FVector&)>& locationFilter = nullptr) const;
+
+	bool IsInitialized() const { return m_cellsPerDimension > 0; }
+	int32 GetCellsPerDimension() const { return m_cellsPerDimension; }
+	bool IsEntityStamped(uint16 entityId) const { return m_stampedEntityIds.IsValidIndex(entityId) && m_stampedEntityIds[entityId]; }
+	int32 GetLowestStampedEntityId() const { return m_stampedEntityIds.Find(true); }
+	int32 GetHighestStampedEntityId() const { return m_stampedEntityIds.FindLast(true); }
+
+private:
+	template <typename Function>
+	void IterateCellsInCircle(const FVector2D& center, float radius, bool shouldIncludeTouchedCells, Function&& perCellFunction) const;
+
+	bool GetCellCoordinates(const FVector2D& location, int32& xCoordinate, int32& yCoordinate) const;
+	FVector2D GetCellCenter(int32 xCoordinate, int32 yCoordinate) const;
+	void StampCircle(const FVector2D& center, float radius, bool shouldAdd);
+
+	TBitArray<> m_obstacleCells;
+	TArray<uint16> m_staticEntityCounts;
+	TBitArray<> m_stampedEntityIds;
+	TArray<FVector2D> m_stampedEntityLocations;
+	TArray<float> m_stampedEntityRadii;
+	float m_validSpaceExtent = 0.0f;
+	int32 m_cellsPerDimension = 0;
+};
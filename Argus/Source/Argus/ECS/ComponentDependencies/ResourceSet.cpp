@@ -64,6 +64,19 @@ bool FResourceSet::HasResourceType(EResourceType type) const
 	return m_resourceQuantities[static_cast<uint8>(type)] > 0;
 }
 
+bool FResourceSet::HasSameResourceTypes(const FResourceSet& other) const
+{
+	for (uint8 i = 0; i < static_cast<uint8>(EResourceType::Count); ++i)
+	{
+		if ((m_resourceQuantities[i] > 0) != (other.m_resourceQuantities[i] > 0))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 bool FResourceSet::CanAffordResourceChange(const FResourceSet& otherResourceSetRepresentingChange) const
 {
 	for (uint8 i = 0; i < static_cast<uint8>(EResourceType::Count); ++i)
@@ -32,6 +32,7 @@ struct FResourceSet
 
 	void Reset();
 	bool HasResourceType(EResourceType type) const;
+	bool HasSameResourceTypes(const FResourceSet& other) const;
 	bool CanAffordResourceChange(const FResourceSet& otherResourceSetRepresentingChange) const;
 	FResourceSet GetResourceChangeConstraints(const FResourceSet& otherResourceSetRepresentingChange) const;
 	void ApplyResourceChange(const FResourceSet& otherResourceSetRepresentingChange);
@@ -0,0 +1,213 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ScoutingDistanceField.h"
+#include "ArgusLogging.h"
+
+void ScoutingDistanceField::Initialize(int32 areasPerDimension)
+{
+	m_areasPerDimension = FMath::Max(areasPerDimension, 0);
+	const int32 numAreas = m_areasPerDimension * m_areasPerDimension;
+
+	m_scoutableAreas.Init(false, numAreas);
+	m_claimedAreas.Init(false, numAreas);
+	m_nearestScoutableAreaIndices.Init(-1, numAreas);
+	m_distances.Init(-1, numAreas);
+	m_searchQueue.Reset(numAreas);
+	m_invalidatedAreaIndices.Reset(numAreas);
+	m_pendingAreaIndices.Reset(numAreas);
+}
+
+void ScoutingDistanceField::Reset()
+{
+	m_scoutableAreas.Reset();
+	m_claimedAreas.Reset();
+	m_nearestScoutableAreaIndices.Reset();
+	m_distances.Reset();
+	m_searchQueue.Reset();
+	m_invalidatedAreaIndices.Reset();
+	m_pendingAreaIndices.Reset();
+	m_areasPerDimension = 0;
+}
+
+void ScoutingDistanceField::SetScoutableArea(int32 areaIndex, bool isScoutable)
+{
+	SetAreaBit(m_scoutableAreas, areaIndex, isScoutable);
+}
+
+void ScoutingDistanceField::SetClaimedArea(int32 areaIndex, bool isClaimed)
+{
+	SetAreaBit(m_claimedAreas, areaIndex, isClaimed);
+}
+
+void ScoutingDistanceField::ClearClaimedAreas()
+{
+	for (TConstSetBitIterator<> iterator(m_claimedAreas); iterator; ++iterator)
+	{
+		if (m_scoutableAreas[iterator.GetIndex()])
+		{
+			m_pendingAreaIndices.Add(iterator.GetIndex());
+		}
+	}
+
+	m_claimedAreas.SetRange(0, m_claimedAreas.Num(), false);
+}
+
+bool ScoutingDistanceField::UpdateIfDirty()
+{
+	ARGUS_TRACE(ScoutingDistanceField::UpdateIfDirty);
+
+	if (m_pendingAreaIndices.IsEmpty())
+	{
+		return false;
+	}
+
+	if (m_pendingAreaIndices.Num() * k_pendingAreasPerFullRebuild >= m_nearestScoutableAreaIndices.Num())
+	{
+		m_pendingAreaIndices.Reset();
+		Rebuild();
+		return true;
+	}
+
+	// Areas that stopped being sources hand their whole region back, and the search restarts from the areas bordering it.
+	m_searchQueue.Reset();
+	m_invalidatedAreaIndices.Reset();
+	for (int32 areaIndex : m_pendingAreaIndices)
+	{
+		if (!IsSourceArea(areaIndex) && m_nearestScoutableAreaIndices[areaIndex] == areaIndex)
+		{
+			InvalidateRegionOfSource(areaIndex);
+		}
+	}
+
+	for (int32 areaIndex : m_invalidatedAreaIndices)
+	{
+		IterateNeighbors(areaIndex, [this](int32 neighborIndex)
+		{
+			if (m_distances[neighborIndex] >= 0)
+			{
+				m_searchQueue.Add(neighborIndex);
+			}
+		});
+	}
+
+	for (int32 areaIndex : m_pendingAreaIndices)
+	{
+		if (IsSourceArea(areaIndex) && m_nearestScoutableAreaIndices[areaIndex] != areaIndex)
+		{
+			m_nearestScoutableAreaIndices[areaIndex] = areaIndex;
+			m_distances[areaIndex] = 0;
+			m_searchQueue.Add(areaIndex);
+		}
+	}
+
+	m_pendingAreaIndices.Reset();
+	PropagateSearchQueue();
+	return true;
+}
+
+int32 ScoutingDistanceField::GetNearestScoutableAreaIndex(int32 areaIndex) const
+{
+	if (!IsValidAreaIndex(areaIndex))
+	{
+		return -1;
+	}
+
+	return m_nearestScoutableAreaIndices[areaIndex];
+}
+
+int32 ScoutingDistanceField::GetDistanceToNearestScoutableArea(int32 areaIndex) const
+{
+	if (!IsValidAreaIndex(areaIndex))
+	{
+		return -1;
+	}
+
+	return m_distances[areaIndex];
+}
+
+void ScoutingDistanceField::SetAreaBit(TBitArray<>& areaBits, int32 areaIndex, bool value)
+{
+	if (!IsValidAreaIndex(areaIndex) || areaBits[areaIndex] == value)
+	{
+		return;
+	}
+
+	const bool wasSourceArea = IsSourceArea(areaIndex);
+	areaBits[areaIndex] = value;
+	if (IsSourceArea(areaIndex) != wasSourceArea)
+	{
+		m_pendingAreaIndices.Add(areaIndex);
+	}
+}
+
+void ScoutingDistanceField::Rebuild()
+{
+	ARGUS_TRACE(ScoutingDistanceField::Rebuild);
+
+	const int32 numAreas = m_nearestScoutableAreaIndices.Num();
+	m_searchQueue.Reset();
+	for (int32 i = 0; i < numAreas; ++i)
+	{
+		if (IsSourceArea(i))
+		{
+			m_nearestScoutableAreaIndices[i] = i;
+			m_distances[i] = 0;
+			m_searchQueue.Add(i);
+		}
+		else
+		{
+			m_nearestScoutableAreaIndices[i] = -1;
+			m_distances[i] = -1;
+		}
+	}
+
+	PropagateSearchQueue();
+}
+
+// Every area in a source's region was reached through a neighbor in the same region, so the region is connected and can be flood filled from the source.
+void ScoutingDistanceField::InvalidateRegionOfSource(int32 sourceAreaIndex)
+{
+	const int32 regionStart = m_invalidatedAreaIndices.Num();
+	m_nearestScoutableAreaIndices[sourceAreaIndex] = -1;
+	m_distances[sourceAreaIndex] = -1;
+	m_invalidatedAreaIndices.Add(sourceAreaIndex);
+
+	for (int32 i = regionStart; i < m_invalidatedAreaIndices.Num(); ++i)
+	{
+		IterateNeighbors(m_invalidatedAreaIndices[i], [this, sourceAreaIndex](int32 neighborIndex)
+		{
+			if (m_nearestScoutableAreaIndices[neighborIndex] != sourceAreaIndex)
+			{
+				return;
+			}
+
+			m_nearestScoutableAreaIndices[neighborIndex] = -1;
+			m_distances[neighborIndex] = -1;
+			m_invalidatedAreaIndices.Add(neighborIndex);
+		});
+	}
+}
+
+// Expanding to all eight neighbors makes the distance match the concentric ring search it replaces. Seeds of a partial update start at different distances, so an
+// area is revisited whenever a shorter distance reaches it. Seeds of a full rebuild all start at zero, which makes this a plain BFS that visits each area once.
+void ScoutingDistanceField::PropagateSearchQueue()
+{
+	for (int32 queueIndex = 0; queueIndex < m_searchQueue.Num(); ++queueIndex)
+	{
+		const int32 areaIndex = m_searchQueue[queueIndex];
+		const int32 neighborDistance = m_distances[areaIndex] + 1;
+		const int32 nearestScoutableAreaIndex = m_nearestScoutableAreaIndices[areaIndex];
+
+		IterateNeighbors(areaIndex, [this, neighborDistance, nearestScoutableAreaIndex](int32 neighborIndex)
+		{
+			if (m_distances[neighborIndex] >= 0 && m_distances[neighborIndex] <= neighborDistance)
+			{
+				return;
+			}
+
+			m_distances[neighborIndex] = neighborDistance;
+			m_nearestScoutableAreaIndices[neighborIndex] = nearestScoutableAreaIndex;
+			m_searchQueue.Add(neighborIndex);
+		});
+	}
+}
@@ -0,0 +1,72 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#pragma once
+
+#include "Containers/BitArray.h"
+#include "CoreMinimal.h"
+
+// Multi-source BFS distance transform over a team commander's area grid. Every area stores the index of, and the ring distance to, the nearest area that is worth scouting,
+// so a scout assignment is a single lookup. An area is a source while it is scoutable and no scout has claimed it. Callers only report the areas that flipped, and an update
+// only repairs the regions around those areas, unless so many flipped that a full rebuild is cheaper.
+class ScoutingDistanceField
+{
+public:
+	void Initialize(int32 areasPerDimension);
+	void Reset();
+
+	void SetScoutableArea(int32 areaIndex, bool isScoutable);
+	void SetClaimedArea(int32 areaIndex, bool isClaimed);
+	void ClearClaimedAreas();
+	bool UpdateIfDirty();
+
+	int32 GetNearestScoutableAreaIndex(int32 areaIndex) const;
+	int32 GetDistanceToNearestScoutableArea(int32 areaIndex) const;
+
+	int32 GetAreasPerDimension() const { return m_areasPerDimension; }
+	bool IsValidAreaIndex(int32 areaIndex) const { return areaIndex >= 0 && areaIndex < m_nearestScoutableAreaIndices.Num(); }
+
+private:
+	static constexpr int32 k_pendingAreasPerFullRebuild = 8;
+
+	bool IsSourceArea(int32 areaIndex) const { return m_scoutableAreas[areaIndex] && !m_claimedAreas[areaIndex]; }
+	void SetAreaBit(TBitArray<>& areaBits, int32 areaIndex, bool value);
+	void Rebuild();
+	void InvalidateRegionOfSource(int32 sourceAreaIndex);
+	void PropagateSearchQueue();
+
+	template <typename Function>
+	void IterateNeighbors(int32 areaIndex, Function&& function) const
+	{
+		const int32 xCoordinate = areaIndex % m_areasPerDimension;
+		const int32 yCoordinate = areaIndex / m_areasPerDimension;
+
+		for (int32 yOffset = -1; yOffset <= 1; ++yOffset)
+		{
+			const int32 neighborY = yCoordinate + yOffset;
+			if (neighborY < 0 || neighborY >= m_areasPerDimension)
+			{
+				continue;
+			}
+
+			for (int32 xOffset = -1; xOffset <= 1; ++xOffset)
+			{
+				const int32 neighborX = xCoordinate + xOffset;
+				if ((xOffset == 0 && yOffset == 0) || neighborX < 0 || neighborX >= m_areasPerDimension)
+				{
+					continue;
+				}
+
+				function((neighborY * m_areasPerDimension) + neighborX);
+			}
+		}
+	}
+
+	TBitArray<> m_scoutableAreas;
+	TBitArray<> m_claimedAreas;
+	TArray<int32> m_nearestScoutableAreaIndices;
+	TArray<int32> m_distances;
+	TArray<int32> m_searchQueue;
+	TArray<int32> m_invalidatedAreaIndices;
+	TArray<int32> m_pendingAreaIndices;
+	int32 m_areasPerDimension = 0;
+};
@@ -21,6 +21,15 @@ enum class ETeamCommanderDirective : uint8
 	Count
 };
 
+UENUM()
+enum class ETeamCommanderUpdatePhase : uint8
+{
+	Idle,
+	GatherInfo,
+	UpdatePriorities,
+	AssignEntities
+};
+
 struct TeamCommanderPriority
 {
 	float m_weight = 0.0f;
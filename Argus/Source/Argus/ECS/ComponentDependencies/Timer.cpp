@@ -5,6 +5,7 @@
 #include "ArgusLogging.h"
 #include "ComponentDefinitions/TimerComponent.h"
 #include "Serialization/Archive.h"
+#include "Systems/TimerSystems.h"
 
 #if !UE_BUILD_SHIPPING
 #include "imgui.h"
@@ -39,24 +40,28 @@ void TimerHandle::StartTimer(ArgusEntity entityWithTimer, float seconds)
 		return;
 	}
 
+	int32 timerIndex = INDEX_NONE;
 	for (int32 i = 0; i < timerComponent->m_timers.Num(); ++i)
 	{
 		if (timerComponent->m_timers[i].m_timerState == TimerState::NotSet)
 		{
-			timerComponent->m_timers[i].m_timerState = TimerState::Ticking;
-			timerComponent->m_timers[i].m_initialDurationSeconds = seconds;
-			timerComponent->m_timers[i].m_timeRemainingSeconds = seconds;
-			m_timerIndex = static_cast<uint8>(i);
-			return;
+			timerIndex = i;
+			break;
 		}
 	}
 
-	Timer timerToAdd;
-	timerToAdd.m_timerState = TimerState::Ticking;
-	timerToAdd.m_initialDurationSeconds = seconds;
-	timerToAdd.m_timeRemainingSeconds = seconds;
-	timerComponent->m_timers.Add(timerToAdd);
-	m_timerIndex = static_cast<uint8>(timerComponent->m_timers.Num() - 1);
+	if (timerIndex == INDEX_NONE)
+	{
+		timerIndex = timerComponent->m_timers.Add(Timer());
+	}
+
+	Timer& timer = timerComponent->m_timers[timerIndex];
+	timer.m_timerState = TimerState::Ticking;
+	timer.m_initialDurationSeconds = seconds;
+	timer.m_expirationTick = TimerSystems::CalculateExpirationTick(seconds);
+	m_timerIndex = static_cast<uint8>(timerIndex);
+
+	TimerSystems::ScheduleTimer(entityWithTimer, m_timerIndex, timer.m_expirationTick);
 }
 
 void TimerHandle::FinishTimerHandling()
@@ -79,7 +84,7 @@ void TimerHandle::FinishTimerHandling(ArgusEntity entityWithTimer)
 	}
 
 	timer->m_initialDurationSeconds = 0.0f;
-	timer->m_timeRemainingSeconds = 0.0f;
+	timer->m_expirationTick = 0u;
 	timer->m_timerState = TimerState::NotSet;
 	m_timerIndex = UINT8_MAX;
 }
@@ -99,7 +104,7 @@ void TimerHandle::CancelTimer(ArgusEntity entityWithTimer)
 	}
 
 	timer->m_initialDurationSeconds = 0.0f;
-	timer->m_timeRemainingSeconds = 0.0f;
+	timer->m_expirationTick = 0u;
 	timer->m_timerState = TimerState::NotSet;
 	m_timerIndex = UINT8_MAX;
 }
@@ -122,12 +127,12 @@ float TimerHandle::GetTimeRemaining(ArgusEntity entityWithTimer) const
 		return 0.0f;
 	}
 
-	if (timer->m_initialDurationSeconds == 0.0f)
+	if (timer->m_initialDurationSeconds == 0.0f || timer->m_timerState != TimerState::Ticking)
 	{
 		return 0.0f;
 	}
 
-	return timer->m_timeRemainingSeconds;
+	return TimerSystems::CalculateTimeRemaining(timer->m_expirationTick);
 }
 
 float TimerHandle::GetTimeElapsedProportion() const
@@ -153,7 +158,12 @@ float TimerHandle::GetTimeElapsedProportion(ArgusEntity entityWithTimer) const
 		return 0.0f;
 	}
 
-	return 1.0f - (timer->m_timeRemainingSeconds / timer->m_initialDurationSeconds);
+	if (timer->m_timerState == TimerState::Completed)
+	{
+		return 1.0f;
+	}
+
+	return 1.0f - (TimerSystems::CalculateTimeRemaining(timer->m_expirationTick) / timer->m_initialDurationSeconds);
 }
 
 bool TimerHandle::IsTimerTicking() const
@@ -293,7 +303,7 @@ Timer* TimerHandle::GetTimerForEntity(ArgusEntity entityWithTimer, const WIDECHA
 
 FArchive& operator<<(FArchive& archive, Timer& timer)
 {
-	archive << timer.m_timeRemainingSeconds;
+	archive << timer.m_expirationTick;
 	archive << timer.m_initialDurationSeconds;
 	archive << timer.m_timerState;
 
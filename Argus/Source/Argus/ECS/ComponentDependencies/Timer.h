@@ -17,7 +17,7 @@ enum class TimerState : uint8
 
 struct Timer
 {
-	float m_timeRemainingSeconds = 0.0f;
+	uint32 m_expirationTick = 0u;
 	float m_initialDurationSeconds = 0.0f;
 	TimerState m_timerState = TimerState::NotSet;
 };
@@ -0,0 +1,106 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "TimingWheel.h"
+#include "ArgusMacros.h"
+
+void TimingWheel::Schedule(uint16 entityId, uint8 timerIndex, uint32 expirationTick)
+{
+	ARGUS_MEMORY_TRACE(ArgusTimerSystems);
+
+	TimingWheelEntry entry;
+	entry.m_expirationTick = expirationTick;
+	entry.m_entityId = entityId;
+	entry.m_timerIndex = timerIndex;
+
+	m_numScheduledEntries++;
+	if (expirationTick <= m_currentTick)
+	{
+		m_overdueEntries.Add(entry);
+		return;
+	}
+
+	InsertEntry(entry);
+}
+
+void TimingWheel::Advance(uint32 targetTick, TArray<TimingWheelEntry>& outExpiredEntries)
+{
+	ARGUS_TRACE(TimingWheel::Advance);
+
+	if (!m_overdueEntries.IsEmpty())
+	{
+		m_numScheduledEntries -= m_overdueEntries.Num();
+		outExpiredEntries.Append(m_overdueEntries);
+		m_overdueEntries.Reset();
+	}
+
+	while (m_currentTick < targetTick)
+	{
+		m_currentTick++;
+
+		// Pull the next slot of each higher level down once every lower level has wrapped, starting from the highest so entries can fall through more than one level.
+		for (uint32 level = k_numLevels - 1u; level > 0u; --level)
+		{
+			const uint32 lowerBits = level * k_numSlotBitsPerLevel;
+			if ((m_currentTick & ((1u << lowerBits) - 1u)) == 0u)
+			{
+				CascadeSlot(level, (m_currentTick >> lowerBits) & k_slotMask);
+			}
+		}
+
+		TArray<TimingWheelEntry>& slot = m_slots[0][m_currentTick & k_slotMask];
+		if (slot.IsEmpty())
+		{
+			continue;
+		}
+
+		m_numScheduledEntries -= slot.Num();
+		outExpiredEntries.Append(slot);
+		slot.Reset();
+	}
+}
+
+void TimingWheel::Reset(uint32 currentTick)
+{
+	for (uint32 level = 0u; level < k_numLevels; ++level)
+	{
+		for (uint32 slotIndex = 0u; slotIndex < k_numSlotsPerLevel; ++slotIndex)
+		{
+			m_slots[level][slotIndex].Reset();
+		}
+	}
+
+	m_overdueEntries.Reset();
+	m_currentTick = currentTick;
+	m_numScheduledEntries = 0;
+}
+
+void TimingWheel::InsertEntry(const TimingWheelEntry& entry)
+{
+	// Anything further out than the wheel can represent parks in the furthest slot and gets re-inserted when that slot cascades.
+	const uint32 delta = FMath::Min(entry.m_expirationTick - m_currentTick, k_maxScheduleDelta);
+	const uint32 slotTick = m_currentTick + delta;
+
+	uint32 level = 0u;
+	while (level < (k_numLevels - 1u) && delta >= (1u << ((level + 1u) * k_numSlotBitsPerLevel)))
+	{
+		level++;
+	}
+
+	m_slots[level][(slotTick >> (level * k_numSlotBitsPerLevel)) & k_slotMask].Add(entry);
+}
+
+void TimingWheel::CascadeSlot(uint32 level, uint32 slotIndex)
+{
+	TArray<TimingWheelEntry>& slot = m_slots[level][slotIndex];
+	if (slot.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<TimingWheelEntry> cascadingEntries = MoveTemp(slot);
+	slot.Reset();
+	for (int32 i = 0; i < cascadingEntries.Num(); ++i)
+	{
+		InsertEntry(cascadingEntries[i]);
+	}
+}
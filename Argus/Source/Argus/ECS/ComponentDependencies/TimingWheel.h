@@ -0,0 +1,40 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct TimingWheelEntry
+{
+	uint32 m_expirationTick = 0u;
+	uint16 m_entityId = 0u;
+	uint8 m_timerIndex = UINT8_MAX;
+};
+
+// Hierarchical timing wheel keyed on absolute ticks. Each level has k_numSlotsPerLevel slots, and each slot on a level spans a full revolution of the level below it.
+// Entries only move down a level when the wheel reaches their slot, so advancing costs one slot drain per tick plus the entries that actually expire.
+class TimingWheel
+{
+public:
+	void Schedule(uint16 entityId, uint8 timerIndex, uint32 expirationTick);
+	void Advance(uint32 targetTick, TArray<TimingWheelEntry>& outExpiredEntries);
+	void Reset(uint32 currentTick = 0u);
+
+	uint32 GetCurrentTick() const { return m_currentTick; }
+	int32 GetNumScheduledEntries() const { return m_numScheduledEntries; }
+
+private:
+	static constexpr uint32 k_numLevels = 4u;
+	static constexpr uint32 k_numSlotBitsPerLevel = 6u;
+	static constexpr uint32 k_numSlotsPerLevel = 1u << k_numSlotBitsPerLevel;
+	static constexpr uint32 k_slotMask = k_numSlotsPerLevel - 1u;
+	static constexpr uint32 k_maxScheduleDelta = (1u << (k_numLevels * k_numSlotBitsPerLevel)) - 1u;
+
+	void InsertEntry(const TimingWheelEntry& entry);
+	void CascadeSlot(uint32 level, uint32 slotIndex);
+
+	TArray<TimingWheelEntry> m_slots[k_numLevels][k_numSlotsPerLevel];
+	TArray<TimingWheelEntry> m_overdueEntries;
+	uint32 m_currentTick = 0u;
+	int32 m_numScheduledEntries = 0;
+};
@@ -160,7 +160,7 @@ void AbilityComponent::DrawComponentDebug() const
 		ImGui::TableNextColumn();
 		ImGui::Text("m_abilityToRefundId");
 		ImGui::TableNextColumn();
-		ImGui::Text("%d", m_abilityToRefundId);
+		ImGui::Text("%u", m_abilityToRefundId);
 		ImGui::TableNextColumn();
 		ImGui::Text("m_abilityOverrideBitmask");
 		ImGui::TableNextColumn();
@@ -26,6 +26,8 @@ void AvoidanceGroupingComponent::Reset()
 	m_groupId = ArgusECSConstants::k_maxEntities;
 	m_previousGroupId = ArgusECSConstants::k_maxEntities;
 	m_numberOfIdleEntities = 0u;
+	m_numberOfSettledFrames = 0u;
+	m_isGroupSleeping = false;
 	m_avoidancePriority = EAvoidancePriority::Lowest;
 }
 
@@ -81,6 +83,14 @@ void AvoidanceGroupingComponent::DrawComponentDebug() const
 		ImGui::TableNextColumn();
 		ImGui::Text("%d", m_numberOfIdleEntities);
 		ImGui::TableNextColumn();
+		ImGui::Text("m_numberOfSettledFrames");
+		ImGui::TableNextColumn();
+		ImGui::Text("%d", m_numberOfSettledFrames);
+		ImGui::TableNextColumn();
+		ImGui::Text("m_isGroupSleeping");
+		ImGui::TableNextColumn();
+		ImGui::Text(m_isGroupSleeping ? "true" : "false");
+		ImGui::TableNextColumn();
 		ImGui::Text("m_avoidancePriority");
 		ImGui::TableNextColumn();
 		const char* valueName_m_avoidancePriority = ARGUS_FSTRING_TO_CHAR(StaticEnum<EAvoidancePriority>()->GetNameStringByValue(static_cast<uint8>(m_avoidancePriority)));
@@ -52,7 +52,7 @@ void CombatComponent::DrawComponentDebug() const
 		ImGui::TableNextColumn();
 		ImGui::Text("m_baseDamagePerIntervalOrPerSecond");
 		ImGui::TableNextColumn();
-		ImGui::Text("%d", m_baseDamagePerIntervalOrPerSecond);
+		ImGui::Text("%u", m_baseDamagePerIntervalOrPerSecond);
 		ImGui::TableNextColumn();
 		ImGui::Text("m_intervalDurationSeconds");
 		ImGui::TableNextColumn();
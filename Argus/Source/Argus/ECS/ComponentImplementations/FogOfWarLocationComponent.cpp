@@ -42,7 +42,7 @@ void FogOfWarLocationComponent::DrawComponentDebug() const
 		ImGui::TableNextColumn();
 		ImGui::Text("m_fogOfWarPixel");
 		ImGui::TableNextColumn();
-		ImGui::Text("%d", m_fogOfWarPixel);
+		ImGui::Text("%u", m_fogOfWarPixel);
 		ImGui::EndTable();
 	}
 #endif //!UE_BUILD_SHIPPING
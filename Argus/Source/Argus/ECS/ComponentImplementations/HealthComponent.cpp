@@ -44,11 +44,11 @@ void HealthComponent::DrawComponentDebug() const
 		ImGui::TableNextColumn();
 		ImGui::Text("m_currentHealth");
 		ImGui::TableNextColumn();
-		ImGui::Text("%d", m_currentHealth);
+		ImGui::Text("%u", m_currentHealth);
 		ImGui::TableNextColumn();
 		ImGui::Text("m_maximumHealth");
 		ImGui::TableNextColumn();
-		ImGui::Text("%d", m_maximumHealth);
+		ImGui::Text("%u", m_maximumHealth);
 		ImGui::EndTable();
 	}
 #endif //!UE_BUILD_SHIPPING
@@ -23,6 +23,10 @@ void LODComponent::Reset()
 {
 	m_bIsInViewFrustrum = false;
 	m_bWasInViewFrustrum = false;
+	m_simulationLOD = ESimulationLOD::FullRate;
+	m_accumulatedSimulationDeltaTime = 0.0f;
+	m_simulationDeltaTime = 0.0f;
+	m_shouldUpdateSimulationThisFrame = true;
 }
 
 void LODComponent::Serialize(FArchive& archive)
@@ -47,6 +51,23 @@ void LODComponent::DrawComponentDebug() const
 		ImGui::Text("m_bWasInViewFrustrum");
 		ImGui::TableNextColumn();
 		ImGui::Text(m_bWasInViewFrustrum ? "true" : "false");
+		ImGui::TableNextColumn();
+		ImGui::Text("m_simulationLOD");
+		ImGui::TableNextColumn();
+		const char* valueName_m_simulationLOD = ARGUS_FSTRING_TO_CHAR(StaticEnum<ESimulationLOD>()->GetNameStringByValue(static_cast<uint8>(m_simulationLOD)));
+		ImGui::Text(valueName_m_simulationLOD);
+		ImGui::TableNextColumn();
+		ImGui::Text("m_accumulatedSimulationDeltaTime");
+		ImGui::TableNextColumn();
+		ImGui::Text("%.2f", m_accumulatedSimulationDeltaTime);
+		ImGui::TableNextColumn();
+		ImGui::Text("m_simulationDeltaTime");
+		ImGui::TableNextColumn();
+		ImGui::Text("%.2f", m_simulationDeltaTime);
+		ImGui::TableNextColumn();
+		ImGui::Text("m_shouldUpdateSimulationThisFrame");
+		ImGui::TableNextColumn();
+		ImGui::Text(m_shouldUpdateSimulationThisFrame ? "true" : "false");
 		ImGui::EndTable();
 	}
 #endif //!UE_BUILD_SHIPPING
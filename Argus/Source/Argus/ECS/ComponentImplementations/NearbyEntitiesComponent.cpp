@@ -23,6 +23,7 @@ void NearbyEntitiesComponent::Reset()
 {
 	m_nearbyEntities.ResetAll();
 	m_nearbyFlyingEntities.ResetAll();
+	m_hasSightRangeChanged = false;
 }
 
 void NearbyEntitiesComponent::Serialize(FArchive& archive)
@@ -153,6 +154,10 @@ void NearbyEntitiesComponent::DrawComponentDebug() const
 			}
 			ImGui::Unindent();
 		}
+		ImGui::TableNextColumn();
+		ImGui::Text("m_hasSightRangeChanged");
+		ImGui::TableNextColumn();
+		ImGui::Text(m_hasSightRangeChanged ? "true" : "false");
 		ImGui::EndTable();
 	}
 #endif //!UE_BUILD_SHIPPING
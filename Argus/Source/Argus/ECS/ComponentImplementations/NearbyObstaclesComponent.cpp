@@ -22,6 +22,10 @@ uint16 NearbyObstaclesComponent::GetOwningEntityId() const
 void NearbyObstaclesComponent::Reset()
 {
 	m_obstacleIndicies.ResetAll();
+	m_cachedObstacleORCALinePoints.Reset();
+	m_cachedObstacleORCALineDirections.Reset();
+	m_cachedObstacleORCALinesKey.Reset();
+	m_hasCachedObstacleORCALines = false;
 }
 
 void NearbyObstaclesComponent::Serialize(FArchive& archive)
@@ -41,6 +45,51 @@ void NearbyObstaclesComponent::DrawComponentDebug() const
 		ImGui::TableNextColumn();
 		ImGui::Text("m_obstacleIndicies");
 		ImGui::TableNextColumn();
+		ImGui::TableNextColumn();
+		ImGui::Text("m_cachedObstacleORCALinePoints");
+		ImGui::TableNextColumn();
+		ImGui::Text("Array max is currently = %d", m_cachedObstacleORCALinePoints.Max());
+		if (m_cachedObstacleORCALinePoints.IsEmpty())
+		{
+			ImGui::Text("Array is empty");
+		}
+		else
+		{
+			ImGui::Text("Size of array = %d", m_cachedObstacleORCALinePoints.Num());
+			ImGui::Indent();
+			for (int32 i = 0; i < m_cachedObstacleORCALinePoints.Num(); ++i)
+			{
+				if (i != 0) ImGui::Separator();
+				ImGui::Text("(%.2f, %.2f)", m_cachedObstacleORCALinePoints[i].X, m_cachedObstacleORCALinePoints[i].Y);
+			}
+			ImGui::Unindent();
+		}
+		ImGui::TableNextColumn();
+		ImGui::Text("m_cachedObstacleORCALineDirections");
+		ImGui::TableNextColumn();
+		ImGui::Text("Array max is currently = %d", m_cachedObstacleORCALineDirections.Max());
+		if (m_cachedObstacleORCALineDirections.IsEmpty())
+		{
+			ImGui::Text("Array is empty");
+		}
+		else
+		{
+			ImGui::Text("Size of array = %d", m_cachedObstacleORCALineDirections.Num());
+			ImGui::Indent();
+			for (int32 i = 0; i < m_cachedObstacleORCALineDirections.Num(); ++i)
+			{
+				if (i != 0) ImGui::Separator();
+				ImGui::Text("(%.2f, %.2f)", m_cachedObstacleORCALineDirections[i].X, m_cachedObstacleORCALineDirections[i].Y);
+			}
+			ImGui::Unindent();
+		}
+		ImGui::TableNextColumn();
+		ImGui::Text("m_cachedObstacleORCALinesKey");
+		ImGui::TableNextColumn();
+		ImGui::TableNextColumn();
+		ImGui::Text("m_hasCachedObstacleORCALines");
+		ImGui::TableNextColumn();
+		ImGui::Text(m_hasCachedObstacleORCALines ? "true" : "false");
 		ImGui::EndTable();
 	}
 #endif //!UE_BUILD_SHIPPING
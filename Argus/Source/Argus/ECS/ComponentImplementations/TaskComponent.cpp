@@ -31,6 +31,9 @@ void TaskComponent::Reset()
 	m_resourceExtractionState = EResourceExtractionState::None;
 	m_flightState = EFlightState::Grounded;
 	m_directiveFromTeamCommander = ETeamCommanderDirective::Count;
+	m_wasIdleLastUpdate = false;
+	m_flightStateLastUpdate = EFlightState::Grounded;
+	m_updatesUntilIdleRescan = 0u;
 }
 
 void TaskComponent::Serialize(FArchive& archive)
@@ -60,7 +63,7 @@ void TaskComponent::DrawComponentDebug() const
 		ImGui::TableNextColumn();
 		ImGui::Text("m_spawnedFromArgusActorRecordId");
 		ImGui::TableNextColumn();
-		ImGui::Text("%d", m_spawnedFromArgusActorRecordId);
+		ImGui::Text("%u", m_spawnedFromArgusActorRecordId);
 		ImGui::TableNextColumn();
 		ImGui::Text("m_baseState");
 		ImGui::TableNextColumn();
@@ -106,6 +109,19 @@ void TaskComponent::DrawComponentDebug() const
 		ImGui::TableNextColumn();
 		const char* valueName_m_directiveFromTeamCommander = ARGUS_FSTRING_TO_CHAR(StaticEnum<ETeamCommanderDirective>()->GetNameStringByValue(static_cast<uint8>(m_directiveFromTeamCommander)));
 		ImGui::Text(valueName_m_directiveFromTeamCommander);
+		ImGui::TableNextColumn();
+		ImGui::Text("m_wasIdleLastUpdate");
+		ImGui::TableNextColumn();
+		ImGui::Text(m_wasIdleLastUpdate ? "true" : "false");
+		ImGui::TableNextColumn();
+		ImGui::Text("m_flightStateLastUpdate");
+		ImGui::TableNextColumn();
+		const char* valueName_m_flightStateLastUpdate = ARGUS_FSTRING_TO_CHAR(StaticEnum<EFlightState>()->GetNameStringByValue(static_cast<uint8>(m_flightStateLastUpdate)));
+		ImGui::Text(valueName_m_flightStateLastUpdate);
+		ImGui::TableNextColumn();
+		ImGui::Text("m_updatesUntilIdleRescan");
+		ImGui::TableNextColumn();
+		ImGui::Text("%d", m_updatesUntilIdleRescan);
 		ImGui::EndTable();
 	}
 #endif //!UE_BUILD_SHIPPING
@@ -11,6 +11,8 @@ void UTeamCommanderComponentData::InstantiateComponentForEntity(ArgusEntity enti
 	ARGUS_RETURN_ON_NULL(TeamCommanderComponentRef, ArgusECSLog);
 
 	TeamCommanderComponentRef->m_revealedAreaDimensionLength = m_revealedAreaDimensionLength;
+	TeamCommanderComponentRef->m_updateIntervalSeconds = m_updateIntervalSeconds;
+	TeamCommanderComponentRef->m_updateEntityBudget = m_updateEntityBudget;
 }
 
 void UTeamCommanderComponentData::ReinitializeComponentForEntityPostLoad(ArgusEntity entity) const
@@ -15,6 +15,12 @@ public:
 	UPROPERTY(EditAnywhere)
 	float m_revealedAreaDimensionLength = 800.0f;
 
+	UPROPERTY(EditAnywhere)
+	float m_updateIntervalSeconds = 0.25f;
+
+	UPROPERTY(EditAnywhere)
+	int32 m_updateEntityBudget = 1024;
+
 
 	void InstantiateComponentForEntity(ArgusEntity entity) const override;
 	void ReinitializeComponentForEntityPostLoad(ArgusEntity entity) const override;
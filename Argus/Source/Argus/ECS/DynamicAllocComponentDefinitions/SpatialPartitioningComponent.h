@@ -4,7 +4,10 @@
 
 #include "ArgusMacros.h"
 #include "ComponentDependencies/ArgusEntityKDTree.h"
+#include "ComponentDependencies/AvoidanceGroupUnionFind.h"
+#include "ComponentDependencies/EntityRoleIndex.h"
 #include "ComponentDependencies/ObstaclePointKDTree.h"
+#include "ComponentDependencies/PlacementOccupancyGrid.h"
 #include "CoreMinimal.h"
 
 struct SpatialPartitioningComponent
@@ -17,12 +20,21 @@ struct SpatialPartitioningComponent
 	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
 	ArgusEntityKDTree m_flyingArgusEntityKDTree;
 
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	AvoidanceGroupUnionFind m_avoidanceGroupUnionFind;
+
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	EntityRoleIndex m_entityRoleIndex;
+
 	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
 	ObstaclePointKDTree m_obstaclePointKDTree;
 
 	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
 	ObstaclesContainer m_obstacles;
 
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	PlacementOccupancyGrid m_placementOccupancyGrid;
+
 	float m_validSpaceExtent = 3000.0f;
 	float m_flyingPlaneHeight = 300.0f;
 	float m_elevatedObstaclePointHeightThreshold = 10.0f;
@@ -7,7 +7,9 @@
 #include "ArgusMap.h"
 #include "ArgusSet.h"
 #include "ArgusSetAllocator.h"
+#include "ComponentDependencies/InfluenceMap.h"
 #include "ComponentDependencies/ResourceSet.h"
+#include "ComponentDependencies/ScoutingDistanceField.h"
 #include "ComponentDependencies/TeamCommanderPriorities.h"
 #include "ComponentDependencies/Teams.h"
 #include "Containers/BitArray.h"
@@ -35,8 +37,38 @@ struct TeamCommanderComponent
 	ARGUS_COMP_NO_DATA
 	TBitArray<ArgusContainerAllocator<0u> > m_revealedAreas;
 
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	InfluenceMap m_influenceMap;
+
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	ScoutingDistanceField m_scoutingDistanceField;
+
 	float m_revealedAreaDimensionLength = 800.0f;
 
+	// A commander only starts a new update once per interval, and each frame processes at most the entity budget before picking back up on the next frame.
+	// The budget is counted in entities rather than time so that every machine splits the update across the same frames.
+	float m_updateIntervalSeconds = 0.25f;
+	int32 m_updateEntityBudget = 1024;
+
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	ETeamCommanderUpdatePhase m_updatePhase = ETeamCommanderUpdatePhase::Idle;
+
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	int32 m_gatherInfoResumeEntityId = 0;
+
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	float m_timeUntilNextUpdate = 0.0f;
+
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	float m_timeSinceLastUpdate = 0.0f;
+
+	// Only measured outside of shipping builds for the debugger. Slices slower than Argus.TeamCommander.SlowSliceMicroseconds are counted as slow.
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	float m_lastUpdateSliceMicroseconds = 0.0f;
+
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	uint32 m_slowUpdateSliceCount = 0u;
+
 	ARGUS_COMP_NO_DATA
 	ETeam m_teamToCommand = ETeam::None;
 
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "ArgusMacros.h"
+#include "ComponentDependencies/ArgusRandomStream.h"
+#include "ComponentDependencies/TimingWheel.h"
 #include "CoreMinimal.h"
 
 class UWorld;
@@ -13,4 +15,19 @@ struct WorldReferenceComponent
 
 	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
 	UWorld* m_worldPointer = nullptr;
+
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	uint32 m_simulationFrameIndex = 0u;
+
+	ARGUS_COMP_NO_DATA
+	uint32 m_timerTick = 0u;
+
+	ARGUS_COMP_NO_DATA
+	float m_timerTickRemainderSeconds = 0.0f;
+
+	ARGUS_COMP_NO_DATA
+	ArgusRandomStream m_randomStream;
+
+	ARGUS_COMP_NO_DATA ARGUS_COMP_TRANSIENT
+	TimingWheel m_timingWheel;
 };
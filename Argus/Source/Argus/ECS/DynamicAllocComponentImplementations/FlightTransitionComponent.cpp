@@ -47,7 +47,7 @@ void FlightTransitionComponent::DrawComponentDebug() const
 		ImGui::TableNextColumn();
 		ImGui::Text("m_onTransitionCompleteAbilityId");
 		ImGui::TableNextColumn();
-		ImGui::Text("%d", m_onTransitionCompleteAbilityId);
+		ImGui::Text("%u", m_onTransitionCompleteAbilityId);
 		ImGui::EndTable();
 	}
 #endif //!UE_BUILD_SHIPPING
@@ -42,7 +42,7 @@ void ReticleComponent::DrawComponentDebug() const
 		ImGui::TableNextColumn();
 		ImGui::Text("m_abilityRecordId");
 		ImGui::TableNextColumn();
-		ImGui::Text("%d", m_abilityRecordId);
+		ImGui::Text("%u", m_abilityRecordId);
 		ImGui::TableNextColumn();
 		ImGui::Text("m_radius");
 		ImGui::TableNextColumn();
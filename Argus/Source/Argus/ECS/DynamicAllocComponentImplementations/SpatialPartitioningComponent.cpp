@@ -16,7 +16,10 @@ void SpatialPartitioningComponent::Reset()
 {
 	m_argusEntityKDTree.FlushAllNodes();
 	m_flyingArgusEntityKDTree.FlushAllNodes();
+	m_avoidanceGroupUnionFind.Reset();
+	m_entityRoleIndex.Reset();
 	m_obstaclePointKDTree.FlushAllNodes();
+	m_placementOccupancyGrid.Reset();
 	m_validSpaceExtent = 3000.0f;
 	m_flyingPlaneHeight = 300.0f;
 	m_elevatedObstaclePointHeightThreshold = 10.0f;
@@ -46,12 +49,21 @@ void SpatialPartitioningComponent::DrawComponentDebug() const
 		ImGui::Text("m_flyingArgusEntityKDTree");
 		ImGui::TableNextColumn();
 		ImGui::TableNextColumn();
+		ImGui::Text("m_avoidanceGroupUnionFind");
+		ImGui::TableNextColumn();
+		ImGui::TableNextColumn();
+		ImGui::Text("m_entityRoleIndex");
+		ImGui::TableNextColumn();
+		ImGui::TableNextColumn();
 		ImGui::Text("m_obstaclePointKDTree");
 		ImGui::TableNextColumn();
 		ImGui::TableNextColumn();
 		ImGui::Text("m_obstacles");
 		ImGui::TableNextColumn();
 		ImGui::TableNextColumn();
+		ImGui::Text("m_placementOccupancyGrid");
+		ImGui::TableNextColumn();
+		ImGui::TableNextColumn();
 		ImGui::Text("m_validSpaceExtent");
 		ImGui::TableNextColumn();
 		ImGui::Text("%.2f", m_validSpaceExtent);
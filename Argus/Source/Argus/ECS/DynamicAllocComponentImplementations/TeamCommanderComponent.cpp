@@ -20,7 +20,17 @@ void TeamCommanderComponent::Reset()
 	m_priorities.Reset();
 	m_availableAbilityRecordIds.Reset();
 	m_revealedAreas.Reset();
+	m_influenceMap.Reset();
+	m_scoutingDistanceField.Reset();
 	m_revealedAreaDimensionLength = 800.0f;
+	m_updateIntervalSeconds = 0.25f;
+	m_updateEntityBudget = 1024;
+	m_updatePhase = ETeamCommanderUpdatePhase::Idle;
+	m_gatherInfoResumeEntityId = 0;
+	m_timeUntilNextUpdate = 0.0f;
+	m_timeSinceLastUpdate = 0.0f;
+	m_lastUpdateSliceMicroseconds = 0.0f;
+	m_slowUpdateSliceCount = 0u;
 	m_teamToCommand = ETeam::None;
 	m_allies = 0u;
 	m_enemies = 0u;
@@ -30,6 +40,8 @@ void TeamCommanderComponent::Serialize(FArchive& archive)
 {
 	m_revealedAreas.Serialize(archive);
 	archive << m_revealedAreaDimensionLength;
+	archive << m_updateIntervalSeconds;
+	archive << m_updateEntityBudget;
 	archive << m_teamToCommand;
 	archive << m_allies;
 	archive << m_enemies;
@@ -138,10 +150,49 @@ void TeamCommanderComponent::DrawComponentDebug() const
 		ImGui::Text("m_revealedAreas");
 		ImGui::TableNextColumn();
 		ImGui::TableNextColumn();
+		ImGui::Text("m_influenceMap");
+		ImGui::TableNextColumn();
+		ImGui::TableNextColumn();
+		ImGui::Text("m_scoutingDistanceField");
+		ImGui::TableNextColumn();
+		ImGui::TableNextColumn();
 		ImGui::Text("m_revealedAreaDimensionLength");
 		ImGui::TableNextColumn();
 		ImGui::Text("%.2f", m_revealedAreaDimensionLength);
 		ImGui::TableNextColumn();
+		ImGui::Text("m_updateIntervalSeconds");
+		ImGui::TableNextColumn();
+		ImGui::Text("%.2f", m_updateIntervalSeconds);
+		ImGui::TableNextColumn();
+		ImGui::Text("m_updateEntityBudget");
+		ImGui::TableNextColumn();
+		ImGui::Text("%d", m_updateEntityBudget);
+		ImGui::TableNextColumn();
+		ImGui::Text("m_updatePhase");
+		ImGui::TableNextColumn();
+		const char* valueName_m_updatePhase = ARGUS_FSTRING_TO_CHAR(StaticEnum<ETeamCommanderUpdatePhase>()->GetNameStringByValue(static_cast<uint8>(m_updatePhase)));
+		ImGui::Text(valueName_m_updatePhase);
+		ImGui::TableNextColumn();
+		ImGui::Text("m_gatherInfoResumeEntityId");
+		ImGui::TableNextColumn();
+		ImGui::Text("%d", m_gatherInfoResumeEntityId);
+		ImGui::TableNextColumn();
+		ImGui::Text("m_timeUntilNextUpdate");
+		ImGui::TableNextColumn();
+		ImGui::Text("%.2f", m_timeUntilNextUpdate);
+		ImGui::TableNextColumn();
+		ImGui::Text("m_timeSinceLastUpdate");
+		ImGui::TableNextColumn();
+		ImGui::Text("%.2f", m_timeSinceLastUpdate);
+		ImGui::TableNextColumn();
+		ImGui::Text("m_lastUpdateSliceMicroseconds");
+		ImGui::TableNextColumn();
+		ImGui::Text("%.2f", m_lastUpdateSliceMicroseconds);
+		ImGui::TableNextColumn();
+		ImGui::Text("m_slowUpdateSliceCount");
+		ImGui::TableNextColumn();
+		ImGui::Text("%u", m_slowUpdateSliceCount);
+		ImGui::TableNextColumn();
 		ImGui::Text("m_teamToCommand");
 		ImGui::TableNextColumn();
 		const char* valueName_m_teamToCommand = ARGUS_FSTRING_TO_CHAR(StaticEnum<ETeam>()->GetNameStringByValue(static_cast<uint8>(m_teamToCommand)));
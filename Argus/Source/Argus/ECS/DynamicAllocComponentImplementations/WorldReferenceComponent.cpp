@@ -15,10 +15,18 @@
 void WorldReferenceComponent::Reset()
 {
 	m_worldPointer = nullptr;
+	m_simulationFrameIndex = 0u;
+	m_timerTick = 0u;
+	m_timerTickRemainderSeconds = 0.0f;
+	m_randomStream.Reset();
+	m_timingWheel.Reset();
 }
 
 void WorldReferenceComponent::Serialize(FArchive& archive)
 {
+	archive << m_timerTick;
+	archive << m_timerTickRemainderSeconds;
+	m_randomStream.Serialize(archive);
 }
 
 void WorldReferenceComponent::DrawComponentDebug() const
@@ -34,6 +42,24 @@ void WorldReferenceComponent::DrawComponentDebug() const
 		ImGui::TableNextColumn();
 		ImGui::Text("m_worldPointer");
 		ImGui::TableNextColumn();
+		ImGui::TableNextColumn();
+		ImGui::Text("m_simulationFrameIndex");
+		ImGui::TableNextColumn();
+		ImGui::Text("%u", m_simulationFrameIndex);
+		ImGui::TableNextColumn();
+		ImGui::Text("m_timerTick");
+		ImGui::TableNextColumn();
+		ImGui::Text("%u", m_timerTick);
+		ImGui::TableNextColumn();
+		ImGui::Text("m_timerTickRemainderSeconds");
+		ImGui::TableNextColumn();
+		ImGui::Text("%.2f", m_timerTickRemainderSeconds);
+		ImGui::TableNextColumn();
+		ImGui::Text("m_randomStream");
+		ImGui::TableNextColumn();
+		ImGui::TableNextColumn();
+		ImGui::Text("m_timingWheel");
+		ImGui::TableNextColumn();
 		ImGui::EndTable();
 	}
 #endif //!UE_BUILD_SHIPPING
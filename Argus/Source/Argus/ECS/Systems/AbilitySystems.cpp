@@ -5,6 +5,7 @@
 #include "ArgusIterators.h"
 #include "ArgusLogging.h"
 #include "ArgusStaticData.h"
+#include "ArgusStaticRecordTable.h"
 #include "ComponentDependencies/SpawnEntityInfo.h"
 #include "DataComponentDefinitions/ResourceComponentData.h"
 #include "DataComponentDefinitions/TransformComponentData.h"
@@ -301,13 +302,13 @@ void AbilitySystems::ProcessAbilityRefundRequests(const AbilitySystemsArgs& comp
 		return;
 	}
 
-	const UAbilityRecord* abilityRecord = ArgusStaticData::GetRecord<UAbilityRecord>(components.m_abilityComponent->m_abilityToRefundId);
+	const AbilityRecordData* abilityRecord = ArgusStaticRecordTable<UAbilityRecord>::Get(components.m_abilityComponent->m_abilityToRefundId);
 	ARGUS_RETURN_ON_NULL(abilityRecord, ArgusECSLog);
 
 	const FResourceSet refund = -abilityRecord->m_requiredResourceChangeToCast;
 	if (!ResourceSystems::ApplyTeamResourceChangeIfAffordable(components.m_entity, refund))
 	{
-		ARGUS_LOG(ArgusECSLog, Error, TEXT("[%s] Successfully refunded ability id %d, but could not afford the refund???"), ARGUS_FUNCNAME, abilityRecord->m_id);
+		ARGUS_LOG(ArgusECSLog, Error, TEXT("[%s] Successfully refunded ability id %d, but could not afford the refund???"), ARGUS_FUNCNAME, components.m_abilityComponent->m_abilityToRefundId);
 	}
 
 	components.m_abilityComponent->m_abilityToRefundId = 0u;
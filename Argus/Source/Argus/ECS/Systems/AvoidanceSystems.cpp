@@ -8,6 +8,7 @@
 #include "NavigationSystem.h"
 #include "Systems/CombatSystems.h"
 #include "Systems/FlockingSystems.h"
+#include "Systems/LODSystems.h"
 #include "Systems/TargetingSystems.h"
 #include "Systems/TransformSystems.h"
 #include <limits>
@@ -33,6 +34,18 @@ void AvoidanceSystems::RunSystems(UWorld* worldPointer, float deltaTime)
 			return;
 		}
 
+		if (IsInSleepingAvoidanceGroup(components.m_entity))
+		{
+			return;
+		}
+
+		// Entities at a reduced simulation LOD keep moving along their last proposed avoidance velocity on the frames they skip. That velocity is still integrated
+		// every frame, so the collision cutoff uses the per frame step rather than the time accumulated since the last update.
+		if (!LODSystems::ShouldUpdateSimulationThisFrame(components.m_entity))
+		{
+			return;
+		}
+
 		const NearbyEntitiesComponent* nearbyEntitiesComponent = components.m_entity.GetComponent<NearbyEntitiesComponent>();
 		if (!nearbyEntitiesComponent)
 		{
@@ -64,6 +77,8 @@ void AvoidanceSystems::ProcessORCAvoidance(UWorld* worldPointer, float deltaTime
 
 	SpatialPartitioningComponent* spatialPartitioningComponent = singletonEntity.GetComponent<SpatialPartitioningComponent>();
 	ARGUS_RETURN_ON_NULL(spatialPartitioningComponent, ArgusECSLog);
+	const WorldReferenceComponent* worldReferenceComponent = singletonEntity.GetComponent<WorldReferenceComponent>();
+	ARGUS_RETURN_ON_NULL(worldReferenceComponent, ArgusECSLog);
 
 	bool shouldShowAvoidanceDebug = false;
 
@@ -85,7 +100,7 @@ void AvoidanceSystems::ProcessORCAvoidance(UWorld* worldPointer, float deltaTime
 	params.m_sourceEntityLocation3D = components.m_transformComponent->m_location;
 	params.m_sourceEntityLocation = ArgusMath::ToCartesianVector2(FVector2D(params.m_sourceEntityLocation3D));
 
-	const NearbyObstaclesComponent* nearbyObstaclesComponent = components.m_entity.GetComponent<NearbyObstaclesComponent>();
+	NearbyObstaclesComponent* nearbyObstaclesComponent = components.m_entity.GetComponent<NearbyObstaclesComponent>();
 	if (nearbyObstaclesComponent)
 	{
 		params.m_hasObstacles = nearbyObstaclesComponent->m_obstacleIndicies.AnyObstacleInidiciesInAvoidanceRange();
@@ -105,6 +120,8 @@ void AvoidanceSystems::ProcessORCAvoidance(UWorld* worldPointer, float deltaTime
 	params.m_adjacentObstacleRange = GetAvoidanceRange(components.m_entity, AvoidanceRange::Obstacle, obstaclePredictionTime);
 
 	params.m_spatialPartitioningComponent = spatialPartitioningComponent;
+	params.m_randomStream = &worldReferenceComponent->m_randomStream;
+	params.m_sourceEntityId = components.m_entity.GetId();
 
 	// If no entities nearby, then nothing can effect our navigation, so we should just early out with a desired velocity.
 	if (!shouldShowAvoidanceDebug && nearbyEntitiesComponent->GetNearbyEntities(components.m_taskComponent->m_flightState != EFlightState::Grounded).GetEntityIdsInAvoidanceRange().IsEmpty())
@@ -115,7 +132,7 @@ void AvoidanceSystems::ProcessORCAvoidance(UWorld* worldPointer, float deltaTime
 
 	// Generate ORCA lines for grounded entities.
 	// TODO JAMES: Create a component cached calculatedORCALines array to reduce allocation?
-	TArray<ORCALine> calculatedORCALines;
+	ORCALineBatch calculatedORCALines;
 	if (params.m_hasObstacles)
 	{
 		CreateObstacleORCALines(worldPointer, params, components, nearbyObstaclesComponent, calculatedORCALines);
@@ -208,6 +225,48 @@ void AvoidanceSystems::DecrementIdleEntitiesInGroup(ArgusEntity entity)
 	}
 }
 
+bool AvoidanceSystems::IsInSleepingAvoidanceGroup(ArgusEntity entity)
+{
+	ArgusEntity groupLeader = GetAvoidanceGroupLeader(entity);
+	if (!groupLeader)
+	{
+		return false;
+	}
+
+	const AvoidanceGroupingComponent* groupingComponent = groupLeader.GetComponent<AvoidanceGroupingComponent>();
+	if (!groupingComponent || !groupingComponent->m_isGroupSleeping)
+	{
+		return false;
+	}
+
+	// An entity that just received a command is no longer idle, so it should update even before the group is re-evaluated.
+	return entity.IsIdle();
+}
+
+void AvoidanceSystems::WakeAvoidanceGroup(ArgusEntity entity)
+{
+	if (!entity)
+	{
+		return;
+	}
+
+	if (AvoidanceGroupingComponent* groupingComponent = entity.GetComponent<AvoidanceGroupingComponent>())
+	{
+		groupingComponent->m_numberOfSettledFrames = 0u;
+	}
+
+	ArgusEntity groupLeader = GetAvoidanceGroupLeader(entity);
+	if (!groupLeader)
+	{
+		return;
+	}
+
+	if (AvoidanceGroupingComponent* groupLeaderGroupingComponent = groupLeader.GetComponent<AvoidanceGroupingComponent>())
+	{
+		groupLeaderGroupingComponent->m_isGroupSleeping = false;
+	}
+}
+
 TOptional<FVector> AvoidanceSystems::GetAvoidanceGroupDestinationLocation(const TransformSystemsArgs& components)
 {
 	if (!components.AreComponentsValidCheck(ARGUS_FUNCNAME))
@@ -344,7 +403,7 @@ float AvoidanceSystems::GetAvoidanceRange(ArgusEntity entity, AvoidanceRange avo
 	return GetAvoidanceRange(entity, avoidanceRange, GetAvoidancePredictionTime(entity, avoidanceRange));
 }
 
-void AvoidanceSystems::CreateObstacleORCALines(UWorld* worldPointer, const CreateEntityORCALinesParams& params, const TransformSystemsArgs& components, const NearbyObstaclesComponent* nearbyObstaclesComponent,  TArray<ORCALine>& outORCALines)
+void AvoidanceSystems::CreateObstacleORCALines(UWorld* worldPointer, const CreateEntityORCALinesParams& params, const TransformSystemsArgs& components, NearbyObstaclesComponent* nearbyObstaclesComponent, ORCALineBatch& outORCALines)
 {
 	const GlobalSettingsComponent* settings = ArgusEntity::GetSingletonEntity().GetComponent<GlobalSettingsComponent>();
 	ARGUS_RETURN_ON_NULL(settings, ArgusECSLog);
@@ -353,6 +412,21 @@ void AvoidanceSystems::CreateObstacleORCALines(UWorld* worldPointer, const Creat
 		return;
 	}
 
+	bool shouldShowAvoidanceDebug = false;
+#if !UE_BUILD_SHIPPING
+	shouldShowAvoidanceDebug = ArgusECSDebugger::ShouldShowAvoidanceDebugForEntity(components.m_entity.GetId());
+#endif //!UE_BUILD_SHIPPING
+
+	// Static obstacles never move after load, so the lines only change when the nearby obstacle set or our own (quantized) motion does.
+	// Debug drawing needs the per point data, so always recalculate while it is enabled.
+	ObstacleORCALinesCacheKey cacheKey;
+	PopulateObstacleORCALinesCacheKey(params, nearbyObstaclesComponent, cacheKey);
+	if (!shouldShowAvoidanceDebug && TryGetCachedObstacleORCALines(nearbyObstaclesComponent, cacheKey, outORCALines))
+	{
+		return;
+	}
+
+	const int32 startingLine = outORCALines.Num();
 	const TArray<ObstacleIndicies, ArgusContainerAllocator<20u> >& obstacleIndicies = nearbyObstaclesComponent->m_obstacleIndicies.GetObstacleIndiciesInAvoidanceRange();
 	for (int32 i = 0; i < obstacleIndicies.Num(); ++i)
 	{
@@ -382,15 +456,65 @@ void AvoidanceSystems::CreateObstacleORCALines(UWorld* worldPointer, const Creat
 #endif //!UE_BUILD_SHIPPING
 	}
 
+	CacheObstacleORCALines(nearbyObstaclesComponent, cacheKey, outORCALines, startingLine);
+
 #if !UE_BUILD_SHIPPING
-	if (worldPointer && ArgusECSDebugger::ShouldShowAvoidanceDebugForEntity(components.m_entity.GetId()))
+	if (worldPointer && shouldShowAvoidanceDebug)
 	{
 		DrawORCADebugLines(worldPointer, params, outORCALines, true, 0);
 	}
 #endif //!UE_BUILD_SHIPPING
 }
 
-void AvoidanceSystems::CreateEntityORCALines(const CreateEntityORCALinesParams& params, const TransformSystemsArgs& components, const NearbyEntitiesComponent* nearbyEntitiesComponent, TArray<ORCALine>& outORCALines, FVector2D& outDesiredVelocity)
+void AvoidanceSystems::PopulateObstacleORCALinesCacheKey(const CreateEntityORCALinesParams& params, const NearbyObstaclesComponent* nearbyObstaclesComponent, ObstacleORCALinesCacheKey& outCacheKey)
+{
+	ARGUS_RETURN_ON_NULL(nearbyObstaclesComponent, ArgusECSLog);
+
+	outCacheKey.Populate
+	(
+		params.m_sourceEntityLocation3D,
+		params.m_sourceEntityVelocity,
+		params.m_entityRadius,
+		params.m_inverseObstaclePredictionTime,
+		nearbyObstaclesComponent->m_obstacleIndicies.GetObstacleIndiciesInAvoidanceRange()
+	);
+}
+
+bool AvoidanceSystems::TryGetCachedObstacleORCALines(const NearbyObstaclesComponent* nearbyObstaclesComponent, const ObstacleORCALinesCacheKey& cacheKey, ORCALineBatch& outORCALines)
+{
+	if (!nearbyObstaclesComponent || !nearbyObstaclesComponent->m_hasCachedObstacleORCALines || nearbyObstaclesComponent->m_cachedObstacleORCALinesKey != cacheKey)
+	{
+		return false;
+	}
+
+	ORCALine line;
+	for (int32 i = 0; i < nearbyObstaclesComponent->m_cachedObstacleORCALinePoints.Num(); ++i)
+	{
+		line.m_point = nearbyObstaclesComponent->m_cachedObstacleORCALinePoints[i];
+		line.m_direction = nearbyObstaclesComponent->m_cachedObstacleORCALineDirections[i];
+		outORCALines.Add(line);
+	}
+
+	return true;
+}
+
+void AvoidanceSystems::CacheObstacleORCALines(NearbyObstaclesComponent* nearbyObstaclesComponent, const ObstacleORCALinesCacheKey& cacheKey, const ORCALineBatch& orcaLines, int32 startingLine)
+{
+	ARGUS_RETURN_ON_NULL(nearbyObstaclesComponent, ArgusECSLog);
+
+	nearbyObstaclesComponent->m_cachedObstacleORCALinePoints.Reset();
+	nearbyObstaclesComponent->m_cachedObstacleORCALineDirections.Reset();
+	for (int32 i = startingLine; i < orcaLines.Num(); ++i)
+	{
+		nearbyObstaclesComponent->m_cachedObstacleORCALinePoints.Add(orcaLines.GetPoint(i));
+		nearbyObstaclesComponent->m_cachedObstacleORCALineDirections.Add(orcaLines.GetDirection(i));
+	}
+
+	nearbyObstaclesComponent->m_cachedObstacleORCALinesKey = cacheKey;
+	nearbyObstaclesComponent->m_hasCachedObstacleORCALines = true;
+}
+
+void AvoidanceSystems::CreateEntityORCALines(const CreateEntityORCALinesParams& params, const TransformSystemsArgs& components, const NearbyEntitiesComponent* nearbyEntitiesComponent, ORCALineBatch& outORCALines, FVector2D& outDesiredVelocity)
 {
 	if (!components.AreComponentsValidCheck(ARGUS_FUNCNAME))
 	{
@@ -405,6 +529,8 @@ void AvoidanceSystems::CreateEntityORCALines(const CreateEntityORCALinesParams&
 
 	const AvoidanceGroupingComponent* sourceGroupingComponent = components.m_entity.GetComponent<AvoidanceGroupingComponent>();
 	const bool isGrounded = components.m_taskComponent->m_flightState == EFlightState::Grounded;
+
+	ORCANeighborBatch neighbors;
 	for (int32 i = 0; i < nearbyEntitiesComponent->GetNearbyEntities(!isGrounded).GetEntityIdsInAvoidanceRange().Num(); ++i)
 	{
 		ArgusEntity foundEntity = ArgusEntity::RetrieveEntity(nearbyEntitiesComponent->GetNearbyEntities(!isGrounded).GetEntityIdsInAvoidanceRange()[i]);
@@ -424,280 +550,28 @@ void AvoidanceSystems::CreateEntityORCALines(const CreateEntityORCALinesParams&
 			continue;
 		}
 
-		CreateEntityORCALinesParamsPerEntity perEntityParams;
 		const AvoidanceGroupingComponent* foundGroupingComponent = foundEntity.GetComponent<AvoidanceGroupingComponent>();
-		if (sourceGroupingComponent && foundGroupingComponent && sourceGroupingComponent->m_groupId == foundGroupingComponent->m_groupId)
-		{
-			perEntityParams.m_inSameAvoidanceGroup = true;
-		}
+		const bool inSameAvoidanceGroup = sourceGroupingComponent && foundGroupingComponent && sourceGroupingComponent->m_groupId == foundGroupingComponent->m_groupId;
 
-		const float effortCoefficient = GetEffortCoefficientForEntityPair(effortSettings, components, foundEntity, sourceGroupingComponent, foundGroupingComponent, params.m_hasObstacles, perEntityParams.m_inSameAvoidanceGroup);
+		const float effortCoefficient = GetEffortCoefficientForEntityPair(effortSettings, components, foundEntity, sourceGroupingComponent, foundGroupingComponent, params.m_hasObstacles, inSameAvoidanceGroup);
 		if (effortCoefficient == 0.0f)
 		{
 			continue;
 		}
 
-		perEntityParams.m_foundEntityLocation = ArgusMath::ToCartesianVector2(FVector2D(foundTransformComponent->m_location));
-		perEntityParams.m_inverseEntityPredictionTime = params.m_inverseEntityPredictionTime;
-
+		FVector2D foundEntityVelocity = FVector2D::ZeroVector;
 		if (const VelocityComponent* foundVelocityComponent = foundEntity.GetComponent<VelocityComponent>())
 		{
-			perEntityParams.m_foundEntityVelocity = ArgusMath::ToCartesianVector2(foundVelocityComponent->m_currentVelocity);
+			foundEntityVelocity = ArgusMath::ToCartesianVector2(foundVelocityComponent->m_currentVelocity);
 		}
-		else
-		{
-			perEntityParams.m_foundEntityVelocity = FVector2D::ZeroVector;
-		}
-		
-		perEntityParams.m_entityRadius = foundTransformComponent->m_radius;
-
-		FVector2D velocityToBoundaryOfVO = FVector2D::ZeroVector;
-		ORCALine calculatedORCALine;
-
-		if (!FindORCALineAndVelocityToBoundaryPerEntity(params, perEntityParams, velocityToBoundaryOfVO, calculatedORCALine))
-		{
-			continue;
-		}
-		
-		calculatedORCALine.m_point = params.m_sourceEntityVelocity + (velocityToBoundaryOfVO * effortCoefficient);
-
-#if !UE_BUILD_SHIPPING
-		calculatedORCALine.m_instigatingEntityId = foundEntity.GetId();
-#endif //!UE_BUILD_SHIPPING
 
-		outORCALines.Add(calculatedORCALine);
+		const FVector2D relativeLocation = ArgusMath::ToCartesianVector2(FVector2D(foundTransformComponent->m_location)) - params.m_sourceEntityLocation;
+		const FVector2D relativeVelocity = params.m_sourceEntityVelocity - foundEntityVelocity;
+		neighbors.Add(relativeLocation, relativeVelocity, params.m_entityRadius + foundTransformComponent->m_radius, effortCoefficient, foundEntity.GetId());
 	}
-}
-
-bool AvoidanceSystems::FindORCALineAndVelocityToBoundaryPerEntity(const CreateEntityORCALinesParams& params, const CreateEntityORCALinesParamsPerEntity& perEntityParams, FVector2D& velocityToBoundaryOfVO, ORCALine& calculatedORCALine)
-{
-	ARGUS_TRACE(AvoidanceSystems::FindORCALineAndVelocityToBoundaryPerEntity);
-
-	const FVector2D relativeLocation = perEntityParams.m_foundEntityLocation - params.m_sourceEntityLocation;
-	const FVector2D relativeVelocity = params.m_sourceEntityVelocity - perEntityParams.m_foundEntityVelocity;
-	const float relativeLocationDistanceSquared = relativeLocation.SquaredLength();
-	const float combinedRadius = params.m_entityRadius + perEntityParams.m_entityRadius;
-	const float combinedRadiusSquared = FMath::Square(combinedRadius);
-
-	if (relativeLocationDistanceSquared > combinedRadiusSquared)
-	{
-		// No collision yet.
-		const FVector2D cutoffCenterToRelativeVelocity = relativeVelocity - (perEntityParams.m_inverseEntityPredictionTime * relativeLocation);
-		const float cutoffCenterToRelativeVelocityLengthSqared = cutoffCenterToRelativeVelocity.SquaredLength();
-		const float dotProduct = cutoffCenterToRelativeVelocity.Dot(relativeLocation);
 
-		if ((dotProduct < 0.0f) && (cutoffCenterToRelativeVelocityLengthSqared > FMath::Square(ArgusECSConstants::k_avoidanceEpsilonValue)) && (FMath::Square(dotProduct) > (combinedRadiusSquared * cutoffCenterToRelativeVelocityLengthSqared)))
-		{
-			const float cutoffCenterToRelativeVelocityLength = FMath::Sqrt(cutoffCenterToRelativeVelocityLengthSqared);
-			const FVector2D unitCutoffCenterToRelativeVelocity = cutoffCenterToRelativeVelocity / cutoffCenterToRelativeVelocityLength;
-			calculatedORCALine.m_direction = FVector2D(unitCutoffCenterToRelativeVelocity.Y, -unitCutoffCenterToRelativeVelocity.X);
-			velocityToBoundaryOfVO = ((combinedRadius * perEntityParams.m_inverseEntityPredictionTime) - cutoffCenterToRelativeVelocityLength) * unitCutoffCenterToRelativeVelocity;
-		}
-		else
-		{
-			const float leg = FMath::Sqrt(relativeLocationDistanceSquared - combinedRadiusSquared);
-			const float legDeterminant = ArgusMath::Determinant(relativeLocation, cutoffCenterToRelativeVelocity);
-			if (legDeterminant > ArgusECSConstants::k_avoidanceEpsilonValue)
-			{
-				calculatedORCALine.m_direction = FVector2D((relativeLocation.X * leg) - (relativeLocation.Y * combinedRadius),
-					(relativeLocation.X * combinedRadius) + (relativeLocation.Y * leg));
-			}
-			else
-			{
-				calculatedORCALine.m_direction = -FVector2D((relativeLocation.X * leg) + (relativeLocation.Y * combinedRadius),
-					(-relativeLocation.X * combinedRadius) + (relativeLocation.Y * leg));
-			}
-			calculatedORCALine.m_direction /= relativeLocationDistanceSquared;
-			velocityToBoundaryOfVO = (relativeVelocity.Dot(calculatedORCALine.m_direction) * calculatedORCALine.m_direction) - relativeVelocity;
-		}
-	}
-	else
-	{
-		// Collision occurred.
-		const float inverseDeltaTime = 1.0f / params.m_deltaTime;
-
-		const FVector2D cutoffCenterToRelativeVelocity = relativeVelocity - (inverseDeltaTime * relativeLocation);
-		const float lengthCutoffCenterToRelativeVelocity = cutoffCenterToRelativeVelocity.Length();
-
-		if (FMath::IsNearlyZero(lengthCutoffCenterToRelativeVelocity))
-		{
-			// In this case, we just gotta nudge the fella into a random direction by setting a random ORCA line.
-			// TODO JAMES: Not entirely sold this is the best way to do the nudge.
-			calculatedORCALine.m_direction = FVector2D(FMath::FRand(), FMath::FRand()).GetSafeNormal();
-			velocityToBoundaryOfVO = FVector2D::ZeroVector;
-		}
-		else
-		{
-			const FVector2D normalizedCutoffCenterToRelativeVelocity = ArgusMath::SafeDivide(cutoffCenterToRelativeVelocity, lengthCutoffCenterToRelativeVelocity);
-			calculatedORCALine.m_direction = FVector2D(normalizedCutoffCenterToRelativeVelocity.Y, -normalizedCutoffCenterToRelativeVelocity.X);
-			velocityToBoundaryOfVO = ((combinedRadius * inverseDeltaTime) - lengthCutoffCenterToRelativeVelocity) * normalizedCutoffCenterToRelativeVelocity;
-		}
-	}
-
-	return true;
-}
-
-bool AvoidanceSystems::OneDimensionalLinearProgram(const TArray<ORCALine>& orcaLines, const float radius, const FVector2D& preferredVelocity, bool shouldOptimizeDirection, const int32 lineIndex, FVector2D& resultingVelocity)
-{
-	ARGUS_TRACE(AvoidanceSystems::OneDimensionalLinearProgram);
-
-	const float dotProduct = orcaLines[lineIndex].m_point.Dot(orcaLines[lineIndex].m_direction);
-	const float discriminant = FMath::Square(dotProduct) + FMath::Square(radius) - orcaLines[lineIndex].m_point.SquaredLength();
-
-	if (discriminant < 0.0f)
-	{
-		return false;
-	}
-
-	const float sqrtDiscriminant = FMath::Sqrt(discriminant);
-	float tLeft = -dotProduct - sqrtDiscriminant;
-	float tRight = -dotProduct + sqrtDiscriminant;
-
-	for (int32 i = 0; i < lineIndex; ++i)
-	{
-		const float denominator = ArgusMath::Determinant(orcaLines[lineIndex].m_direction, orcaLines[i].m_direction);
-		const float numerator = ArgusMath::Determinant(orcaLines[i].m_direction, orcaLines[lineIndex].m_point - orcaLines[i].m_point);
-
-		if (FMath::IsNearlyZero(denominator, ArgusECSConstants::k_avoidanceEpsilonValue))
-		{
-			if (numerator < 0.0f)
-			{
-				return false;
-			}
-
-			continue;
-		}
-
-		const float t = numerator / denominator;
-
-		if (denominator >= 0.0f)
-		{
-			tRight = FMath::Min(tRight, t);
-		}
-		else
-		{
-			tLeft = FMath::Max(tLeft, t);
-		}
-
-		if (tLeft > tRight)
-		{
-			return false;
-		}
-	}
-
-	if (shouldOptimizeDirection)
-	{
-		if (preferredVelocity.Dot(orcaLines[lineIndex].m_direction) > 0.0f)
-		{
-			resultingVelocity = orcaLines[lineIndex].m_point + (tRight * orcaLines[lineIndex].m_direction);
-		}
-		else
-		{
-			resultingVelocity = orcaLines[lineIndex].m_point + (tLeft * orcaLines[lineIndex].m_direction);
-		}
-	}
-	else
-	{
-		const float t = orcaLines[lineIndex].m_direction.Dot((preferredVelocity - orcaLines[lineIndex].m_point));
-		if (t < tLeft)
-		{
-			resultingVelocity = orcaLines[lineIndex].m_point + (tLeft * orcaLines[lineIndex].m_direction);
-		}
-		else if (t > tRight)
-		{
-			resultingVelocity = orcaLines[lineIndex].m_point + (tRight * orcaLines[lineIndex].m_direction);
-		}
-		else
-		{
-			resultingVelocity = orcaLines[lineIndex].m_point + (t * orcaLines[lineIndex].m_direction);
-		}
-	}
-
-	return true;
-}
-
-bool AvoidanceSystems::TwoDimensionalLinearProgram(const TArray<ORCALine>& orcaLines, const float radius, const FVector2D& preferredVelocity, bool shouldOptimizeDirection, FVector2D& resultingVelocity, int32& failureLine)
-{
-	ARGUS_TRACE(AvoidanceSystems::TwoDimensionalLinearProgram);
-
-	if (shouldOptimizeDirection)
-	{
-		resultingVelocity = preferredVelocity * radius;
-	}
-	else if (preferredVelocity.SquaredLength() > FMath::Square(radius))
-	{
-		resultingVelocity = preferredVelocity.GetSafeNormal() * radius;
-	}
-	else
-	{
-		resultingVelocity = preferredVelocity;
-	}
-
-	for (int32 i = 0; i < orcaLines.Num(); ++i)
-	{
-		if (ArgusMath::Determinant(orcaLines[i].m_direction, orcaLines[i].m_point - resultingVelocity) > 0.0f)
-		{
-			const FVector2D cachedResultingVelocity = resultingVelocity;
-			if (!OneDimensionalLinearProgram(orcaLines, radius, preferredVelocity, shouldOptimizeDirection, i, resultingVelocity))
-			{
-				resultingVelocity = cachedResultingVelocity;
-				failureLine = i;
-				return false;
-			}
-		}
-	}
-
-	failureLine = -1;
-	return true;
-}
-
-void AvoidanceSystems::ThreeDimensionalLinearProgram(const TArray<ORCALine>& orcaLines, const float radius, const int32 lineIndex, const int numStaticObstacleORCALines, FVector2D& resultingVelocity)
-{
-	ARGUS_MEMORY_TRACE(ArgusAvoidanceSystems);
-
-	float distance = 0.0f;
-
-	for (int32 i = lineIndex; i < orcaLines.Num(); ++i)
-	{
-		if (ArgusMath::Determinant(orcaLines[i].m_direction, (orcaLines[i].m_point - resultingVelocity)) <= distance)
-		{
-			continue;
-		}
-
-		TArray<ORCALine> projectedLines;
-		projectedLines.Append(&orcaLines[0], numStaticObstacleORCALines);
-
-		for (int32 j = numStaticObstacleORCALines; j < i; ++j)
-		{
-			ORCALine orcaLine;
-			const float determinant = ArgusMath::Determinant(orcaLines[i].m_direction, orcaLines[j].m_direction);
-			if (FMath::IsNearlyZero(determinant, ArgusECSConstants::k_avoidanceEpsilonValue))
-			{
-				if (orcaLines[i].m_direction.Dot(orcaLines[j].m_direction) > 0.0f)
-				{
-					continue;
-				}
-
-				orcaLine.m_point = 0.5f * (orcaLines[i].m_point + orcaLines[j].m_point);
-			}
-			else
-			{
-				orcaLine.m_point = orcaLines[i].m_point + ((ArgusMath::Determinant(orcaLines[j].m_direction, orcaLines[i].m_point - orcaLines[j].m_point) / determinant) * orcaLines[i].m_direction);
-			}
-
-			orcaLine.m_direction = (orcaLines[j].m_direction - orcaLines[i].m_direction).GetSafeNormal();
-			projectedLines.Add(orcaLine);
-		}
-
-		const FVector2D cachedResultingVelocity = resultingVelocity;
-		int32 failureLine = -1;
-		if (!TwoDimensionalLinearProgram(projectedLines, radius, FVector2D(-orcaLines[i].m_direction.Y, orcaLines[i].m_direction.X), true, resultingVelocity, failureLine))
-		{
-			resultingVelocity = cachedResultingVelocity;
-		}
-
-		distance = ArgusMath::Determinant(orcaLines[i].m_direction, orcaLines[i].m_point - resultingVelocity);
-	}
+	// Construct every ORCA line for the gathered neighbors at once.
+	CalculateEntityORCALines(params, neighbors, outORCALines);
 }
 
 FVector2D AvoidanceSystems::GetDesiredVelocity(const TransformSystemsArgs& components, bool isInRangeOfObstacles)
@@ -813,24 +687,15 @@ float AvoidanceSystems::FindAreaOfObstacleCartesian(const TArray<ObstaclePoint>&
 	return area;
 }
 
-void AvoidanceSystems::CalculateORCALineForObstacleSegment(const CreateEntityORCALinesParams& params, ObstaclePoint obstaclePoint0, ObstaclePoint obstaclePoint1, const FVector2D& previousObstaclePointDir, TArray<ORCALine>& outORCALines)
+void AvoidanceSystems::CalculateORCALineForObstacleSegment(const CreateEntityORCALinesParams& params, ObstaclePoint obstaclePoint0, ObstaclePoint obstaclePoint1, const FVector2D& previousObstaclePointDir, ORCALineBatch& outORCALines)
 {
 	const FVector2D relativeLocation0 = obstaclePoint0.m_point - params.m_sourceEntityLocation;
 	const FVector2D relativeLocation1 = obstaclePoint1.m_point - params.m_sourceEntityLocation;
 
 	// Check if the velocity obstacle of the obstacle is already covered by existing ORCA lines.
-	for (int32 i = 0; i < outORCALines.Num(); ++i)
+	if (AreObstaclePointsCoveredByORCALines(outORCALines, params.m_inverseObstaclePredictionTime * relativeLocation0, params.m_inverseObstaclePredictionTime * relativeLocation1, params.m_inverseObstaclePredictionTime * params.m_entityRadius))
 	{
-		const float determinant0 = ArgusMath::Determinant((params.m_inverseObstaclePredictionTime * relativeLocation0) - outORCALines[i].m_point, outORCALines[i].m_direction);
-		const float determinant1 = ArgusMath::Determinant((params.m_inverseObstaclePredictionTime * relativeLocation1) - outORCALines[i].m_point, outORCALines[i].m_direction);
-		const float scaledRadius = params.m_inverseObstaclePredictionTime * params.m_entityRadius;
-		const bool point0Check = (determinant0 - scaledRadius) >= -ArgusECSConstants::k_avoidanceEpsilonValue;
-		const bool point1Check = (determinant1 - scaledRadius) >= -ArgusECSConstants::k_avoidanceEpsilonValue;
-
-		if (point0Check && point1Check)
-		{
-			return;
-		}
+		return;
 	}
 
 	const float squaredDistance0 = relativeLocation0.SquaredLength();
@@ -1050,7 +915,7 @@ void AvoidanceSystems::CalculateORCALineForObstacleSegment(const CreateEntityORC
 }
 
 #if !UE_BUILD_SHIPPING
-void AvoidanceSystems::DrawORCADebugLines(UWorld* worldPointer, const CreateEntityORCALinesParams& params, const TArray<ORCALine>& orcaLines, bool areObstacleLines, int32 startingLine)
+void AvoidanceSystems::DrawORCADebugLines(UWorld* worldPointer, const CreateEntityORCALinesParams& params, const ORCALineBatch& orcaLines, bool areObstacleLines, int32 startingLine)
 {
 	if (!worldPointer)
 	{
@@ -1065,8 +930,8 @@ void AvoidanceSystems::DrawORCADebugLines(UWorld* worldPointer, const CreateEnti
 
 	for (int32 i = startingLine; i < orcaLines.Num(); ++i)
 	{
-		const FVector worldspacePoint = basisTransform.TransformPosition(FVector(ArgusMath::ToUnrealVector2(orcaLines[i].m_point), 0.0f));
-		const FVector worldspaceDirection = basisTransform.TransformVector(FVector(ArgusMath::ToUnrealVector2(orcaLines[i].m_direction), 0.0f));
+		const FVector worldspacePoint = basisTransform.TransformPosition(FVector(ArgusMath::ToUnrealVector2(orcaLines.GetPoint(i)), 0.0f));
+		const FVector worldspaceDirection = basisTransform.TransformVector(FVector(ArgusMath::ToUnrealVector2(orcaLines.GetDirection(i)), 0.0f));
 		const FVector worldspaceOrthogonalDirectionScaled = worldspaceDirection.Cross(FVector::UpVector) * 1000.0f;
 
 		DrawDebugSphere(worldPointer, worldspacePoint, 10.0f, 10u, debugColor, false, -1.0f, 0u, ArgusECSConstants::k_debugDrawLineWidth);
@@ -1074,9 +939,9 @@ void AvoidanceSystems::DrawORCADebugLines(UWorld* worldPointer, const CreateEnti
 		DrawDebugLine(worldPointer, worldspacePoint, worldspacePoint + (worldspaceDirection * -100.0f), FColor::Green, false, -1.0f, 0u, ArgusECSConstants::k_debugDrawLineWidth);
 		DrawDebugLine(worldPointer, worldspacePoint - worldspaceOrthogonalDirectionScaled, worldspacePoint + worldspaceOrthogonalDirectionScaled, debugColor, false, -1.0f, 0u, ArgusECSConstants::k_debugDrawLineWidth);
 	
-		if (orcaLines[i].m_instigatingEntityId != ArgusECSConstants::k_maxEntities)
+		if (orcaLines.m_instigatingEntityIds[i] != ArgusECSConstants::k_maxEntities)
 		{
-			DrawDebugString(worldPointer, worldspacePoint, FString::Printf(TEXT("%d"), orcaLines[i].m_instigatingEntityId), nullptr, debugColor, 0.0f, true, 1.0f);
+			DrawDebugString(worldPointer, worldspacePoint, FString::Printf(TEXT("%d"), orcaLines.m_instigatingEntityIds[i]), nullptr, debugColor, 0.0f, true, 1.0f);
 		}
 	}
 }
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "ComponentDependencies/ArgusRandomStream.h"
 #include "ComponentDependencies/ObstaclePoint.h"
 #include "SystemArgumentDefinitions/TransformSystemsArgs.h"
 
@@ -22,6 +23,8 @@ public:
 	static ArgusEntity			GetAvoidanceGroupLeader(ArgusEntity entity);
 	static bool					AreInSameAvoidanceGroup(ArgusEntity entity, ArgusEntity otherEntity);
 	static void					DecrementIdleEntitiesInGroup(ArgusEntity entity);
+	static bool					IsInSleepingAvoidanceGroup(ArgusEntity entity);
+	static void					WakeAvoidanceGroup(ArgusEntity entity);
 	static TOptional<FVector>	GetAvoidanceGroupDestinationLocation(const TransformSystemsArgs& components);
 	static TOptional<FVector>	GetAvoidanceGroupSourceLocation(const TransformSystemsArgs& components);
 	static FVector2D			GetFlockingVelocity(const TransformSystemsArgs& components);
@@ -78,23 +81,70 @@ private:
 		float m_adjacentEntityRange = 150.0f;
 		float m_adjacentObstacleRange = 150.0f;
 		SpatialPartitioningComponent* m_spatialPartitioningComponent = nullptr;
+		const ArgusRandomStream* m_randomStream = nullptr;
+		uint16 m_sourceEntityId = ArgusECSConstants::k_maxEntities;
 		bool m_hasObstacles = false;
 	};
-	struct CreateEntityORCALinesParamsPerEntity
+	// Structure of arrays storage for ORCA lines. Every array is padded with zeroed lanes out to a multiple of k_vectorWidth so that the
+	// linear program kernels can always load full, aligned vector registers.
+	struct ORCALineBatch
 	{
-		FVector2D m_foundEntityLocation = FVector2D::ZeroVector;
-		FVector2D m_foundEntityVelocity = FVector2D::ZeroVector;
-		float m_entityRadius = 45.0f;
-		float m_inverseEntityPredictionTime = 0.0f;
-		bool  m_inSameAvoidanceGroup = false;
+		static constexpr int32 k_vectorWidth = 4;
+
+		void		Reset();
+		void		Add(const ORCALine& orcaLine);
+		void		AppendRange(const ORCALineBatch& other, int32 count);
+		ORCALine	Get(int32 index) const;
+		FVector2D	GetPoint(int32 index) const { return FVector2D(m_pointX[index], m_pointY[index]); }
+		FVector2D	GetDirection(int32 index) const { return FVector2D(m_directionX[index], m_directionY[index]); }
+		int32		Num() const { return m_num; }
+		int32		GetPaddedNum() const { return m_pointX.Num(); }
+
+		TArray<float, TAlignedHeapAllocator<16> > m_pointX;
+		TArray<float, TAlignedHeapAllocator<16> > m_pointY;
+		TArray<float, TAlignedHeapAllocator<16> > m_directionX;
+		TArray<float, TAlignedHeapAllocator<16> > m_directionY;
+#if !UE_BUILD_SHIPPING
+		TArray<uint16> m_instigatingEntityIds;
+#endif // !UE_BUILD_SHIPPING
+
+	private:
+		int32 m_num = 0;
+	};
+	// Structure of arrays storage for the per neighbor inputs of entity ORCA line construction. Padded the same way as ORCALineBatch.
+	struct ORCANeighborBatch
+	{
+		void		Reset();
+		void		Add(const FVector2D& relativeLocation, const FVector2D& relativeVelocity, float combinedRadius, float effortCoefficient, uint16 entityId);
+		int32		Num() const { return m_num; }
+		int32		GetPaddedNum() const { return m_relativeLocationX.Num(); }
+
+		TArray<float, TAlignedHeapAllocator<16> > m_relativeLocationX;
+		TArray<float, TAlignedHeapAllocator<16> > m_relativeLocationY;
+		TArray<float, TAlignedHeapAllocator<16> > m_relativeVelocityX;
+		TArray<float, TAlignedHeapAllocator<16> > m_relativeVelocityY;
+		TArray<float, TAlignedHeapAllocator<16> > m_combinedRadius;
+		TArray<float, TAlignedHeapAllocator<16> > m_effortCoefficient;
+#if !UE_BUILD_SHIPPING
+		TArray<uint16> m_entityIds;
+#endif // !UE_BUILD_SHIPPING
+
+	private:
+		int32 m_num = 0;
 	};
 
-	static void			CreateObstacleORCALines(UWorld* worldPointer, const CreateEntityORCALinesParams& params, const TransformSystemsArgs& components, const NearbyObstaclesComponent* nearbyObstaclesComponent, TArray<ORCALine>& outORCALines);
-	static void			CreateEntityORCALines(const CreateEntityORCALinesParams& params, const TransformSystemsArgs& components, const NearbyEntitiesComponent* nearbyEntitiesComponent, TArray<ORCALine>& outORCALines, FVector2D& outDesiredVelocity);
-	static bool			FindORCALineAndVelocityToBoundaryPerEntity(const CreateEntityORCALinesParams& params, const CreateEntityORCALinesParamsPerEntity& perEntityParams, FVector2D& velocityToBoundaryOfVO, ORCALine& orcaLine);
-	static bool			OneDimensionalLinearProgram(const TArray<ORCALine>& orcaLines, const float radius, const FVector2D& preferredVelocity, bool shouldOptimizeDirection, const int32 lineIndex, FVector2D& resultingVelocity);
-	static bool			TwoDimensionalLinearProgram(const TArray<ORCALine>& orcaLines, const float radius, const FVector2D& preferredVelocity, bool shouldOptimizeDirection, FVector2D& resultingVelocity, int32& failureLine);
-	static void			ThreeDimensionalLinearProgram(const TArray<ORCALine>& orcaLines, const float radius, const int32 lineIndex, const int numStaticObstacleORCALines, FVector2D& resultingVelocity);
+	static void			CreateObstacleORCALines(UWorld* worldPointer, const CreateEntityORCALinesParams& params, const TransformSystemsArgs& components, NearbyObstaclesComponent* nearbyObstaclesComponent, ORCALineBatch& outORCALines);
+	static void			PopulateObstacleORCALinesCacheKey(const CreateEntityORCALinesParams& params, const NearbyObstaclesComponent* nearbyObstaclesComponent, ObstacleORCALinesCacheKey& outCacheKey);
+	static bool			TryGetCachedObstacleORCALines(const NearbyObstaclesComponent* nearbyObstaclesComponent, const ObstacleORCALinesCacheKey& cacheKey, ORCALineBatch& outORCALines);
+	static void			CacheObstacleORCALines(NearbyObstaclesComponent* nearbyObstaclesComponent, const ObstacleORCALinesCacheKey& cacheKey, const ORCALineBatch& orcaLines, int32 startingLine);
+	static void			CreateEntityORCALines(const CreateEntityORCALinesParams& params, const TransformSystemsArgs& components, const NearbyEntitiesComponent* nearbyEntitiesComponent, ORCALineBatch& outORCALines, FVector2D& outDesiredVelocity);
+	static void			CalculateEntityORCALines(const CreateEntityORCALinesParams& params, const ORCANeighborBatch& neighbors, ORCALineBatch& outORCALines);
+	static bool			OneDimensionalLinearProgram(const ORCALineBatch& orcaLines, const float radius, const FVector2D& preferredVelocity, bool shouldOptimizeDirection, const int32 lineIndex, FVector2D& resultingVelocity);
+	static bool			TwoDimensionalLinearProgram(const ORCALineBatch& orcaLines, const float radius, const FVector2D& preferredVelocity, bool shouldOptimizeDirection, FVector2D& resultingVelocity, int32& failureLine);
+	static void			ThreeDimensionalLinearProgram(const ORCALineBatch& orcaLines, const float radius, const int32 lineIndex, const int numStaticObstacleORCALines, FVector2D& resultingVelocity);
+	static int32		FindFirstViolatedORCALine(const ORCALineBatch& orcaLines, int32 startIndex, const FVector2D& velocity, float violationThreshold);
+	static bool			AreObstaclePointsCoveredByORCALines(const ORCALineBatch& orcaLines, const FVector2D& scaledRelativeLocation0, const FVector2D& scaledRelativeLocation1, float scaledRadius);
+	static int32		GetValidORCALaneBits(int32 blockStart, int32 fromInclusive, int32 toExclusive);
 	static FVector2D	GetDesiredVelocity(const TransformSystemsArgs& components, bool isInRangeOfObstacles);
 	static FVector		GetDesiredDirection(const TransformSystemsArgs& components, bool isInRangeOfObstacles, const GlobalSettingsComponent* settings);
 
@@ -113,9 +163,9 @@ private:
 	static bool			ShouldReturnObstacleEffortCoefficient(const EffortCoefficientSettingsComponent* settings, const TransformSystemsArgs& sourceEntityComponents, ArgusEntity foundEntity, bool sourceHasObstacles, float& coefficient);
 	static float		FindAreaOfObstacleCartesian(const TArray<ObstaclePoint>& obstaclePoints);
 	
-	static void			CalculateORCALineForObstacleSegment(const CreateEntityORCALinesParams& params, ObstaclePoint obstaclePoint0, ObstaclePoint obstaclePoint1, const FVector2D& previousObstaclePointDir, TArray<ORCALine>& outORCALines);
+	static void			CalculateORCALineForObstacleSegment(const CreateEntityORCALinesParams& params, ObstaclePoint obstaclePoint0, ObstaclePoint obstaclePoint1, const FVector2D& previousObstaclePointDir, ORCALineBatch& outORCALines);
 	
 #if !UE_BUILD_SHIPPING
-	static void			DrawORCADebugLines(UWorld* worldPointer, const CreateEntityORCALinesParams& params, const TArray<ORCALine>& orcaLines, bool areObstacleLines, int32 startingLine);
+	static void			DrawORCADebugLines(UWorld* worldPointer, const CreateEntityORCALinesParams& params, const ORCALineBatch& orcaLines, bool areObstacleLines, int32 startingLine);
 #endif //!UE_BUILD_SHIPPING
 };
\ No newline at end of file
@@ -0,0 +1,486 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "AvoidanceSystems.h"
+#include "ArgusMath.h"
+#include "Math/VectorRegister.h"
+#include <limits>
+
+#pragma region ORCA Batches
+void AvoidanceSystems::ORCALineBatch::Reset()
+{
+	m_pointX.Reset();
+	m_pointY.Reset();
+	m_directionX.Reset();
+	m_directionY.Reset();
+#if !UE_BUILD_SHIPPING
+	m_instigatingEntityIds.Reset();
+#endif // !UE_BUILD_SHIPPING
+	m_num = 0;
+}
+
+void AvoidanceSystems::ORCALineBatch::Add(const ORCALine& orcaLine)
+{
+	if (m_num == m_pointX.Num())
+	{
+		m_pointX.AddZeroed(k_vectorWidth);
+		m_pointY.AddZeroed(k_vectorWidth);
+		m_directionX.AddZeroed(k_vectorWidth);
+		m_directionY.AddZeroed(k_vectorWidth);
+	}
+
+	m_pointX[m_num] = orcaLine.m_point.X;
+	m_pointY[m_num] = orcaLine.m_point.Y;
+	m_directionX[m_num] = orcaLine.m_direction.X;
+	m_directionY[m_num] = orcaLine.m_direction.Y;
+#if !UE_BUILD_SHIPPING
+	m_instigatingEntityIds.Add(orcaLine.m_instigatingEntityId);
+#endif // !UE_BUILD_SHIPPING
+	++m_num;
+}
+
+void AvoidanceSystems::ORCALineBatch::AppendRange(const ORCALineBatch& other, int32 count)
+{
+	const int32 numToAppend = FMath::Min(count, other.Num());
+	for (int32 i = 0; i < numToAppend; ++i)
+	{
+		Add(other.Get(i));
+	}
+}
+
+AvoidanceSystems::ORCALine AvoidanceSystems::ORCALineBatch::Get(int32 index) const
+{
+	ORCALine orcaLine;
+	orcaLine.m_point = GetPoint(index);
+	orcaLine.m_direction = GetDirection(index);
+#if !UE_BUILD_SHIPPING
+	orcaLine.m_instigatingEntityId = m_instigatingEntityIds[index];
+#endif // !UE_BUILD_SHIPPING
+	return orcaLine;
+}
+
+void AvoidanceSystems::ORCANeighborBatch::Reset()
+{
+	m_relativeLocationX.Reset();
+	m_relativeLocationY.Reset();
+	m_relativeVelocityX.Reset();
+	m_relativeVelocityY.Reset();
+	m_combinedRadius.Reset();
+	m_effortCoefficient.Reset();
+#if !UE_BUILD_SHIPPING
+	m_entityIds.Reset();
+#endif // !UE_BUILD_SHIPPING
+	m_num = 0;
+}
+
+void AvoidanceSystems::ORCANeighborBatch::Add(const FVector2D& relativeLocation, const FVector2D& relativeVelocity, float combinedRadius, float effortCoefficient, uint16 entityId)
+{
+	if (m_num == m_relativeLocationX.Num())
+	{
+		m_relativeLocationX.AddZeroed(ORCALineBatch::k_vectorWidth);
+		m_relativeLocationY.AddZeroed(ORCALineBatch::k_vectorWidth);
+		m_relativeVelocityX.AddZeroed(ORCALineBatch::k_vectorWidth);
+		m_relativeVelocityY.AddZeroed(ORCALineBatch::k_vectorWidth);
+		m_combinedRadius.AddZeroed(ORCALineBatch::k_vectorWidth);
+		m_effortCoefficient.AddZeroed(ORCALineBatch::k_vectorWidth);
+	}
+
+	m_relativeLocationX[m_num] = relativeLocation.X;
+	m_relativeLocationY[m_num] = relativeLocation.Y;
+	m_relativeVelocityX[m_num] = relativeVelocity.X;
+	m_relativeVelocityY[m_num] = relativeVelocity.Y;
+	m_combinedRadius[m_num] = combinedRadius;
+	m_effortCoefficient[m_num] = effortCoefficient;
+#if !UE_BUILD_SHIPPING
+	m_entityIds.Add(entityId);
+#endif // !UE_BUILD_SHIPPING
+	++m_num;
+}
+
+int32 AvoidanceSystems::GetValidORCALaneBits(int32 blockStart, int32 fromInclusive, int32 toExclusive)
+{
+	int32 laneBits = 0;
+	for (int32 lane = 0; lane < ORCALineBatch::k_vectorWidth; ++lane)
+	{
+		const int32 index = blockStart + lane;
+		if (index >= fromInclusive && index < toExclusive)
+		{
+			laneBits |= (1 << lane);
+		}
+	}
+
+	return laneBits;
+}
+#pragma endregion
+
+#pragma region ORCA Kernels
+void AvoidanceSystems::CalculateEntityORCALines(const CreateEntityORCALinesParams& params, const ORCANeighborBatch& neighbors, ORCALineBatch& outORCALines)
+{
+	ARGUS_TRACE(AvoidanceSystems::CalculateEntityORCALines);
+
+	const VectorRegister4Float zero = VectorZeroFloat();
+	const VectorRegister4Float nearlyZero = VectorSetFloat1(UE_SMALL_NUMBER);
+	const VectorRegister4Float epsilon = VectorSetFloat1(ArgusECSConstants::k_avoidanceEpsilonValue);
+	const VectorRegister4Float epsilonSquared = VectorSetFloat1(FMath::Square(ArgusECSConstants::k_avoidanceEpsilonValue));
+	const VectorRegister4Float inverseEntityPredictionTime = VectorSetFloat1(params.m_inverseEntityPredictionTime);
+	const VectorRegister4Float inverseDeltaTime = VectorSetFloat1(1.0f / params.m_deltaTime);
+	const VectorRegister4Float sourceVelocityX = VectorSetFloat1(params.m_sourceEntityVelocity.X);
+	const VectorRegister4Float sourceVelocityY = VectorSetFloat1(params.m_sourceEntityVelocity.Y);
+
+	alignas(16) float directionX[ORCALineBatch::k_vectorWidth];
+	alignas(16) float directionY[ORCALineBatch::k_vectorWidth];
+	alignas(16) float pointX[ORCALineBatch::k_vectorWidth];
+	alignas(16) float pointY[ORCALineBatch::k_vectorWidth];
+
+	for (int32 blockStart = 0; blockStart < neighbors.GetPaddedNum(); blockStart += ORCALineBatch::k_vectorWidth)
+	{
+		const VectorRegister4Float relativeLocationX = VectorLoadAligned(neighbors.m_relativeLocationX.GetData() + blockStart);
+		const VectorRegister4Float relativeLocationY = VectorLoadAligned(neighbors.m_relativeLocationY.GetData() + blockStart);
+		const VectorRegister4Float relativeVelocityX = VectorLoadAligned(neighbors.m_relativeVelocityX.GetData() + blockStart);
+		const VectorRegister4Float relativeVelocityY = VectorLoadAligned(neighbors.m_relativeVelocityY.GetData() + blockStart);
+		const VectorRegister4Float combinedRadius = VectorLoadAligned(neighbors.m_combinedRadius.GetData() + blockStart);
+		const VectorRegister4Float effortCoefficient = VectorLoadAligned(neighbors.m_effortCoefficient.GetData() + blockStart);
+
+		const VectorRegister4Float relativeLocationDistanceSquared = VectorMultiplyAdd(relativeLocationX, relativeLocationX, VectorMultiply(relativeLocationY, relativeLocationY));
+		const VectorRegister4Float combinedRadiusSquared = VectorMultiply(combinedRadius, combinedRadius);
+		const VectorRegister4Float isColliding = VectorCompareLE(relativeLocationDistanceSquared, combinedRadiusSquared);
+
+		// No collision yet, project on the cutoff circle.
+		const VectorRegister4Float cutoffCenterToRelativeVelocityX = VectorNegateMultiplyAdd(inverseEntityPredictionTime, relativeLocationX, relativeVelocityX);
+		const VectorRegister4Float cutoffCenterToRelativeVelocityY = VectorNegateMultiplyAdd(inverseEntityPredictionTime, relativeLocationY, relativeVelocityY);
+		const VectorRegister4Float cutoffLengthSquared = VectorMultiplyAdd(cutoffCenterToRelativeVelocityX, cutoffCenterToRelativeVelocityX, VectorMultiply(cutoffCenterToRelativeVelocityY, cutoffCenterToRelativeVelocityY));
+		const VectorRegister4Float dotProduct = VectorMultiplyAdd(cutoffCenterToRelativeVelocityX, relativeLocationX, VectorMultiply(cutoffCenterToRelativeVelocityY, relativeLocationY));
+		const VectorRegister4Float shouldProjectOnCutoff = VectorBitwiseAnd
+		(
+			VectorBitwiseAnd(VectorCompareLT(dotProduct, zero), VectorCompareGT(cutoffLengthSquared, epsilonSquared)),
+			VectorCompareGT(VectorMultiply(dotProduct, dotProduct), VectorMultiply(combinedRadiusSquared, cutoffLengthSquared))
+		);
+
+		const VectorRegister4Float cutoffLength = VectorSqrt(VectorMax(cutoffLengthSquared, nearlyZero));
+		const VectorRegister4Float unitCutoffX = VectorDivide(cutoffCenterToRelativeVelocityX, cutoffLength);
+		const VectorRegister4Float unitCutoffY = VectorDivide(cutoffCenterToRelativeVelocityY, cutoffLength);
+		const VectorRegister4Float cutoffBoundaryScale = VectorSubtract(VectorMultiply(combinedRadius, inverseEntityPredictionTime), cutoffLength);
+
+		// No collision yet, project on the closer leg.
+		const VectorRegister4Float leg = VectorSqrt(VectorMax(VectorSubtract(relativeLocationDistanceSquared, combinedRadiusSquared), zero));
+		const VectorRegister4Float legDeterminant = VectorNegateMultiplyAdd(relativeLocationY, cutoffCenterToRelativeVelocityX, VectorMultiply(relativeLocationX, cutoffCenterToRelativeVelocityY));
+		const VectorRegister4Float isLeftLeg = VectorCompareGT(legDeterminant, epsilon);
+		const VectorRegister4Float inverseDistanceSquared = VectorDivide(VectorOneFloat(), VectorMax(relativeLocationDistanceSquared, nearlyZero));
+
+		const VectorRegister4Float leftLegX = VectorNegateMultiplyAdd(relativeLocationY, combinedRadius, VectorMultiply(relativeLocationX, leg));
+		const VectorRegister4Float leftLegY = VectorMultiplyAdd(relativeLocationX, combinedRadius, VectorMultiply(relativeLocationY, leg));
+		const VectorRegister4Float rightLegX = VectorNegate(VectorMultiplyAdd(relativeLocationX, leg, VectorMultiply(relativeLocationY, combinedRadius)));
+		const VectorRegister4Float rightLegY = VectorNegateMultiplyAdd(relativeLocationY, leg, VectorMultiply(relativeLocationX, combinedRadius));
+		const VectorRegister4Float legDirectionX = VectorMultiply(VectorSelect(isLeftLeg, leftLegX, rightLegX), inverseDistanceSquared);
+		const VectorRegister4Float legDirectionY = VectorMultiply(VectorSelect(isLeftLeg, leftLegY, rightLegY), inverseDistanceSquared);
+		const VectorRegister4Float legProjection = VectorMultiplyAdd(relativeVelocityX, legDirectionX, VectorMultiply(relativeVelocityY, legDirectionY));
+		const VectorRegister4Float legBoundaryX = VectorMultiplyAdd(legProjection, legDirectionX, VectorNegate(relativeVelocityX));
+		const VectorRegister4Float legBoundaryY = VectorMultiplyAdd(legProjection, legDirectionY, VectorNegate(relativeVelocityY));
+
+		// Collision occurred, project on the cutoff circle for this frame.
+		const VectorRegister4Float collisionCutoffX = VectorNegateMultiplyAdd(inverseDeltaTime, relativeLocationX, relativeVelocityX);
+		const VectorRegister4Float collisionCutoffY = VectorNegateMultiplyAdd(inverseDeltaTime, relativeLocationY, relativeVelocityY);
+		const VectorRegister4Float collisionCutoffLength = VectorSqrt(VectorMultiplyAdd(collisionCutoffX, collisionCutoffX, VectorMultiply(collisionCutoffY, collisionCutoffY)));
+		const VectorRegister4Float needsNudge = VectorBitwiseAnd(isColliding, VectorCompareLE(collisionCutoffLength, nearlyZero));
+		const VectorRegister4Float safeCollisionCutoffLength = VectorMax(collisionCutoffLength, nearlyZero);
+		const VectorRegister4Float unitCollisionCutoffX = VectorDivide(collisionCutoffX, safeCollisionCutoffLength);
+		const VectorRegister4Float unitCollisionCutoffY = VectorDivide(collisionCutoffY, safeCollisionCutoffLength);
+		const VectorRegister4Float collisionBoundaryScale = VectorSubtract(VectorMultiply(combinedRadius, inverseDeltaTime), collisionCutoffLength);
+
+		// Blend the three cases together. The ORCA line direction is always the boundary direction rotated clockwise.
+		const VectorRegister4Float noCollisionUnitX = VectorSelect(shouldProjectOnCutoff, unitCutoffX, zero);
+		const VectorRegister4Float noCollisionUnitY = VectorSelect(shouldProjectOnCutoff, unitCutoffY, zero);
+		const VectorRegister4Float noCollisionDirectionX = VectorSelect(shouldProjectOnCutoff, unitCutoffY, legDirectionX);
+		const VectorRegister4Float noCollisionDirectionY = VectorSelect(shouldProjectOnCutoff, VectorNegate(unitCutoffX), legDirectionY);
+		const VectorRegister4Float noCollisionBoundaryX = VectorSelect(shouldProjectOnCutoff, VectorMultiply(cutoffBoundaryScale, noCollisionUnitX), legBoundaryX);
+		const VectorRegister4Float noCollisionBoundaryY = VectorSelect(shouldProjectOnCutoff, VectorMultiply(cutoffBoundaryScale, noCollisionUnitY), legBoundaryY);
+
+		const VectorRegister4Float orcaDirectionX = VectorSelect(isColliding, unitCollisionCutoffY, noCollisionDirectionX);
+		const VectorRegister4Float orcaDirectionY = VectorSelect(isColliding, VectorNegate(unitCollisionCutoffX), noCollisionDirectionY);
+		const VectorRegister4Float velocityToBoundaryX = VectorSelect(isColliding, VectorMultiply(collisionBoundaryScale, unitCollisionCutoffX), noCollisionBoundaryX);
+		const VectorRegister4Float velocityToBoundaryY = VectorSelect(isColliding, VectorMultiply(collisionBoundaryScale, unitCollisionCutoffY), noCollisionBoundaryY);
+
+		VectorStoreAligned(orcaDirectionX, directionX);
+		VectorStoreAligned(orcaDirectionY, directionY);
+		VectorStoreAligned(VectorMultiplyAdd(velocityToBoundaryX, effortCoefficient, sourceVelocityX), pointX);
+		VectorStoreAligned(VectorMultiplyAdd(velocityToBoundaryY, effortCoefficient, sourceVelocityY), pointY);
+
+		const int32 validLaneBits = GetValidORCALaneBits(blockStart, 0, neighbors.Num());
+		const int32 nudgeLaneBits = VectorMaskBits(needsNudge) & validLaneBits;
+		for (int32 lane = 0; lane < ORCALineBatch::k_vectorWidth; ++lane)
+		{
+			if ((validLaneBits & (1 << lane)) == 0)
+			{
+				continue;
+			}
+
+			ORCALine calculatedORCALine;
+			if ((nudgeLaneBits & (1 << lane)) != 0)
+			{
+				// In this case, we just gotta nudge the fella into a random direction by setting a random ORCA line.
+				// TODO JAMES: Not entirely sold this is the best way to do the nudge.
+				// Avoidance runs in parallel, so the nudge draws from a stream derived from the entity and neighbor rather than from the shared one.
+				const FRandomStream nudgeStream = params.m_randomStream ? params.m_randomStream->MakeDerivedStream(params.m_sourceEntityId, blockStart + lane) : FRandomStream(0);
+				calculatedORCALine.m_direction = FVector2D(nudgeStream.FRand(), nudgeStream.FRand()).GetSafeNormal();
+				calculatedORCALine.m_point = params.m_sourceEntityVelocity;
+			}
+			else
+			{
+				calculatedORCALine.m_direction = FVector2D(directionX[lane], directionY[lane]);
+				calculatedORCALine.m_point = FVector2D(pointX[lane], pointY[lane]);
+			}
+
+#if !UE_BUILD_SHIPPING
+			calculatedORCALine.m_instigatingEntityId = neighbors.m_entityIds[blockStart + lane];
+#endif //!UE_BUILD_SHIPPING
+
+			outORCALines.Add(calculatedORCALine);
+		}
+	}
+}
+
+int32 AvoidanceSystems::FindFirstViolatedORCALine(const ORCALineBatch& orcaLines, int32 startIndex, const FVector2D& velocity, float violationThreshold)
+{
+	if (startIndex >= orcaLines.Num())
+	{
+		return INDEX_NONE;
+	}
+
+	const VectorRegister4Float velocityX = VectorSetFloat1(velocity.X);
+	const VectorRegister4Float velocityY = VectorSetFloat1(velocity.Y);
+	const VectorRegister4Float threshold = VectorSetFloat1(violationThreshold);
+
+	for (int32 blockStart = startIndex - (startIndex % ORCALineBatch::k_vectorWidth); blockStart < orcaLines.Num(); blockStart += ORCALineBatch::k_vectorWidth)
+	{
+		const VectorRegister4Float directionX = VectorLoadAligned(orcaLines.m_directionX.GetData() + blockStart);
+		const VectorRegister4Float directionY = VectorLoadAligned(orcaLines.m_directionY.GetData() + blockStart);
+		const VectorRegister4Float toPointX = VectorSubtract(VectorLoadAligned(orcaLines.m_pointX.GetData() + blockStart), velocityX);
+		const VectorRegister4Float toPointY = VectorSubtract(VectorLoadAligned(orcaLines.m_pointY.GetData() + blockStart), velocityY);
+
+		// Determinant of the line direction and the line point relative to the velocity. Positive means the velocity is outside of the half plane.
+		const VectorRegister4Float determinant = VectorNegateMultiplyAdd(directionY, toPointX, VectorMultiply(directionX, toPointY));
+		const int32 violatedLaneBits = VectorMaskBits(VectorCompareGT(determinant, threshold)) & GetValidORCALaneBits(blockStart, startIndex, orcaLines.Num());
+		if (violatedLaneBits != 0)
+		{
+			return blockStart + FMath::CountTrailingZeros(static_cast<uint32>(violatedLaneBits));
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+bool AvoidanceSystems::AreObstaclePointsCoveredByORCALines(const ORCALineBatch& orcaLines, const FVector2D& scaledRelativeLocation0, const FVector2D& scaledRelativeLocation1, float scaledRadius)
+{
+	const VectorRegister4Float location0X = VectorSetFloat1(scaledRelativeLocation0.X);
+	const VectorRegister4Float location0Y = VectorSetFloat1(scaledRelativeLocation0.Y);
+	const VectorRegister4Float location1X = VectorSetFloat1(scaledRelativeLocation1.X);
+	const VectorRegister4Float location1Y = VectorSetFloat1(scaledRelativeLocation1.Y);
+	const VectorRegister4Float minimumDeterminant = VectorSetFloat1(scaledRadius - ArgusECSConstants::k_avoidanceEpsilonValue);
+
+	for (int32 blockStart = 0; blockStart < orcaLines.Num(); blockStart += ORCALineBatch::k_vectorWidth)
+	{
+		const VectorRegister4Float directionX = VectorLoadAligned(orcaLines.m_directionX.GetData() + blockStart);
+		const VectorRegister4Float directionY = VectorLoadAligned(orcaLines.m_directionY.GetData() + blockStart);
+		const VectorRegister4Float pointX = VectorLoadAligned(orcaLines.m_pointX.GetData() + blockStart);
+		const VectorRegister4Float pointY = VectorLoadAligned(orcaLines.m_pointY.GetData() + blockStart);
+
+		const VectorRegister4Float determinant0 = VectorNegateMultiplyAdd(VectorSubtract(location0Y, pointY), directionX, VectorMultiply(VectorSubtract(location0X, pointX), directionY));
+		const VectorRegister4Float determinant1 = VectorNegateMultiplyAdd(VectorSubtract(location1Y, pointY), directionX, VectorMultiply(VectorSubtract(location1X, pointX), directionY));
+		const VectorRegister4Float isCovered = VectorBitwiseAnd(VectorCompareGE(determinant0, minimumDeterminant), VectorCompareGE(determinant1, minimumDeterminant));
+		if ((VectorMaskBits(isCovered) & GetValidORCALaneBits(blockStart, 0, orcaLines.Num())) != 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+#pragma endregion
+
+#pragma region Linear Programs
+bool AvoidanceSystems::OneDimensionalLinearProgram(const ORCALineBatch& orcaLines, const float radius, const FVector2D& preferredVelocity, bool shouldOptimizeDirection, const int32 lineIndex, FVector2D& resultingVelocity)
+{
+	ARGUS_TRACE(AvoidanceSystems::OneDimensionalLinearProgram);
+
+	const FVector2D linePoint = orcaLines.GetPoint(lineIndex);
+	const FVector2D lineDirection = orcaLines.GetDirection(lineIndex);
+	const float dotProduct = linePoint.Dot(lineDirection);
+	const float discriminant = FMath::Square(dotProduct) + FMath::Square(radius) - linePoint.SquaredLength();
+
+	if (discriminant < 0.0f)
+	{
+		return false;
+	}
+
+	const float sqrtDiscriminant = FMath::Sqrt(discriminant);
+	float tLeft = -dotProduct - sqrtDiscriminant;
+	float tRight = -dotProduct + sqrtDiscriminant;
+
+	// Clip the line parameter range against every previous line. tLeft only ever grows and tRight only ever shrinks, so it is equivalent to reduce across
+	// all previous lines and then test for an empty range once.
+	const VectorRegister4Float zero = VectorZeroFloat();
+	const VectorRegister4Float epsilon = VectorSetFloat1(ArgusECSConstants::k_avoidanceEpsilonValue);
+	const VectorRegister4Float positiveInfinity = VectorSetFloat1(std::numeric_limits<float>::infinity());
+	const VectorRegister4Float negativeInfinity = VectorSetFloat1(-std::numeric_limits<float>::infinity());
+	const VectorRegister4Float laneIndices = MakeVectorRegisterFloat(0.0f, 1.0f, 2.0f, 3.0f);
+	const VectorRegister4Float linePointX = VectorSetFloat1(linePoint.X);
+	const VectorRegister4Float linePointY = VectorSetFloat1(linePoint.Y);
+	const VectorRegister4Float lineDirectionX = VectorSetFloat1(lineDirection.X);
+	const VectorRegister4Float lineDirectionY = VectorSetFloat1(lineDirection.Y);
+	VectorRegister4Float tLeftVector = VectorSetFloat1(tLeft);
+	VectorRegister4Float tRightVector = VectorSetFloat1(tRight);
+
+	for (int32 blockStart = 0; blockStart < lineIndex; blockStart += ORCALineBatch::k_vectorWidth)
+	{
+		const VectorRegister4Float directionX = VectorLoadAligned(orcaLines.m_directionX.GetData() + blockStart);
+		const VectorRegister4Float directionY = VectorLoadAligned(orcaLines.m_directionY.GetData() + blockStart);
+		const VectorRegister4Float pointX = VectorLoadAligned(orcaLines.m_pointX.GetData() + blockStart);
+		const VectorRegister4Float pointY = VectorLoadAligned(orcaLines.m_pointY.GetData() + blockStart);
+
+		const VectorRegister4Float denominator = VectorNegateMultiplyAdd(lineDirectionY, directionX, VectorMultiply(lineDirectionX, directionY));
+		const VectorRegister4Float numerator = VectorNegateMultiplyAdd(directionY, VectorSubtract(linePointX, pointX), VectorMultiply(directionX, VectorSubtract(linePointY, pointY)));
+		const VectorRegister4Float validLanes = VectorCompareLT(laneIndices, VectorSetFloat1(static_cast<float>(lineIndex - blockStart)));
+		const VectorRegister4Float isParallel = VectorCompareLE(VectorAbs(denominator), epsilon);
+
+		if (VectorMaskBits(VectorBitwiseAnd(validLanes, VectorBitwiseAnd(isParallel, VectorCompareLT(numerator, zero)))) != 0)
+		{
+			return false;
+		}
+
+		const VectorRegister4Float t = VectorDivide(numerator, VectorSelect(isParallel, VectorOneFloat(), denominator));
+		const VectorRegister4Float constrainingLanes = VectorSelect(isParallel, zero, validLanes);
+		const VectorRegister4Float rightLanes = VectorBitwiseAnd(constrainingLanes, VectorCompareGE(denominator, zero));
+		const VectorRegister4Float leftLanes = VectorSelect(rightLanes, zero, constrainingLanes);
+
+		tRightVector = VectorMin(tRightVector, VectorSelect(rightLanes, t, positiveInfinity));
+		tLeftVector = VectorMax(tLeftVector, VectorSelect(leftLanes, t, negativeInfinity));
+	}
+
+	alignas(16) float tLeftLanes[ORCALineBatch::k_vectorWidth];
+	alignas(16) float tRightLanes[ORCALineBatch::k_vectorWidth];
+	VectorStoreAligned(tLeftVector, tLeftLanes);
+	VectorStoreAligned(tRightVector, tRightLanes);
+	for (int32 lane = 0; lane < ORCALineBatch::k_vectorWidth; ++lane)
+	{
+		tLeft = FMath::Max(tLeft, tLeftLanes[lane]);
+		tRight = FMath::Min(tRight, tRightLanes[lane]);
+	}
+
+	if (tLeft > tRight)
+	{
+		return false;
+	}
+
+	if (shouldOptimizeDirection)
+	{
+		if (preferredVelocity.Dot(lineDirection) > 0.0f)
+		{
+			resultingVelocity = linePoint + (tRight * lineDirection);
+		}
+		else
+		{
+			resultingVelocity = linePoint + (tLeft * lineDirection);
+		}
+	}
+	else
+	{
+		const float t = lineDirection.Dot((preferredVelocity - linePoint));
+		if (t < tLeft)
+		{
+			resultingVelocity = linePoint + (tLeft * lineDirection);
+		}
+		else if (t > tRight)
+		{
+			resultingVelocity = linePoint + (tRight * lineDirection);
+		}
+		else
+		{
+			resultingVelocity = linePoint + (t * lineDirection);
+		}
+	}
+
+	return true;
+}
+
+bool AvoidanceSystems::TwoDimensionalLinearProgram(const ORCALineBatch& orcaLines, const float radius, const FVector2D& preferredVelocity, bool shouldOptimizeDirection, FVector2D& resultingVelocity, int32& failureLine)
+{
+	ARGUS_TRACE(AvoidanceSystems::TwoDimensionalLinearProgram);
+
+	if (shouldOptimizeDirection)
+	{
+		resultingVelocity = preferredVelocity * radius;
+	}
+	else if (preferredVelocity.SquaredLength() > FMath::Square(radius))
+	{
+		resultingVelocity = preferredVelocity.GetSafeNormal() * radius;
+	}
+	else
+	{
+		resultingVelocity = preferredVelocity;
+	}
+
+	for (int32 i = FindFirstViolatedORCALine(orcaLines, 0, resultingVelocity, 0.0f); i != INDEX_NONE; i = FindFirstViolatedORCALine(orcaLines, i + 1, resultingVelocity, 0.0f))
+	{
+		const FVector2D cachedResultingVelocity = resultingVelocity;
+		if (!OneDimensionalLinearProgram(orcaLines, radius, preferredVelocity, shouldOptimizeDirection, i, resultingVelocity))
+		{
+			resultingVelocity = cachedResultingVelocity;
+			failureLine = i;
+			return false;
+		}
+	}
+
+	failureLine = -1;
+	return true;
+}
+
+void AvoidanceSystems::ThreeDimensionalLinearProgram(const ORCALineBatch& orcaLines, const float radius, const int32 lineIndex, const int numStaticObstacleORCALines, FVector2D& resultingVelocity)
+{
+	ARGUS_MEMORY_TRACE(ArgusAvoidanceSystems);
+
+	float distance = 0.0f;
+	ORCALineBatch projectedLines;
+
+	for (int32 i = FindFirstViolatedORCALine(orcaLines, lineIndex, resultingVelocity, distance); i != INDEX_NONE; i = FindFirstViolatedORCALine(orcaLines, i + 1, resultingVelocity, distance))
+	{
+		const FVector2D lineDirection = orcaLines.GetDirection(i);
+		const FVector2D linePoint = orcaLines.GetPoint(i);
+
+		projectedLines.Reset();
+		projectedLines.AppendRange(orcaLines, numStaticObstacleORCALines);
+
+		for (int32 j = numStaticObstacleORCALines; j < i; ++j)
+		{
+			const FVector2D otherDirection = orcaLines.GetDirection(j);
+			const FVector2D otherPoint = orcaLines.GetPoint(j);
+
+			ORCALine orcaLine;
+			const float determinant = ArgusMath::Determinant(lineDirection, otherDirection);
+			if (FMath::IsNearlyZero(determinant, ArgusECSConstants::k_avoidanceEpsilonValue))
+			{
+				if (lineDirection.Dot(otherDirection) > 0.0f)
+				{
+					continue;
+				}
+
+				orcaLine.m_point = 0.5f * (linePoint + otherPoint);
+			}
+			else
+			{
+				orcaLine.m_point = linePoint + ((ArgusMath::Determinant(otherDirection, linePoint - otherPoint) / determinant) * lineDirection);
+			}
+
+			orcaLine.m_direction = (otherDirection - lineDirection).GetSafeNormal();
+			projectedLines.Add(orcaLine);
+		}
+
+		const FVector2D cachedResultingVelocity = resultingVelocity;
+		int32 failureLine = -1;
+		if (!TwoDimensionalLinearProgram(projectedLines, radius, FVector2D(-lineDirection.Y, lineDirection.X), true, resultingVelocity, failureLine))
+		{
+			resultingVelocity = cachedResultingVelocity;
+		}
+
+		distance = ArgusMath::Determinant(lineDirection, linePoint - resultingVelocity);
+	}
+}
+#pragma endregion
@@ -2,21 +2,60 @@
 
 #include "CombatSystems.h"
 #include "ArgusIterators.h"
+#include "Algo/StableSort.h"
+#include "Systems/AvoidanceSystems.h"
+#include "Systems/SpatialPartitioningSystems.h"
 #include "Systems/TargetingSystems.h"
 
 void CombatSystems::RunSystems(float deltaTime)
 {
 	ARGUS_TRACE(CombatSystems::RunSystems);
 
-	ArgusIterators::IterateSystemsArgs<CombatSystemsArgs>([deltaTime](CombatSystemsArgs& components)
+	// Attackers only read other entities and write to their own components, so they can run in parallel. Everything that touches a victim is deferred to
+	// ProcessDamageEvents, which runs single threaded once all of the attacks for the frame are known.
+	TArray<DamageEvent> damageEventBuffers[k_numDamageEventBuffers];
+	ArgusIterators::IterateSystemsArgsParallelWithChunkIndex<CombatSystemsArgs, k_numDamageEventBuffers>([deltaTime, &damageEventBuffers](CombatSystemsArgs& components, uint8 chunkIndex)
 	{
 		if ((components.m_entity.IsKillable() && !components.m_entity.IsAlive()) || components.m_entity.IsPassenger())
 		{
 			return;
 		}
 
-		ProcessCombatTaskCommands(deltaTime, components);
+		ProcessCombatTaskCommands(deltaTime, components, damageEventBuffers[chunkIndex]);
 	});
+
+	// Chunks cover ascending entity id ranges, so appending them in order keeps the event order deterministic for replays.
+	TArray<DamageEvent>& damageEvents = damageEventBuffers[0];
+	for (uint8 i = 1u; i < k_numDamageEventBuffers; ++i)
+	{
+		damageEvents.Append(damageEventBuffers[i]);
+	}
+
+	ProcessDamageEvents(damageEvents);
+}
+
+void CombatSystems::ProcessDamageEvents(TArray<DamageEvent>& damageEvents)
+{
+	ARGUS_TRACE(CombatSystems::ProcessDamageEvents);
+
+	if (damageEvents.IsEmpty())
+	{
+		return;
+	}
+
+	Algo::StableSortBy(damageEvents, &DamageEvent::m_victimEntityId);
+
+	int32 victimStartIndex = 0;
+	for (int32 i = 1; i <= damageEvents.Num(); ++i)
+	{
+		if (i < damageEvents.Num() && damageEvents[i].m_victimEntityId == damageEvents[victimStartIndex].m_victimEntityId)
+		{
+			continue;
+		}
+
+		ApplyDamageEventsToVictim(&damageEvents[victimStartIndex], i - victimStartIndex);
+		victimStartIndex = i;
+	}
 }
 
 bool CombatSystems::CanEntityAttackOtherEntity(ArgusEntity potentialAttacker, ArgusEntity potentialVictim)
@@ -93,7 +132,7 @@ bool CombatSystems::CanAttackFlying(const CombatSystemsArgs& components)
 		(components.m_combatComponent->m_attackType == EAttackType::Ranged && (components.m_combatComponent->m_rangedAttackCapability == ERangedAttackCapability::FlyingOnly || components.m_combatComponent->m_rangedAttackCapability == ERangedAttackCapability::GroundedAndFlying));
 }
 
-void CombatSystems::ProcessCombatTaskCommands(float deltaTime, const CombatSystemsArgs& components)
+void CombatSystems::ProcessCombatTaskCommands(float deltaTime, const CombatSystemsArgs& components, TArray<DamageEvent>& outDamageEvents)
 {
 	ARGUS_TRACE(CombatSystems::ProcessCombatTaskCommands);
 
@@ -108,7 +147,7 @@ void CombatSystems::ProcessCombatTaskCommands(float deltaTime, const CombatSyste
 			break;
 		case ECombatState::DispatchedToAttack:
 		case ECombatState::Attacking:
-			ProcessAttackCommand(deltaTime, components);
+			ProcessAttackCommand(deltaTime, components, outDamageEvents);
 			break;
 		case ECombatState::OnAttackMove:
 			ProcessAttackMoveCommand(deltaTime, components);
@@ -116,7 +155,7 @@ void CombatSystems::ProcessCombatTaskCommands(float deltaTime, const CombatSyste
 	}
 }
 
-void CombatSystems::ProcessAttackCommand(float deltaTime, const CombatSystemsArgs& components)
+void CombatSystems::ProcessAttackCommand(float deltaTime, const CombatSystemsArgs& components, TArray<DamageEvent>& outDamageEvents)
 {
 	ARGUS_TRACE(CombatSystems::ProcessAttackCommand);
 
@@ -163,11 +202,11 @@ void CombatSystems::ProcessAttackCommand(float deltaTime, const CombatSystemsArg
 	components.m_taskComponent->m_combatState = ECombatState::Attacking;
 	if (components.m_combatComponent->m_intervalDurationSeconds > 0.0f)
 	{
-		PerformTimerAttack(targetEntity, components);
+		PerformTimerAttack(targetEntity, components, outDamageEvents);
 	}
 	else
 	{
-		PerformContinuousAttack(deltaTime, targetEntity, components);
+		PerformContinuousAttack(deltaTime, targetEntity, components, outDamageEvents);
 	}
 }
 
@@ -185,7 +224,7 @@ void CombatSystems::ProcessAttackMoveCommand(float deltaTime, const CombatSystem
 	}
 
 	const bool canAttackGrounded = CanAttackGrounded(components);
-	nearbyEntitiesComponent->IterateSeenEntityIds(CanAttackGrounded(components), CanAttackFlying(components), [&components](uint16 targetEntityId) 
+	nearbyEntitiesComponent->IterateNearestHostileEntityIds(CanAttackGrounded(components), CanAttackFlying(components), [&components](uint16 targetEntityId) 
 	{
 		if (!CanEntityAttackOtherEntity(components.m_entity, ArgusEntity::RetrieveEntity(targetEntityId)))
 		{
@@ -199,7 +238,7 @@ void CombatSystems::ProcessAttackMoveCommand(float deltaTime, const CombatSystem
 	});
 }
 
-void CombatSystems::PerformTimerAttack(ArgusEntity targetEntity, const CombatSystemsArgs& components)
+void CombatSystems::PerformTimerAttack(ArgusEntity targetEntity, const CombatSystemsArgs& components, TArray<DamageEvent>& outDamageEvents)
 {
 	if (components.m_combatComponent->m_attackTimerHandle.IsTimerTicking(components.m_entity))
 	{
@@ -213,38 +252,73 @@ void CombatSystems::PerformTimerAttack(ArgusEntity targetEntity, const CombatSys
 
 	if (!CanEntityAttackOtherEntity(components.m_entity, targetEntity))
 	{
-		StopAttackingEntity(components);
+		StopAttackingEntity(components.m_entity);
 	}
 
-	ApplyDamage(components.m_combatComponent->m_baseDamagePerIntervalOrPerSecond, targetEntity, components);
-
-	components.m_combatComponent->m_attackTimerHandle.StartTimer(components.m_entity, components.m_combatComponent->m_intervalDurationSeconds);
+	// Starting the timer schedules it on the shared timing wheel, so the restart is carried by the event and happens in ProcessDamageEvents.
+	EmitDamageEvent(components.m_combatComponent->m_baseDamagePerIntervalOrPerSecond, targetEntity, components, true, outDamageEvents);
 }
 
-void CombatSystems::PerformContinuousAttack(float deltaTime, ArgusEntity targetEntity, const CombatSystemsArgs& components)
+void CombatSystems::PerformContinuousAttack(float deltaTime, ArgusEntity targetEntity, const CombatSystemsArgs& components, TArray<DamageEvent>& outDamageEvents)
 {
 	float amountPerTick = components.m_combatComponent->m_baseDamagePerIntervalOrPerSecond * deltaTime;
 	uint32 damage = FMath::FloorToInt32(amountPerTick);
-	ApplyDamage(damage, targetEntity, components);
+	EmitDamageEvent(damage, targetEntity, components, false, outDamageEvents);
+}
+
+void CombatSystems::EmitDamageEvent(uint32 damageAmount, ArgusEntity targetEntity, const CombatSystemsArgs& components, bool shouldRestartAttackTimer, TArray<DamageEvent>& outDamageEvents)
+{
+	DamageEvent& damageEvent = outDamageEvents.AddDefaulted_GetRef();
+	damageEvent.m_attackerEntityId = components.m_entity.GetId();
+	damageEvent.m_victimEntityId = targetEntity.GetId();
+	damageEvent.m_damageAmount = damageAmount;
+	damageEvent.m_shouldRestartAttackTimer = shouldRestartAttackTimer;
 }
 
-void CombatSystems::ApplyDamage(uint32 damageAmount, ArgusEntity targetEntity, const CombatSystemsArgs& components)
+void CombatSystems::ApplyDamageEventsToVictim(const DamageEvent* victimDamageEvents, int32 numVictimDamageEvents)
 {
-	HealthComponent* targetHealthComponent = targetEntity.GetComponent<HealthComponent>();
+	ARGUS_RETURN_ON_NULL(victimDamageEvents, ArgusECSLog);
+
+	for (int32 i = 0; i < numVictimDamageEvents; ++i)
+	{
+		if (!victimDamageEvents[i].m_shouldRestartAttackTimer)
+		{
+			continue;
+		}
+
+		ArgusEntity attackerEntity = ArgusEntity::RetrieveEntity(victimDamageEvents[i].m_attackerEntityId);
+		if (CombatComponent* attackerCombatComponent = attackerEntity ? attackerEntity.GetComponent<CombatComponent>() : nullptr)
+		{
+			attackerCombatComponent->m_attackTimerHandle.StartTimer(attackerEntity, attackerCombatComponent->m_intervalDurationSeconds);
+		}
+	}
+
+	ArgusEntity targetEntity = ArgusEntity::RetrieveEntity(victimDamageEvents[0].m_victimEntityId);
+	HealthComponent* targetHealthComponent = targetEntity ? targetEntity.GetComponent<HealthComponent>() : nullptr;
 	if (!targetHealthComponent)
 	{
 		return;
 	}
 
-	// The entity has taken lethal damage. "Kill" the entity.
-	if (targetHealthComponent->m_currentHealth <= damageAmount)
+	AvoidanceSystems::WakeAvoidanceGroup(targetEntity);
+
+	uint32 totalDamageAmount = 0u;
+	for (int32 i = 0; i < numVictimDamageEvents; ++i)
 	{
-		KillEntity(targetEntity, targetHealthComponent);
-		StopAttackingEntity(components);
+		totalDamageAmount += victimDamageEvents[i].m_damageAmount;
 	}
-	else
+
+	if (targetHealthComponent->m_currentHealth > totalDamageAmount)
 	{
-		targetHealthComponent->m_currentHealth -= damageAmount;
+		targetHealthComponent->m_currentHealth -= totalDamageAmount;
+		return;
+	}
+
+	// The entity has taken lethal damage. "Kill" the entity and release everyone that was attacking it this frame.
+	KillEntity(targetEntity, targetHealthComponent);
+	for (int32 i = 0; i < numVictimDamageEvents; ++i)
+	{
+		StopAttackingEntity(ArgusEntity::RetrieveEntity(victimDamageEvents[i].m_attackerEntityId));
 	}
 }
 
@@ -262,6 +336,7 @@ void CombatSystems::KillEntity(ArgusEntity targetEntity, HealthComponent* target
 		return;
 	}
 	targetTaskComponent->SetToKillState();
+	SpatialPartitioningSystems::RequestEntityRoleIndexUpdate(targetEntity);
 
 	CarrierComponent* targetCarrierComponent = targetEntity.GetComponent<CarrierComponent>();
 	if (!targetCarrierComponent)
@@ -283,9 +358,16 @@ void CombatSystems::KillEntity(ArgusEntity targetEntity, HealthComponent* target
 	targetCarrierComponent->m_passengerEntityIds.Reset();
 }
 
-void CombatSystems::StopAttackingEntity(const CombatSystemsArgs& components)
+void CombatSystems::StopAttackingEntity(ArgusEntity attackerEntity)
 {
-	components.m_targetingComponent->m_targetEntityId = ArgusECSConstants::k_maxEntities;
-	components.m_taskComponent->m_combatState = ECombatState::None;
-	components.m_taskComponent->m_movementState = EMovementState::None;
+	TargetingComponent* targetingComponent = attackerEntity ? attackerEntity.GetComponent<TargetingComponent>() : nullptr;
+	TaskComponent* taskComponent = attackerEntity ? attackerEntity.GetComponent<TaskComponent>() : nullptr;
+	if (!targetingComponent || !taskComponent)
+	{
+		return;
+	}
+
+	targetingComponent->m_targetEntityId = ArgusECSConstants::k_maxEntities;
+	taskComponent->m_combatState = ECombatState::None;
+	taskComponent->m_movementState = EMovementState::None;
 }
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "ComponentDependencies/CombatInfo.h"
 #include "SystemArgumentDefinitions/CombatSystemsArgs.h"
 
 class CombatSystems
@@ -12,13 +13,18 @@ public:
 	static bool CanAttackGrounded(const CombatSystemsArgs& components);
 	static bool CanAttackFlying(const CombatSystemsArgs& components);
 
+	static void ProcessDamageEvents(TArray<DamageEvent>& damageEvents);
+
 private:
-	static void ProcessCombatTaskCommands(float deltaTime, const CombatSystemsArgs& components);
-	static void ProcessAttackCommand(float deltaTime, const CombatSystemsArgs& components);
+	static constexpr uint8 k_numDamageEventBuffers = 12u;
+
+	static void ProcessCombatTaskCommands(float deltaTime, const CombatSystemsArgs& components, TArray<DamageEvent>& outDamageEvents);
+	static void ProcessAttackCommand(float deltaTime, const CombatSystemsArgs& components, TArray<DamageEvent>& outDamageEvents);
 	static void ProcessAttackMoveCommand(float deltaTime, const CombatSystemsArgs& components);
-	static void PerformTimerAttack(ArgusEntity targetEntity, const CombatSystemsArgs& components);
-	static void PerformContinuousAttack(float deltaTime, ArgusEntity targetEntity, const CombatSystemsArgs& components);
-	static void ApplyDamage(uint32 damageAmount, ArgusEntity targetEntity, const CombatSystemsArgs& components);
+	static void PerformTimerAttack(ArgusEntity targetEntity, const CombatSystemsArgs& components, TArray<DamageEvent>& outDamageEvents);
+	static void PerformContinuousAttack(float deltaTime, ArgusEntity targetEntity, const CombatSystemsArgs& components, TArray<DamageEvent>& outDamageEvents);
+	static void EmitDamageEvent(uint32 damageAmount, ArgusEntity targetEntity, const CombatSystemsArgs& components, bool shouldRestartAttackTimer, TArray<DamageEvent>& outDamageEvents);
+	static void ApplyDamageEventsToVictim(const DamageEvent* victimDamageEvents, int32 numVictimDamageEvents);
 	static void KillEntity(ArgusEntity targetEntity, HealthComponent* targetHealthComponent);
-	static void StopAttackingEntity(const CombatSystemsArgs& components);
+	static void StopAttackingEntity(ArgusEntity attackerEntity);
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "ConstructionSystems.h"
 #include "ArgusIterators.h"
 #include "ArgusLogging.h"
+#include "Systems/SpatialPartitioningSystems.h"
 #include "Systems/TargetingSystems.h"
 
 void ConstructionSystems::RunSystems(float deltaTime)
@@ -101,6 +102,7 @@ void ConstructionSystems::ProcessBeingConstructedState(float deltaTime, const Co
 	if (components.m_constructionComponent->m_currentWorkSeconds >= components.m_constructionComponent->m_requiredWorkSeconds)
 	{
 		components.m_taskComponent->m_constructionState = EConstructionState::ConstructionFinished;
+		SpatialPartitioningSystems::RequestEntityRoleIndexUpdate(components.m_entity);
 	}
 }
 
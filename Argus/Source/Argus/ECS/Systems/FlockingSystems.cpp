@@ -5,6 +5,7 @@
 #include "ArgusLogging.h"
 #include "ArgusMacros.h"
 #include "Systems/AvoidanceSystems.h"
+#include "Systems/LODSystems.h"
 #include "Systems/TargetingSystems.h"
 
 #if !UE_BUILD_SHIPPING
@@ -105,6 +106,11 @@ void FlockingSystems::SetPackingValues()
 			return;
 		}
 
+		if (AvoidanceSystems::IsInSleepingAvoidanceGroup(components.m_entity))
+		{
+			return;
+		}
+
 		if (FlockingComponent* flockingRootComponent = GetFlockingRootComponent(components.m_entity))
 		{
 			IncrementStableEntitiesInRange(flockingRootComponent);
@@ -118,9 +124,19 @@ void FlockingSystems::SetFlockingState(float deltaTime)
 
 	ArgusIterators::IterateSystemsArgs<FlockingSystemsArgs>([deltaTime](FlockingSystemsArgs& components)
 	{
+		if (AvoidanceSystems::IsInSleepingAvoidanceGroup(components.m_entity))
+		{
+			return;
+		}
+
+		if (!LODSystems::ShouldUpdateSimulationThisFrame(components.m_entity))
+		{
+			return;
+		}
+
 		if (components.m_flockingComponent->m_flockingState == EFlockingState::Shrinking)
 		{
-			EndFlockingIfNecessary(deltaTime, components);
+			EndFlockingIfNecessary(LODSystems::GetSimulationDeltaTime(components.m_entity, deltaTime), components);
 		}
 		else
 		{
@@ -428,6 +428,7 @@ void InputInterfaceSystems::MoveEntityToTarget(ArgusEntity entity, EMovementStat
 		else if (navigationComponent)
 		{
 			AvoidanceSystems::DecrementIdleEntitiesInGroup(entity);
+			AvoidanceSystems::WakeAvoidanceGroup(entity);
 			taskComponent->m_movementState = inputMovementState;
 		}
 
@@ -441,6 +442,7 @@ void InputInterfaceSystems::MoveEntityToTarget(ArgusEntity entity, EMovementStat
 		if (navigationComponent)
 		{
 			AvoidanceSystems::DecrementIdleEntitiesInGroup(entity);
+			AvoidanceSystems::WakeAvoidanceGroup(entity);
 			taskComponent->m_movementState = inputMovementState;
 		}
 
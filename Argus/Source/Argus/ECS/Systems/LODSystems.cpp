@@ -0,0 +1,70 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "LODSystems.h"
+#include "ArgusECSConstants.h"
+#include "ArgusIterators.h"
+#include "ArgusLogging.h"
+#include "ArgusMacros.h"
+
+void LODSystems::RunSystems(float deltaTime)
+{
+	ARGUS_TRACE(LODSystems::RunSystems);
+
+	const WorldReferenceComponent* worldReferenceComponent = ArgusEntity::GetSingletonEntity().GetComponent<WorldReferenceComponent>();
+	ARGUS_RETURN_ON_NULL(worldReferenceComponent, ArgusECSLog);
+
+	const uint32 frameIndex = worldReferenceComponent->m_simulationFrameIndex;
+	ArgusIterators::IterateEntities([deltaTime, frameIndex](ArgusEntity entity)
+	{
+		LODComponent* lodComponent = entity.GetComponent<LODComponent>();
+		if (!lodComponent)
+		{
+			return;
+		}
+
+		lodComponent->m_accumulatedSimulationDeltaTime += deltaTime;
+
+		// Offset by entity id so that entities sharing a reduced rate are spread evenly across frames instead of all updating together.
+		const uint32 frameInterval = lodComponent->GetSimulationFrameInterval();
+		lodComponent->m_shouldUpdateSimulationThisFrame = ((frameIndex + entity.GetId()) % frameInterval) == 0u;
+		if (!lodComponent->m_shouldUpdateSimulationThisFrame)
+		{
+			return;
+		}
+
+		lodComponent->m_simulationDeltaTime = lodComponent->m_accumulatedSimulationDeltaTime;
+		lodComponent->m_accumulatedSimulationDeltaTime = 0.0f;
+	});
+}
+
+ESimulationLOD LODSystems::CalculateSimulationLOD(bool isInViewFrustrum, float distanceToCameraSquared)
+{
+	if (isInViewFrustrum)
+	{
+		return distanceToCameraSquared < FMath::Square(ArgusECSConstants::k_simulationLODInViewHalfRateDistance) ? ESimulationLOD::FullRate : ESimulationLOD::HalfRate;
+	}
+
+	return distanceToCameraSquared < FMath::Square(ArgusECSConstants::k_simulationLODOutOfViewQuarterRateDistance) ? ESimulationLOD::HalfRate : ESimulationLOD::QuarterRate;
+}
+
+bool LODSystems::ShouldUpdateSimulationThisFrame(ArgusEntity entity)
+{
+	const LODComponent* lodComponent = entity.GetComponent<LODComponent>();
+	if (!lodComponent)
+	{
+		return true;
+	}
+
+	return lodComponent->m_shouldUpdateSimulationThisFrame;
+}
+
+float LODSystems::GetSimulationDeltaTime(ArgusEntity entity, float deltaTime)
+{
+	const LODComponent* lodComponent = entity.GetComponent<LODComponent>();
+	if (!lodComponent)
+	{
+		return deltaTime;
+	}
+
+	return lodComponent->m_simulationDeltaTime;
+}
@@ -0,0 +1,14 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#pragma once
+
+#include "ArgusEntity.h"
+
+class LODSystems
+{
+public:
+	static void RunSystems(float deltaTime);
+	static ESimulationLOD CalculateSimulationLOD(bool isInViewFrustrum, float distanceToCameraSquared);
+	static bool ShouldUpdateSimulationThisFrame(ArgusEntity entity);
+	static float GetSimulationDeltaTime(ArgusEntity entity, float deltaTime);
+};
@@ -4,9 +4,10 @@
 #include "ArgusEntityTemplate.h"
 #include "ArgusIterators.h"
 #include "ArgusLogging.h"
-#include "ArgusStaticData.h"
+#include "ArgusStaticRecordTable.h"
 #include "DataComponentDefinitions/ResourceComponentData.h"
 #include "RecordDefinitions/ResourceSetRecord.h"
+#include "Systems/SpatialPartitioningSystems.h"
 #include "Systems/TargetingSystems.h"
 
 void ResourceSystems::RunSystems(float deltaTime)
@@ -148,19 +149,20 @@ bool ResourceSystems::ExtractResources(const ResourceSystemsArgs& components)
 	}
 
 	ResourceComponent* extractionTargetResourceComponent = targetEntity.GetComponent<ResourceComponent>();
-	const UResourceSetRecord* extractionResourceRecord = ArgusStaticData::GetRecord<UResourceSetRecord>(components.m_resourceExtractionComponent->m_resourcesToExtractRecordId);
+	const ResourceSetRecordData* extractionResourceRecord = ArgusStaticRecordTable<UResourceSetRecord>::Get(components.m_resourceExtractionComponent->m_resourcesToExtractRecordId);
 	if (!extractionResourceRecord || !extractionTargetResourceComponent)
 	{
 		return false;
 	}
 
-	const UResourceSetRecord* resourceCapacityRecord = ArgusStaticData::GetRecord<UResourceSetRecord>(components.m_resourceComponent->m_resourceCapacityRecordId);
-	TransferResourcesBetweenComponents(extractionTargetResourceComponent, components.m_resourceComponent, extractionResourceRecord->m_resourceSet, resourceCapacityRecord);
+	const ResourceSetRecordData* resourceCapacityRecord = ArgusStaticRecordTable<UResourceSetRecord>::Get(components.m_resourceComponent->m_resourceCapacityRecordId);
+	TransferResourcesBetweenComponents(extractionTargetResourceComponent, components.m_resourceComponent, extractionResourceRecord->m_resourceSet, resourceCapacityRecord ? &resourceCapacityRecord->m_resourceSet : nullptr);
 	if (extractionTargetResourceComponent->m_currentResources.IsEmpty())
 	{
 		if (TaskComponent* targetTaskComponent = targetEntity.GetComponent<TaskComponent>())
 		{
 			targetTaskComponent->SetToKillState();
+			SpatialPartitioningSystems::RequestEntityRoleIndexUpdate(targetEntity);
 		}
 		return false;
 	}
@@ -207,18 +209,27 @@ void ResourceSystems::MoveToNearestDepositSink(const ResourceSystemsArgs& compon
 		return;
 	}
 
-	TFunction<bool(const ArgusEntityKDTreeNode*)> queryFilter = [&components](const ArgusEntityKDTreeNode* entityNode)
+	const IdentityComponent* identityComponent = components.m_entity.GetComponent<IdentityComponent>();
+	const TransformComponent* transformComponent = components.m_entity.GetComponent<TransformComponent>();
+	if (!identityComponent || !transformComponent)
 	{
-		ARGUS_RETURN_ON_NULL_BOOL(entityNode, ArgusECSLog);
-		if (entityNode->m_entityId == components.m_entity.GetId())
-		{
-			return false;
-		}
+		ClearResourceGatheringForEntity(components);
+		return;
+	}
 
-		return CanEntityDepositResourcesToOtherEntity(components.m_entity, ArgusEntity::RetrieveEntity(entityNode->m_entityId));
+	TFunction<bool(ArgusEntity)> queryFilter = [&components](ArgusEntity otherEntity)
+	{
+		return CanEntityDepositResourcesToOtherEntity(components.m_entity, otherEntity);
 	};
 
-	const uint16 targetDepositEntityId = spatialPartitioningComponent->m_argusEntityKDTree.FindOtherArgusEntityIdClosestToArgusEntity(components.m_entity, queryFilter);
+	const uint16 targetDepositEntityId = spatialPartitioningComponent->m_entityRoleIndex.FindResourceSinkEntityIdClosestToLocation
+	(
+		identityComponent->m_team,
+		components.m_resourceComponent->m_currentResources,
+		transformComponent->m_location,
+		components.m_entity,
+		queryFilter
+	);
 	if (targetDepositEntityId == ArgusECSConstants::k_maxEntities)
 	{
 		ClearResourceGatheringForEntity(components);
@@ -319,7 +330,7 @@ bool ResourceSystems::CanEntityExtractResourcesFromOtherEntity(ArgusEntity entit
 		return false;
 	}
 
-	const UResourceSetRecord* extractionResourceRecord = ArgusStaticData::GetRecord<UResourceSetRecord>(resourceExtractionComponent->m_resourcesToExtractRecordId);
+	const ResourceSetRecordData* extractionResourceRecord = ArgusStaticRecordTable<UResourceSetRecord>::Get(resourceExtractionComponent->m_resourcesToExtractRecordId);
 	if (!extractionResourceRecord)
 	{
 		return false;
@@ -450,24 +461,30 @@ ResourceComponent* ResourceSystems::GetTeamResourceComponentForTeam(ETeam team)
 	return teamEntity.GetComponent<ResourceComponent>();
 }
 
-void ResourceSystems::TransferResourcesBetweenComponents(ResourceComponent* sourceComponent, ResourceComponent* targetComponent, const FResourceSet& amount, const UResourceSetRecord* resourceCapacityRecord)
+void ResourceSystems::TransferResourcesBetweenComponents(ResourceComponent* sourceComponent, ResourceComponent* targetComponent, const FResourceSet& amount, const FResourceSet* resourceCapacity)
 {
 	if (!sourceComponent || !targetComponent)
 	{
 		return;
 	}
 
-	const FResourceSet* resourceCapacityPointer = nullptr;
-	if (resourceCapacityRecord)
-	{
-		resourceCapacityPointer = &resourceCapacityRecord->m_resourceSet;
-	}
-
 	FResourceSet potentialResourceChange = sourceComponent->m_currentResources.CalculateResourceChangeAffordable(-amount);
-	potentialResourceChange = targetComponent->m_currentResources.CalculateResourceChangeAffordable(-potentialResourceChange, resourceCapacityPointer);
+	potentialResourceChange = targetComponent->m_currentResources.CalculateResourceChangeAffordable(-potentialResourceChange, resourceCapacity);
 
+	const FResourceSet previousSourceResources = sourceComponent->m_currentResources;
+	const FResourceSet previousTargetResources = targetComponent->m_currentResources;
 	sourceComponent->Apply_m_currentResources_Change(-potentialResourceChange);
 	targetComponent->Apply_m_currentResources_Change(potentialResourceChange);
+
+	// Sources and sinks are bucketed by which resource types they hold, so only a type running out or showing up changes their role.
+	if (!previousSourceResources.HasSameResourceTypes(sourceComponent->m_currentResources))
+	{
+		SpatialPartitioningSystems::RequestEntityRoleIndexUpdate(ArgusEntity::RetrieveEntity(sourceComponent->GetOwningEntityId()));
+	}
+	if (!previousTargetResources.HasSameResourceTypes(targetComponent->m_currentResources))
+	{
+		SpatialPartitioningSystems::RequestEntityRoleIndexUpdate(ArgusEntity::RetrieveEntity(targetComponent->GetOwningEntityId()));
+	}
 }
 
 void ResourceSystems::ClearResourceGatheringForEntity(const ResourceSystemsArgs& components)
@@ -9,7 +9,6 @@
 
 class ArgusEntity;
 class UArgusEntityTemplate;
-class UResourceSetRecord;
 struct FResourceSet;
 struct ResourceComponent;
 
@@ -39,6 +38,6 @@ public:
 	static ResourceComponent* GetTeamResourceComponentForTeam(ETeam team);
 
 private:
-	static void TransferResourcesBetweenComponents(ResourceComponent* sourceComponent, ResourceComponent* targetComponent, const FResourceSet& amount, const UResourceSetRecord* resourceCapacityRecord = nullptr);
+	static void TransferResourcesBetweenComponents(ResourceComponent* sourceComponent, ResourceComponent* targetComponent, const FResourceSet& amount, const FResourceSet* resourceCapacity = nullptr);
 	static void ClearResourceGatheringForEntity(const ResourceSystemsArgs& components);
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
 // Copyright Karazaa. This is a part of an RTS project called Argus.
 
 #include "SpatialPartitioningSystems.h"
+#include "ArgusBakedObstacles.h"
 #include "ArgusDetourQuery.h"
 #include "ArgusECSConstants.h"
 #include "ArgusIterators.h"
@@ -12,6 +13,8 @@
 #include "NavMesh/RecastNavMesh.h"
 #include "NavMesh/RecastQueryFilter.h"
 #include "Systems/AvoidanceSystems.h"
+#include "Systems/IdentitySystems.h"
+#include "Systems/LODSystems.h"
 
 #if !UE_BUILD_SHIPPING
 #include "ArgusCVars.h"
@@ -38,10 +41,85 @@ void SpatialPartitioningSystems::RunSystems()
 	spatialPartitioningComponent->m_flyingArgusEntityKDTree.ProcessDeferredStateChanges();
 	spatialPartitioningComponent->m_argusEntityKDTree.RebuildKDTreeForAllArgusEntities();
 	spatialPartitioningComponent->m_flyingArgusEntityKDTree.RebuildKDTreeForAllArgusEntities();
+	spatialPartitioningComponent->m_entityRoleIndex.ProcessDeferredStateChanges();
+	UpdatePlacementOccupancyGrid(spatialPartitioningComponent);
 
 	ClearSeenByStatus();
 	CacheAdjacentEntityIds(spatialPartitioningComponent);
-	CalculateAdjacentEntityGroups();
+	CalculateAdjacentEntityGroups(spatialPartitioningComponent);
+}
+
+void SpatialPartitioningSystems::RequestEntityRoleIndexUpdate(ArgusEntity entity)
+{
+	ArgusEntity singletonEntity = ArgusEntity::GetSingletonEntity();
+	if (!singletonEntity)
+	{
+		return;
+	}
+
+	if (SpatialPartitioningComponent* spatialPartitioningComponent = singletonEntity.GetComponent<SpatialPartitioningComponent>())
+	{
+		spatialPartitioningComponent->m_entityRoleIndex.RequestUpdateEntity(entity);
+	}
+}
+
+void SpatialPartitioningSystems::RequestEntityRoleIndexRebuild()
+{
+	ArgusEntity singletonEntity = ArgusEntity::GetSingletonEntity();
+	if (!singletonEntity)
+	{
+		return;
+	}
+
+	if (SpatialPartitioningComponent* spatialPartitioningComponent = singletonEntity.GetComponent<SpatialPartitioningComponent>())
+	{
+		spatialPartitioningComponent->m_entityRoleIndex.RequestRebuild();
+	}
+}
+
+void SpatialPartitioningSystems::UpdatePlacementOccupancyGrid(SpatialPartitioningComponent* spatialPartitioningComponent)
+{
+	ARGUS_TRACE(SpatialPartitioningSystems::UpdatePlacementOccupancyGrid);
+
+	ARGUS_RETURN_ON_NULL(spatialPartitioningComponent, ArgusECSLog);
+
+	PlacementOccupancyGrid& placementOccupancyGrid = spatialPartitioningComponent->m_placementOccupancyGrid;
+	if (!placementOccupancyGrid.IsInitialized())
+	{
+		placementOccupancyGrid.Initialize(spatialPartitioningComponent->m_validSpaceExtent);
+		placementOccupancyGrid.StampObstacles(spatialPartitioningComponent->m_obstacles);
+	}
+
+	// Static entities only touch the grid when they first show up, go away, or change footprint. Entities that can no longer move (including dead ones)
+	// block placement, the same as they do in the grounded KD tree. The range also covers stamped ids so that destroyed entities at either end get removed.
+	int32 lowestEntityId = static_cast<int32>(ArgusEntity::GetLowestTakenEntityId());
+	int32 highestEntityId = static_cast<int32>(ArgusEntity::GetHighestTakenEntityId());
+	if (placementOccupancyGrid.GetLowestStampedEntityId() >= 0)
+	{
+		lowestEntityId = FMath::Min(lowestEntityId, placementOccupancyGrid.GetLowestStampedEntityId());
+		highestEntityId = FMath::Max(highestEntityId, placementOccupancyGrid.GetHighestStampedEntityId());
+	}
+
+	for (int32 i = lowestEntityId; i <= highestEntityId; ++i)
+	{
+		const uint16 entityId = static_cast<uint16>(i);
+		ArgusEntity entity = ArgusEntity::RetrieveEntity(entityId);
+		const TransformComponent* transformComponent = entity ? entity.GetComponent<TransformComponent>() : nullptr;
+		if (!transformComponent)
+		{
+			if (placementOccupancyGrid.IsEntityStamped(entityId))
+			{
+				placementOccupancyGrid.UpdateStaticEntity(entityId, false, FVector::ZeroVector, 0.0f);
+			}
+			continue;
+		}
+
+		const bool shouldBeStamped = !entity.IsMoveable() && !entity.IsPassenger() && !entity.IsFlying();
+		if (shouldBeStamped || placementOccupancyGrid.IsEntityStamped(entityId))
+		{
+			placementOccupancyGrid.UpdateStaticEntity(entityId, shouldBeStamped, transformComponent->m_location, transformComponent->m_radius);
+		}
+	}
 }
 
 void SpatialPartitioningSystems::ClearSeenByStatus()
@@ -63,7 +141,14 @@ void SpatialPartitioningSystems::CacheAdjacentEntityIds(const SpatialPartitionin
 
 	ARGUS_RETURN_ON_NULL(spatialPartitioningComponent, ArgusECSLog);
 
-	ArgusIterators::IterateEntitiesParallel<12u>([spatialPartitioningComponent](ArgusEntity entity)
+	// Resolved once up front so that the parallel queries below don't each have to look up their team commander.
+	BITMASK_ETeam hostileTeamMasks[NUM_TEAMS];
+	for (uint8 i = 0u; i < NUM_TEAMS; ++i)
+	{
+		hostileTeamMasks[i] = GetHostileTeamMask(static_cast<ETeam>(1u << i));
+	}
+
+	ArgusIterators::IterateEntitiesParallel<12u>([spatialPartitioningComponent, &hostileTeamMasks](ArgusEntity entity)
 	{
 		NearbyEntitiesComponent* nearbyEntitiesComponent = entity.GetComponent<NearbyEntitiesComponent>();
 		const TransformComponent* transformComponent = entity.GetComponent<TransformComponent>();
@@ -72,17 +157,37 @@ void SpatialPartitioningSystems::CacheAdjacentEntityIds(const SpatialPartitionin
 			return;
 		}
 
-		nearbyEntitiesComponent->m_nearbyEntities.ResetAll();
-		nearbyEntitiesComponent->m_nearbyFlyingEntities.ResetAll();
-
 		if (AvoidanceGroupingComponent* avoidanceGroupingComponent = entity.GetComponent<AvoidanceGroupingComponent>())
 		{
 			avoidanceGroupingComponent->m_groupId = ArgusECSConstants::k_maxEntities;
 			avoidanceGroupingComponent->m_groupAverageLocation = FVector::ZeroVector;
 			avoidanceGroupingComponent->m_numberOfIdleEntities = 0u;
 			avoidanceGroupingComponent->m_entityIdsInGroup.Reset();
+			avoidanceGroupingComponent->m_isGroupSleeping = false;
+
+			if (IsEntitySettled(entity))
+			{
+				avoidanceGroupingComponent->m_numberOfSettledFrames = FMath::Min<uint16>(avoidanceGroupingComponent->m_numberOfSettledFrames + 1u, ArgusECSConstants::k_avoidanceGroupSleepSettledFrames);
+			}
+			else
+			{
+				avoidanceGroupingComponent->m_numberOfSettledFrames = 0u;
+			}
+		}
+
+		// Groups are rebuilt from scratch every frame, but entities at a reduced simulation LOD keep their previous nearby entity and obstacle results.
+		// Seen by status is cleared every frame though, so it has to be re-registered from the kept results.
+		if (!LODSystems::ShouldUpdateSimulationThisFrame(entity))
+		{
+			RegisterCachedEntitiesAsSeen(entity, nearbyEntitiesComponent);
+			return;
 		}
 
+		const uint32 previousSightRangeSignature = nearbyEntitiesComponent->m_nearbyEntities.GetSightRangeSignature();
+		const uint32 previousFlyingSightRangeSignature = nearbyEntitiesComponent->m_nearbyFlyingEntities.GetSightRangeSignature();
+		nearbyEntitiesComponent->m_nearbyEntities.ResetAll();
+		nearbyEntitiesComponent->m_nearbyFlyingEntities.ResetAll();
+
 		const float adjacentEntityRange = AvoidanceSystems::GetAvoidanceRange(entity, AvoidanceRange::Entity);
 		const float groupExitRange = AvoidanceSystems::GetAvoidanceRange(entity, AvoidanceRange::GroupExit);
 
@@ -110,8 +215,18 @@ void SpatialPartitioningSystems::CacheAdjacentEntityIds(const SpatialPartitionin
 		}
 
 		ArgusEntityKDTreeQueryRangeThresholds queryThresholds = ArgusEntityKDTreeQueryRangeThresholds(groupExitRange, adjacentEntityRange, transformComponent->m_radius, entity.GetId());
+		const IdentityComponent* identityComponent = entity.GetComponent<IdentityComponent>();
+		if (identityComponent && identityComponent->m_team != ETeam::None)
+		{
+			queryThresholds.m_hostileTeamMask = hostileTeamMasks[ArgusEntity::GetTeamOffset(identityComponent->m_team)];
+		}
 		spatialPartitioningComponent->m_argusEntityKDTree.FindOtherArgusEntityIdsWithinRangeOfArgusEntity(nearbyEntitiesComponent->m_nearbyEntities, queryThresholds, entity, sightRange, queryFilter);
 		spatialPartitioningComponent->m_flyingArgusEntityKDTree.FindOtherArgusEntityIdsWithinRangeOfArgusEntity(nearbyEntitiesComponent->m_nearbyFlyingEntities, queryThresholds, entity, sightRange, queryFilter);
+		if (nearbyEntitiesComponent->m_nearbyEntities.GetSightRangeSignature() != previousSightRangeSignature ||
+			nearbyEntitiesComponent->m_nearbyFlyingEntities.GetSightRangeSignature() != previousFlyingSightRangeSignature)
+		{
+			nearbyEntitiesComponent->m_hasSightRangeChanged = true;
+		}
 		if (NearbyObstaclesComponent* nearbyObstaclesComponent = entity.GetComponent<NearbyObstaclesComponent>())
 		{
 			// TODO JAMES: Gate updates by whether or not the entity is capable of moving?
@@ -122,85 +237,328 @@ void SpatialPartitioningSystems::CacheAdjacentEntityIds(const SpatialPartitionin
 	});
 }
 
-void SpatialPartitioningSystems::CalculateAdjacentEntityGroups()
+void SpatialPartitioningSystems::RegisterCachedEntitiesAsSeen(ArgusEntity entity, const NearbyEntitiesComponent* nearbyEntitiesComponent)
+{
+	ARGUS_RETURN_ON_NULL(nearbyEntitiesComponent, ArgusECSLog);
+
+	// Cached ids can belong to entities that died, were destroyed or boarded a transport since the results were kept, so they are filtered like a fresh query would.
+	auto registerIfStillVisible = [entity](uint16 nearbyEntityId)
+	{
+		const ArgusEntity nearbyEntity = ArgusEntity::RetrieveEntity(nearbyEntityId);
+		if (!nearbyEntity || (nearbyEntity.IsKillable() && !nearbyEntity.IsAlive()) || nearbyEntity.IsPassenger())
+		{
+			return;
+		}
+
+		IdentitySystems::RegisterEntityAsSeenByOther(nearbyEntityId, entity.GetId());
+	};
+
+	const TArray<uint16, ArgusContainerAllocator<20u> >& nearbyEntityIds = nearbyEntitiesComponent->m_nearbyEntities.GetEntityIdsInSightRange();
+	for (int32 i = 0; i < nearbyEntityIds.Num(); ++i)
+	{
+		registerIfStillVisible(nearbyEntityIds[i]);
+	}
+
+	const TArray<uint16, ArgusContainerAllocator<20u> >& nearbyFlyingEntityIds = nearbyEntitiesComponent->m_nearbyFlyingEntities.GetEntityIdsInSightRange();
+	for (int32 i = 0; i < nearbyFlyingEntityIds.Num(); ++i)
+	{
+		registerIfStillVisible(nearbyFlyingEntityIds[i]);
+	}
+}
+
+BITMASK_ETeam SpatialPartitioningSystems::GetHostileTeamMask(ETeam team)
+{
+	if (const ArgusEntity teamCommanderEntity = ArgusEntity::GetTeamEntity(team))
+	{
+		if (const TeamCommanderComponent* teamCommanderComponent = teamCommanderEntity.GetComponent<TeamCommanderComponent>())
+		{
+			return teamCommanderComponent->m_enemies;
+		}
+	}
+
+	// Without a commander there are no alignments to go off of, so every other team is treated as hostile.
+	return static_cast<BITMASK_ETeam>(~static_cast<BITMASK_ETeam>(team));
+}
+
+void SpatialPartitioningSystems::CalculateAdjacentEntityGroups(SpatialPartitioningComponent* spatialPartitioningComponent)
 {
 	ARGUS_TRACE(SpatialPartitioningSystems::CalculateAdjacentEntityGroups);
 
+	ARGUS_RETURN_ON_NULL(spatialPartitioningComponent, ArgusECSLog);
+
+	// Groups are the connected components of group exit range neighbors, found with a lock free union find over every neighbor pair in parallel.
+	AvoidanceGroupUnionFind& unionFind = spatialPartitioningComponent->m_avoidanceGroupUnionFind;
+	unionFind.Reset();
+	ArgusIterators::IterateEntities([&unionFind](ArgusEntity entity)
+	{
+		if (CanJoinAvoidanceGroup(entity))
+		{
+			unionFind.AddEntityId(entity.GetId());
+		}
+	});
+
+	ArgusIterators::IterateEntitiesParallel<12u>([&unionFind](ArgusEntity entity)
+	{
+		if (!unionFind.Contains(entity.GetId()))
+		{
+			return;
+		}
+
+		const NearbyEntitiesComponent* nearbyEntitiesComponent = entity.GetComponent<NearbyEntitiesComponent>();
+		const TaskComponent* taskComponent = entity.GetComponent<TaskComponent>();
+		ARGUS_RETURN_ON_NULL(nearbyEntitiesComponent, ArgusECSLog);
+		ARGUS_RETURN_ON_NULL(taskComponent, ArgusECSLog);
+
+		const bool isGrounded = taskComponent->m_flightState == EFlightState::Grounded;
+		const TArray<uint16, ArgusContainerAllocator<10u> >& groupExitRangeEntityIds = nearbyEntitiesComponent->GetNearbyEntities(!isGrounded).GetEntityIdsInGroupExitRange();
+		for (int32 i = 0; i < groupExitRangeEntityIds.Num(); ++i)
+		{
+			const uint16 otherEntityId = groupExitRangeEntityIds[i];
+			if (!unionFind.Contains(otherEntityId))
+			{
+				continue;
+			}
+
+			if (ShouldLinkAvoidanceGroupMembers(entity, ArgusEntity::RetrieveEntity(otherEntityId)))
+			{
+				unionFind.Unite(entity.GetId(), otherEntityId);
+			}
+		}
+	});
+
+	ArgusIterators::IterateEntitiesParallel<12u>([&unionFind](ArgusEntity entity)
+	{
+		if (!unionFind.Contains(entity.GetId()))
+		{
+			return;
+		}
+
+		if (AvoidanceGroupingComponent* avoidanceGroupingComponent = entity.GetComponent<AvoidanceGroupingComponent>())
+		{
+			avoidanceGroupingComponent->m_groupId = unionFind.FindRoot(entity.GetId());
+		}
+	});
+
+	// Member lists are appended in id order on one thread so that they, and the sums reduced from them below, come out the same every run.
+	ArgusIterators::IterateEntities([](ArgusEntity entity)
+	{
+		AvoidanceGroupingComponent* avoidanceGroupingComponent = entity.GetComponent<AvoidanceGroupingComponent>();
+		if (!avoidanceGroupingComponent || avoidanceGroupingComponent->m_groupId == ArgusECSConstants::k_maxEntities)
+		{
+			return;
+		}
+
+		if (AvoidanceGroupingComponent* groupLeaderComponent = ArgusEntity::RetrieveEntity(avoidanceGroupingComponent->m_groupId).GetComponent<AvoidanceGroupingComponent>())
+		{
+			groupLeaderComponent->m_entityIdsInGroup.Add(entity.GetId());
+		}
+	});
+
+	ArgusIterators::IterateEntitiesParallel<12u>([](ArgusEntity entity)
+	{
+		AvoidanceGroupingComponent* avoidanceGroupingComponent = entity.GetComponent<AvoidanceGroupingComponent>();
+		if (avoidanceGroupingComponent && avoidanceGroupingComponent->m_groupId == entity.GetId())
+		{
+			ReduceAvoidanceGroup(avoidanceGroupingComponent);
+		}
+	});
+
+	// Navigation changes write task and navigation state that other entities read while reducing, so they are applied after the reduction on one thread.
 	ArgusIterators::IterateEntities([](ArgusEntity entity)
 	{
-		CalculateAdjacentEntityGroupsForEntity(entity, true);
+		if (AvoidanceGroupingComponent* avoidanceGroupingComponent = entity.GetComponent<AvoidanceGroupingComponent>())
+		{
+			UpdatePreviousAvoidanceGroup(entity, avoidanceGroupingComponent, true);
+		}
 	});
 }
 
-bool SpatialPartitioningSystems::FloodFillGroupRecursive(uint16 groupId, AvoidanceGroupingComponent* groupLeaderComponent, uint16 entityId, uint16 lastArgusEntityId, FVector& averageLocation, float& numberOfEntitiesInGroup, uint16& numberOfStoppedEntities)
+bool SpatialPartitioningSystems::CanJoinAvoidanceGroup(ArgusEntity entity)
 {
-	ARGUS_TRACE(SpatialPartitioningSystems::FloodFillGroupRecursive);
+	if (!entity || !entity.IsMoveable())
+	{
+		return false;
+	}
 
-	ARGUS_RETURN_ON_NULL_BOOL(groupLeaderComponent, ArgusECSLog);
+	return	entity.GetComponent<NearbyEntitiesComponent>() && entity.GetComponent<AvoidanceGroupingComponent>() && entity.GetComponent<TaskComponent>() &&
+			entity.GetComponent<TransformComponent>() && entity.GetComponent<IdentityComponent>() && entity.GetComponent<TargetingComponent>();
+}
 
-	ArgusEntity entity = ArgusEntity::RetrieveEntity(entityId);
-	ArgusEntity groupLeaderEntity = ArgusEntity::RetrieveEntity(groupId);
+bool SpatialPartitioningSystems::ShouldLinkAvoidanceGroupMembers(ArgusEntity entity, ArgusEntity otherEntity)
+{
 	ARGUS_RETURN_ON_INVALID_ENTITY_VALUE(entity, ArgusECSLog, false);
-	ARGUS_RETURN_ON_INVALID_ENTITY_VALUE(groupLeaderEntity, ArgusECSLog, false);
-	if (!entity.IsMoveable())
+	ARGUS_RETURN_ON_INVALID_ENTITY_VALUE(otherEntity, ArgusECSLog, false);
+
+	const AvoidanceGroupingComponent* avoidanceGroupingComponent = entity.GetComponent<AvoidanceGroupingComponent>();
+	const IdentityComponent* identityComponent = entity.GetComponent<IdentityComponent>();
+	const TargetingComponent* targetingComponent = entity.GetComponent<TargetingComponent>();
+	const AvoidanceGroupingComponent* otherAvoidanceGroupingComponent = otherEntity.GetComponent<AvoidanceGroupingComponent>();
+	const IdentityComponent* otherIdentityComponent = otherEntity.GetComponent<IdentityComponent>();
+	const TargetingComponent* otherTargetingComponent = otherEntity.GetComponent<TargetingComponent>();
+	if (!avoidanceGroupingComponent || !identityComponent || !targetingComponent || !otherAvoidanceGroupingComponent || !otherIdentityComponent || !otherTargetingComponent)
 	{
 		return false;
 	}
 
-	NearbyEntitiesComponent* nearbyEntitiesComponent = entity.GetComponent<NearbyEntitiesComponent>();
-	AvoidanceGroupingComponent* avoidanceGroupingComponent = entity.GetComponent<AvoidanceGroupingComponent>();
-	const TaskComponent* taskComponent = entity.GetComponent<TaskComponent>();
-	const TransformComponent* transformComponent = entity.GetComponent<TransformComponent>();
-	const IdentityComponent* identityComponent = entity.GetComponent<IdentityComponent>();
-	const TargetingComponent* targetingComponent = entity.GetComponent<TargetingComponent>();
-	const IdentityComponent* groupLeaderIdentityComponent = groupLeaderEntity.GetComponent<IdentityComponent>();
-	const TargetingComponent* groupLeaderTargetingComponent = groupLeaderEntity.GetComponent<TargetingComponent>();
-	if (!taskComponent || !nearbyEntitiesComponent || !avoidanceGroupingComponent || !transformComponent || !identityComponent || !targetingComponent || !groupLeaderIdentityComponent || !groupLeaderTargetingComponent)
+	if (identityComponent->m_team != otherIdentityComponent->m_team)
 	{
 		return false;
 	}
 
-	if (avoidanceGroupingComponent->m_groupId != ArgusECSConstants::k_maxEntities)
+	if (!targetingComponent->HasSameTarget(otherTargetingComponent))
 	{
 		return false;
 	}
 
-	if (identityComponent->m_team != groupLeaderIdentityComponent->m_team)
+	// Pairs that were already grouped together only need to stay within group exit range, everyone else has to come within group enter range first.
+	if (avoidanceGroupingComponent->m_previousGroupId != ArgusECSConstants::k_maxEntities && avoidanceGroupingComponent->m_previousGroupId == otherAvoidanceGroupingComponent->m_previousGroupId)
+	{
+		return true;
+	}
+
+	return entity.IsInRangeOfOtherEntity(otherEntity, AvoidanceSystems::GetAvoidanceRange(entity, AvoidanceRange::GroupEnter));
+}
+
+void SpatialPartitioningSystems::ReduceAvoidanceGroup(AvoidanceGroupingComponent* groupLeaderComponent)
+{
+	ARGUS_TRACE(SpatialPartitioningSystems::ReduceAvoidanceGroup);
+
+	ARGUS_RETURN_ON_NULL(groupLeaderComponent, ArgusECSLog);
+
+	FVector locationSum = FVector::ZeroVector;
+	uint16 numberOfIdleEntities = 0u;
+	for (int32 i = 0; i < groupLeaderComponent->m_entityIdsInGroup.Num(); ++i)
+	{
+		ArgusEntity memberEntity = ArgusEntity::RetrieveEntity(groupLeaderComponent->m_entityIdsInGroup[i]);
+		if (const TransformComponent* memberTransformComponent = memberEntity.GetComponent<TransformComponent>())
+		{
+			locationSum += memberTransformComponent->m_location;
+		}
+
+		if (memberEntity.IsIdle())
+		{
+			numberOfIdleEntities++;
+		}
+	}
+
+	groupLeaderComponent->m_groupAverageLocation = ArgusMath::SafeDivide(locationSum, static_cast<float>(groupLeaderComponent->m_entityIdsInGroup.Num()));
+	groupLeaderComponent->m_numberOfIdleEntities = numberOfIdleEntities;
+	groupLeaderComponent->m_isGroupSleeping = ShouldAvoidanceGroupSleep(groupLeaderComponent);
+}
+
+void SpatialPartitioningSystems::UpdatePreviousAvoidanceGroup(ArgusEntity entity, AvoidanceGroupingComponent* groupingComponent, bool allowNavigationRecalculation)
+{
+	ARGUS_RETURN_ON_INVALID_ENTITY(entity, ArgusECSLog);
+	ARGUS_RETURN_ON_NULL(groupingComponent, ArgusECSLog);
+
+	if (!allowNavigationRecalculation)
+	{
+		groupingComponent->m_previousGroupId = groupingComponent->m_groupId;
+		return;
+	}
+
+	if (groupingComponent->m_previousGroupId == groupingComponent->m_groupId)
+	{
+		return;
+	}
+
+	if (groupingComponent->m_previousGroupId == ArgusECSConstants::k_maxEntities || groupingComponent->m_groupId == ArgusECSConstants::k_maxEntities)
+	{
+		groupingComponent->m_previousGroupId = groupingComponent->m_groupId;
+		return;
+	}
+
+	if (groupingComponent->m_groupId == entity.GetId())
+	{
+		OnBecomeAvoidanceGroupLeader(entity);
+	}
+	else
+	{
+		OnChangeAvoidanceGroups(entity, groupingComponent);
+	}
+
+	groupingComponent->m_previousGroupId = groupingComponent->m_groupId;
+}
+
+bool SpatialPartitioningSystems::IsEntitySettled(ArgusEntity entity)
+{
+	if (!entity.IsIdle())
 	{
 		return false;
 	}
 
-	if (!targetingComponent->HasSameTarget(groupLeaderTargetingComponent))
+	const TaskComponent* taskComponent = entity.GetComponent<TaskComponent>();
+	if (!taskComponent || (taskComponent->m_flightState != EFlightState::Grounded && taskComponent->m_flightState != EFlightState::Flying))
 	{
 		return false;
 	}
 
-	// If it's the same group, we don't need to do the range constraint
-	if (groupId != avoidanceGroupingComponent->m_previousGroupId)
+	if (const VelocityComponent* velocityComponent = entity.GetComponent<VelocityComponent>())
+	{
+		if (!velocityComponent->m_currentVelocity.IsNearlyZero() || !velocityComponent->m_proposedAvoidanceVelocity.IsNearlyZero())
+		{
+			return false;
+		}
+	}
+
+	if (const FacingComponent* facingComponent = entity.GetComponent<FacingComponent>())
 	{
-		const float range = AvoidanceSystems::GetAvoidanceRange(entity, AvoidanceRange::GroupEnter);
-		if (!entity.IsInRangeOfOtherEntity(ArgusEntity::RetrieveEntity(lastArgusEntityId), range))
+		if (!FMath::IsNearlyEqual(facingComponent->GetCurrentFacing(), facingComponent->m_targetFacing, ArgusECSConstants::k_avoidanceGroupSleepFacingTolerance))
 		{
 			return false;
 		}
 	}
 
-	avoidanceGroupingComponent->m_groupId = groupId;
-	averageLocation += transformComponent->m_location;
-	numberOfEntitiesInGroup += 1.0f;
-	groupLeaderComponent->m_entityIdsInGroup.Add(entity.GetId());
-	if (entity.IsIdle())
+	if (const FlockingComponent* flockingComponent = entity.GetComponent<FlockingComponent>())
+	{
+		if (flockingComponent->m_flockingState != EFlockingState::Stable)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool SpatialPartitioningSystems::ShouldAvoidanceGroupSleep(const AvoidanceGroupingComponent* groupLeaderComponent)
+{
+	ARGUS_RETURN_ON_NULL_BOOL(groupLeaderComponent, ArgusECSLog);
+
+	if (groupLeaderComponent->m_entityIdsInGroup.IsEmpty() || groupLeaderComponent->m_numberOfIdleEntities != groupLeaderComponent->m_entityIdsInGroup.Num())
 	{
-		numberOfStoppedEntities++;
+		return false;
 	}
 
-	const bool isGrounded = taskComponent->m_flightState == EFlightState::Grounded;
-	for (int32 i = 0; i < nearbyEntitiesComponent->GetNearbyEntities(!isGrounded).GetEntityIdsInGroupExitRange().Num(); ++i)
+	for (int32 i = 0; i < groupLeaderComponent->m_entityIdsInGroup.Num(); ++i)
 	{
-		FloodFillGroupRecursive(groupId, groupLeaderComponent, nearbyEntitiesComponent->GetNearbyEntities(!isGrounded).GetEntityIdsInGroupExitRange()[i], entityId, averageLocation, numberOfEntitiesInGroup, numberOfStoppedEntities);
+		ArgusEntity memberEntity = ArgusEntity::RetrieveEntity(groupLeaderComponent->m_entityIdsInGroup[i]);
+		const AvoidanceGroupingComponent* memberGroupingComponent = memberEntity.GetComponent<AvoidanceGroupingComponent>();
+		const NearbyEntitiesComponent* memberNearbyEntitiesComponent = memberEntity.GetComponent<NearbyEntitiesComponent>();
+		const TaskComponent* memberTaskComponent = memberEntity.GetComponent<TaskComponent>();
+		if (!memberGroupingComponent || !memberNearbyEntitiesComponent || !memberTaskComponent)
+		{
+			return false;
+		}
+
+		if (memberGroupingComponent->m_numberOfSettledFrames < ArgusECSConstants::k_avoidanceGroupSleepSettledFrames)
+		{
+			return false;
+		}
+
+		// Anything moving within avoidance range of a member needs the group awake so that it can get out of the way.
+		const bool isGrounded = memberTaskComponent->m_flightState == EFlightState::Grounded;
+		const TArray<uint16, ArgusContainerAllocator<10u> >& nearbyEntityIds = memberNearbyEntitiesComponent->GetNearbyEntities(!isGrounded).GetEntityIdsInAvoidanceRange();
+		for (int32 j = 0; j < nearbyEntityIds.Num(); ++j)
+		{
+			ArgusEntity nearbyEntity = ArgusEntity::RetrieveEntity(nearbyEntityIds[j]);
+			if (nearbyEntity && nearbyEntity.IsMoveable() && !IsEntitySettled(nearbyEntity))
+			{
+				return false;
+			}
+		}
 	}
 
-	return groupId == entityId;
+	return true;
 }
 
 void SpatialPartitioningSystems::OnBecomeAvoidanceGroupLeader(ArgusEntity entity)
@@ -269,25 +627,27 @@ void SpatialPartitioningSystems::CalculateAvoidanceObstacles(SpatialPartitioning
 		return;
 	}
 
-	FNavLocation originLocation;
-	if (!unrealNavigationSystem->ProjectPointToNavigation(FVector::ZeroVector, originLocation))
-	{
-		return;
-	}
-
 	spatialPartitioningComponent->m_obstacles.Reset();
 	spatialPartitioningComponent->m_obstaclePointKDTree.ResetKDTreeWithAverageLocation();
 
-	TArray<FVector> navWalls;
-	GetNavMeshWalls(spatialPartitioningComponent, navMesh, originLocation, navWalls);
-
-	ConvertWallsIntoObstacles(navWalls, spatialPartitioningComponent->m_obstacles);
+	if (!TryPopulateBakedAvoidanceObstacles(spatialPartitioningComponent, navMesh, worldPointer))
+	{
+		if (!BuildAvoidanceObstacles(spatialPartitioningComponent, navMesh, spatialPartitioningComponent->m_obstacles))
+		{
+			return;
+		}
+	}
 
 #if !UE_BUILD_SHIPPING
 	DrawDebugObstacles(worldPointer, spatialPartitioningComponent->m_obstacles);
 #endif //!UE_BUILD_SHIPPING
 
 	spatialPartitioningComponent->m_obstaclePointKDTree.InsertObstaclesIntoKDTree(spatialPartitioningComponent->m_obstacles);
+	if (!spatialPartitioningComponent->m_placementOccupancyGrid.IsInitialized())
+	{
+		spatialPartitioningComponent->m_placementOccupancyGrid.Initialize(spatialPartitioningComponent->m_validSpaceExtent);
+	}
+	spatialPartitioningComponent->m_placementOccupancyGrid.StampObstacles(spatialPartitioningComponent->m_obstacles);
 
 	ArgusIterators::IterateEntities([spatialPartitioningComponent](ArgusEntity entity)
 	{
@@ -305,6 +665,67 @@ void SpatialPartitioningSystems::CalculateAvoidanceObstacles(SpatialPartitioning
 	});
 }
 
+bool SpatialPartitioningSystems::BuildAvoidanceObstacles(const SpatialPartitioningComponent* spatialPartitioningComponent, const ARecastNavMesh* navMesh, ObstaclesContainer& outObstacles)
+{
+	ARGUS_TRACE(SpatialPartitioningSystems::BuildAvoidanceObstacles);
+
+	ARGUS_RETURN_ON_NULL_BOOL(spatialPartitioningComponent, ArgusECSLog);
+	ARGUS_RETURN_ON_NULL_BOOL(navMesh, ArgusECSLog);
+
+	FNavLocation originLocation;
+	if (!navMesh->ProjectPoint(FVector::ZeroVector, originLocation, navMesh->GetConfig().DefaultQueryExtent))
+	{
+		return false;
+	}
+
+	outObstacles.Reset();
+
+	TArray<FVector> navWalls;
+	GetNavMeshWalls(spatialPartitioningComponent, navMesh, originLocation, navWalls);
+
+	ConvertWallsIntoObstacles(navWalls, outObstacles);
+	return true;
+}
+
+uint32 SpatialPartitioningSystems::GetAvoidanceObstaclesSourceHash(const SpatialPartitioningComponent* spatialPartitioningComponent, const ARecastNavMesh* navMesh)
+{
+	ARGUS_TRACE(SpatialPartitioningSystems::GetAvoidanceObstaclesSourceHash);
+
+	ARGUS_RETURN_ON_NULL_VALUE(spatialPartitioningComponent, ArgusECSLog, 0u);
+	ARGUS_RETURN_ON_NULL_VALUE(navMesh, ArgusECSLog, 0u);
+
+	const GlobalSettingsComponent* settings = GlobalSettingsComponent::Get();
+	ARGUS_RETURN_ON_NULL_VALUE(settings, ArgusECSLog, 0u);
+
+	const dtNavMesh* detourMesh = navMesh->GetRecastMesh();
+	ARGUS_RETURN_ON_NULL_VALUE(detourMesh, ArgusECSLog, 0u);
+
+	uint32 hash = GetTypeHash(UArgusBakedObstacles::k_bakeVersion);
+	hash = HashCombineFast(hash, GetTypeHash(spatialPartitioningComponent->m_validSpaceExtent));
+	hash = HashCombineFast(hash, GetTypeHash(spatialPartitioningComponent->m_elevatedObstaclePointHeightThreshold));
+	hash = HashCombineFast(hash, GetTypeHash(settings->m_maxObstaclePointDistance));
+	hash = HashCombineFast(hash, GetTypeHash(settings->m_minObstaclePointDistance));
+	hash = HashCombineFast(hash, GetTypeHash(settings->m_obstacleShrinkFixupDistance));
+
+	// Tile vertices are hashed so that rebuilding the navmesh after a geometry change invalidates any previous bake.
+	for (int32 i = 0; i < detourMesh->getMaxTiles(); ++i)
+	{
+		const dtMeshTile* tile = detourMesh->getTile(i);
+		if (!tile || !tile->header || !tile->verts)
+		{
+			continue;
+		}
+
+		hash = HashCombineFast(hash, GetTypeHash(tile->header->x));
+		hash = HashCombineFast(hash, GetTypeHash(tile->header->y));
+		hash = HashCombineFast(hash, GetTypeHash(tile->header->layer));
+		hash = HashCombineFast(hash, GetTypeHash(tile->header->polyCount));
+		hash = HashCombineFast(hash, FCrc::MemCrc32(tile->verts, tile->header->vertCount * 3 * sizeof(dtReal)));
+	}
+
+	return hash;
+}
+
 float SpatialPartitioningSystems::FindAreaOfObstacleCartesian(const ObstaclePointArray& obstaclePoints)
 {
 	float area = 0.0f;
@@ -404,54 +825,59 @@ bool SpatialPartitioningSystems::IsPointInLineOfSightOfEntity(ArgusEntity source
 
 bool SpatialPartitioningSystems::AnyObstaclesOrStaticEntitiesInCircle(const FVector& center, float radius, float resourceSourceBufferRadius)
 {
-	SpatialPartitioningComponent* spatialPartitioningComponent = ArgusEntity::GetSingletonEntity().GetComponent<SpatialPartitioningComponent>();
-	ARGUS_RETURN_ON_NULL_BOOL(spatialPartitioningComponent, ArgusInputLog);
+	ARGUS_TRACE(SpatialPartitioningSystems::AnyObstaclesOrStaticEntitiesInCircle);
 
-	TArray<ObstacleIndicies> obstacleIndicies;
-	FVector location = ArgusMath::ToCartesianVector(center);
-	location.Z = 0.0f;
-	spatialPartitioningComponent->m_obstaclePointKDTree.FindObstacleIndiciesWithinRangeOfLocation(obstacleIndicies, location, radius);
-	bool anyFound = obstacleIndicies.Num() > 0;
+	const SpatialPartitioningComponent* spatialPartitioningComponent = ArgusEntity::GetSingletonEntity().GetComponent<SpatialPartitioningComponent>();
+	ARGUS_RETURN_ON_NULL_BOOL(spatialPartitioningComponent, ArgusInputLog);
 
-	if (!anyFound)
+	if (spatialPartitioningComponent->m_placementOccupancyGrid.IsCircleBlocked(center, radius))
 	{
-		TArray<uint16> nearbyArgusEntityIds;
-		spatialPartitioningComponent->m_argusEntityKDTree.FindArgusEntityIdsWithinRangeOfLocation(nearbyArgusEntityIds, center, radius + resourceSourceBufferRadius, [&center, radius, resourceSourceBufferRadius](const ArgusEntityKDTreeNode* node)
-		{
-			if (!node)
-			{
-				return false;
-			}
+		return true;
+	}
 
-			ArgusEntity entity = ArgusEntity::RetrieveEntity(node->m_entityId);
-			if (!entity)
-			{
-				return false;
-			}
+	return IsWithinResourceSourceBuffer(spatialPartitioningComponent, center, resourceSourceBufferRadius);
+}
 
-			if (entity.IsMoveable())
-			{
-				return false;
-			}
+bool SpatialPartitioningSystems::FindNearestValidPlacementLocation(const FVector& center, float radius, float resourceSourceBufferRadius, float maxSearchDistance, FVector& outLocation)
+{
+	ARGUS_TRACE(SpatialPartitioningSystems::FindNearestValidPlacementLocation);
 
-			const float distance = FVector::Dist2D(node->m_worldSpaceLocation, center) - node->m_radius;
-			if (distance < radius)
-			{
-				return true;
-			}
+	const SpatialPartitioningComponent* spatialPartitioningComponent = ArgusEntity::GetSingletonEntity().GetComponent<SpatialPartitioningComponent>();
+	ARGUS_RETURN_ON_NULL_BOOL(spatialPartitioningComponent, ArgusECSLog);
 
-			ResourceComponent* resourceComponent = entity.GetComponent<ResourceComponent>();
-			if (!resourceComponent)
-			{
-				return false;
-			}
+	return spatialPartitioningComponent->m_placementOccupancyGrid.FindNearestUnblockedLocation(center, radius, maxSearchDistance, outLocation, [spatialPartitioningComponent, resourceSourceBufferRadius](const FVector& candidateLocation)
+	{
+		return !IsWithinResourceSourceBuffer(spatialPartitioningComponent, candidateLocation, resourceSourceBufferRadius);
+	});
+}
 
-			return (resourceComponent->m_resourceComponentOwnerType == EResourceComponentOwnerType::Source) && (distance < resourceSourceBufferRadius);
-		});
-		anyFound = nearbyArgusEntityIds.Num() > 0;
+bool SpatialPartitioningSystems::IsWithinResourceSourceBuffer(const SpatialPartitioningComponent* spatialPartitioningComponent, const FVector& center, float resourceSourceBufferRadius)
+{
+	ARGUS_RETURN_ON_NULL_BOOL(spatialPartitioningComponent, ArgusECSLog);
+
+	if (resourceSourceBufferRadius <= 0.0f)
+	{
+		return false;
 	}
 
-	return anyFound;
+	// There are only ever a handful of resource sources, so the buffer around them is checked directly rather than being stamped with every possible radius.
+	// Depleted sources are included, since they still block placement until they are removed.
+	const TArray<uint16>& resourceSourceEntityIds = spatialPartitioningComponent->m_entityRoleIndex.GetAllResourceSourceEntityIds();
+	for (int32 i = 0; i < resourceSourceEntityIds.Num(); ++i)
+	{
+		const TransformComponent* transformComponent = ArgusEntity::RetrieveEntity(resourceSourceEntityIds[i]).GetComponent<TransformComponent>();
+		if (!transformComponent)
+		{
+			continue;
+		}
+
+		if ((FVector::Dist2D(transformComponent->m_location, center) - transformComponent->m_radius) < resourceSourceBufferRadius)
+		{
+			return true;
+		}
+	}
+
+	return false;
 }
 
 void SpatialPartitioningSystems::CalculateAdjacentEntityGroupsForEntity(ArgusEntity entity, bool allowNavigationRecalculation)
@@ -459,48 +885,93 @@ void SpatialPartitioningSystems::CalculateAdjacentEntityGroupsForEntity(ArgusEnt
 	ARGUS_TRACE(SpatialPartitioningSystems::CalculateAdjacentEntityGroupsForEntity);
 	ARGUS_RETURN_ON_INVALID_ENTITY(entity, ArgusECSLog);
 
-	FVector averageLocation = FVector::ZeroVector;
-	float numberOfEntitiesInGroup = 0.0f;
-	uint16 numberOfStoppedEntities = 0u;
-	AvoidanceGroupingComponent* groupLeaderComponent = entity.GetComponent<AvoidanceGroupingComponent>();
-	if (!groupLeaderComponent)
+	AvoidanceGroupingComponent* avoidanceGroupingComponent = entity.GetComponent<AvoidanceGroupingComponent>();
+	if (!avoidanceGroupingComponent)
 	{
 		return;
 	}
 
-	if (FloodFillGroupRecursive(entity.GetId(), groupLeaderComponent, entity.GetId(), entity.GetId(), averageLocation, numberOfEntitiesInGroup, numberOfStoppedEntities))
-	{
-		groupLeaderComponent->m_groupAverageLocation = ArgusMath::SafeDivide(averageLocation, numberOfEntitiesInGroup);
-		groupLeaderComponent->m_numberOfIdleEntities = numberOfStoppedEntities;
-	}
+	SpatialPartitioningComponent* spatialPartitioningComponent = ArgusEntity::GetSingletonEntity().GetComponent<SpatialPartitioningComponent>();
+	ARGUS_RETURN_ON_NULL(spatialPartitioningComponent, ArgusECSLog);
 
-	if (!allowNavigationRecalculation)
+	// Only entities that lost their group this frame are regrouped, and only with others that did too. Everyone else keeps the group from the last full pass.
+	if (avoidanceGroupingComponent->m_groupId == ArgusECSConstants::k_maxEntities && CanJoinAvoidanceGroup(entity))
 	{
-		groupLeaderComponent->m_previousGroupId = groupLeaderComponent->m_groupId;
-		return;
-	}
+		AvoidanceGroupUnionFind& unionFind = spatialPartitioningComponent->m_avoidanceGroupUnionFind;
+		unionFind.Reset();
+		unionFind.AddEntityId(entity.GetId());
 
-	if (groupLeaderComponent->m_previousGroupId == groupLeaderComponent->m_groupId)
-	{
-		return;
-	}
+		// Walks outwards from the entity with the same link rules as the full pass. Every id added is linked to the entity, so they all share one root.
+		for (int32 i = 0; i < unionFind.GetEntityIds().Num(); ++i)
+		{
+			ArgusEntity memberEntity = ArgusEntity::RetrieveEntity(unionFind.GetEntityIds()[i]);
+			const NearbyEntitiesComponent* nearbyEntitiesComponent = memberEntity.GetComponent<NearbyEntitiesComponent>();
+			const TaskComponent* taskComponent = memberEntity.GetComponent<TaskComponent>();
+			ARGUS_RETURN_ON_NULL(nearbyEntitiesComponent, ArgusECSLog);
+			ARGUS_RETURN_ON_NULL(taskComponent, ArgusECSLog);
+
+			const bool isGrounded = taskComponent->m_flightState == EFlightState::Grounded;
+			const TArray<uint16, ArgusContainerAllocator<10u> >& groupExitRangeEntityIds = nearbyEntitiesComponent->GetNearbyEntities(!isGrounded).GetEntityIdsInGroupExitRange();
+			for (int32 j = 0; j < groupExitRangeEntityIds.Num(); ++j)
+			{
+				const uint16 otherEntityId = groupExitRangeEntityIds[j];
+				if (otherEntityId >= ArgusECSConstants::k_maxEntities || unionFind.Contains(otherEntityId))
+				{
+					continue;
+				}
+
+				ArgusEntity otherEntity = ArgusEntity::RetrieveEntity(otherEntityId);
+				if (!CanJoinAvoidanceGroup(otherEntity) || otherEntity.GetComponent<AvoidanceGroupingComponent>()->m_groupId != ArgusECSConstants::k_maxEntities)
+				{
+					continue;
+				}
+
+				if (ShouldLinkAvoidanceGroupMembers(memberEntity, otherEntity))
+				{
+					unionFind.AddEntityId(otherEntityId);
+					unionFind.Unite(memberEntity.GetId(), otherEntityId);
+				}
+			}
+		}
 
-	if (groupLeaderComponent->m_previousGroupId == ArgusECSConstants::k_maxEntities || groupLeaderComponent->m_groupId == ArgusECSConstants::k_maxEntities)
-	{
-		groupLeaderComponent->m_previousGroupId = groupLeaderComponent->m_groupId;
-		return;
+		const uint16 groupId = unionFind.FindRoot(entity.GetId());
+		AvoidanceGroupingComponent* groupLeaderComponent = ArgusEntity::RetrieveEntity(groupId).GetComponent<AvoidanceGroupingComponent>();
+		ARGUS_RETURN_ON_NULL(groupLeaderComponent, ArgusECSLog);
+
+		const TArray<uint16>& memberEntityIds = unionFind.GetEntityIds();
+		for (int32 i = 0; i < memberEntityIds.Num(); ++i)
+		{
+			ArgusEntity::RetrieveEntity(memberEntityIds[i]).GetComponent<AvoidanceGroupingComponent>()->m_groupId = groupId;
+			groupLeaderComponent->m_entityIdsInGroup.Add(memberEntityIds[i]);
+		}
+
+		// Kept in id order to match the full pass, so the sums reduced from the list come out the same.
+		groupLeaderComponent->m_entityIdsInGroup.Sort();
+		ReduceAvoidanceGroup(groupLeaderComponent);
 	}
 
-	if (groupLeaderComponent->m_groupId == entity.GetId())
+	UpdatePreviousAvoidanceGroup(entity, avoidanceGroupingComponent, allowNavigationRecalculation);
+}
+
+bool SpatialPartitioningSystems::TryPopulateBakedAvoidanceObstacles(SpatialPartitioningComponent* spatialPartitioningComponent, const ARecastNavMesh* navMesh, const UWorld* worldPointer)
+{
+	ARGUS_TRACE(SpatialPartitioningSystems::TryPopulateBakedAvoidanceObstacles);
+
+	ARGUS_RETURN_ON_NULL_BOOL(spatialPartitioningComponent, ArgusECSLog);
+
+	const UArgusBakedObstacles* bakedObstacles = UArgusBakedObstacles::LoadForWorld(worldPointer);
+	if (!bakedObstacles)
 	{
-		OnBecomeAvoidanceGroupLeader(entity);
+		return false;
 	}
-	else
+
+	if (!bakedObstacles->IsBakeValid(GetAvoidanceObstaclesSourceHash(spatialPartitioningComponent, navMesh)))
 	{
-		OnChangeAvoidanceGroups(entity, groupLeaderComponent);
+		ARGUS_LOG(ArgusECSLog, Warning, TEXT("[%s] %s %s is stale. Falling back to runtime obstacle extraction. Rerun the BakeAvoidanceObstacles commandlet."), ARGUS_FUNCNAME, ARGUS_NAMEOF(UArgusBakedObstacles), *bakedObstacles->GetName());
+		return false;
 	}
 
-	groupLeaderComponent->m_previousGroupId = groupLeaderComponent->m_groupId;
+	return bakedObstacles->PopulateObstacles(spatialPartitioningComponent->m_obstacles);
 }
 
 bool SpatialPartitioningSystems::GetNavMeshWalls(const SpatialPartitioningComponent* spatialPartitioningComponent, const ARecastNavMesh* navMesh, const FNavLocation& originLocation, TArray<FVector>& outNavWalls)
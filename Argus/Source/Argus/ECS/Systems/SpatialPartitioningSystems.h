@@ -14,21 +14,36 @@ class SpatialPartitioningSystems
 public:
 	static void RunSystems();
 	static void CalculateAvoidanceObstacles(SpatialPartitioningComponent* spatialPartitioningComponent, UWorld* worldPointer);
+	static bool BuildAvoidanceObstacles(const SpatialPartitioningComponent* spatialPartitioningComponent, const ARecastNavMesh* navMesh, ObstaclesContainer& outObstacles);
+	static uint32 GetAvoidanceObstaclesSourceHash(const SpatialPartitioningComponent* spatialPartitioningComponent, const ARecastNavMesh* navMesh);
 	static float FindAreaOfObstacleCartesian(const ObstaclePointArray& obstaclePoints);
 	static bool IsEntityInLineOfSightOfOther(ArgusEntity sourceEntity, ArgusEntity targetEntity);
 	static bool IsPointInLineOfSightOfEntity(ArgusEntity sourceEntity, const FVector& targetLocation);
 	static bool AnyObstaclesOrStaticEntitiesInCircle(const FVector& center, float radius, float resourceSourceBufferRadius);
+	static bool FindNearestValidPlacementLocation(const FVector& center, float radius, float resourceSourceBufferRadius, float maxSearchDistance, FVector& outLocation);
 	static void CalculateAdjacentEntityGroupsForEntity(ArgusEntity entity, bool allowNavigationRecalculation);
+	static void RequestEntityRoleIndexUpdate(ArgusEntity entity);
+	static void RequestEntityRoleIndexRebuild();
 
 private:
+	static void UpdatePlacementOccupancyGrid(SpatialPartitioningComponent* spatialPartitioningComponent);
+	static bool IsWithinResourceSourceBuffer(const SpatialPartitioningComponent* spatialPartitioningComponent, const FVector& center, float resourceSourceBufferRadius);
 	static void ClearSeenByStatus();
 	static void CacheAdjacentEntityIds(const SpatialPartitioningComponent* spatialPartitioningComponent);
-
-	static void CalculateAdjacentEntityGroups();
-	static bool FloodFillGroupRecursive(uint16 groupId, AvoidanceGroupingComponent* groupLeaderComponent, uint16 argusEntityId, uint16 lastArgusEntityId, FVector& currentPositionSum, float& numberOfEntitiesInGroup, uint16& numberOfStoppedEntities);
+	static void RegisterCachedEntitiesAsSeen(ArgusEntity entity, const NearbyEntitiesComponent* nearbyEntitiesComponent);
+	static BITMASK_ETeam GetHostileTeamMask(ETeam team);
+
+	static void CalculateAdjacentEntityGroups(SpatialPartitioningComponent* spatialPartitioningComponent);
+	static bool CanJoinAvoidanceGroup(ArgusEntity entity);
+	static bool ShouldLinkAvoidanceGroupMembers(ArgusEntity entity, ArgusEntity otherEntity);
+	static void ReduceAvoidanceGroup(AvoidanceGroupingComponent* groupLeaderComponent);
+	static void UpdatePreviousAvoidanceGroup(ArgusEntity entity, AvoidanceGroupingComponent* groupingComponent, bool allowNavigationRecalculation);
+	static bool IsEntitySettled(ArgusEntity entity);
+	static bool ShouldAvoidanceGroupSleep(const AvoidanceGroupingComponent* groupLeaderComponent);
 	static void OnBecomeAvoidanceGroupLeader(ArgusEntity entity);
 	static void OnChangeAvoidanceGroups(ArgusEntity entity, AvoidanceGroupingComponent* groupingComponent);
 
+	static bool TryPopulateBakedAvoidanceObstacles(SpatialPartitioningComponent* spatialPartitioningComponent, const ARecastNavMesh* navMesh, const UWorld* worldPointer);
 	static bool GetNavMeshWalls(const SpatialPartitioningComponent* spatialPartitioningComponent, const ARecastNavMesh* navMesh, const FNavLocation& originLocation, TArray<FVector>& outNavWalls);
 	static void ConvertWallsIntoObstacles(const TArray<FVector>& navEdges, ObstaclesContainer& outObstacles);
 	static void CalculateFixupDirectionForObstacles(ObstaclePointArray& outObstacle);
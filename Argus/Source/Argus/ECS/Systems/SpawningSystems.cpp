@@ -46,33 +46,67 @@ void SpawningSystems::SpawnEntity(const SpawningSystemsArgs& components, const S
 	ProcessQueuedSpawnEntity(components);
 }
 
-void SpawningSystems::SpawnEntityInternal(const SpawningSystemsArgs& components, const SpawnEntityInfo& spawnInfo, const UArgusActorRecord* overrideArgusActorRecord)
+void SpawningSystems::SpawnEntities(const UArgusActorRecord* argusActorRecord, ETeam team, const TArray<FVector>& spawnLocations, TArray<ArgusEntity>& outSpawnedEntities)
 {
-	ARGUS_TRACE(SpawningSystems::SpawnEntityInternal);
-
-	if (!components.AreComponentsValidCheck(ARGUS_FUNCNAME))
-	{
-		return;
-	}
+	ARGUS_TRACE(SpawningSystems::SpawnEntities);
 
-	const UArgusActorRecord* argusActorRecord = overrideArgusActorRecord ? overrideArgusActorRecord : ArgusStaticData::GetRecord<UArgusActorRecord>(spawnInfo.m_argusActorRecordId);
 	ARGUS_RETURN_ON_NULL(argusActorRecord, ArgusECSLog);
 	const UArgusEntityTemplate* argusEntityTemplate = argusActorRecord->m_entityTemplate.LoadAndStorePtr();
 	ARGUS_RETURN_ON_NULL(argusEntityTemplate, ArgusECSLog);
 
-	if (components.m_taskComponent->m_spawningState != ESpawningState::SpawningEntity)
+	const int32 firstSpawnedEntityIndex = outSpawnedEntities.Num();
+	argusEntityTemplate->MakeEntities(spawnLocations.Num(), outSpawnedEntities);
+	if (team != ETeam::None)
 	{
-		ARGUS_LOG
-		(
-			ArgusECSLog, Error, TEXT("[%s] Could not spawn %s. %s is not equal to %s."), 
-			ARGUS_FUNCNAME, ARGUS_NAMEOF(ArgusEntity), ARGUS_NAMEOF(m_spawningState), ARGUS_NAMEOF(ESpawningState::SpawningEntity)
-		);
-		return;
+		ArgusEntity::RegisterTeam(team);
 	}
 
-	components.m_taskComponent->m_spawningState = ESpawningState::None;
+	SpatialPartitioningComponent* spatialPartitioningComponent = nullptr;
+	if (ArgusEntity singletonEntity = ArgusEntity::GetSingletonEntity())
+	{
+		spatialPartitioningComponent = singletonEntity.GetComponent<SpatialPartitioningComponent>();
+	}
+
+	for (int32 i = firstSpawnedEntityIndex; i < outSpawnedEntities.Num(); ++i)
+	{
+		InitializeSpawnedEntity(outSpawnedEntities[i], argusActorRecord, team, spawnLocations[i - firstSpawnedEntityIndex], spatialPartitioningComponent);
+	}
+}
+
+ArgusEntity SpawningSystems::SpawnSingleEntity(const UArgusActorRecord* argusActorRecord, ETeam team, const FVector& spawnLocation)
+{
+	ARGUS_TRACE(SpawningSystems::SpawnSingleEntity);
+
+	ARGUS_RETURN_ON_NULL_VALUE(argusActorRecord, ArgusECSLog, ArgusEntity::k_emptyEntity);
+	const UArgusEntityTemplate* argusEntityTemplate = argusActorRecord->m_entityTemplate.LoadAndStorePtr();
+	ARGUS_RETURN_ON_NULL_VALUE(argusEntityTemplate, ArgusECSLog, ArgusEntity::k_emptyEntity);
 
 	ArgusEntity spawnedEntity = argusEntityTemplate->MakeEntity();
+	if (!spawnedEntity)
+	{
+		return ArgusEntity::k_emptyEntity;
+	}
+
+	if (team != ETeam::None)
+	{
+		ArgusEntity::RegisterTeam(team);
+	}
+
+	SpatialPartitioningComponent* spatialPartitioningComponent = nullptr;
+	if (ArgusEntity singletonEntity = ArgusEntity::GetSingletonEntity())
+	{
+		spatialPartitioningComponent = singletonEntity.GetComponent<SpatialPartitioningComponent>();
+	}
+
+	InitializeSpawnedEntity(spawnedEntity, argusActorRecord, team, spawnLocation, spatialPartitioningComponent);
+	return spawnedEntity;
+}
+
+void SpawningSystems::InitializeSpawnedEntity(ArgusEntity spawnedEntity, const UArgusActorRecord* argusActorRecord, ETeam team, const FVector& spawnLocation, SpatialPartitioningComponent* spatialPartitioningComponent)
+{
+	ARGUS_RETURN_ON_INVALID_ENTITY(spawnedEntity, ArgusECSLog);
+	ARGUS_RETURN_ON_NULL(argusActorRecord, ArgusECSLog);
+
 	TaskComponent* spawnedEntityTaskComponent = spawnedEntity.GetOrAddComponent<TaskComponent>();
 	if (!spawnedEntityTaskComponent)
 	{
@@ -87,11 +121,12 @@ void SpawningSystems::SpawnEntityInternal(const SpawningSystemsArgs& components,
 	spawnedEntityTaskComponent->m_baseState = EBaseState::SpawnedWaitingForActorTake;
 	spawnedEntityTaskComponent->m_spawnedFromArgusActorRecordId = argusActorRecord->m_id;
 
-	if (IdentityComponent* spawningEntityIdentityComponent = components.m_entity.GetComponent<IdentityComponent>())
+	// No team means the spawned entity keeps the team from its template.
+	if (team != ETeam::None)
 	{
 		if (IdentityComponent* spawnedEntityIdentityComponent = spawnedEntity.GetComponent<IdentityComponent>())
 		{
-			spawnedEntityIdentityComponent->m_team = spawningEntityIdentityComponent->m_team;
+			spawnedEntityIdentityComponent->m_team = team;
 		}
 	}
 
@@ -101,6 +136,54 @@ void SpawningSystems::SpawnEntityInternal(const SpawningSystemsArgs& components,
 		return;
 	}
 
+	spawnedEntityTransformComponent->m_location = spawnLocation;
+
+	if (!spatialPartitioningComponent)
+	{
+		return;
+	}
+
+	if (spawnedEntityTaskComponent->m_flightState == EFlightState::Flying || spawnedEntityTaskComponent->m_flightState == EFlightState::Landing)
+	{
+		spawnedEntityTransformComponent->m_location.Z = spatialPartitioningComponent->m_flyingPlaneHeight;
+		spatialPartitioningComponent->m_flyingArgusEntityKDTree.InsertArgusEntityIntoKDTree(spawnedEntity);
+	}
+	else
+	{
+		spatialPartitioningComponent->m_argusEntityKDTree.InsertArgusEntityIntoKDTree(spawnedEntity);
+	}
+}
+
+void SpawningSystems::SpawnEntityInternal(const SpawningSystemsArgs& components, const SpawnEntityInfo& spawnInfo, const UArgusActorRecord* overrideArgusActorRecord)
+{
+	ARGUS_TRACE(SpawningSystems::SpawnEntityInternal);
+
+	if (!components.AreComponentsValidCheck(ARGUS_FUNCNAME))
+	{
+		return;
+	}
+
+	const UArgusActorRecord* argusActorRecord = overrideArgusActorRecord ? overrideArgusActorRecord : ArgusStaticData::GetRecord<UArgusActorRecord>(spawnInfo.m_argusActorRecordId);
+	ARGUS_RETURN_ON_NULL(argusActorRecord, ArgusECSLog);
+
+	if (components.m_taskComponent->m_spawningState != ESpawningState::SpawningEntity)
+	{
+		ARGUS_LOG
+		(
+			ArgusECSLog, Error, TEXT("[%s] Could not spawn %s. %s is not equal to %s."), 
+			ARGUS_FUNCNAME, ARGUS_NAMEOF(ArgusEntity), ARGUS_NAMEOF(m_spawningState), ARGUS_NAMEOF(ESpawningState::SpawningEntity)
+		);
+		return;
+	}
+
+	components.m_taskComponent->m_spawningState = ESpawningState::None;
+
+	ETeam team = ETeam::None;
+	if (const IdentityComponent* spawningEntityIdentityComponent = components.m_entity.GetComponent<IdentityComponent>())
+	{
+		team = spawningEntityIdentityComponent->m_team;
+	}
+
 	FVector spawnLocation = components.m_transformComponent->m_location;
 	EMovementState initialSpawnMovementState = EMovementState::None;
 
@@ -113,7 +196,17 @@ void SpawningSystems::SpawnEntityInternal(const SpawningSystemsArgs& components,
 		GetSpawnLocationAndNavigationState(components, spawnLocation, initialSpawnMovementState);
 	}
 
-	spawnedEntityTransformComponent->m_location = spawnLocation;
+	ArgusEntity spawnedEntity = SpawnSingleEntity(argusActorRecord, team, spawnLocation);
+	if (!spawnedEntity)
+	{
+		return;
+	}
+
+	TaskComponent* spawnedEntityTaskComponent = spawnedEntity.GetComponent<TaskComponent>();
+	if (!spawnedEntityTaskComponent || !spawnedEntity.GetComponent<TransformComponent>())
+	{
+		return;
+	}
 
 	if (spawnInfo.m_needsConstruction)
 	{
@@ -140,22 +233,6 @@ void SpawningSystems::SpawnEntityInternal(const SpawningSystemsArgs& components,
 		}
 	}
 
-	if (ArgusEntity singletonEntity = ArgusEntity::GetSingletonEntity())
-	{
-		if (SpatialPartitioningComponent* spatialPartitioningComponent = singletonEntity.GetComponent<SpatialPartitioningComponent>())
-		{
-			if (spawnedEntityTaskComponent->m_flightState == EFlightState::Flying || spawnedEntityTaskComponent->m_flightState == EFlightState::Landing)
-			{
-				spawnedEntityTransformComponent->m_location.Z = spatialPartitioningComponent->m_flyingPlaneHeight;
-				spatialPartitioningComponent->m_flyingArgusEntityKDTree.InsertArgusEntityIntoKDTree(spawnedEntity);
-			}
-			else
-			{
-				spatialPartitioningComponent->m_argusEntityKDTree.InsertArgusEntityIntoKDTree(spawnedEntity);
-			}
-		}
-	}
-
 	NavigationComponent* spawnedEntityNavigationComponent = spawnedEntity.GetComponent<NavigationComponent>();
 	TargetingComponent* spawnedEntityTargetingComponent = spawnedEntity.GetComponent<TargetingComponent>();
 	if (!spawnedEntityNavigationComponent || !spawnedEntityTargetingComponent)
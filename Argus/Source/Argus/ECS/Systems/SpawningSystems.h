@@ -9,8 +9,11 @@ class SpawningSystems
 public:
 	static bool RunSystems(float deltaTime);
 	static void SpawnEntity(const SpawningSystemsArgs& components, const SpawnEntityInfo& spawnInfo, const UArgusActorRecord* overrideArgusActorRecord = nullptr);
+	static void SpawnEntities(const UArgusActorRecord* argusActorRecord, ETeam team, const TArray<FVector>& spawnLocations, TArray<ArgusEntity>& outSpawnedEntities);
 
 private:
+	static ArgusEntity SpawnSingleEntity(const UArgusActorRecord* argusActorRecord, ETeam team, const FVector& spawnLocation);
+	static void InitializeSpawnedEntity(ArgusEntity spawnedEntity, const UArgusActorRecord* argusActorRecord, ETeam team, const FVector& spawnLocation, SpatialPartitioningComponent* spatialPartitioningComponent);
 	static void SpawnEntityInternal(const SpawningSystemsArgs& components, const SpawnEntityInfo& spawnInfo, const UArgusActorRecord* overrideArgusActorRecord);
 	static void SpawnEntityFromQueue(const SpawningSystemsArgs& components);
 	static void ProcessCancelationRequest(const SpawningSystemsArgs& components);
@@ -13,16 +13,74 @@ void TaskSystems::RunSystems(float deltaTime)
 {
 	ARGUS_TRACE(TaskSystems::RunSystems);
 
-	ArgusIterators::IterateSystemsArgs<TaskSystemsArgs>([deltaTime](TaskSystemsArgs& components)
+	// Scanning sight for new work is the expensive part of idle processing, so it is only done for entities that just became idle or that saw something new.
+	// Everyone else that is idle already scanned what is in sight and found nothing to do.
+	TArray<uint16> idleEntityIdsToDispatch;
+	ArgusIterators::IterateSystemsArgs<TaskSystemsArgs>([&idleEntityIdsToDispatch](TaskSystemsArgs& components)
 	{
 		if ((components.m_entity.IsKillable() && !components.m_entity.IsAlive()) || components.m_entity.IsPassenger())
 		{
+			components.m_taskComponent->m_wasIdleLastUpdate = false;
 			return;
 		}
 
-		ProcessIdleEntity(components);
+		QueueIdleEntityIfNeeded(components, idleEntityIdsToDispatch);
 		ProcessInRangeOfTargetEntity(components);
 	});
+
+	TaskSystemsArgs components;
+	for (int32 i = 0; i < idleEntityIdsToDispatch.Num(); ++i)
+	{
+		if (components.PopulateArguments(ArgusEntity::RetrieveEntity(idleEntityIdsToDispatch[i])))
+		{
+			ProcessIdleEntity(components);
+		}
+	}
+}
+
+void TaskSystems::QueueIdleEntityIfNeeded(const TaskSystemsArgs& components, TArray<uint16>& idleEntityIdsToDispatch)
+{
+	if (!components.AreComponentsValidCheck(ARGUS_FUNCNAME))
+	{
+		return;
+	}
+
+	TaskComponent* taskComponent = components.m_taskComponent;
+	const bool isIdle = components.m_entity.IsIdle();
+	const bool becameIdle = isIdle && !taskComponent->m_wasIdleLastUpdate;
+	const bool hasSightRangeChanged = components.m_nearbyEntitiesComponent->m_hasSightRangeChanged;
+
+	// Taking off and landing entities cannot attack, so whatever they skipped while transitioning has to be looked at again once they finish.
+	const bool hasFlightStateChanged = taskComponent->m_flightState != taskComponent->m_flightStateLastUpdate;
+	taskComponent->m_wasIdleLastUpdate = isIdle;
+	taskComponent->m_flightStateLastUpdate = taskComponent->m_flightState;
+	components.m_nearbyEntitiesComponent->m_hasSightRangeChanged = false;
+
+	if (!isIdle)
+	{
+		return;
+	}
+
+	// The first fallback rescan is offset by entity id, so entities that became idle together do not all rescan on the same update.
+	if (becameIdle)
+	{
+		taskComponent->m_updatesUntilIdleRescan = k_updatesPerIdleRescan + (components.m_entity.GetId() % k_updatesPerIdleRescan);
+	}
+	else if (taskComponent->m_updatesUntilIdleRescan > 0u)
+	{
+		taskComponent->m_updatesUntilIdleRescan--;
+	}
+
+	const bool isRescanDue = taskComponent->m_updatesUntilIdleRescan == 0u;
+	if (isRescanDue)
+	{
+		taskComponent->m_updatesUntilIdleRescan = k_updatesPerIdleRescan;
+	}
+
+	if (becameIdle || hasSightRangeChanged || hasFlightStateChanged || isRescanDue)
+	{
+		idleEntityIdsToDispatch.Add(components.m_entity.GetId());
+	}
 }
 
 void TaskSystems::ProcessIdleEntity(const TaskSystemsArgs& components)
@@ -45,27 +103,16 @@ void TaskSystems::ProcessIdleEntity(const TaskSystemsArgs& components)
 
 	for (int32 i = 0; i < components.m_nearbyEntitiesComponent->m_nearbyEntities.GetEntityIdsInSightRange().Num(); ++i)
 	{
-		if (ProcessDispatchingForEntityPair(components, components.m_nearbyEntitiesComponent->m_nearbyEntities.GetEntityIdsInSightRange()[i]))
+		if (DispatchToConstructionIfAble(components, ArgusEntity::RetrieveEntity(components.m_nearbyEntitiesComponent->m_nearbyEntities.GetEntityIdsInSightRange()[i])))
 		{
 			return;
 		}
 	}
-}
 
-bool TaskSystems::ProcessDispatchingForEntityPair(const TaskSystemsArgs& components, uint16 potentialTargetEntityId)
-{
-	ArgusEntity potentialTargetEntity = ArgusEntity::RetrieveEntity(potentialTargetEntityId);
-
-	if (DispatchToConstructionIfAble(components, potentialTargetEntity))
+	components.m_nearbyEntitiesComponent->IterateNearestHostileEntityIds(true, false, [&components](uint16 targetEntityId)
 	{
-		return true;
-	}
-	if (DispatchToCombatIfAble(components, potentialTargetEntity))
-	{
-		return true;
-	}
-
-	return false;
+		return DispatchToCombatIfAble(components, ArgusEntity::RetrieveEntity(targetEntityId));
+	});
 }
 
 bool TaskSystems::DispatchToConstructionIfAble(const TaskSystemsArgs& components, ArgusEntity potentialTargetEntity)
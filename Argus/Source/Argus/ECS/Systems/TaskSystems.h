@@ -8,10 +8,13 @@ class TaskSystems
 {
 public:
 	static void RunSystems(float deltaTime);
+	static void QueueIdleEntityIfNeeded(const TaskSystemsArgs& components, TArray<uint16>& idleEntityIdsToDispatch);
+
+	// Idle entities also rescan on a slow cadence, so changes that do not raise an event (like team alignment changes) are still picked up.
+	static constexpr uint16 k_updatesPerIdleRescan = 60u;
 
 private:
 	static void ProcessIdleEntity(const TaskSystemsArgs& components);
-	static bool ProcessDispatchingForEntityPair(const TaskSystemsArgs& components, uint16 potentialTargetEntityId);
 	static bool DispatchToConstructionIfAble(const TaskSystemsArgs& components, ArgusEntity potentialTargetEntity);
 	static bool DispatchToCombatIfAble(const TaskSystemsArgs& components, ArgusEntity potentialTargetEntity);
 
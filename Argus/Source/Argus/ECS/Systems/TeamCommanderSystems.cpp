@@ -2,6 +2,7 @@
 
 #include "TeamCommanderSystems.h"
 #include "ArgusEntity.h"
+#include "ArgusIterators.h"
 #include "ArgusLogging.h"
 #include "ArgusMacros.h"
 #include "ArgusMath.h"
@@ -10,11 +11,12 @@
 #include "Systems/TeamCommanderSystems_AssignEntities.h"
 
 #if !UE_BUILD_SHIPPING
+#include "ArgusCVars.h"
 #include "ArgusECSDebugger.h"
 #include "DrawDebugHelpers.h"
 #endif // !UE_BUILD_SHIPPING
 
-void TeamCommanderSystems::RunSystems(float)
+void TeamCommanderSystems::RunSystems(float deltaTime)
 {
 	ARGUS_TRACE(TeamCommanderSystems::RunSystems);
 
@@ -25,9 +27,10 @@ void TeamCommanderSystems::RunSystems(float)
 	}
 #endif
 
-	TeamCommanderSystems_GatherInfo::RunSystems(false);
-	TeamCommanderSystems_UpdatePriorities::RunSystems();
-	TeamCommanderSystems_AssignEntities::RunSystems();
+	ArgusIterators::IterateTeamEntities([deltaTime](ArgusEntity teamCommanderEntity)
+	{
+		TeamCommanderSystems::RunScheduledUpdatePerCommanderEntity(teamCommanderEntity, deltaTime);
+	});
 }
 
 void TeamCommanderSystems::InitializeRevealedAreas(TeamCommanderComponent* teamCommanderComponent)
@@ -40,31 +43,141 @@ void TeamCommanderSystems::InitializeRevealedAreas(TeamCommanderComponent* teamC
 	const float areasPerWidth = ArgusMath::SafeDivide(worldspaceWidth, teamCommanderComponent->m_revealedAreaDimensionLength);
 	const int32 numAreas = FMath::FloorToInt32(FMath::Square(areasPerWidth));
 	teamCommanderComponent->m_revealedAreas.SetNum(numAreas, false);
+	InitializeAreaLayers(teamCommanderComponent, FMath::FloorToInt32(areasPerWidth));
+}
+
+// The influence map and scouting distance field are transient, so this also rebuilds them from the saved revealed areas after a load. Revealed areas start out as freshly
+// explored, and from then on only areas that get explored or turn stale are reported to the scouting distance field.
+void TeamCommanderSystems::InitializeAreaLayers(TeamCommanderComponent* teamCommanderComponent, int32 areasPerDimension)
+{
+	ARGUS_RETURN_ON_NULL(teamCommanderComponent, ArgusECSLog);
+
+	teamCommanderComponent->m_influenceMap.Initialize(areasPerDimension);
+	teamCommanderComponent->m_scoutingDistanceField.Initialize(areasPerDimension);
+	teamCommanderComponent->IterateRevealedAreas(true, [teamCommanderComponent](int32 areaIndex)
+	{
+		teamCommanderComponent->m_influenceMap.ResetExplorationAge(areaIndex);
+	});
+
+	const int32 numAreas = teamCommanderComponent->m_influenceMap.GetNumAreas();
+	for (int32 i = 0; i < numAreas; ++i)
+	{
+		teamCommanderComponent->m_scoutingDistanceField.SetScoutableArea(i, ShouldScoutArea(i, teamCommanderComponent));
+	}
+	teamCommanderComponent->m_scoutingDistanceField.UpdateIfDirty();
+}
+
+void TeamCommanderSystems::InitializeUpdateSchedule(TeamCommanderComponent* teamCommanderComponent, uint8 scheduleSlot)
+{
+	ARGUS_RETURN_ON_NULL(teamCommanderComponent, ArgusECSLog);
+
+	// Spreading the commanders across the interval keeps them from all starting an update on the same frame.
+	teamCommanderComponent->m_updatePhase = ETeamCommanderUpdatePhase::Idle;
+	teamCommanderComponent->m_timeSinceLastUpdate = 0.0f;
+	teamCommanderComponent->m_timeUntilNextUpdate = teamCommanderComponent->m_updateIntervalSeconds * (static_cast<float>(scheduleSlot) / static_cast<float>(NUM_TEAMS));
 }
 
 void TeamCommanderSystems::PerformInitialUpdate()
 {
 	ARGUS_TRACE(TeamCommanderSystems::PerformInitialUpdate);
 
-	TeamCommanderSystems_GatherInfo::RunSystems(true);
+	TeamCommanderSystems_GatherInfo::RunSystems(0.0f);
+}
+
+void TeamCommanderSystems::RunScheduledUpdatePerCommanderEntity(ArgusEntity teamCommanderEntity, float deltaTime)
+{
+	ARGUS_TRACE(TeamCommanderSystems::RunScheduledUpdatePerCommanderEntity);
+
+	TeamCommanderComponent* teamCommanderComponent = teamCommanderEntity.GetComponent<TeamCommanderComponent>();
+	ARGUS_RETURN_ON_NULL(teamCommanderComponent, ArgusECSLog);
+
+	teamCommanderComponent->m_timeSinceLastUpdate += deltaTime;
+	teamCommanderComponent->m_timeUntilNextUpdate -= deltaTime;
+	if (teamCommanderComponent->m_updatePhase == ETeamCommanderUpdatePhase::Idle)
+	{
+		if (teamCommanderComponent->m_timeUntilNextUpdate > 0.0f)
+		{
+			return;
+		}
+
+		teamCommanderComponent->m_timeUntilNextUpdate = FMath::Max(teamCommanderComponent->m_timeUntilNextUpdate + teamCommanderComponent->m_updateIntervalSeconds, 0.0f);
+		TeamCommanderSystems_GatherInfo::BeginUpdateForCommander(teamCommanderEntity, teamCommanderComponent->m_timeSinceLastUpdate);
+		teamCommanderComponent->m_timeSinceLastUpdate = 0.0f;
+		teamCommanderComponent->m_updatePhase = ETeamCommanderUpdatePhase::GatherInfo;
+	}
+
+	// How far the update gets is decided by the entity budget alone, so that it is the same on every machine. The slice is only timed for the debugger.
+#if !UE_BUILD_SHIPPING
+	const uint64 sliceStartCycles = FPlatformTime::Cycles64();
+#endif //!UE_BUILD_SHIPPING
+	int32 remainingEntityBudget = FMath::Max(teamCommanderComponent->m_updateEntityBudget, 1);
+
+	// Each phase picks up where the last frame left off. Gathering info can stop partway through the entity list, and the later phases wait for the next frame
+	// if the budget has already been spent.
+	if (teamCommanderComponent->m_updatePhase == ETeamCommanderUpdatePhase::GatherInfo)
+	{
+		if (TeamCommanderSystems_GatherInfo::ContinueUpdateForCommander(teamCommanderEntity, remainingEntityBudget))
+		{
+			TeamCommanderSystems_GatherInfo::FinishUpdateForCommander(teamCommanderEntity);
+			teamCommanderComponent->m_updatePhase = ETeamCommanderUpdatePhase::UpdatePriorities;
+		}
+	}
+
+	if (teamCommanderComponent->m_updatePhase == ETeamCommanderUpdatePhase::UpdatePriorities && remainingEntityBudget > 0)
+	{
+		TeamCommanderSystems_UpdatePriorities::UpdateTeamCommanderPriorities(teamCommanderEntity);
+		teamCommanderComponent->m_updatePhase = ETeamCommanderUpdatePhase::AssignEntities;
+	}
+
+	if (teamCommanderComponent->m_updatePhase == ETeamCommanderUpdatePhase::AssignEntities && remainingEntityBudget > 0)
+	{
+		TeamCommanderSystems_AssignEntities::ActUponUpdatesPerCommanderEntity(teamCommanderEntity);
+		teamCommanderComponent->m_updatePhase = ETeamCommanderUpdatePhase::Idle;
+	}
+
+#if !UE_BUILD_SHIPPING
+	const double sliceMicroseconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - sliceStartCycles) * 1000000.0;
+	teamCommanderComponent->m_lastUpdateSliceMicroseconds = static_cast<float>(sliceMicroseconds);
+	if (sliceMicroseconds > ArgusCVars::CVarTeamCommanderSlowSliceMicroseconds.GetValueOnGameThread())
+	{
+		teamCommanderComponent->m_slowUpdateSliceCount++;
+	}
+#endif //!UE_BUILD_SHIPPING
+}
+
+int32 TeamCommanderSystems::GetAreasPerDimension(const TeamCommanderComponent* teamCommanderComponent)
+{
+	ARGUS_RETURN_ON_NULL_VALUE(teamCommanderComponent, ArgusECSLog, 0);
+
+	SpatialPartitioningComponent* spatialPartitioningComponent = ArgusEntity::GetSingletonEntity().GetComponent<SpatialPartitioningComponent>();
+	ARGUS_RETURN_ON_NULL_VALUE(spatialPartitioningComponent, ArgusECSLog, 0);
+
+	const float worldspaceWidth = spatialPartitioningComponent->m_validSpaceExtent * 2.0f;
+	return FMath::FloorToInt32(ArgusMath::SafeDivide(worldspaceWidth, teamCommanderComponent->m_revealedAreaDimensionLength));
 }
 
 int32 TeamCommanderSystems::GetAreaIndexFromWorldSpaceLocation(const TeamCommanderSystemsArgs& components, const TeamCommanderComponent* teamCommanderComponent)
 {
-	ARGUS_RETURN_ON_NULL_VALUE(teamCommanderComponent, ArgusECSLog, -1);
 	if (!components.AreComponentsValidCheck(ARGUS_FUNCNAME) || !components.m_transformComponent || !components.m_targetingComponent)
 	{
 		return -1;
 	}
 
+	return GetAreaIndexFromWorldSpaceLocation(components.m_transformComponent->m_location, teamCommanderComponent);
+}
+
+int32 TeamCommanderSystems::GetAreaIndexFromWorldSpaceLocation(const FVector& location, const TeamCommanderComponent* teamCommanderComponent)
+{
+	ARGUS_RETURN_ON_NULL_VALUE(teamCommanderComponent, ArgusECSLog, -1);
+
 	SpatialPartitioningComponent* spatialPartitioningComponent = ArgusEntity::GetSingletonEntity().GetComponent<SpatialPartitioningComponent>();
 	ARGUS_RETURN_ON_NULL_VALUE(spatialPartitioningComponent, ArgusECSLog, -1);
 
 	const float worldspaceWidth = spatialPartitioningComponent->m_validSpaceExtent * 2.0f;
 	const float areasPerDimension = ArgusMath::SafeDivide(worldspaceWidth, teamCommanderComponent->m_revealedAreaDimensionLength);
 
-	float xValue = ArgusMath::SafeDivide(components.m_transformComponent->m_location.Y + spatialPartitioningComponent->m_validSpaceExtent, teamCommanderComponent->m_revealedAreaDimensionLength);
-	float yValue = ArgusMath::SafeDivide((-components.m_transformComponent->m_location.X) + spatialPartitioningComponent->m_validSpaceExtent, teamCommanderComponent->m_revealedAreaDimensionLength);
+	float xValue = ArgusMath::SafeDivide(location.Y + spatialPartitioningComponent->m_validSpaceExtent, teamCommanderComponent->m_revealedAreaDimensionLength);
+	float yValue = ArgusMath::SafeDivide((-location.X) + spatialPartitioningComponent->m_validSpaceExtent, teamCommanderComponent->m_revealedAreaDimensionLength);
 
 	int32 xValue32 = FMath::FloorToInt32(xValue);
 	int32 yValue32 = FMath::FloorToInt32(yValue);
@@ -98,66 +211,50 @@ FVector TeamCommanderSystems::GetWorldSpaceLocationFromAreaIndex(int32 areaIndex
 	return output;
 }
 
-int32 TeamCommanderSystems::GetClosestUnrevealedAreaToEntity(const TeamCommanderSystemsArgs& components, const TeamCommanderComponent* teamCommanderComponent)
+int32 TeamCommanderSystems::GetClosestAreaToScoutForEntity(const TeamCommanderSystemsArgs& components, const TeamCommanderComponent* teamCommanderComponent)
 {
 	ARGUS_RETURN_ON_NULL_VALUE(teamCommanderComponent, ArgusECSLog, -1);
 
-	SpatialPartitioningComponent* spatialPartitioningComponent = ArgusEntity::GetSingletonEntity().GetComponent<SpatialPartitioningComponent>();
-	ARGUS_RETURN_ON_NULL_VALUE(spatialPartitioningComponent, ArgusECSLog, -1);
+	const int32 entityAreaIndex = GetAreaIndexFromWorldSpaceLocation(components, teamCommanderComponent);
+	return teamCommanderComponent->m_scoutingDistanceField.GetNearestScoutableAreaIndex(entityAreaIndex);
+}
 
-	const float worldspaceWidth = spatialPartitioningComponent->m_validSpaceExtent * 2.0f;
-	const int32 areasPerDimension = FMath::FloorToInt32(ArgusMath::SafeDivide(worldspaceWidth, teamCommanderComponent->m_revealedAreaDimensionLength));
-	int32 entityXCoordinate, entityYCoordinate;
-	ConvertAreaIndexToAreaCoordinates(GetAreaIndexFromWorldSpaceLocation(components, teamCommanderComponent), areasPerDimension, entityXCoordinate, entityYCoordinate);
+bool TeamCommanderSystems::ShouldScoutArea(int32 areaIndex, const TeamCommanderComponent* teamCommanderComponent)
+{
+	ARGUS_RETURN_ON_NULL_BOOL(teamCommanderComponent, ArgusECSLog);
 
-	if (entityXCoordinate < 0 || entityYCoordinate < 0)
+	if (areaIndex < 0 || areaIndex >= teamCommanderComponent->m_revealedAreas.Num())
 	{
-		return -1;
+		return false;
 	}
 
-	for (int32 i = 1; i < areasPerDimension; ++i)
+	if (!teamCommanderComponent->m_revealedAreas[areaIndex])
 	{
-		const int32 leftBoundX = FMath::Max(entityXCoordinate - i, 0);
-		const int32 rightBoundX = FMath::Min(entityXCoordinate + i, (areasPerDimension - 1));
-		const int32 upperBoundY = FMath::Max(entityYCoordinate - i, 0);
-		const int32 lowerBoundY = FMath::Min(entityYCoordinate + i, (areasPerDimension - 1));
+		return true;
+	}
 
-		TArray<int32> validAreasNearby;
-		for (int32 j = -i; j <= i; ++j)
-		{
-			const int32 xBoundY = FMath::Min(FMath::Max(entityYCoordinate + j, 0), (areasPerDimension - 1));
-			const int32 yBoundX = FMath::Min(FMath::Max(entityXCoordinate + j, 0), (areasPerDimension - 1));
-
-			int32 indexToCheck;
-			ConvertAreaCoordinatesToAreaIndex(leftBoundX, xBoundY, areasPerDimension, indexToCheck);
-			if (indexToCheck >= 0 && !teamCommanderComponent->m_revealedAreas[indexToCheck])
-			{
-				validAreasNearby.Add(indexToCheck);
-			}
-			ConvertAreaCoordinatesToAreaIndex(rightBoundX, xBoundY, areasPerDimension, indexToCheck);
-			if (indexToCheck >= 0 && !teamCommanderComponent->m_revealedAreas[indexToCheck])
-			{
-				validAreasNearby.Add(indexToCheck);
-			}
-			ConvertAreaCoordinatesToAreaIndex(yBoundX, upperBoundY, areasPerDimension, indexToCheck);
-			if (indexToCheck >= 0 && !teamCommanderComponent->m_revealedAreas[indexToCheck])
-			{
-				validAreasNearby.Add(indexToCheck);
-			}
-			ConvertAreaCoordinatesToAreaIndex(yBoundX, lowerBoundY, areasPerDimension, indexToCheck);
-			if (indexToCheck >= 0 && !teamCommanderComponent->m_revealedAreas[indexToCheck])
-			{
-				validAreasNearby.Add(indexToCheck);
-			}
-		}
+	return teamCommanderComponent->m_influenceMap.GetInfluence(EInfluenceLayer::ExplorationAge, areaIndex) >= ArgusECSConstants::k_teamCommanderStaleAreaExplorationAge;
+}
 
-		if (validAreasNearby.Num() > 0)
-		{
-			return validAreasNearby[FMath::RandRange(0, validAreasNearby.Num() - 1)];
-		}
+// Exploration age only grows when an update begins, so an area is observed if an entity on the team stood in it during the last gathered update.
+bool TeamCommanderSystems::IsAreaObserved(int32 areaIndex, const TeamCommanderComponent* teamCommanderComponent)
+{
+	ARGUS_RETURN_ON_NULL_BOOL(teamCommanderComponent, ArgusECSLog);
+
+	if (areaIndex < 0 || areaIndex >= teamCommanderComponent->m_revealedAreas.Num() || !teamCommanderComponent->m_revealedAreas[areaIndex])
+	{
+		return false;
 	}
 
-	return -1;
+	return teamCommanderComponent->m_influenceMap.GetInfluence(EInfluenceLayer::ExplorationAge, areaIndex) <= 0.0f;
+}
+
+bool TeamCommanderSystems::IsAreaContested(int32 areaIndex, const TeamCommanderComponent* teamCommanderComponent)
+{
+	ARGUS_RETURN_ON_NULL_BOOL(teamCommanderComponent, ArgusECSLog);
+
+	const InfluenceMap& influenceMap = teamCommanderComponent->m_influenceMap;
+	return influenceMap.GetInfluence(EInfluenceLayer::EnemyStrength, areaIndex) > influenceMap.GetInfluence(EInfluenceLayer::FriendlyStrength, areaIndex);
 }
 
 void TeamCommanderSystems::ConvertAreaIndexToAreaCoordinates(int32 areaIndex, int32 areasPerDimension, int32& xCoordinate, int32& yCoordinate)
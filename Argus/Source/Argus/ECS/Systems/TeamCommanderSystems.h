@@ -9,16 +9,26 @@ class UAbilityRecord;
 class TeamCommanderSystems
 {
 public:
-	static void RunSystems(float);
+	static void RunSystems(float deltaTime);
 	static void InitializeRevealedAreas(TeamCommanderComponent* teamCommanderComponent);
+	static void InitializeAreaLayers(TeamCommanderComponent* teamCommanderComponent, int32 areasPerDimension);
+	static void InitializeUpdateSchedule(TeamCommanderComponent* teamCommanderComponent, uint8 scheduleSlot);
 	static void PerformInitialUpdate();
 
+	static int32 GetAreasPerDimension(const TeamCommanderComponent* teamCommanderComponent);
 	static int32 GetAreaIndexFromWorldSpaceLocation(const TeamCommanderSystemsArgs& components, const TeamCommanderComponent* teamCommanderComponent);
+	static int32 GetAreaIndexFromWorldSpaceLocation(const FVector& location, const TeamCommanderComponent* teamCommanderComponent);
 	static FVector GetWorldSpaceLocationFromAreaIndex(int32 areaIndex, const TeamCommanderComponent* teamCommanderComponent);
-	static int32 GetClosestUnrevealedAreaToEntity(const TeamCommanderSystemsArgs& components, const TeamCommanderComponent* teamCommanderComponent);
+	static int32 GetClosestAreaToScoutForEntity(const TeamCommanderSystemsArgs& components, const TeamCommanderComponent* teamCommanderComponent);
+	static bool ShouldScoutArea(int32 areaIndex, const TeamCommanderComponent* teamCommanderComponent);
+	static bool IsAreaObserved(int32 areaIndex, const TeamCommanderComponent* teamCommanderComponent);
+	static bool IsAreaContested(int32 areaIndex, const TeamCommanderComponent* teamCommanderComponent);
 	static void ConvertAreaIndexToAreaCoordinates(int32 areaIndex, int32 areasPerDimension, int32& xCoordinate, int32& yCoordinate);
 	static void ConvertAreaCoordinatesToAreaIndex(int32 xCoordinate, int32 yCoordinate, int32 areasPerDimension, int32& areaIndex);
 
+private:
+	static void RunScheduledUpdatePerCommanderEntity(ArgusEntity teamCommanderEntity, float deltaTime);
+
 public:
 #if !UE_BUILD_SHIPPING
 	static void DebugRevealedAreasForTeamEntityId(uint16 teamEntityId);
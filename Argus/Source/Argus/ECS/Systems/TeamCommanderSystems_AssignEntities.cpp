@@ -1,7 +1,6 @@
 // Copyright Karazaa. This is a part of an RTS project called Argus.
 
 #include "TeamCommanderSystems_AssignEntities.h"
-#include "ArgusIterators.h"
 #include "ArgusLogging.h"
 #include "ArgusMacros.h"
 #include "RecordDefinitions/AbilityRecord.h"
@@ -12,13 +11,6 @@
 #include "Systems/TeamCommanderSystems.h"
 #include "Systems/TransformSystems.h"
 
-void TeamCommanderSystems_AssignEntities::RunSystems()
-{
-	ARGUS_TRACE(TeamCommanderSystems_AssignEntities::RunSystems);
-
-	ArgusIterators::IterateTeamEntities(TeamCommanderSystems_AssignEntities::ActUponUpdatesPerCommanderEntity);
-}
-
 void TeamCommanderSystems_AssignEntities::ActUponUpdatesPerCommanderEntity(ArgusEntity teamEntity)
 {
 	ARGUS_TRACE(TeamCommanderSystems_AssignEntities::ActUponUpdatesPerCommanderEntity);
@@ -41,7 +33,14 @@ void TeamCommanderSystems_AssignEntities::ActUponUpdatesPerCommanderEntity(Argus
 
 	for (int32 i = 0; i < components.m_baseComponent->m_idleEntityIdsForTeam.Num(); ++i)
 	{
-		AssignIdleEntityToWork(ArgusEntity::RetrieveEntity(components.m_baseComponent->m_idleEntityIdsForTeam[i]), components);
+		// The idle list was gathered over previous frames, so an entity may have died or been given work since.
+		ArgusEntity idleEntity = ArgusEntity::RetrieveEntity(components.m_baseComponent->m_idleEntityIdsForTeam[i]);
+		if (!idleEntity || !idleEntity.IsAlive() || !idleEntity.IsIdle())
+		{
+			continue;
+		}
+
+		AssignIdleEntityToWork(idleEntity, components);
 	}
 }
 
@@ -212,7 +211,7 @@ bool TeamCommanderSystems_AssignEntities::AssignEntityToResourceExtractionIfAble
 	ArgusEntity closestEntity = ArgusEntity::k_emptyEntity;
 	float closestDistanceSquared = FLT_MAX;
 	ResourceSourceExtractionData* pointerToClosestExtractionData = nullptr;
-	components.m_resourceDataComponent->IterateAllSeenResourceSources([entity, &closestEntity, &closestDistanceSquared, &pointerToClosestExtractionData](ResourceSourceExtractionData& data)
+	components.m_resourceDataComponent->IterateAllSeenResourceSources([entity, &components, &closestEntity, &closestDistanceSquared, &pointerToClosestExtractionData](ResourceSourceExtractionData& data)
 	{
 		const bool isCurrentEntity = data.m_resourceExtractorEntityId == entity.GetId();
 		if (data.m_resourceSourceEntityId == ArgusECSConstants::k_maxEntities || (data.m_resourceExtractorEntityId != ArgusECSConstants::k_maxEntities && !isCurrentEntity))
@@ -233,6 +232,12 @@ bool TeamCommanderSystems_AssignEntities::AssignEntityToResourceExtractionIfAble
 			return true;
 		}
 
+		// Extractors are not sent into areas where the team is currently outmatched.
+		if (IsResourceSourceContested(resourceSourceEntity, components))
+		{
+			return false;
+		}
+
 		const float distanceSquared = entity.GetDistanceSquaredToOtherEntity(resourceSourceEntity);
 		if (distanceSquared < closestDistanceSquared)
 		{
@@ -314,15 +319,19 @@ bool TeamCommanderSystems_AssignEntities::AssignEntityToScoutingIfAble(ArgusEnti
 		return  false;
 	}
 
-	const int32 unrevealedIndex = TeamCommanderSystems::GetClosestUnrevealedAreaToEntity(perEntityComponents, components.m_baseComponent);
-	if (unrevealedIndex < 0)
+	const int32 scoutingAreaIndex = TeamCommanderSystems::GetClosestAreaToScoutForEntity(perEntityComponents, components.m_baseComponent);
+	if (scoutingAreaIndex < 0)
 	{
 		return false;
 	}
 
-	perEntityComponents.m_targetingComponent->SetLocationTarget(TeamCommanderSystems::GetWorldSpaceLocationFromAreaIndex(unrevealedIndex, components.m_baseComponent));
+	perEntityComponents.m_targetingComponent->SetLocationTarget(TeamCommanderSystems::GetWorldSpaceLocationFromAreaIndex(scoutingAreaIndex, components.m_baseComponent));
 	perEntityComponents.m_taskComponent->m_movementState = EMovementState::ProcessMoveToLocationCommand;
 	perEntityComponents.m_taskComponent->m_directiveFromTeamCommander = ETeamCommanderDirective::Scout;
+
+	// Claiming the area right away sends the next idle scout somewhere else, instead of every idle scout to the same area.
+	components.m_baseComponent->m_scoutingDistanceField.SetClaimedArea(scoutingAreaIndex, true);
+	components.m_baseComponent->m_scoutingDistanceField.UpdateIfDirty();
 	return true;
 }
 
@@ -363,35 +372,30 @@ bool TeamCommanderSystems_AssignEntities::FindTargetLocForConstructResourceSink(
 	const float safeZoneDistance = AbilitySystems::GetResourceBufferRadiusOfConstructionAbility(abilityIndexPairs[pairIndex].Key);
 	const float radiusDistance = AbilitySystems::GetRadiusOfConstructionAbility(abilityIndexPairs[pairIndex].Key);
 
-	FVector2D candidateOffset = (fromSinkToEntity * (safeZoneDistance + resourceSourceTransformComponent->m_radius + ArgusECSConstants::k_resourceSinkBufferDistanceAdjustment));
-	FVector candidatePoint = FVector(candidateOffset, 0.0f) + resourceSourceTransformComponent->m_location;
-	bool isBlocked = SpatialPartitioningSystems::AnyObstaclesOrStaticEntitiesInCircle(candidatePoint, radiusDistance, safeZoneDistance);
-	if (isBlocked)
-	{
-		const int32 numIterations = 16;
-		const float angleOffset = ArgusMath::SafeDivide(360.0f, static_cast<float>(numIterations));
+	const FVector2D candidateOffset = (fromSinkToEntity * (safeZoneDistance + resourceSourceTransformComponent->m_radius + ArgusECSConstants::k_resourceSinkBufferDistanceAdjustment));
+	const FVector candidatePoint = FVector(candidateOffset, 0.0f) + resourceSourceTransformComponent->m_location;
 
-		for (int32 i = 0; i < numIterations; ++i)
-		{
-			candidateOffset = candidateOffset.GetRotated(angleOffset);
-			candidatePoint.X = resourceSourceTransformComponent->m_location.X + candidateOffset.X;
-			candidatePoint.Y = resourceSourceTransformComponent->m_location.Y + candidateOffset.Y;
-
-			if (!SpatialPartitioningSystems::AnyObstaclesOrStaticEntitiesInCircle(candidatePoint, radiusDistance, safeZoneDistance))
-			{
-				isBlocked = false;
-				break;
-			}
-		}
+	// Searching outward from the preferred spot by no more than its distance to the source keeps the sink roughly as close to the source as the preferred spot.
+	FVector placementLocation = candidatePoint;
+	if (!SpatialPartitioningSystems::FindNearestValidPlacementLocation(candidatePoint, radiusDistance, safeZoneDistance, candidateOffset.Size(), placementLocation))
+	{
+		return false;
 	}
 
-	if (isBlocked)
+	targetingComponent->SetLocationTarget(TransformSystems::ProjectLocationOntoNavigationData(worldReferenceComponent->m_worldPointer, radiusDistance, placementLocation));
+	return true;
+}
+
+bool TeamCommanderSystems_AssignEntities::IsResourceSourceContested(ArgusEntity resourceSourceEntity, const TeamCommanderComponentCollection& components)
+{
+	const TransformComponent* resourceSourceTransformComponent = resourceSourceEntity.GetComponent<TransformComponent>();
+	if (!resourceSourceTransformComponent || !components.m_baseComponent)
 	{
 		return false;
 	}
 
-	targetingComponent->SetLocationTarget(TransformSystems::ProjectLocationOntoNavigationData(worldReferenceComponent->m_worldPointer, radiusDistance, candidatePoint));
-	return true;
+	const int32 areaIndex = TeamCommanderSystems::GetAreaIndexFromWorldSpaceLocation(resourceSourceTransformComponent->m_location, components.m_baseComponent);
+	return TeamCommanderSystems::IsAreaContested(areaIndex, components.m_baseComponent);
 }
 
 ArgusEntity TeamCommanderSystems_AssignEntities::GetNearestSeenResourceSourceToEntity(ArgusEntity entity, const TArray<TPair<const UAbilityRecord*, EAbilityIndex>>& abilityIndexPairs, const TeamCommanderComponentCollection& components, EResourceType type, int32& outPairIndex, int32& outExtractionDataIndex)
@@ -439,7 +443,7 @@ ArgusEntity TeamCommanderSystems_AssignEntities::GetNearestSeenResourceSourceToE
 			}
 		}
 
-		if (!anyValidAbilities)
+		if (!anyValidAbilities || IsResourceSourceContested(resourceSourceEntity, components))
 		{
 			continue;
 		}
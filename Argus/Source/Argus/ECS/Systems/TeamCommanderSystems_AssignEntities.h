@@ -8,10 +8,9 @@
 class TeamCommanderSystems_AssignEntities
 {
 public:
-	static void RunSystems();
+	static void ActUponUpdatesPerCommanderEntity(ArgusEntity teamCommmanderEntity);
 
 private:
-	static void ActUponUpdatesPerCommanderEntity(ArgusEntity teamCommmanderEntity);
 	static void AssignIdleEntityToWork(ArgusEntity idleEntity, const TeamCommanderComponentCollection& components);
 	static bool AssignIdleEntityToDirectiveIfAble(ArgusEntity idleEntity, const TeamCommanderComponentCollection& components, TeamCommanderPriority& priority);
 	static bool AssignEntityToStartConstructionIfAble(ArgusEntity entity, const TeamCommanderComponentCollection& components, TeamCommanderPriority& priority);
@@ -22,5 +21,6 @@ private:
 	static bool AssignEntityToScoutingIfAble(ArgusEntity entity, const TeamCommanderComponentCollection& components);
 
 	static bool FindTargetLocForConstructResourceSink(ArgusEntity entity, const TArray<TPair<const UAbilityRecord*, EAbilityIndex>>& abilityIndexPairs, const TeamCommanderComponentCollection& components, EResourceType type);
+	static bool IsResourceSourceContested(ArgusEntity resourceSourceEntity, const TeamCommanderComponentCollection& components);
 	static ArgusEntity GetNearestSeenResourceSourceToEntity(ArgusEntity entity, const TArray<TPair<const UAbilityRecord*, EAbilityIndex>>& abilityIndexPairs, const TeamCommanderComponentCollection& components, EResourceType type, int32& outPairIndex, int32& outExtractionDataIndex);
 };
@@ -8,28 +8,28 @@
 #include "Systems/TargetingSystems.h"
 #include "Systems/TeamCommanderSystems.h"
 
-void TeamCommanderSystems_GatherInfo::RunSystems(bool forceSynchronous)
+void TeamCommanderSystems_GatherInfo::RunSystems(float deltaTime)
 {
 	ARGUS_TRACE(TeamCommanderSystems_GatherInfo::RunSystems);
 
-	if (forceSynchronous)
+	ArgusIterators::IterateTeamEntities([deltaTime](ArgusEntity teamCommanderEntity)
 	{
-		ArgusIterators::IterateTeamEntities(TeamCommanderSystems_GatherInfo::ClearUpdatesPerCommanderEntity);
-		ArgusIterators::IterateSystemsArgsByTeam<TeamCommanderSystemsArgs>(TeamCommanderSystems_GatherInfo::UpdateTeamCommanderPerEntity);
-	}
-	else
+		TeamCommanderSystems_GatherInfo::BeginUpdateForCommander(teamCommanderEntity, deltaTime);
+	});
+	ArgusIterators::IterateTeamEntities([](ArgusEntity teamCommanderEntity)
 	{
-		ArgusIterators::IterateTeamEntitiesParallel(TeamCommanderSystems_GatherInfo::ClearUpdatesPerCommanderEntity);
-		ArgusIterators::IterateSystemsArgsByTeamParallel<TeamCommanderSystemsArgs>(TeamCommanderSystems_GatherInfo::UpdateTeamCommanderPerEntity);
-	}
+		int32 entityBudget = MAX_int32;
+		TeamCommanderSystems_GatherInfo::ContinueUpdateForCommander(teamCommanderEntity, entityBudget);
+	});
+	ArgusIterators::IterateTeamEntities(TeamCommanderSystems_GatherInfo::FinishUpdateForCommander);
 }
 
-void TeamCommanderSystems_GatherInfo::ClearUpdatesPerCommanderEntity(ArgusEntity teamEntity)
+void TeamCommanderSystems_GatherInfo::BeginUpdateForCommander(ArgusEntity teamCommanderEntity, float elapsedSeconds)
 {
-	ARGUS_TRACE(TeamCommanderSystems_GatherInfo::ClearUpdatesPerCommanderEntity);
+	ARGUS_TRACE(TeamCommanderSystems_GatherInfo::BeginUpdateForCommander);
 
 	TeamCommanderComponentCollection components;
-	components.PopulateArguments(teamEntity);
+	components.PopulateArguments(teamCommanderEntity);
 	if (!components.AreComponentsValidCheck(ARGUS_FUNCNAME))
 	{
 		return;
@@ -43,6 +43,61 @@ void TeamCommanderSystems_GatherInfo::ClearUpdatesPerCommanderEntity(ArgusEntity
 	});
 	components.m_baseComponent->ResetUpdateArrays();
 	components.m_combatDataComponent->ClearTeamCountArrays();
+	components.m_baseComponent->m_gatherInfoResumeEntityId = ArgusEntity::GetLowestTakenEntityId();
+
+	// The influence map and scouting distance field are transient, so they need to be rebuilt after a load.
+	const int32 areasPerDimension = TeamCommanderSystems::GetAreasPerDimension(components.m_baseComponent);
+	if (components.m_baseComponent->m_influenceMap.GetAreasPerDimension() != areasPerDimension ||
+		components.m_baseComponent->m_scoutingDistanceField.GetAreasPerDimension() != areasPerDimension)
+	{
+		TeamCommanderSystems::InitializeAreaLayers(components.m_baseComponent, areasPerDimension);
+	}
+	components.m_baseComponent->m_influenceMap.BeginUpdate(elapsedSeconds);
+
+	// Scouts claim their target area again while their entities are gathered.
+	components.m_baseComponent->m_scoutingDistanceField.ClearClaimedAreas();
+}
+
+bool TeamCommanderSystems_GatherInfo::ContinueUpdateForCommander(ArgusEntity teamCommanderEntity, int32& remainingEntityBudget)
+{
+	ARGUS_TRACE(TeamCommanderSystems_GatherInfo::ContinueUpdateForCommander);
+
+	TeamCommanderComponentCollection teamCommanderComponents;
+	teamCommanderComponents.PopulateArguments(teamCommanderEntity);
+	if (!teamCommanderComponents.AreComponentsValidCheck(ARGUS_FUNCNAME))
+	{
+		return true;
+	}
+
+	// Entities are walked by id so that the pass can stop when the budget runs out and pick back up from the same id on a later frame.
+	const int32 highestEntityId = ArgusEntity::GetHighestTakenEntityId();
+	int32 currentEntityId = teamCommanderComponents.m_baseComponent->m_gatherInfoResumeEntityId;
+	TeamCommanderSystemsArgs components;
+	while (currentEntityId <= highestEntityId && currentEntityId >= 0 && remainingEntityBudget > 0)
+	{
+		if (components.PopulateArguments(ArgusEntity::RetrieveEntity(currentEntityId)))
+		{
+			UpdateTeamCommanderPerEntity(components, teamCommanderComponents);
+		}
+
+		currentEntityId = ArgusEntity::FindFromEntityBitArray(true, currentEntityId + 1);
+		remainingEntityBudget--;
+	}
+
+	teamCommanderComponents.m_baseComponent->m_gatherInfoResumeEntityId = currentEntityId;
+	return currentEntityId > highestEntityId || currentEntityId < 0;
+}
+
+void TeamCommanderSystems_GatherInfo::FinishUpdateForCommander(ArgusEntity teamCommanderEntity)
+{
+	ARGUS_TRACE(TeamCommanderSystems_GatherInfo::FinishUpdateForCommander);
+
+	TeamCommanderComponent* teamCommanderComponent = teamCommanderEntity.GetComponent<TeamCommanderComponent>();
+	ARGUS_RETURN_ON_NULL(teamCommanderComponent, ArgusECSLog);
+
+	teamCommanderComponent->m_influenceMap.EndUpdate();
+	UpdateEnemyInfluencePerCommander(teamCommanderComponent);
+	UpdateScoutingDistanceFieldPerCommander(teamCommanderComponent);
 }
 
 void TeamCommanderSystems_GatherInfo::ClearResourceSinkFromExtractionDataIfNeeded(ArgusEntity existingResourceSinkEntity, ResourceSourceExtractionData& data)
@@ -101,35 +156,39 @@ void TeamCommanderSystems_GatherInfo::ClearResourceExtractorFromExtractionDataIf
 	}
 }
 
-void TeamCommanderSystems_GatherInfo::UpdateTeamCommanderPerEntity(const TeamCommanderSystemsArgs& components)
+void TeamCommanderSystems_GatherInfo::UpdateTeamCommanderPerEntity(const TeamCommanderSystemsArgs& components, const TeamCommanderComponentCollection& teamCommanderComponents)
 {
 	ARGUS_TRACE(TeamCommanderSystems_GatherInfo::UpdateTeamCommanderPerEntity);
 
-	if (!components.AreComponentsValidCheck(ARGUS_FUNCNAME))
+	if (!components.AreComponentsValidCheck(ARGUS_FUNCNAME) || !teamCommanderComponents.AreComponentsValidCheck(ARGUS_FUNCNAME))
 	{
 		return;
 	}
 
-	if (components.m_identityComponent->m_team == ETeam::None)
+	const ETeam entityTeam = components.m_identityComponent->m_team;
+	const ETeam commandedTeam = teamCommanderComponents.m_baseComponent->m_teamToCommand;
+	if (entityTeam == ETeam::None)
 	{
-		ArgusIterators::IterateTeamEntities([&components](ArgusEntity teamCommanderEntity)
-		{
-			TeamCommanderSystems_GatherInfo::UpdateTeamCommanderPerNeutralEntity(components, teamCommanderEntity);
-		});
+		UpdateTeamCommanderPerNeutralEntity(components, teamCommanderComponents);
 		return;
 	}
 
-	UpdateTeamCommanderPerEntityOnTeam(components, ArgusEntity::GetTeamEntity(components.m_identityComponent->m_team));
-	UpdateSeenByTeamCommandersPerEntity(components);
+	if (entityTeam == commandedTeam)
+	{
+		UpdateTeamCommanderPerEntityOnTeam(components, teamCommanderComponents);
+		return;
+	}
+
+	if (components.m_identityComponent->WasEverSeenBy(commandedTeam))
+	{
+		UpdateSeenByTeamCommanderPerEntity(components, teamCommanderComponents);
+	}
 }
 
-void TeamCommanderSystems_GatherInfo::UpdateTeamCommanderPerEntityOnTeam(const TeamCommanderSystemsArgs& components, ArgusEntity teamCommanderEntity)
+void TeamCommanderSystems_GatherInfo::UpdateTeamCommanderPerEntityOnTeam(const TeamCommanderSystemsArgs& components, const TeamCommanderComponentCollection& teamCommanderComponents)
 {
 	ARGUS_TRACE(TeamCommanderSystems_GatherInfo::UpdateTeamCommanderPerEntityOnTeam);
 
-	TeamCommanderComponentCollection teamCommanderComponents;
-	teamCommanderComponents.PopulateArguments(teamCommanderEntity);
-
 	if (!components.AreComponentsValidCheck(ARGUS_FUNCNAME) || !teamCommanderComponents.AreComponentsValidCheck(ARGUS_FUNCNAME))
 	{
 		return;
@@ -146,33 +205,7 @@ void TeamCommanderSystems_GatherInfo::UpdateTeamCommanderPerEntityOnTeam(const T
 	UpdateSpawningUnitTypesPerSpawner(components, teamCommanderComponents);
 	UpdateConstructionDataPerConstructee(components, teamCommanderComponents);
 	UpdateTeamAvailableAbilityIdsPerEntity(components, teamCommanderComponents);
-}
-
-void TeamCommanderSystems_GatherInfo::UpdateSeenByTeamCommandersPerEntity(const TeamCommanderSystemsArgs& components)
-{
-	ARGUS_TRACE(TeamCommanderSystems_GatherInfo::UpdateSeenByTeamCommandersPerEntity);
-
-	if (!components.AreComponentsValidCheck(ARGUS_FUNCNAME))
-	{
-		return;
-	}
-
-	ArgusIterators::IterateTeamEntitiesInBitmask(components.m_identityComponent->m_everSeenBy, [&components](ArgusEntity teamCommanderEntity)
-	{	
-		TeamCommanderComponentCollection teamCommanderComponents;
-		teamCommanderComponents.PopulateArguments(teamCommanderEntity);
-		if (!teamCommanderComponents.AreComponentsValidCheck(ARGUS_FUNCNAME))
-		{
-			return;
-		}
-
-		if (components.m_identityComponent->m_team == teamCommanderComponents.m_baseComponent->m_teamToCommand)
-		{
-			return;
-		}
-
-		UpdateSeenByTeamCommanderPerEntity(components, teamCommanderComponents);
-	});
+	UpdateInfluenceMapPerEntityOnTeam(components, teamCommanderComponents);
 }
 
 void TeamCommanderSystems_GatherInfo::UpdateSeenByTeamCommanderPerEntity(const TeamCommanderSystemsArgs& components, const TeamCommanderComponentCollection& teamCommanderComponents)
@@ -182,32 +215,38 @@ void TeamCommanderSystems_GatherInfo::UpdateSeenByTeamCommanderPerEntity(const T
 	UpdateCombatDataPerEntity(components, teamCommanderComponents);
 }
 
-void TeamCommanderSystems_GatherInfo::UpdateTeamCommanderPerNeutralEntity(const TeamCommanderSystemsArgs& components, ArgusEntity teamCommanderEntity)
+void TeamCommanderSystems_GatherInfo::UpdateTeamCommanderPerNeutralEntity(const TeamCommanderSystemsArgs& components, const TeamCommanderComponentCollection& teamCommanderComponents)
 {
 	ARGUS_TRACE(TeamCommanderSystems_GatherInfo::UpdateTeamCommanderPerNeutralEntity);
 
-	TeamCommanderComponent* teamCommanderComponent = teamCommanderEntity.GetComponent<TeamCommanderComponent>();
-	ARGUS_RETURN_ON_NULL(teamCommanderComponent, ArgusECSLog);
-	TeamCommanderResourceDataComponent* teamCommanderResourceDataComponent = teamCommanderEntity.GetComponent<TeamCommanderResourceDataComponent>();
-	ARGUS_RETURN_ON_NULL(teamCommanderResourceDataComponent, ArgusECSLog);
-
-	if (!components.AreComponentsValidCheck(ARGUS_FUNCNAME))
+	if (!components.AreComponentsValidCheck(ARGUS_FUNCNAME) || !teamCommanderComponents.AreComponentsValidCheck(ARGUS_FUNCNAME))
 	{
 		return;
 	}
 
+	TeamCommanderComponent* teamCommanderComponent = teamCommanderComponents.m_baseComponent;
+	TeamCommanderResourceDataComponent* teamCommanderResourceDataComponent = teamCommanderComponents.m_resourceDataComponent;
+
 	if (components.m_resourceComponent)
 	{
 		if (components.m_resourceComponent->m_resourceComponentOwnerType == EResourceComponentOwnerType::Source && components.m_identityComponent->WasEverSeenBy(teamCommanderComponent->m_teamToCommand))
 		{
+			int32 totalResourceQuantity = 0;
 			for (uint8 i = 0u; i < static_cast<uint8>(EResourceType::Count); ++i)
 			{
 				EResourceType type = static_cast<EResourceType>(i);
 				if (components.m_resourceComponent->m_currentResources.HasResourceType(type))
 				{
 					teamCommanderResourceDataComponent->AddSeenResourceSourceIfNotPresent(type, components.m_entity.GetId());
+					totalResourceQuantity += components.m_resourceComponent->m_currentResources.m_resourceQuantities[i];
 				}
 			}
+
+			if (components.m_transformComponent && totalResourceQuantity > 0)
+			{
+				const int32 areaIndex = TeamCommanderSystems::GetAreaIndexFromWorldSpaceLocation(components.m_transformComponent->m_location, teamCommanderComponent);
+				teamCommanderComponent->m_influenceMap.AddInfluence(EInfluenceLayer::ResourceValue, areaIndex, static_cast<float>(totalResourceQuantity));
+			}
 		}
 	}
 }
@@ -271,6 +310,15 @@ void TeamCommanderSystems_GatherInfo::UpdateRevealedAreasPerEntityOnTeam(const T
 	if (areaIndex >= 0)
 	{
 		teamCommanderComponents.m_baseComponent->m_revealedAreas[areaIndex] = true;
+		teamCommanderComponents.m_baseComponent->m_influenceMap.ResetExplorationAge(areaIndex);
+		teamCommanderComponents.m_baseComponent->m_scoutingDistanceField.SetScoutableArea(areaIndex, false);
+	}
+
+	if (components.m_taskComponent->m_directiveFromTeamCommander == ETeamCommanderDirective::Scout && components.m_targetingComponent->HasLocationTarget() &&
+		!components.m_entity.IsIdle())
+	{
+		const int32 targetAreaIndex = TeamCommanderSystems::GetAreaIndexFromWorldSpaceLocation(components.m_targetingComponent->m_targetLocation.GetValue(), teamCommanderComponents.m_baseComponent);
+		teamCommanderComponents.m_baseComponent->m_scoutingDistanceField.SetClaimedArea(targetAreaIndex, true);
 	}
 }
 
@@ -397,3 +445,71 @@ void TeamCommanderSystems_GatherInfo::UpdateTeamAvailableAbilityIdsPerEntity(con
 		}
 	});
 }
+
+void TeamCommanderSystems_GatherInfo::UpdateInfluenceMapPerEntityOnTeam(const TeamCommanderSystemsArgs& components, const TeamCommanderComponentCollection& teamCommanderComponents)
+{
+	ARGUS_TRACE(TeamCommanderSystems_GatherInfo::UpdateInfluenceMapPerEntityOnTeam);
+
+	if (!components.AreComponentsValidCheck(ARGUS_FUNCNAME) || !teamCommanderComponents.AreComponentsValidCheck(ARGUS_FUNCNAME) || !components.m_transformComponent)
+	{
+		return;
+	}
+
+	if (!components.m_entity.IsAlive())
+	{
+		return;
+	}
+
+	FEntityCategory combatantCategory;
+	combatantCategory.m_entityCategoryType = EEntityCategoryType::Combatant;
+	if (!components.m_entity.DoesEntitySatisfyEntityCategory(combatantCategory))
+	{
+		return;
+	}
+
+	const int32 areaIndex = TeamCommanderSystems::GetAreaIndexFromWorldSpaceLocation(components.m_transformComponent->m_location, teamCommanderComponents.m_baseComponent);
+	teamCommanderComponents.m_baseComponent->m_influenceMap.AddPendingFriendlyStrength(areaIndex, 1.0f);
+}
+
+void TeamCommanderSystems_GatherInfo::UpdateEnemyInfluencePerCommander(TeamCommanderComponent* teamCommanderComponent)
+{
+	ARGUS_TRACE(TeamCommanderSystems_GatherInfo::UpdateEnemyInfluencePerCommander);
+	ARGUS_RETURN_ON_NULL(teamCommanderComponent, ArgusECSLog);
+
+	ArgusIterators::IterateTeamEntitiesInBitmask(teamCommanderComponent->m_enemies, [teamCommanderComponent](ArgusEntity enemyTeamCommanderEntity)
+	{
+		const TeamCommanderComponent* enemyTeamCommanderComponent = enemyTeamCommanderEntity.GetComponent<TeamCommanderComponent>();
+		if (!enemyTeamCommanderComponent || !ArgusEntity::IsTeamRegistered(enemyTeamCommanderComponent->m_teamToCommand))
+		{
+			return;
+		}
+
+		teamCommanderComponent->m_influenceMap.AccumulateLayer(EInfluenceLayer::EnemyStrength, enemyTeamCommanderComponent->m_influenceMap, EInfluenceLayer::FriendlyStrength);
+	});
+
+	// Commanders only get to know about enemy strength in areas an entity on their team is standing in right now. Areas that were revealed earlier are back
+	// under fog of war, so they would otherwise leak enemy movements.
+	InfluenceMap& influenceMap = teamCommanderComponent->m_influenceMap;
+	for (int32 i = 0; i < influenceMap.GetNumAreas(); ++i)
+	{
+		if (!TeamCommanderSystems::IsAreaObserved(i, teamCommanderComponent))
+		{
+			influenceMap.SetInfluence(EInfluenceLayer::EnemyStrength, i, 0.0f);
+		}
+	}
+}
+
+void TeamCommanderSystems_GatherInfo::UpdateScoutingDistanceFieldPerCommander(TeamCommanderComponent* teamCommanderComponent)
+{
+	ARGUS_TRACE(TeamCommanderSystems_GatherInfo::UpdateScoutingDistanceFieldPerCommander);
+	ARGUS_RETURN_ON_NULL(teamCommanderComponent, ArgusECSLog);
+
+	// Explored areas were already reported while gathering, so only areas that turned stale are left to report.
+	ScoutingDistanceField& scoutingDistanceField = teamCommanderComponent->m_scoutingDistanceField;
+	teamCommanderComponent->m_influenceMap.PopAreasThatTurnedStale([&scoutingDistanceField](int32 areaIndex)
+	{
+		scoutingDistanceField.SetScoutableArea(areaIndex, true);
+	});
+
+	scoutingDistanceField.UpdateIfDirty();
+}
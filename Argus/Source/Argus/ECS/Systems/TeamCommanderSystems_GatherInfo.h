@@ -8,22 +8,26 @@
 class TeamCommanderSystems_GatherInfo
 {
 public:
-	static void RunSystems(bool forceSynchronous = false);
+	static void RunSystems(float deltaTime);
+	static void BeginUpdateForCommander(ArgusEntity teamCommanderEntity, float elapsedSeconds);
+	static bool ContinueUpdateForCommander(ArgusEntity teamCommanderEntity, int32& remainingEntityBudget);
+	static void FinishUpdateForCommander(ArgusEntity teamCommanderEntity);
 
 private:
-	static void ClearUpdatesPerCommanderEntity(ArgusEntity teamCommmanderEntity);
 	static void ClearResourceSinkFromExtractionDataIfNeeded(ArgusEntity existingResourceSinkEntity, ResourceSourceExtractionData& data);
 	static void ClearResourceExtractorFromExtractionDataIfNeeded(ArgusEntity existingResourceExtractorEntity, ResourceSourceExtractionData& data);
 
-	static void UpdateTeamCommanderPerEntity(const TeamCommanderSystemsArgs& components);
-	static void UpdateTeamCommanderPerEntityOnTeam(const TeamCommanderSystemsArgs& components, ArgusEntity teamCommanderEntity);
-	static void UpdateSeenByTeamCommandersPerEntity(const TeamCommanderSystemsArgs& components);
+	static void UpdateTeamCommanderPerEntity(const TeamCommanderSystemsArgs& components, const TeamCommanderComponentCollection& teamCommanderComponents);
+	static void UpdateTeamCommanderPerEntityOnTeam(const TeamCommanderSystemsArgs& components, const TeamCommanderComponentCollection& teamCommanderComponents);
 	static void UpdateSeenByTeamCommanderPerEntity(const TeamCommanderSystemsArgs& components, const TeamCommanderComponentCollection& teamCommanderComponents);
-	static void UpdateTeamCommanderPerNeutralEntity(const TeamCommanderSystemsArgs& components, ArgusEntity teamCommanderEntity);
+	static void UpdateTeamCommanderPerNeutralEntity(const TeamCommanderSystemsArgs& components, const TeamCommanderComponentCollection& teamCommanderComponents);
 	static void UpdateResourceExtractionDataPerSink(const TeamCommanderSystemsArgs& components, const TeamCommanderComponentCollection& teamCommanderComponents);
 	static void UpdateRevealedAreasPerEntityOnTeam(const TeamCommanderSystemsArgs& components, const TeamCommanderComponentCollection& teamCommanderComponents);
 	static void UpdateCombatDataPerEntity(const TeamCommanderSystemsArgs& components, const TeamCommanderComponentCollection& teamCommanderComponents);
 	static void UpdateSpawningUnitTypesPerSpawner(const TeamCommanderSystemsArgs& components, const TeamCommanderComponentCollection& teamCommanderComponents);
 	static void UpdateConstructionDataPerConstructee(const TeamCommanderSystemsArgs& components, const TeamCommanderComponentCollection& teamCommanderComponents);
 	static void UpdateTeamAvailableAbilityIdsPerEntity(const TeamCommanderSystemsArgs& components, const TeamCommanderComponentCollection& teamCommanderComponents);
+	static void UpdateInfluenceMapPerEntityOnTeam(const TeamCommanderSystemsArgs& components, const TeamCommanderComponentCollection& teamCommanderComponents);
+	static void UpdateEnemyInfluencePerCommander(TeamCommanderComponent* teamCommanderComponent);
+	static void UpdateScoutingDistanceFieldPerCommander(TeamCommanderComponent* teamCommanderComponent);
 };
@@ -5,18 +5,12 @@
 #include "ArgusLogging.h"
 #include "ArgusMacros.h"
 #include "ArgusStaticData.h"
+#include "ArgusStaticRecordTable.h"
 #include "RecordDefinitions/AbilityRecord.h"
 #include "RecordDefinitions/ArgusActorRecord.h"
 #include "Systems/AbilitySystems.h"
 #include "Systems/ResourceSystems.h"
 
-void TeamCommanderSystems_UpdatePriorities::RunSystems()
-{
-	ARGUS_TRACE(TeamCommanderSystems_UpdatePriorities::RunSystems);
-
-	ArgusIterators::IterateTeamEntities(TeamCommanderSystems_UpdatePriorities::UpdateTeamCommanderPriorities);
-}
-
 void TeamCommanderSystems_UpdatePriorities::UpdateTeamCommanderPriorities(ArgusEntity teamEntity)
 {
 	ARGUS_TRACE(TeamCommanderSystems_UpdatePriorities::UpdateTeamCommanderPriorities);
@@ -140,7 +134,7 @@ void TeamCommanderSystems_UpdatePriorities::UpdateTeamCommanderPriorityCost(cons
 	priority.m_minAssociatedResourceCost.Reset();
 	for (uint32 abilityRecordId : components.m_baseComponent->m_availableAbilityRecordIds)
 	{
-		const UAbilityRecord* record = ArgusStaticData::GetRecord<UAbilityRecord>(abilityRecordId);
+		const AbilityRecordData* record = ArgusStaticRecordTable<UAbilityRecord>::Get(abilityRecordId);
 		if (!record)
 		{
 			continue;
@@ -8,10 +8,9 @@
 class TeamCommanderSystems_UpdatePriorities
 {
 public:
-	static void RunSystems();
+	static void UpdateTeamCommanderPriorities(ArgusEntity teamCommmanderEntity);
 
 private:
-	static void UpdateTeamCommanderPriorities(ArgusEntity teamCommmanderEntity);
 	static void UpdateTeamCommanderPriorityCost(const TeamCommanderComponentCollection& components, TeamCommanderPriority& priority);
 	static void UpdateConstructResourceSinkTeamPriority(const TeamCommanderComponentCollection& components, TeamCommanderPriority& priority);
 	static void UpdateResourceExtractionTeamPriority(const TeamCommanderComponentCollection& components, TeamCommanderPriority& priority);
@@ -8,54 +8,144 @@ void TimerSystems::RunSystems(float deltaTime)
 {
 	ARGUS_TRACE(TimerSystems::RunSystems);
 
-	ArgusIterators::IterateEntities([deltaTime](ArgusEntity entity)
+	AdvanceTimers(deltaTime, GetTimerClock());
+}
+
+void TimerSystems::InitializeSystemsPostLoad()
+{
+	ARGUS_TRACE(TimerSystems::InitializeSystemsPostLoad);
+
+	WorldReferenceComponent* worldReferenceComponent = GetTimerClock();
+	ARGUS_RETURN_ON_NULL(worldReferenceComponent, ArgusECSLog);
+
+	// The wheel itself is never saved, so rebuild it from every timer that was still ticking.
+	worldReferenceComponent->m_timingWheel.Reset(worldReferenceComponent->m_timerTick);
+
+	auto scheduleTickingTimers = [worldReferenceComponent](ArgusEntity entity)
 	{
-		TimerComponent* timerComponent = entity.GetComponent<TimerComponent>();
+		const TimerComponent* timerComponent = entity.GetComponent<TimerComponent>();
 		if (!timerComponent)
 		{
 			return;
 		}
 
-		AdvaceTimers(deltaTime, timerComponent);
-	});
+		for (int32 i = 0; i < timerComponent->m_timers.Num(); ++i)
+		{
+			if (timerComponent->m_timers[i].m_timerState == TimerState::Ticking)
+			{
+				worldReferenceComponent->m_timingWheel.Schedule(entity.GetId(), static_cast<uint8>(i), timerComponent->m_timers[i].m_expirationTick);
+			}
+		}
+	};
+
+	ArgusIterators::IterateEntities(scheduleTickingTimers);
+	ArgusIterators::IterateTeamEntities(scheduleTickingTimers);
+	scheduleTickingTimers(ArgusEntity::GetSingletonEntity());
+}
 
-	ArgusEntity singletonEntity = ArgusEntity::GetSingletonEntity();
-	if (!singletonEntity)
+void TimerSystems::AdvanceTimers(float deltaTime, WorldReferenceComponent* worldReferenceComponent)
+{
+	ARGUS_TRACE(TimerSystems::AdvanceTimers);
+
+	if (!worldReferenceComponent)
 	{
+		ARGUS_LOG(ArgusECSLog, Error, TEXT("[%s] Passed in %s was null."), ARGUS_FUNCNAME, ARGUS_NAMEOF(WorldReferenceComponent*));
 		return;
 	}
 
-	TimerComponent* singletonTimerComponent = singletonEntity.GetComponent<TimerComponent>();
-	if (!singletonTimerComponent)
+	worldReferenceComponent->m_timerTickRemainderSeconds += deltaTime;
+	const int32 numElapsedTicks = FMath::FloorToInt32(worldReferenceComponent->m_timerTickRemainderSeconds * ArgusECSConstants::k_timerTicksPerSecond);
+	if (numElapsedTicks <= 0)
 	{
 		return;
 	}
 
-	AdvaceTimers(deltaTime, singletonTimerComponent);
+	worldReferenceComponent->m_timerTick += static_cast<uint32>(numElapsedTicks);
+	worldReferenceComponent->m_timerTickRemainderSeconds -= static_cast<float>(numElapsedTicks) / ArgusECSConstants::k_timerTicksPerSecond;
+
+	TArray<TimingWheelEntry> expiredEntries;
+	worldReferenceComponent->m_timingWheel.Advance(worldReferenceComponent->m_timerTick, expiredEntries);
+	for (int32 i = 0; i < expiredEntries.Num(); ++i)
+	{
+		CompleteExpiredTimer(expiredEntries[i].m_entityId, expiredEntries[i].m_timerIndex, expiredEntries[i].m_expirationTick);
+	}
 }
 
-void TimerSystems::AdvaceTimers(float deltaTime, TimerComponent* timerComponent)
+void TimerSystems::ScheduleTimer(ArgusEntity entityWithTimer, uint8 timerIndex, uint32 expirationTick)
 {
-	ARGUS_TRACE(TimerSystems::AdvaceTimers);
+	WorldReferenceComponent* worldReferenceComponent = GetTimerClock();
+	if (!worldReferenceComponent)
+	{
+		return;
+	}
+
+	worldReferenceComponent->m_timingWheel.Schedule(entityWithTimer.GetId(), timerIndex, expirationTick);
+}
 
-	if (!timerComponent)
+uint32 TimerSystems::CalculateExpirationTick(float seconds)
+{
+	uint32 currentTick = 0u;
+	float tickRemainderSeconds = 0.0f;
+	if (const WorldReferenceComponent* worldReferenceComponent = GetTimerClock())
+	{
+		currentTick = worldReferenceComponent->m_timerTick;
+		tickRemainderSeconds = worldReferenceComponent->m_timerTickRemainderSeconds;
+	}
+
+	const float ticksUntilExpiration = (tickRemainderSeconds + FMath::Max(seconds, 0.0f)) * ArgusECSConstants::k_timerTicksPerSecond;
+	return currentTick + static_cast<uint32>(FMath::Max(FMath::CeilToInt32(ticksUntilExpiration - KINDA_SMALL_NUMBER), 0));
+}
+
+float TimerSystems::CalculateTimeRemaining(uint32 expirationTick)
+{
+	uint32 currentTick = 0u;
+	float tickRemainderSeconds = 0.0f;
+	if (const WorldReferenceComponent* worldReferenceComponent = GetTimerClock())
+	{
+		currentTick = worldReferenceComponent->m_timerTick;
+		tickRemainderSeconds = worldReferenceComponent->m_timerTickRemainderSeconds;
+	}
+
+	if (expirationTick <= currentTick)
+	{
+		return 0.0f;
+	}
+
+	return FMath::Max((static_cast<float>(expirationTick - currentTick) / ArgusECSConstants::k_timerTicksPerSecond) - tickRemainderSeconds, 0.0f);
+}
+
+WorldReferenceComponent* TimerSystems::GetTimerClock()
+{
+	// Timers can be used before the singleton exists (and in tests without one), so look it up without erroring.
+	ArgusEntity singletonEntity = ArgusEntity::RetrieveEntity(ArgusECSConstants::k_singletonEntityId);
+	if (!singletonEntity)
+	{
+		return nullptr;
+	}
+
+	return singletonEntity.GetComponent<WorldReferenceComponent>();
+}
+
+void TimerSystems::CompleteExpiredTimer(uint16 entityId, uint8 timerIndex, uint32 expirationTick)
+{
+	ArgusEntity entity = ArgusEntity::RetrieveEntity(entityId);
+	if (!entity)
 	{
-		ARGUS_LOG(ArgusECSLog, Error, TEXT("[%s] Passed in %s was null."), ARGUS_FUNCNAME, ARGUS_NAMEOF(TimerComponent*));
 		return;
 	}
 
-	for (int32 i = 0; i < timerComponent->m_timers.Num(); ++i)
+	TimerComponent* timerComponent = entity.GetComponent<TimerComponent>();
+	if (!timerComponent || !timerComponent->m_timers.IsValidIndex(timerIndex))
 	{
-		if (timerComponent->m_timers[i].m_timerState != TimerState::Ticking)
-		{
-			continue;
-		}
+		return;
+	}
 
-		timerComponent->m_timers[i].m_timeRemainingSeconds -= deltaTime;
-		if (timerComponent->m_timers[i].m_timeRemainingSeconds <= 0.0f)
-		{
-			timerComponent->m_timers[i].m_timeRemainingSeconds = 0.0f;
-			timerComponent->m_timers[i].m_timerState = TimerState::Completed;
-		}
+	// Canceled or restarted timers leave their old wheel entry behind, so only complete the timer this entry was scheduled for.
+	Timer& timer = timerComponent->m_timers[timerIndex];
+	if (timer.m_timerState != TimerState::Ticking || timer.m_expirationTick != expirationTick)
+	{
+		return;
 	}
+
+	timer.m_timerState = TimerState::Completed;
 }
@@ -2,11 +2,24 @@
 
 #pragma once
 
+#include "CoreMinimal.h"
+
+class ArgusEntity;
 struct TimerComponent;
+struct WorldReferenceComponent;
 
 class TimerSystems
 {
 public:
 	static void RunSystems(float deltaTime);
-	static void AdvaceTimers(float deltaTime, TimerComponent* timerComponent);
-};
\ No newline at end of file
+	static void InitializeSystemsPostLoad();
+	static void AdvanceTimers(float deltaTime, WorldReferenceComponent* worldReferenceComponent);
+
+	static void ScheduleTimer(ArgusEntity entityWithTimer, uint8 timerIndex, uint32 expirationTick);
+	static uint32 CalculateExpirationTick(float seconds);
+	static float CalculateTimeRemaining(uint32 expirationTick);
+
+private:
+	static WorldReferenceComponent* GetTimerClock();
+	static void CompleteExpiredTimer(uint16 entityId, uint8 timerIndex, uint32 expirationTick);
+};
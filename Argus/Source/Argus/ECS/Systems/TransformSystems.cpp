@@ -32,6 +32,11 @@ bool TransformSystems::RunSystems(UWorld* worldPointer, float deltaTime)
 			return;
 		}
 
+		if (AvoidanceSystems::IsInSleepingAvoidanceGroup(components.m_entity))
+		{
+			return;
+		}
+
 		const bool didEntityMove = ProcessMovementTaskCommands(worldPointer, deltaTime, components);
 		didMovementUpdateThisFrame |= didEntityMove;
 
@@ -0,0 +1,84 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusBakedObstacles.h"
+#include "ArgusTesting.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ArgusBakedObstaclesRoundTripTest, "Argus.ECS.BakedObstacles.RoundTrip", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool ArgusBakedObstaclesRoundTripTest::RunTest(const FString& Parameters)
+{
+	const uint32 sourceHash = 1234u;
+	const uint32 staleSourceHash = 4321u;
+	const float floorHeight = 50.0f;
+	const FVector2D firstPointLocation = FVector2D(100.0f, -200.0f);
+	const FVector2D secondPointLocation = FVector2D(-300.0f, 400.0f);
+
+	ArgusTesting::StartArgusTest();
+
+	ObstaclesContainer obstacles;
+	obstacles.AddDefaulted(2);
+	obstacles[0].m_floorHeight = floorHeight;
+	obstacles[0].Add(ObstaclePoint{ firstPointLocation, FVector2D(1.0f, 0.0f), floorHeight, true, false });
+	obstacles[0].Add(ObstaclePoint{ secondPointLocation, FVector2D(0.0f, 1.0f), floorHeight, false, true });
+
+	UArgusBakedObstacles* bakedObstacles = NewObject<UArgusBakedObstacles>();
+	bakedObstacles->BakeObstacles(sourceHash, obstacles);
+
+	ObstaclesContainer loadedObstacles;
+	const bool didPopulate = bakedObstacles->PopulateObstacles(loadedObstacles);
+
+#pragma region Test that baked obstacles can be populated
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Test that %s succeeds after calling %s."), ARGUS_FUNCNAME, ARGUS_NAMEOF(UArgusBakedObstacles::PopulateObstacles), ARGUS_NAMEOF(UArgusBakedObstacles::BakeObstacles)),
+		didPopulate
+	);
+#pragma endregion
+
+#pragma region Test that the number of obstacles survives the bake
+	TestEqual
+	(
+		FString::Printf(TEXT("[%s] Test that the number of obstacles is %d after a bake round trip."), ARGUS_FUNCNAME, obstacles.Num()),
+		loadedObstacles.Num(),
+		obstacles.Num()
+	);
+#pragma endregion
+
+	if (loadedObstacles.Num() != obstacles.Num() || loadedObstacles[0].Num() != obstacles[0].Num())
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+#pragma region Test that obstacle point data survives the bake
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Test that %s values are identical after a bake round trip."), ARGUS_FUNCNAME, ARGUS_NAMEOF(ObstaclePoint)),
+		loadedObstacles[0][0].m_point == firstPointLocation && loadedObstacles[0][1].m_point == secondPointLocation && loadedObstacles[0][0].m_isConvex && loadedObstacles[0][1].m_isAlias
+	);
+#pragma endregion
+
+#pragma region Test that the obstacle floor height survives the bake
+	TestEqual
+	(
+		FString::Printf(TEXT("[%s] Test that %s is %f after a bake round trip."), ARGUS_FUNCNAME, ARGUS_NAMEOF(ObstaclePointArray::m_floorHeight), floorHeight),
+		loadedObstacles[0].m_floorHeight,
+		floorHeight
+	);
+#pragma endregion
+
+#pragma region Test that a bake is considered stale when the source hash changes
+	TestFalse
+	(
+		FString::Printf(TEXT("[%s] Test that %s returns false for a mismatched source hash."), ARGUS_FUNCNAME, ARGUS_NAMEOF(UArgusBakedObstacles::IsBakeValid)),
+		bakedObstacles->IsBakeValid(staleSourceHash)
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+#endif //WITH_AUTOMATION_TESTS
@@ -1,8 +1,11 @@
 // Copyright Karazaa. This is a part of an RTS project called Argus.
 
+#include "ArgusComponentRegistry.h"
 #include "ArgusEntity.h"
 #include "ArgusTesting.h"
 #include "Misc/AutomationTest.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 
 #if WITH_AUTOMATION_TESTS
 
@@ -49,6 +52,166 @@ bool ArgusComponentHealthComponentPersistenceTest::RunTest(const FString& Parame
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ArgusComponentHealthComponentBulkSerializeTest, "Argus.ECS.Component.HealthComponent.BulkSerialize", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool ArgusComponentHealthComponentBulkSerializeTest::RunTest(const FString& Parameters)
+{
+	const uint32 expectedSerializedHealthValue = 250u;
+
+	ArgusTesting::StartArgusTest();
+	ArgusEntity entity = ArgusEntity::CreateEntity();
+	ArgusEntity entityWithoutHealth = ArgusEntity::CreateEntity();
+	HealthComponent* healthComponent = entity.AddComponent<HealthComponent>();
+
+	if (!healthComponent || !entityWithoutHealth)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	healthComponent->m_currentHealth = expectedSerializedHealthValue;
+
+	TArray<uint8> serializedBytes;
+	FMemoryWriter writer = FMemoryWriter(serializedBytes);
+	ArgusComponentRegistry::Serialize(writer);
+
+	ArgusComponentRegistry::FlushAllComponents();
+
+	FMemoryReader reader = FMemoryReader(serializedBytes);
+	ArgusComponentRegistry::Serialize(reader);
+	healthComponent = ArgusComponentRegistry::GetComponent<HealthComponent>(entity.GetId());
+
+#pragma region Test that a bulk serialized HealthComponent keeps its value across a save and load
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Serializing a %s with health %d, flushing components, deserializing, then checking the value is %d."), ARGUS_FUNCNAME, ARGUS_NAMEOF(HealthComponent), expectedSerializedHealthValue, expectedSerializedHealthValue),
+		healthComponent && healthComponent->m_currentHealth == expectedSerializedHealthValue
+	);
+#pragma endregion
+
+#pragma region Test that bulk serialization does not activate components that were not saved
+	TestNull
+	(
+		FString::Printf(TEXT("[%s] Checking that an entity without a %s still has none after deserializing."), ARGUS_FUNCNAME, ARGUS_NAMEOF(HealthComponent)),
+		ArgusComponentRegistry::GetComponent<HealthComponent>(entityWithoutHealth.GetId())
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ArgusComponentHealthComponentBulkSerializeLayoutMismatchTest, "Argus.ECS.Component.HealthComponent.BulkSerializeLayoutMismatch", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool ArgusComponentHealthComponentBulkSerializeLayoutMismatchTest::RunTest(const FString& Parameters)
+{
+	// Statically allocated component types are indexed alphabetically, which puts HealthComponent tenth.
+	const uint32 healthComponentTypeIndex = 9u;
+	const uint32 serializedHealthValue = 250u;
+
+	ArgusTesting::StartArgusTest();
+	ArgusEntity entity = ArgusEntity::CreateEntity();
+	HealthComponent* healthComponent = entity.AddComponent<HealthComponent>();
+
+	if (!healthComponent)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	healthComponent->m_currentHealth = serializedHealthValue;
+
+	TArray<uint8> serializedBytes;
+	FMemoryWriter writer = FMemoryWriter(serializedBytes);
+	ArgusComponentRegistry::SerializeComponentType(writer, healthComponentTypeIndex);
+
+	// The layout hash is the first thing written for a bulk serialized type.
+	uint32 serializedLayoutHash = 0u;
+	FMemory::Memcpy(&serializedLayoutHash, serializedBytes.GetData(), sizeof(uint32));
+	serializedLayoutHash = ~serializedLayoutHash;
+	FMemory::Memcpy(serializedBytes.GetData(), &serializedLayoutHash, sizeof(uint32));
+
+	ArgusComponentRegistry::FlushAllComponents();
+
+	AddExpectedError(TEXT("no longer matches the current layout"), EAutomationExpectedErrorFlags::Contains, 1);
+	FMemoryReader reader = FMemoryReader(serializedBytes);
+	ArgusComponentRegistry::SerializeComponentType(reader, healthComponentTypeIndex);
+
+#pragma region Test that a mismatched layout fails the load instead of leaving default components active
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Deserializing %s with a mismatched layout hash, then checking that the archive errored and no %s is active."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(HealthComponent),
+			ARGUS_NAMEOF(HealthComponent)
+		),
+		reader.IsError() && ArgusComponentRegistry::GetComponent<HealthComponent>(entity.GetId()) == nullptr
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ArgusComponentRegistrySerializeComponentTypeTest, "Argus.ECS.Component.ComponentRegistry.SerializeComponentType", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool ArgusComponentRegistrySerializeComponentTypeTest::RunTest(const FString& Parameters)
+{
+	const uint32 expectedSerializedHealthValue = 250u;
+	const FVector expectedSerializedLocation = FVector(100.0f, 200.0f, 0.0f);
+
+	ArgusTesting::StartArgusTest();
+	ArgusEntity entity = ArgusEntity::CreateEntity();
+	HealthComponent* healthComponent = entity.AddComponent<HealthComponent>();
+	TransformComponent* transformComponent = entity.AddComponent<TransformComponent>();
+
+	if (!healthComponent || !transformComponent)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	healthComponent->m_currentHealth = expectedSerializedHealthValue;
+	transformComponent->m_location = expectedSerializedLocation;
+
+	TArray<TArray<uint8>> serializedBytesPerType;
+	serializedBytesPerType.SetNum(ArgusComponentRegistry::k_numStaticComponentTypes);
+	for (uint32 i = 0u; i < ArgusComponentRegistry::k_numStaticComponentTypes; ++i)
+	{
+		FMemoryWriter writer = FMemoryWriter(serializedBytesPerType[i]);
+		ArgusComponentRegistry::SerializeComponentType(writer, i);
+	}
+
+	ArgusComponentRegistry::FlushAllComponents();
+
+	// Types are independent, so reading them back in a different order than they were written must not matter.
+	for (int32 i = serializedBytesPerType.Num() - 1; i >= 0; --i)
+	{
+		FMemoryReader reader = FMemoryReader(serializedBytesPerType[i]);
+		ArgusComponentRegistry::SerializeComponentType(reader, static_cast<uint32>(i));
+	}
+	healthComponent = ArgusComponentRegistry::GetComponent<HealthComponent>(entity.GetId());
+	transformComponent = ArgusComponentRegistry::GetComponent<TransformComponent>(entity.GetId());
+
+#pragma region Test that a HealthComponent keeps its value when component types are serialized separately
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Serializing each component type separately, flushing components, deserializing in reverse order, then checking the %s value is %d."), ARGUS_FUNCNAME, ARGUS_NAMEOF(HealthComponent), expectedSerializedHealthValue),
+		healthComponent && healthComponent->m_currentHealth == expectedSerializedHealthValue
+	);
+#pragma endregion
+
+#pragma region Test that a TransformComponent keeps its value when component types are serialized separately
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Serializing each component type separately, flushing components, deserializing in reverse order, then checking the %s location is %s."), ARGUS_FUNCNAME, ARGUS_NAMEOF(TransformComponent), *expectedSerializedLocation.ToString()),
+		transformComponent && transformComponent->m_location.Equals(expectedSerializedLocation)
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(ArgusComponentSpatialPartitioningComponentPersistenceTest, "Argus.ECS.Component.SpatialPartitioningComponent.Persistence", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
 bool ArgusComponentSpatialPartitioningComponentPersistenceTest::RunTest(const FString& Parameters)
 {
@@ -55,4 +55,64 @@ bool ArgusEntityTemplateInstantiateEntityTest::RunTest(const FString& Parameters
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ArgusEntityTemplateMakeEntitiesTest, "Argus.ECS.EntityTemplate.MakeEntities", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool ArgusEntityTemplateMakeEntitiesTest::RunTest(const FString& Parameters)
+{
+	const uint32 expectedHealthValue = 5000u;
+	const int32 numEntitiesToMake = 8;
+
+	ArgusTesting::StartArgusTest();
+
+	UHealthComponentData* healthComponentData = NewObject<UHealthComponentData>();
+	healthComponentData->m_currentHealth = expectedHealthValue;
+
+	UArgusEntityTemplate* entityTemplate = NewObject<UArgusEntityTemplate>();
+	entityTemplate->m_entityPriority = UEntityPriority::MediumPriority;
+	entityTemplate->m_componentData.Add(healthComponentData);
+
+	TArray<ArgusEntity> entities;
+	entityTemplate->MakeEntities(numEntitiesToMake, entities);
+
+#pragma region Test that the requested number of entities were made in one batch
+	TestEqual
+	(
+		FString::Printf(TEXT("[%s] Validating that %s made %d entities."), ARGUS_FUNCNAME, ARGUS_NAMEOF(UArgusEntityTemplate::MakeEntities), numEntitiesToMake),
+		entities.Num(),
+		numEntitiesToMake
+	);
+#pragma endregion
+
+	int32 numEntitiesWithExpectedHealth = 0;
+	for (const ArgusEntity& entity : entities)
+	{
+		if (const HealthComponent* healthComponent = entity.GetComponent<HealthComponent>())
+		{
+			if (healthComponent->m_currentHealth == expectedHealthValue)
+			{
+				numEntitiesWithExpectedHealth++;
+			}
+		}
+	}
+
+#pragma region Test that every entity in the batch was populated from the template
+	TestEqual
+	(
+		FString::Printf(TEXT("[%s] Validating that every batched %s has a %s with the proper value, %d."), ARGUS_FUNCNAME, ARGUS_NAMEOF(ArgusEntity), ARGUS_NAMEOF(HealthComponent), expectedHealthValue),
+		numEntitiesWithExpectedHealth,
+		numEntitiesToMake
+	);
+#pragma endregion
+
+#pragma region Test that the template compiled its spawn recipe
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Validating that the template compiled its spawn recipe."), ARGUS_FUNCNAME),
+		entityTemplate->m_spawnRecipe.m_isCompiled && entityTemplate->m_spawnRecipe.m_componentData.Num() == 1
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
 #endif //WITH_AUTOMATION_TESTS
\ No newline at end of file
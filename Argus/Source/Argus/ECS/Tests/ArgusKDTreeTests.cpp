@@ -564,4 +564,123 @@ bool ArgusUtilitiesArgusKDTreeFindArgusEntityIdsWithinRangeOfLocationTest::RunTe
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ArgusUtilitiesArgusKDTreeFindNearestHostileTest, "Argus.Utilities.ArgusKDTree.FindNearestHostileTest", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool ArgusUtilitiesArgusKDTreeFindNearestHostileTest::RunTest(const FString& Parameters)
+{
+	const float range = 200.0f;
+
+	ArgusTesting::StartArgusTest();
+	SpatialPartitioningComponent* spatialPartitioningComponent = ArgusEntity::CreateEntity(ArgusECSConstants::k_singletonEntityId).GetOrAddComponent<SpatialPartitioningComponent>();
+	if (!spatialPartitioningComponent)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+	CollectionOfArgusEntities entities;
+	PopulateKDTreeForTests(spatialPartitioningComponent->m_argusEntityKDTree, entities, false);
+
+	IdentityComponent* identityComponent0 = entities.entity0.AddComponent<IdentityComponent>();
+	IdentityComponent* identityComponent1 = entities.entity1.AddComponent<IdentityComponent>();
+	IdentityComponent* identityComponent2 = entities.entity2.AddComponent<IdentityComponent>();
+	IdentityComponent* identityComponent3 = entities.entity3.AddComponent<IdentityComponent>();
+	IdentityComponent* identityComponent4 = entities.entity4.AddComponent<IdentityComponent>();
+	if (!identityComponent0 || !identityComponent1 || !identityComponent2 || !identityComponent3 || !identityComponent4)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	identityComponent0->m_team = ETeam::TeamA;
+	identityComponent1->m_team = ETeam::TeamA;
+	identityComponent2->m_team = ETeam::TeamB;
+	identityComponent3->m_team = ETeam::TeamB;
+	identityComponent4->m_team = ETeam::TeamB;
+
+	spatialPartitioningComponent->m_argusEntityKDTree.InsertArgusEntityIntoKDTree(entities.entity0);
+	spatialPartitioningComponent->m_argusEntityKDTree.InsertArgusEntityIntoKDTree(entities.entity1);
+	spatialPartitioningComponent->m_argusEntityKDTree.InsertArgusEntityIntoKDTree(entities.entity2);
+	spatialPartitioningComponent->m_argusEntityKDTree.InsertArgusEntityIntoKDTree(entities.entity3);
+	spatialPartitioningComponent->m_argusEntityKDTree.InsertArgusEntityIntoKDTree(entities.entity4);
+
+	ArgusEntityKDTreeRangeOutput output;
+	ArgusEntityKDTreeQueryRangeThresholds thresholds = ArgusEntityKDTreeQueryRangeThresholds(0.0f, 0.0f, 0.0f, ArgusECSConstants::k_maxEntities);
+	thresholds.m_hostileTeamMask = static_cast<BITMASK_ETeam>(ETeam::TeamB);
+	spatialPartitioningComponent->m_argusEntityKDTree.FindArgusEntityIdsWithinRangeOfLocation(output, thresholds, ArgusKDTreeTestConstants::location0, range, entities.entity0);
+	const uint32 hostileQuerySightRangeSignature = output.GetSightRangeSignature();
+
+#pragma region Test that the range query tracks the nearest entity on a hostile team
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Creating a %s, creating some %s on two teams, then checking that %s returns the closest %s on the hostile team."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(ArgusEntityKDTree),
+			ARGUS_NAMEOF(ArgusEntity),
+			ARGUS_NAMEOF(ArgusEntityKDTreeRangeOutput::GetNearestHostileEntityId),
+			ARGUS_NAMEOF(ArgusEntity)
+		),
+		output.GetNearestHostileEntityId(),
+		ArgusKDTreeTestConstants::id3
+	);
+#pragma endregion
+
+	output.ResetAll();
+	thresholds.m_hostileTeamMask = 0u;
+	spatialPartitioningComponent->m_argusEntityKDTree.FindArgusEntityIdsWithinRangeOfLocation(output, thresholds, ArgusKDTreeTestConstants::location0, range, entities.entity0);
+
+#pragma region Test that no hostile is tracked when the query has no hostile teams
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Creating a %s, creating some %s on two teams, then checking that %s returns %s when no teams are hostile."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(ArgusEntityKDTree),
+			ARGUS_NAMEOF(ArgusEntity),
+			ARGUS_NAMEOF(ArgusEntityKDTreeRangeOutput::GetNearestHostileEntityId),
+			ARGUS_NAMEOF(ArgusECSConstants::k_maxEntities)
+		),
+		output.GetNearestHostileEntityId(),
+		ArgusECSConstants::k_maxEntities
+	);
+#pragma endregion
+
+#pragma region Test that the sight range signature only depends on which entities are in range
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Creating a %s, querying the same range twice with different hostile teams, then checking that %s matches between the two queries."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(ArgusEntityKDTree),
+			ARGUS_NAMEOF(ArgusEntityKDTreeRangeOutput::GetSightRangeSignature)
+		),
+		output.GetSightRangeSignature(),
+		hostileQuerySightRangeSignature
+	);
+#pragma endregion
+
+	output.ResetAll();
+	spatialPartitioningComponent->m_argusEntityKDTree.FindArgusEntityIdsWithinRangeOfLocation(output, thresholds, ArgusKDTreeTestConstants::location0, 0.0f, entities.entity0);
+
+#pragma region Test that the sight range signature changes when entities leave range
+	TestNotEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Creating a %s, shrinking the query range to zero, then checking that %s changes."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(ArgusEntityKDTree),
+			ARGUS_NAMEOF(ArgusEntityKDTreeRangeOutput::GetSightRangeSignature)
+		),
+		output.GetSightRangeSignature(),
+		hostileQuerySightRangeSignature
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
 #endif //WITH_AUTOMATION_TESTS
\ No newline at end of file
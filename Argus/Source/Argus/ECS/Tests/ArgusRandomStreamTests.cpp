@@ -0,0 +1,92 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusTesting.h"
+#include "ComponentDependencies/ArgusRandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ArgusRandomStreamSerializeTest, "Argus.ECS.ArgusRandomStream.Serialize", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool ArgusRandomStreamSerializeTest::RunTest(const FString& Parameters)
+{
+	const int32 initialSeed = 1234;
+	const int32 numAdvances = 7;
+	const uint32 entityId = 12u;
+	const uint32 neighborIndex = 3u;
+
+	ArgusTesting::StartArgusTest();
+
+	ArgusRandomStream randomStream;
+	randomStream.Initialize(initialSeed);
+	for (int32 i = 0; i < numAdvances; ++i)
+	{
+		randomStream.Advance();
+	}
+
+	TArray<uint8> serializedBytes;
+	FMemoryWriter writer = FMemoryWriter(serializedBytes);
+	randomStream.Serialize(writer);
+
+	ArgusRandomStream loadedRandomStream;
+	FMemoryReader reader = FMemoryReader(serializedBytes);
+	loadedRandomStream.Serialize(reader);
+
+#pragma region Test that a loaded stream continues from the same seed
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s restores the current seed of an %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(ArgusRandomStream::Serialize),
+			ARGUS_NAMEOF(ArgusRandomStream)
+		),
+		loadedRandomStream.GetCurrentSeed(),
+		randomStream.GetCurrentSeed()
+	);
+#pragma endregion
+
+	randomStream.Advance();
+	loadedRandomStream.Advance();
+	const FRandomStream derivedStream = randomStream.MakeDerivedStream(entityId, neighborIndex);
+	const FRandomStream loadedDerivedStream = loadedRandomStream.MakeDerivedStream(entityId, neighborIndex);
+
+#pragma region Test that a loaded stream derives the same values
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s gives the same values before and after a round trip through %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(ArgusRandomStream::MakeDerivedStream),
+			ARGUS_NAMEOF(ArgusRandomStream::Serialize)
+		),
+		loadedDerivedStream.GetUnsignedInt(),
+		derivedStream.GetUnsignedInt()
+	);
+#pragma endregion
+
+	const FRandomStream otherNeighborStream = randomStream.MakeDerivedStream(entityId, neighborIndex + 1u);
+	const FRandomStream repeatedDerivedStream = randomStream.MakeDerivedStream(entityId, neighborIndex);
+
+#pragma region Test that derived streams only depend on their salts
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s is unaffected by other derived streams and differs per salt."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(ArgusRandomStream::MakeDerivedStream)
+		),
+		repeatedDerivedStream.GetCurrentSeed() == derivedStream.GetInitialSeed() &&
+		otherNeighborStream.GetInitialSeed() != derivedStream.GetInitialSeed()
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+#endif //WITH_AUTOMATION_TESTS
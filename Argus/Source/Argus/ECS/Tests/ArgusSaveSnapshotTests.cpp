@@ -0,0 +1,280 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusEntity.h"
+#include "ArgusMetadataSaveGame.h"
+#include "ArgusReplayManager.h"
+#include "ArgusSaveGame.h"
+#include "ArgusTesting.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryWriter.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ArgusSaveSnapshotRewindTest, "Argus.Persistence.ArgusSaveSnapshot.Rewind", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool ArgusSaveSnapshotRewindTest::RunTest(const FString& Parameters)
+{
+	const uint32 expectedRewoundHealthValue = 250u;
+	const uint32 changedHealthValue = 10u;
+
+	ArgusTesting::StartArgusTest();
+	ArgusEntity entity = ArgusEntity::CreateEntity();
+	HealthComponent* healthComponent = entity.AddComponent<HealthComponent>();
+	ArgusEntity entityDestroyedAfterSnapshot = ArgusEntity::CreateEntity();
+	if (!healthComponent || !entityDestroyedAfterSnapshot.AddComponent<HealthComponent>())
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	healthComponent->m_currentHealth = expectedRewoundHealthValue;
+	const uint16 entityDestroyedAfterSnapshotId = entityDestroyedAfterSnapshot.GetId();
+
+	ArgusSaveSnapshot snapshot;
+	snapshot.Capture();
+	const bool didCopyComponentTypes = snapshot.HasComponentTypeCopies();
+	snapshot.SerializeComponentTypeCopies();
+
+	// Every type is serialized in place again, so copied types only match if writing the copy later produces the same bytes.
+	bool doSerializedCopiesMatch = true;
+	for (uint32 i = 0u; i < ArgusComponentRegistry::k_numStaticComponentTypes; ++i)
+	{
+		TArray<uint8> inPlaceBytes;
+		FMemoryWriter inPlaceWriter = FMemoryWriter(inPlaceBytes);
+		ArgusComponentRegistry::SerializeComponentType(inPlaceWriter, i);
+		doSerializedCopiesMatch &= inPlaceBytes == snapshot.m_chunks[i + 1].m_snapshotBytes;
+	}
+
+#pragma region Test that capturing a snapshot copies bulk serialized component types instead of serializing them
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Capturing an %s with a %s, then checking that it has copies to serialize until %s runs."), ARGUS_FUNCNAME, ARGUS_NAMEOF(ArgusSaveSnapshot), ARGUS_NAMEOF(HealthComponent), ARGUS_NAMEOF(ArgusSaveSnapshot::SerializeComponentTypeCopies)),
+		didCopyComponentTypes && !snapshot.HasComponentTypeCopies()
+	);
+#pragma endregion
+
+#pragma region Test that serializing copied component types writes the same bytes as serializing them in place
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Calling %s, then checking that every chunk matches %s on the live components."), ARGUS_FUNCNAME, ARGUS_NAMEOF(ArgusSaveSnapshot::SerializeComponentTypeCopies), ARGUS_NAMEOF(ArgusComponentRegistry::SerializeComponentType)),
+		doSerializedCopiesMatch
+	);
+#pragma endregion
+
+	healthComponent->m_currentHealth = changedHealthValue;
+	ArgusEntity::DestroyEntity(entityDestroyedAfterSnapshot);
+	ArgusEntity entityCreatedAfterSnapshot = ArgusEntity::CreateEntity();
+	const uint16 entityCreatedAfterSnapshotId = entityCreatedAfterSnapshot.GetId();
+
+	// Applied on top of the changed state, without flushing first, so that every check below only passes if Apply itself restored it.
+	const bool didApply = snapshot.Apply();
+	healthComponent = entity.GetComponent<HealthComponent>();
+
+#pragma region Test that applying a snapshot succeeds
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Capturing an %s, then checking that %s succeeds."), ARGUS_FUNCNAME, ARGUS_NAMEOF(ArgusSaveSnapshot), ARGUS_NAMEOF(ArgusSaveSnapshot::Apply)),
+		didApply
+	);
+#pragma endregion
+
+#pragma region Test that applying a snapshot restores component values
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Capturing an %s, changing health to %d, applying the snapshot, then checking that health is back to %d."), ARGUS_FUNCNAME, ARGUS_NAMEOF(ArgusSaveSnapshot), changedHealthValue, expectedRewoundHealthValue),
+		healthComponent && healthComponent->m_currentHealth == expectedRewoundHealthValue
+	);
+#pragma endregion
+
+#pragma region Test that applying a snapshot removes entities created after it was captured
+	TestFalse
+	(
+		FString::Printf(TEXT("[%s] Capturing an %s, creating an %s, applying the snapshot, then checking that the new %s no longer exists."), ARGUS_FUNCNAME, ARGUS_NAMEOF(ArgusSaveSnapshot), ARGUS_NAMEOF(ArgusEntity), ARGUS_NAMEOF(ArgusEntity)),
+		ArgusEntity::DoesEntityExist(entityCreatedAfterSnapshotId)
+	);
+#pragma endregion
+
+#pragma region Test that applying a snapshot brings back entities destroyed after it was captured
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Capturing an %s, destroying an %s, applying the snapshot, then checking that the destroyed %s and its %s exist again."), ARGUS_FUNCNAME, ARGUS_NAMEOF(ArgusSaveSnapshot), ARGUS_NAMEOF(ArgusEntity), ARGUS_NAMEOF(ArgusEntity), ARGUS_NAMEOF(HealthComponent)),
+		ArgusEntity::DoesEntityExist(entityDestroyedAfterSnapshotId) && ArgusEntity::RetrieveEntity(entityDestroyedAfterSnapshotId).GetComponent<HealthComponent>()
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ArgusSaveSnapshotDeltaEncodeTest, "Argus.Persistence.ArgusSaveSnapshot.DeltaEncode", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool ArgusSaveSnapshotDeltaEncodeTest::RunTest(const FString& Parameters)
+{
+	const uint32 initialHealthValue = 250u;
+	const uint32 changedHealthValue = 10u;
+	const int32 expectedNumDirtySlots = 1;
+
+	ArgusTesting::StartArgusTest();
+	ArgusEntity unchangedEntity = ArgusEntity::CreateEntity();
+	ArgusEntity changedEntity = ArgusEntity::CreateEntity();
+	HealthComponent* unchangedHealthComponent = unchangedEntity.AddComponent<HealthComponent>();
+	HealthComponent* changedHealthComponent = changedEntity.AddComponent<HealthComponent>();
+	UArgusSaveGame* keyframeSaveGame = NewObject<UArgusSaveGame>();
+	UArgusSaveGame* deltaSaveGame = NewObject<UArgusSaveGame>();
+	if (!unchangedHealthComponent || !changedHealthComponent || !keyframeSaveGame || !deltaSaveGame)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	unchangedHealthComponent->m_currentHealth = initialHealthValue;
+	changedHealthComponent->m_currentHealth = initialHealthValue;
+
+	ArgusSaveSnapshot keyframeSnapshot;
+	keyframeSnapshot.Capture(true);
+	const bool didEncodeKeyframe = keyframeSnapshot.Encode(nullptr);
+
+	changedHealthComponent->m_currentHealth = changedHealthValue;
+
+	ArgusSaveSnapshot deltaSnapshot;
+	deltaSnapshot.Capture(true);
+	const bool didEncodeDelta = deltaSnapshot.Encode(&keyframeSnapshot);
+
+	int32 numDirtyComponentSlots = 0;
+	for (int32 i = ArgusSaveSnapshot::k_entityChunkIndex + 1; i < deltaSnapshot.m_chunks.Num(); ++i)
+	{
+		numDirtyComponentSlots += deltaSnapshot.m_chunks[i].m_dirtySlotIndices.Num();
+	}
+
+	keyframeSaveGame->TakeEncodedSnapshot(keyframeSnapshot, FString());
+	deltaSaveGame->TakeEncodedSnapshot(deltaSnapshot, TEXT("Keyframe"));
+
+	ArgusSaveSnapshot decodedKeyframeSnapshot;
+	ArgusSaveSnapshot decodedDeltaSnapshot;
+	const bool didDecodeKeyframe = keyframeSaveGame->DecodeSnapshot(nullptr, decodedKeyframeSnapshot);
+	const bool didDecodeDelta = didDecodeKeyframe && deltaSaveGame->DecodeSnapshot(&decodedKeyframeSnapshot, decodedDeltaSnapshot);
+
+	bool doDecodedBytesMatch = decodedDeltaSnapshot.m_chunks.Num() == deltaSnapshot.m_chunks.Num();
+	for (int32 i = 0; doDecodedBytesMatch && i < deltaSnapshot.m_chunks.Num(); ++i)
+	{
+		doDecodedBytesMatch = decodedDeltaSnapshot.m_chunks[i].m_snapshotBytes == deltaSnapshot.m_chunks[i].m_snapshotBytes;
+	}
+
+#pragma region Test that encoding a keyframe and a delta succeeds
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Capturing two %s, then checking that %s succeeds for both the keyframe and the delta."), ARGUS_FUNCNAME, ARGUS_NAMEOF(ArgusSaveSnapshot), ARGUS_NAMEOF(ArgusSaveSnapshot::Encode)),
+		didEncodeKeyframe && didEncodeDelta
+	);
+#pragma endregion
+
+#pragma region Test that changing one entity only dirties its own slot
+	TestEqual
+	(
+		FString::Printf(TEXT("[%s] Changing the health of one of two %s between captures, then checking that the delta has %d dirty component slot."), ARGUS_FUNCNAME, ARGUS_NAMEOF(ArgusEntity), expectedNumDirtySlots),
+		numDirtyComponentSlots,
+		expectedNumDirtySlots
+	);
+#pragma endregion
+
+#pragma region Test that a decoded delta matches the captured state
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Decoding a delta on top of its keyframe with %s, then checking that every chunk matches the captured bytes."), ARGUS_FUNCNAME, ARGUS_NAMEOF(UArgusSaveGame::DecodeSnapshot)),
+		didDecodeDelta && doDecodedBytesMatch
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ArgusMetadataSaveGameKeyframeDependencyTest, "Argus.Persistence.ArgusMetadataSaveGame.KeyframeDependency", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool ArgusMetadataSaveGameKeyframeDependencyTest::RunTest(const FString& Parameters)
+{
+	const FString keyframeSlotName = TEXT("ArgusSave_0");
+	const FString deltaSlotName = TEXT("ArgusSave_1");
+
+	UArgusMetadataSaveGame* metadataSaveGame = NewObject<UArgusMetadataSaveGame>();
+	if (!metadataSaveGame)
+	{
+		return false;
+	}
+
+	metadataSaveGame->AddSaveSlot(keyframeSlotName, FString());
+	metadataSaveGame->AddSaveSlot(deltaSlotName, keyframeSlotName);
+
+#pragma region Test that a keyframe with deltas is reported as depended on
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Adding delta %s on top of keyframe %s, then checking that %s is true for the keyframe."), ARGUS_FUNCNAME, *deltaSlotName, *keyframeSlotName, ARGUS_NAMEOF(UArgusMetadataSaveGame::HasDeltaSavesOfKeyframe)),
+		metadataSaveGame->HasDeltaSavesOfKeyframe(keyframeSlotName)
+	);
+#pragma endregion
+
+#pragma region Test that a delta is not reported as depended on
+	TestFalse
+	(
+		FString::Printf(TEXT("[%s] Adding delta %s on top of keyframe %s, then checking that %s is false for the delta."), ARGUS_FUNCNAME, *deltaSlotName, *keyframeSlotName, ARGUS_NAMEOF(UArgusMetadataSaveGame::HasDeltaSavesOfKeyframe)),
+		metadataSaveGame->HasDeltaSavesOfKeyframe(deltaSlotName)
+	);
+#pragma endregion
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ArgusReplayManagerStateChecksumTest, "Argus.Persistence.ArgusReplayManager.StateChecksum", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool ArgusReplayManagerStateChecksumTest::RunTest(const FString& Parameters)
+{
+	const uint32 initialHealthValue = 250u;
+	const uint32 changedHealthValue = 10u;
+
+	ArgusTesting::StartArgusTest();
+	ArgusEntity entity = ArgusEntity::CreateEntity();
+	HealthComponent* healthComponent = entity.AddComponent<HealthComponent>();
+	if (!healthComponent)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	healthComponent->m_currentHealth = initialHealthValue;
+	const uint32 initialChecksum = UArgusReplayManager::ComputeStateChecksum();
+	const uint32 repeatedChecksum = UArgusReplayManager::ComputeStateChecksum();
+
+	healthComponent->m_currentHealth = changedHealthValue;
+	const uint32 changedChecksum = UArgusReplayManager::ComputeStateChecksum();
+
+	healthComponent->m_currentHealth = initialHealthValue;
+	const uint32 restoredChecksum = UArgusReplayManager::ComputeStateChecksum();
+
+#pragma region Test that the checksum is stable for unchanged state
+	TestEqual
+	(
+		FString::Printf(TEXT("[%s] Calling %s twice without changing any components, then checking that both checksums match."), ARGUS_FUNCNAME, ARGUS_NAMEOF(UArgusReplayManager::ComputeStateChecksum)),
+		repeatedChecksum,
+		initialChecksum
+	);
+#pragma endregion
+
+#pragma region Test that the checksum changes when a component value changes
+	TestNotEqual
+	(
+		FString::Printf(TEXT("[%s] Changing health from %d to %d, then checking that %s returns a different checksum."), ARGUS_FUNCNAME, initialHealthValue, changedHealthValue, ARGUS_NAMEOF(UArgusReplayManager::ComputeStateChecksum)),
+		changedChecksum,
+		initialChecksum
+	);
+#pragma endregion
+
+#pragma region Test that the checksum only depends on current state
+	TestEqual
+	(
+		FString::Printf(TEXT("[%s] Changing health to %d and back to %d, then checking that %s returns the original checksum."), ARGUS_FUNCNAME, changedHealthValue, initialHealthValue, ARGUS_NAMEOF(UArgusReplayManager::ComputeStateChecksum)),
+		restoredChecksum,
+		initialChecksum
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+#endif //WITH_AUTOMATION_TESTS
@@ -0,0 +1,104 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusStaticRecordTable.h"
+#include "ArgusTesting.h"
+#include "Misc/AutomationTest.h"
+#include "RecordDefinitions/AbilityRecord.h"
+#include "RecordDefinitions/ResourceSetRecord.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ArgusStaticRecordTablePopulateOnLoadTest, "Argus.StaticData.ArgusStaticRecordTable.PopulateOnLoad", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool ArgusStaticRecordTablePopulateOnLoadTest::RunTest(const FString& Parameters)
+{
+	const uint32 resourceSetRecordId = 7u;
+	const uint32 lateResourceSetRecordId = 15u;
+	const uint32 numResourceSetRecords = lateResourceSetRecordId + 1u;
+	const uint32 abilityRecordId = 3u;
+	const int32 resourceAQuantity = 250;
+	const float timeToCastSeconds = 1.5f;
+
+	ArgusTesting::StartArgusTest();
+	ArgusStaticRecordTables::ResetAllTables();
+	ArgusStaticRecordTable<UResourceSetRecord>::Initialize(numResourceSetRecords);
+	ArgusStaticRecordTable<UAbilityRecord>::Initialize(abilityRecordId + 1u);
+
+	UResourceSetRecord* resourceSetRecord = NewObject<UResourceSetRecord>();
+	resourceSetRecord->m_id = resourceSetRecordId;
+	resourceSetRecord->m_resourceSet.m_resourceQuantities[static_cast<uint8>(EResourceType::ResourceA)] = resourceAQuantity;
+	resourceSetRecord->OnAsyncLoaded();
+
+	UAbilityRecord* abilityRecord = NewObject<UAbilityRecord>();
+	abilityRecord->m_id = abilityRecordId;
+	abilityRecord->m_timeToCastSeconds = timeToCastSeconds;
+	abilityRecord->m_requiredResourceChangeToCast = resourceSetRecord->m_resourceSet;
+	abilityRecord->OnAsyncLoaded();
+
+	const ResourceSetRecordData* flatResourceSetRecord = ArgusStaticRecordTable<UResourceSetRecord>::Get(resourceSetRecordId);
+	const AbilityRecordData* flatAbilityRecord = ArgusStaticRecordTable<UAbilityRecord>::Get(abilityRecordId);
+
+#pragma region Test that loading a record populates its row in the flat table
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Test that loading a %s populates %s at id %d."), ARGUS_FUNCNAME, ARGUS_NAMEOF(UResourceSetRecord), ARGUS_NAMEOF(ArgusStaticRecordTable), resourceSetRecordId),
+		flatResourceSetRecord != nullptr
+	);
+#pragma endregion
+
+	if (!flatResourceSetRecord || !flatAbilityRecord)
+	{
+		ArgusStaticRecordTables::ResetAllTables();
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+#pragma region Test that the flat resource set matches the authored record
+	TestEqual
+	(
+		FString::Printf(TEXT("[%s] Test that the flattened %s matches the authored %s."), ARGUS_FUNCNAME, ARGUS_NAMEOF(FResourceSet), ARGUS_NAMEOF(UResourceSetRecord)),
+		flatResourceSetRecord->m_resourceSet.m_resourceQuantities[static_cast<uint8>(EResourceType::ResourceA)],
+		resourceAQuantity
+	);
+#pragma endregion
+
+#pragma region Test that the flat ability record matches the authored record
+	TestEqual
+	(
+		FString::Printf(TEXT("[%s] Test that the flattened %s is %f."), ARGUS_FUNCNAME, ARGUS_NAMEOF(AbilityRecordData::m_timeToCastSeconds), timeToCastSeconds),
+		flatAbilityRecord->m_timeToCastSeconds,
+		timeToCastSeconds
+	);
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Test that the flattened %s matches the authored record."), ARGUS_FUNCNAME, ARGUS_NAMEOF(AbilityRecordData::m_requiredResourceChangeToCast)),
+		flatAbilityRecord->m_requiredResourceChangeToCast == abilityRecord->m_requiredResourceChangeToCast
+	);
+#pragma endregion
+
+	UResourceSetRecord* lateResourceSetRecord = NewObject<UResourceSetRecord>();
+	lateResourceSetRecord->m_id = lateResourceSetRecordId;
+	lateResourceSetRecord->OnAsyncLoaded();
+
+#pragma region Test that loading a later record does not move rows that were already handed out
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that populating id %d leaves the row for id %d where it was when %s returned it."),
+			ARGUS_FUNCNAME,
+			lateResourceSetRecordId,
+			resourceSetRecordId,
+			ARGUS_NAMEOF(ArgusStaticRecordTable::Get)
+		),
+		ArgusStaticRecordTable<UResourceSetRecord>::Get(lateResourceSetRecordId) != nullptr &&
+		ArgusStaticRecordTable<UResourceSetRecord>::Get(resourceSetRecordId) == flatResourceSetRecord &&
+		flatResourceSetRecord->m_resourceSet.m_resourceQuantities[static_cast<uint8>(EResourceType::ResourceA)] == resourceAQuantity
+	);
+#pragma endregion
+
+	ArgusStaticRecordTables::ResetAllTables();
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+#endif //WITH_AUTOMATION_TESTS
@@ -0,0 +1,130 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusEntity.h"
+#include "ArgusTesting.h"
+#include "Misc/AutomationTest.h"
+#include "Systems/CombatSystems.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(CombatSystemsProcessDamageEventsTest, "Argus.ECS.Systems.CombatSystems.ProcessDamageEvents", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool CombatSystemsProcessDamageEventsTest::RunTest(const FString& Parameters)
+{
+	const uint32 startingHealth = 100u;
+	const uint32 damagePerAttacker = 40u;
+
+	ArgusTesting::StartArgusTest();
+	ArgusEntity attackerEntity0 = ArgusEntity::CreateEntity();
+	ArgusEntity attackerEntity1 = ArgusEntity::CreateEntity();
+	ArgusEntity carrierEntity = ArgusEntity::CreateEntity();
+	ArgusEntity passengerEntity = ArgusEntity::CreateEntity();
+
+	TaskComponent* attackerTaskComponent0 = attackerEntity0.AddComponent<TaskComponent>();
+	TaskComponent* attackerTaskComponent1 = attackerEntity1.AddComponent<TaskComponent>();
+	TargetingComponent* attackerTargetingComponent0 = attackerEntity0.AddComponent<TargetingComponent>();
+	TargetingComponent* attackerTargetingComponent1 = attackerEntity1.AddComponent<TargetingComponent>();
+	HealthComponent* carrierHealthComponent = carrierEntity.AddComponent<HealthComponent>();
+	TaskComponent* carrierTaskComponent = carrierEntity.AddComponent<TaskComponent>();
+	CarrierComponent* carrierComponent = carrierEntity.AddComponent<CarrierComponent>();
+	HealthComponent* passengerHealthComponent = passengerEntity.AddComponent<HealthComponent>();
+	TaskComponent* passengerTaskComponent = passengerEntity.AddComponent<TaskComponent>();
+	carrierEntity.AddComponent<ObserversComponent>();
+	passengerEntity.AddComponent<ObserversComponent>();
+
+	if (!attackerTaskComponent0 || !attackerTaskComponent1 || !attackerTargetingComponent0 || !attackerTargetingComponent1 || !carrierHealthComponent ||
+		!carrierTaskComponent || !carrierComponent || !passengerHealthComponent || !passengerTaskComponent)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	carrierHealthComponent->m_currentHealth = startingHealth;
+	carrierComponent->m_passengerEntityIds.Add(passengerEntity.GetId());
+	attackerTaskComponent0->m_combatState = ECombatState::Attacking;
+	attackerTaskComponent1->m_combatState = ECombatState::Attacking;
+	attackerTargetingComponent0->m_targetEntityId = carrierEntity.GetId();
+	attackerTargetingComponent1->m_targetEntityId = carrierEntity.GetId();
+
+	TArray<DamageEvent> damageEvents;
+	DamageEvent& damageEvent0 = damageEvents.AddDefaulted_GetRef();
+	damageEvent0.m_attackerEntityId = attackerEntity0.GetId();
+	damageEvent0.m_victimEntityId = carrierEntity.GetId();
+	damageEvent0.m_damageAmount = damagePerAttacker;
+	CombatSystems::ProcessDamageEvents(damageEvents);
+
+#pragma region Test that a single non-lethal damage event is subtracted from the victim's health
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s subtracts %d from %s after one %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(CombatSystems::ProcessDamageEvents),
+			damagePerAttacker,
+			ARGUS_NAMEOF(m_currentHealth),
+			ARGUS_NAMEOF(DamageEvent)
+		),
+		carrierHealthComponent->m_currentHealth,
+		startingHealth - damagePerAttacker
+	);
+#pragma endregion
+
+	DamageEvent& damageEvent1 = damageEvents.AddDefaulted_GetRef();
+	damageEvent1.m_attackerEntityId = attackerEntity1.GetId();
+	damageEvent1.m_victimEntityId = carrierEntity.GetId();
+	damageEvent1.m_damageAmount = damagePerAttacker;
+	CombatSystems::ProcessDamageEvents(damageEvents);
+
+#pragma region Test that damage events from several attackers are summed into a lethal hit
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s sums two %s into a lethal hit and sets the victim's %s to %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(CombatSystems::ProcessDamageEvents),
+			ARGUS_NAMEOF(DamageEvent),
+			ARGUS_NAMEOF(m_baseState),
+			ARGUS_NAMEOF(EBaseState::Dead)
+		),
+		carrierTaskComponent->m_baseState,
+		EBaseState::Dead
+	);
+#pragma endregion
+
+#pragma region Test that killing a carrier cascades to its passengers
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that killing a %s via %s also sets its passenger's %s to %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(CarrierComponent),
+			ARGUS_NAMEOF(CombatSystems::ProcessDamageEvents),
+			ARGUS_NAMEOF(m_baseState),
+			ARGUS_NAMEOF(EBaseState::Dead)
+		),
+		passengerTaskComponent->m_baseState,
+		EBaseState::Dead
+	);
+#pragma endregion
+
+#pragma region Test that every attacker that contributed to a kill stops attacking
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that both attackers have their %s set to %s after landing a lethal hit."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(m_combatState),
+			ARGUS_NAMEOF(ECombatState::None)
+		),
+		attackerTaskComponent0->m_combatState == ECombatState::None && attackerTaskComponent1->m_combatState == ECombatState::None
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+#endif //WITH_AUTOMATION_TESTS
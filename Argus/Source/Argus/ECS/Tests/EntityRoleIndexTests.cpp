@@ -0,0 +1,180 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusEntity.h"
+#include "ArgusTesting.h"
+#include "ComponentDependencies/EntityRoleIndex.h"
+#include "Misc/AutomationTest.h"
+#include "Systems/ResourceSystems.h"
+
+#if WITH_AUTOMATION_TESTS
+
+static ArgusEntity CreateEntityRoleIndexTestEntity(ETeam team, EResourceComponentOwnerType ownerType, EResourceType resourceType, const FVector& location)
+{
+	ArgusEntity entity = ArgusEntity::CreateEntity();
+	IdentityComponent* identityComponent = entity.AddComponent<IdentityComponent>();
+	TransformComponent* transformComponent = entity.AddComponent<TransformComponent>();
+	ResourceComponent* resourceComponent = entity.AddComponent<ResourceComponent>();
+	entity.AddComponent<TaskComponent>();
+	if (!identityComponent || !transformComponent || !resourceComponent)
+	{
+		return ArgusEntity::k_emptyEntity;
+	}
+
+	identityComponent->m_team = team;
+	transformComponent->m_location = location;
+	resourceComponent->m_resourceComponentOwnerType = ownerType;
+	resourceComponent->m_currentResources.m_resourceQuantities[static_cast<uint8>(resourceType)] = 100;
+	return entity;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(EntityRoleIndexFindResourceSinkEntityIdClosestToLocationTest, "Argus.ECS.EntityRoleIndex.FindResourceSinkEntityIdClosestToLocation", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool EntityRoleIndexFindResourceSinkEntityIdClosestToLocationTest::RunTest(const FString& Parameters)
+{
+	ArgusTesting::StartArgusTest();
+
+	ArgusEntity carrierEntity = CreateEntityRoleIndexTestEntity(ETeam::TeamA, EResourceComponentOwnerType::Carrier, EResourceType::ResourceA, FVector::ZeroVector);
+	ArgusEntity enemySinkEntity = CreateEntityRoleIndexTestEntity(ETeam::TeamB, EResourceComponentOwnerType::Sink, EResourceType::ResourceA, FVector(100.0f, 0.0f, 0.0f));
+	ArgusEntity constructingSinkEntity = CreateEntityRoleIndexTestEntity(ETeam::TeamA, EResourceComponentOwnerType::Sink, EResourceType::ResourceA, FVector(200.0f, 0.0f, 0.0f));
+	ArgusEntity otherTypeSinkEntity = CreateEntityRoleIndexTestEntity(ETeam::TeamA, EResourceComponentOwnerType::Sink, EResourceType::ResourceB, FVector(300.0f, 0.0f, 0.0f));
+	ArgusEntity expectedSinkEntity = CreateEntityRoleIndexTestEntity(ETeam::TeamA, EResourceComponentOwnerType::Sink, EResourceType::ResourceA, FVector(400.0f, 0.0f, 0.0f));
+	ArgusEntity sourceEntity = CreateEntityRoleIndexTestEntity(ETeam::None, EResourceComponentOwnerType::Source, EResourceType::ResourceA, FVector(50.0f, 0.0f, 0.0f));
+	ArgusEntity depletedSourceEntity = CreateEntityRoleIndexTestEntity(ETeam::None, EResourceComponentOwnerType::Source, EResourceType::ResourceA, FVector(150.0f, 0.0f, 0.0f));
+	if (!carrierEntity || !enemySinkEntity || !constructingSinkEntity || !otherTypeSinkEntity || !expectedSinkEntity || !sourceEntity || !depletedSourceEntity)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	TaskComponent* constructingTaskComponent = constructingSinkEntity.GetComponent<TaskComponent>();
+	ResourceComponent* carrierResourceComponent = carrierEntity.GetComponent<ResourceComponent>();
+	ResourceComponent* depletedSourceResourceComponent = depletedSourceEntity.GetComponent<ResourceComponent>();
+	if (!constructingTaskComponent || !carrierResourceComponent || !depletedSourceResourceComponent)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+	constructingTaskComponent->m_constructionState = EConstructionState::BeingConstructed;
+	depletedSourceResourceComponent->m_currentResources.m_resourceQuantities[static_cast<uint8>(EResourceType::ResourceA)] = 0;
+
+	EntityRoleIndex entityRoleIndex;
+	entityRoleIndex.ProcessDeferredStateChanges();
+
+#pragma region Test that only same team sinks of the matching resource type are bucketed together
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s returns the %d %s entities of %s that hold %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(EntityRoleIndex::GetResourceSinkEntityIds),
+			2,
+			ARGUS_NAMEOF(EResourceComponentOwnerType::Sink),
+			ARGUS_NAMEOF(ETeam::TeamA),
+			ARGUS_NAMEOF(EResourceType::ResourceA)
+		),
+		entityRoleIndex.GetResourceSinkEntityIds(ETeam::TeamA, EResourceType::ResourceA).Num(),
+		2
+	);
+#pragma endregion
+
+#pragma region Test that resource sources and in progress constructions get their own buckets
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s contains the source entity and %s contains the entity being constructed."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(EntityRoleIndex::GetResourceSourceEntityIds),
+			ARGUS_NAMEOF(EntityRoleIndex::GetInProgressConstructionEntityIds)
+		),
+		entityRoleIndex.GetResourceSourceEntityIds(EResourceType::ResourceA).Contains(sourceEntity.GetId()) &&
+		entityRoleIndex.GetInProgressConstructionEntityIds(ETeam::TeamA).Contains(constructingSinkEntity.GetId())
+	);
+#pragma endregion
+
+#pragma region Test that depleted resource sources are only in the bucket of all sources
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that a depleted source is missing from %s but still returned by %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(EntityRoleIndex::GetResourceSourceEntityIds),
+			ARGUS_NAMEOF(EntityRoleIndex::GetAllResourceSourceEntityIds)
+		),
+		!entityRoleIndex.GetResourceSourceEntityIds(EResourceType::ResourceA).Contains(depletedSourceEntity.GetId()) &&
+		entityRoleIndex.GetAllResourceSourceEntityIds().Contains(depletedSourceEntity.GetId()) &&
+		entityRoleIndex.GetAllResourceSourceEntityIds().Contains(sourceEntity.GetId())
+	);
+#pragma endregion
+
+	TFunction<bool(ArgusEntity)> queryFilter = [carrierEntity](ArgusEntity otherEntity)
+	{
+		return ResourceSystems::CanEntityDepositResourcesToOtherEntity(carrierEntity, otherEntity);
+	};
+	const uint16 foundSinkEntityId = entityRoleIndex.FindResourceSinkEntityIdClosestToLocation(ETeam::TeamA, carrierResourceComponent->m_currentResources, FVector::ZeroVector, carrierEntity, queryFilter);
+
+#pragma region Test that the nearest query skips sinks that are on another team, of another type, or still being constructed
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s skips invalid sinks and returns the closest sink a carrier can deposit into."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(EntityRoleIndex::FindResourceSinkEntityIdClosestToLocation)
+		),
+		foundSinkEntityId,
+		expectedSinkEntity.GetId()
+	);
+#pragma endregion
+
+	IdentityComponent* expectedSinkIdentityComponent = expectedSinkEntity.GetComponent<IdentityComponent>();
+	if (!expectedSinkIdentityComponent)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+	expectedSinkIdentityComponent->m_team = ETeam::TeamB;
+	entityRoleIndex.RequestUpdateEntity(expectedSinkEntity);
+	entityRoleIndex.ProcessDeferredStateChanges();
+
+#pragma region Test that a requested update moves an entity between buckets without a rebuild
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that calling %s and then %s moves a sink that changed teams into the %s bucket."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(EntityRoleIndex::RequestUpdateEntity),
+			ARGUS_NAMEOF(EntityRoleIndex::ProcessDeferredStateChanges),
+			ARGUS_NAMEOF(ETeam::TeamB)
+		),
+		!entityRoleIndex.GetResourceSinkEntityIds(ETeam::TeamA, EResourceType::ResourceA).Contains(expectedSinkEntity.GetId()) &&
+		entityRoleIndex.GetResourceSinkEntityIds(ETeam::TeamB, EResourceType::ResourceA).Contains(expectedSinkEntity.GetId()) &&
+		entityRoleIndex.GetResourceSinkEntityIds(ETeam::TeamB, EResourceType::ResourceA).Num() == 2
+	);
+#pragma endregion
+
+	entityRoleIndex.Reset();
+
+#pragma region Test that resetting the index empties every bucket
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s returns %s after calling %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(EntityRoleIndex::FindResourceSinkEntityIdClosestToLocation),
+			ARGUS_NAMEOF(ArgusECSConstants::k_maxEntities),
+			ARGUS_NAMEOF(EntityRoleIndex::Reset)
+		),
+		entityRoleIndex.FindResourceSinkEntityIdClosestToLocation(ETeam::TeamA, carrierResourceComponent->m_currentResources, FVector::ZeroVector, carrierEntity),
+		ArgusECSConstants::k_maxEntities
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+#endif //WITH_AUTOMATION_TESTS
@@ -0,0 +1,248 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusTesting.h"
+#include "ComponentDependencies/InfluenceMap.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(InfluenceMapUpdateAndAccumulateLayersTest, "Argus.ECS.InfluenceMap.UpdateAndAccumulateLayers", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool InfluenceMapUpdateAndAccumulateLayersTest::RunTest(const FString& Parameters)
+{
+	const int32 areasPerDimension = 3;
+	const int32 stampedAreaIndex = 4;
+	const int32 revisitedAreaIndex = 8;
+	const float deltaTime = 2.0f;
+	const float enemyStrength = 3.0f;
+	const float resourceValue = 250.0f;
+
+	ArgusTesting::StartArgusTest();
+
+	InfluenceMap friendlyInfluenceMap;
+	InfluenceMap enemyInfluenceMap;
+	friendlyInfluenceMap.Initialize(areasPerDimension);
+	enemyInfluenceMap.Initialize(areasPerDimension);
+
+#pragma region Test that initializing sizes the map to the revealed area grid
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s with %d areas per dimension results in %d areas."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(InfluenceMap::Initialize),
+			areasPerDimension,
+			areasPerDimension * areasPerDimension
+		),
+		friendlyInfluenceMap.GetNumAreas(),
+		areasPerDimension * areasPerDimension
+	);
+#pragma endregion
+
+	friendlyInfluenceMap.AddInfluence(EInfluenceLayer::EnemyStrength, stampedAreaIndex, enemyStrength);
+	friendlyInfluenceMap.AddInfluence(EInfluenceLayer::ResourceValue, stampedAreaIndex, resourceValue);
+	friendlyInfluenceMap.BeginUpdate(deltaTime);
+	friendlyInfluenceMap.SetInfluence(EInfluenceLayer::ExplorationAge, revisitedAreaIndex, 0.0f);
+	friendlyInfluenceMap.AddPendingFriendlyStrength(stampedAreaIndex, 1.0f);
+
+#pragma region Test that beginning an update clears enemy strength so it can be accumulated again
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s clears %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(InfluenceMap::BeginUpdate),
+			ARGUS_NAMEOF(EInfluenceLayer::EnemyStrength)
+		),
+		friendlyInfluenceMap.GetInfluence(EInfluenceLayer::EnemyStrength, stampedAreaIndex),
+		0.0f
+	);
+#pragma endregion
+
+#pragma region Test that beginning an update clears resource value so it can be restamped
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s clears %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(InfluenceMap::BeginUpdate),
+			ARGUS_NAMEOF(EInfluenceLayer::ResourceValue)
+		),
+		friendlyInfluenceMap.GetInfluence(EInfluenceLayer::ResourceValue, stampedAreaIndex),
+		0.0f
+	);
+#pragma endregion
+
+#pragma region Test that exploration age counts up everywhere except where it was reset
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s adds %f to %s, and that an area set back to zero stays at zero."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(InfluenceMap::BeginUpdate),
+			deltaTime,
+			ARGUS_NAMEOF(EInfluenceLayer::ExplorationAge)
+		),
+		friendlyInfluenceMap.GetInfluence(EInfluenceLayer::ExplorationAge, stampedAreaIndex) == deltaTime &&
+		friendlyInfluenceMap.GetInfluence(EInfluenceLayer::ExplorationAge, revisitedAreaIndex) == 0.0f
+	);
+#pragma endregion
+
+#pragma region Test that pending friendly strength is not visible until the update ends
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s does not change %s before calling %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(InfluenceMap::AddPendingFriendlyStrength),
+			ARGUS_NAMEOF(EInfluenceLayer::FriendlyStrength),
+			ARGUS_NAMEOF(InfluenceMap::EndUpdate)
+		),
+		friendlyInfluenceMap.GetInfluence(EInfluenceLayer::FriendlyStrength, stampedAreaIndex),
+		0.0f
+	);
+#pragma endregion
+
+	friendlyInfluenceMap.EndUpdate();
+	friendlyInfluenceMap.EndUpdate();
+
+#pragma region Test that ending an update folds in pending strength and decays what was already there
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s weights pending strength by %f and then decays it by %f on the next call."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(InfluenceMap::EndUpdate),
+			InfluenceMap::k_strengthStampWeight,
+			InfluenceMap::k_strengthDecay
+		),
+		friendlyInfluenceMap.GetInfluence(EInfluenceLayer::FriendlyStrength, stampedAreaIndex),
+		InfluenceMap::k_strengthStampWeight * InfluenceMap::k_strengthDecay
+	);
+#pragma endregion
+
+	enemyInfluenceMap.AccumulateLayer(EInfluenceLayer::EnemyStrength, friendlyInfluenceMap, EInfluenceLayer::FriendlyStrength);
+
+#pragma region Test that accumulating another map's layer adds it area by area
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s copies %s from another map into %s only in the stamped area."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(InfluenceMap::AccumulateLayer),
+			ARGUS_NAMEOF(EInfluenceLayer::FriendlyStrength),
+			ARGUS_NAMEOF(EInfluenceLayer::EnemyStrength)
+		),
+		enemyInfluenceMap.GetInfluence(EInfluenceLayer::EnemyStrength, stampedAreaIndex) == InfluenceMap::k_strengthStampWeight * InfluenceMap::k_strengthDecay &&
+		enemyInfluenceMap.GetInfluence(EInfluenceLayer::EnemyStrength, revisitedAreaIndex) == 0.0f
+	);
+#pragma endregion
+
+#pragma region Test that querying outside of the grid returns zero
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s returns zero for an area index outside of the map."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(InfluenceMap::GetInfluence)
+		),
+		friendlyInfluenceMap.GetInfluence(EInfluenceLayer::ExplorationAge, areasPerDimension * areasPerDimension),
+		0.0f
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(InfluenceMapPopAreasThatTurnedStaleTest, "Argus.ECS.InfluenceMap.PopAreasThatTurnedStale", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool InfluenceMapPopAreasThatTurnedStaleTest::RunTest(const FString& Parameters)
+{
+	const int32 areasPerDimension = 3;
+	const int32 exploredAreaIndex = 2;
+	const float halfStaleAge = ArgusECSConstants::k_teamCommanderStaleAreaExplorationAge * 0.5f;
+
+	ArgusTesting::StartArgusTest();
+
+	InfluenceMap influenceMap;
+	influenceMap.Initialize(areasPerDimension);
+
+	TArray<int32> staleAreaIndices;
+	auto popStaleAreas = [&influenceMap, &staleAreaIndices]()
+	{
+		staleAreaIndices.Reset();
+		influenceMap.PopAreasThatTurnedStale([&staleAreaIndices](int32 areaIndex)
+		{
+			staleAreaIndices.Add(areaIndex);
+		});
+	};
+
+	influenceMap.ResetExplorationAge(exploredAreaIndex);
+	influenceMap.BeginUpdate(halfStaleAge);
+	influenceMap.ResetExplorationAge(exploredAreaIndex);
+	influenceMap.BeginUpdate(halfStaleAge);
+	popStaleAreas();
+
+#pragma region Test that an area explored again is not reported when its first expiry comes up
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s reports nothing for an area that %s was called on again before it turned stale."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(InfluenceMap::PopAreasThatTurnedStale),
+			ARGUS_NAMEOF(InfluenceMap::ResetExplorationAge)
+		),
+		staleAreaIndices.Num(),
+		0
+	);
+#pragma endregion
+
+	influenceMap.BeginUpdate(halfStaleAge);
+	popStaleAreas();
+
+#pragma region Test that the area is reported once it actually turned stale
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s reports area %d exactly once after %f seconds without being explored."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(InfluenceMap::PopAreasThatTurnedStale),
+			exploredAreaIndex,
+			ArgusECSConstants::k_teamCommanderStaleAreaExplorationAge
+		),
+		staleAreaIndices.Num() == 1 && staleAreaIndices[0] == exploredAreaIndex
+	);
+#pragma endregion
+
+	influenceMap.BeginUpdate(halfStaleAge);
+	popStaleAreas();
+
+#pragma region Test that a reported area is not reported again until it is explored again
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s does not report area %d a second time."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(InfluenceMap::PopAreasThatTurnedStale),
+			exploredAreaIndex
+		),
+		staleAreaIndices.Num(),
+		0
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+#endif //WITH_AUTOMATION_TESTS
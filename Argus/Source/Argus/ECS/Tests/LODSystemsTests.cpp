@@ -0,0 +1,171 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusEntity.h"
+#include "ArgusTesting.h"
+#include "Misc/AutomationTest.h"
+#include "Systems/LODSystems.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(LODSystemsReducedRateSimulationTest, "Argus.ECS.Systems.LODSystems.ReducedRateSimulation", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool LODSystemsReducedRateSimulationTest::RunTest(const FString& Parameters)
+{
+	const float deltaTime = 0.25f;
+	const int32 numFrames = 4;
+	const int32 expectedQuarterRateUpdates = 1;
+
+	ArgusTesting::StartArgusTest();
+	ArgusEntity singletonEntity = ArgusEntity::CreateEntity(ArgusECSConstants::k_singletonEntityId);
+	WorldReferenceComponent* worldReferenceComponent = singletonEntity.GetOrAddComponent<WorldReferenceComponent>();
+	ArgusEntity fullRateEntity = ArgusEntity::CreateEntity();
+	ArgusEntity quarterRateEntity = ArgusEntity::CreateEntity();
+	ArgusEntity entityWithoutLOD = ArgusEntity::CreateEntity();
+	LODComponent* fullRateLODComponent = fullRateEntity.AddComponent<LODComponent>();
+	LODComponent* quarterRateLODComponent = quarterRateEntity.AddComponent<LODComponent>();
+	if (!worldReferenceComponent || !fullRateLODComponent || !quarterRateLODComponent || !entityWithoutLOD)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	quarterRateLODComponent->m_simulationLOD = ESimulationLOD::QuarterRate;
+
+	// Line the staggered bucket up so that the quarter rate entity's update lands on the last frame.
+	worldReferenceComponent->m_simulationFrameIndex = (4u - (quarterRateEntity.GetId() % 4u)) % 4u;
+
+	int32 fullRateUpdates = 0;
+	int32 quarterRateUpdates = 0;
+	float quarterRateDeltaTime = 0.0f;
+	for (int32 i = 0; i < numFrames; ++i)
+	{
+		worldReferenceComponent->m_simulationFrameIndex++;
+		LODSystems::RunSystems(deltaTime);
+
+		if (LODSystems::ShouldUpdateSimulationThisFrame(fullRateEntity))
+		{
+			fullRateUpdates++;
+		}
+		if (LODSystems::ShouldUpdateSimulationThisFrame(quarterRateEntity))
+		{
+			quarterRateUpdates++;
+			quarterRateDeltaTime = LODSystems::GetSimulationDeltaTime(quarterRateEntity, deltaTime);
+		}
+	}
+
+#pragma region Test that a full rate entity updates every frame
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that an entity with %s %s updates on all %d frames."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(ESimulationLOD),
+			ARGUS_NAMEOF(ESimulationLOD::FullRate),
+			numFrames
+		),
+		fullRateUpdates,
+		numFrames
+	);
+#pragma endregion
+
+#pragma region Test that a quarter rate entity updates once every four frames
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that an entity with %s %s updates %d time over %d frames."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(ESimulationLOD),
+			ARGUS_NAMEOF(ESimulationLOD::QuarterRate),
+			expectedQuarterRateUpdates,
+			numFrames
+		),
+		quarterRateUpdates,
+		expectedQuarterRateUpdates
+	);
+#pragma endregion
+
+#pragma region Test that a quarter rate entity simulates with the deltaTime accumulated since its last update
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s returns the accumulated deltaTime of %f for an entity with %s %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(LODSystems::GetSimulationDeltaTime),
+			deltaTime * numFrames,
+			ARGUS_NAMEOF(ESimulationLOD),
+			ARGUS_NAMEOF(ESimulationLOD::QuarterRate)
+		),
+		quarterRateDeltaTime,
+		deltaTime * numFrames
+	);
+#pragma endregion
+
+#pragma region Test that an entity without an LODComponent always simulates at full rate
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that an entity without a %s always returns true from %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(LODComponent),
+			ARGUS_NAMEOF(LODSystems::ShouldUpdateSimulationThisFrame)
+		),
+		LODSystems::ShouldUpdateSimulationThisFrame(entityWithoutLOD)
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(LODSystemsCalculateSimulationLODTest, "Argus.ECS.Systems.LODSystems.CalculateSimulationLOD", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool LODSystemsCalculateSimulationLODTest::RunTest(const FString& Parameters)
+{
+	const float inViewNearDistanceSquared = FMath::Square(ArgusECSConstants::k_simulationLODInViewHalfRateDistance - 1.0f);
+	const float inViewFarDistanceSquared = FMath::Square(ArgusECSConstants::k_simulationLODInViewHalfRateDistance + 1.0f);
+	const float outOfViewNearDistanceSquared = FMath::Square(ArgusECSConstants::k_simulationLODOutOfViewQuarterRateDistance - 1.0f);
+	const float outOfViewFarDistanceSquared = FMath::Square(ArgusECSConstants::k_simulationLODOutOfViewQuarterRateDistance + 1.0f);
+
+	ArgusTesting::StartArgusTest();
+
+#pragma region Test that entities in view drop from full to half rate at the in view distance
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s switches from %s to %s at %f units for entities in view."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(LODSystems::CalculateSimulationLOD),
+			ARGUS_NAMEOF(ESimulationLOD::FullRate),
+			ARGUS_NAMEOF(ESimulationLOD::HalfRate),
+			ArgusECSConstants::k_simulationLODInViewHalfRateDistance
+		),
+		LODSystems::CalculateSimulationLOD(true, inViewNearDistanceSquared) == ESimulationLOD::FullRate &&
+		LODSystems::CalculateSimulationLOD(true, inViewFarDistanceSquared) == ESimulationLOD::HalfRate
+	);
+#pragma endregion
+
+#pragma region Test that entities out of view drop from half to quarter rate at the out of view distance
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s switches from %s to %s at %f units for entities out of view."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(LODSystems::CalculateSimulationLOD),
+			ARGUS_NAMEOF(ESimulationLOD::HalfRate),
+			ARGUS_NAMEOF(ESimulationLOD::QuarterRate),
+			ArgusECSConstants::k_simulationLODOutOfViewQuarterRateDistance
+		),
+		LODSystems::CalculateSimulationLOD(false, outOfViewNearDistanceSquared) == ESimulationLOD::HalfRate &&
+		LODSystems::CalculateSimulationLOD(false, outOfViewFarDistanceSquared) == ESimulationLOD::QuarterRate
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+#endif //WITH_AUTOMATION_TESTS
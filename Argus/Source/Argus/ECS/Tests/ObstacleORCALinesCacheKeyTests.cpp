@@ -0,0 +1,62 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusECSConstants.h"
+#include "ArgusTesting.h"
+#include "ComponentDependencies/ObstacleORCALinesCacheKey.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ObstacleORCALinesCacheKeyHitAndInvalidationTest, "Argus.ECS.ObstacleORCALinesCacheKey.HitAndInvalidation", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool ObstacleORCALinesCacheKeyHitAndInvalidationTest::RunTest(const FString& Parameters)
+{
+	const FVector location = FVector(100.25f, 200.25f, 0.0f);
+	const FVector2D velocity = FVector2D(50.25f, 0.0f);
+	const float radius = 45.0f;
+	const float inverseObstaclePredictionTime = 0.5f;
+	const float subQuantizationOffset = ArgusECSConstants::k_avoidanceObstacleCacheLocationQuantization * 0.5f;
+	const float quantizationOffset = ArgusECSConstants::k_avoidanceObstacleCacheLocationQuantization;
+
+	ArgusTesting::StartArgusTest();
+
+	TArray<ObstacleIndicies, ArgusContainerAllocator<20u> > obstacleIndicies;
+	obstacleIndicies.Add({ 0, 1 });
+	obstacleIndicies.Add({ 2, 3 });
+	TArray<ObstacleIndicies, ArgusContainerAllocator<20u> > otherObstacleIndicies;
+	otherObstacleIndicies.Add({ 0, 1 });
+	otherObstacleIndicies.Add({ 3, 2 });
+
+	ObstacleORCALinesCacheKey cachedKey;
+	cachedKey.Populate(location, velocity, radius, inverseObstaclePredictionTime, obstacleIndicies);
+
+	ObstacleORCALinesCacheKey nearbyKey;
+	nearbyKey.Populate(location + FVector(subQuantizationOffset, 0.0f, 0.0f), velocity, radius, inverseObstaclePredictionTime, obstacleIndicies);
+
+#pragma region Test that a key within the same quantization step hits the cache
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Moving less than one quantization step, then checking that the %s still matches."), ARGUS_FUNCNAME, ARGUS_NAMEOF(ObstacleORCALinesCacheKey)),
+		nearbyKey == cachedKey
+	);
+#pragma endregion
+
+	ObstacleORCALinesCacheKey movedKey;
+	movedKey.Populate(location + FVector(quantizationOffset, 0.0f, 0.0f), velocity, radius, inverseObstaclePredictionTime, obstacleIndicies);
+	ObstacleORCALinesCacheKey otherObstaclesKey;
+	otherObstaclesKey.Populate(location, velocity, radius, inverseObstaclePredictionTime, otherObstacleIndicies);
+	ObstacleORCALinesCacheKey otherRadiusKey;
+	otherRadiusKey.Populate(location, velocity, radius + 1.0f, inverseObstaclePredictionTime, obstacleIndicies);
+
+#pragma region Test that moving, a different obstacle set or a different radius invalidates the cache
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Changing the location, the nearby obstacle points or the radius, then checking that the %s no longer matches."), ARGUS_FUNCNAME, ARGUS_NAMEOF(ObstacleORCALinesCacheKey)),
+		movedKey != cachedKey && otherObstaclesKey != cachedKey && otherRadiusKey != cachedKey
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+#endif //WITH_AUTOMATION_TESTS
@@ -0,0 +1,117 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusMath.h"
+#include "ArgusTesting.h"
+#include "ComponentDependencies/PlacementOccupancyGrid.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(PlacementOccupancyGridStampAndSearchTest, "Argus.ECS.PlacementOccupancyGrid.StampAndSearch", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool PlacementOccupancyGridStampAndSearchTest::RunTest(const FString& Parameters)
+{
+	const float validSpaceExtent = 500.0f;
+	const uint16 staticEntityId = 10u;
+	const float staticEntityRadius = 50.0f;
+	const float footprintRadius = 20.0f;
+	const float maxSearchDistance = 300.0f;
+	const FVector staticEntityLocation = FVector::ZeroVector;
+	const FVector obstacleLocation = FVector(200.0f, 0.0f, 0.0f);
+	const float edgeFootprintRadius = 5.0f;
+	const FVector edgeFootprintLocation = FVector(37.5f, 37.5f, 0.0f);
+
+	ArgusTesting::StartArgusTest();
+
+	PlacementOccupancyGrid placementOccupancyGrid;
+	placementOccupancyGrid.Initialize(validSpaceExtent);
+	placementOccupancyGrid.UpdateStaticEntity(staticEntityId, true, staticEntityLocation, staticEntityRadius);
+
+#pragma region Test that a stamped static entity blocks its footprint
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s reports a blocked footprint on top of an entity stamped with %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(PlacementOccupancyGrid::IsCircleBlocked),
+			ARGUS_NAMEOF(PlacementOccupancyGrid::UpdateStaticEntity)
+		),
+		placementOccupancyGrid.IsCircleBlocked(staticEntityLocation, footprintRadius)
+	);
+#pragma endregion
+
+#pragma region Test that a footprint overlapping the edge of a stamped entity is blocked
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s reports a blocked footprint that only overlaps a cell whose center is outside an entity stamped with %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(PlacementOccupancyGrid::IsCircleBlocked),
+			ARGUS_NAMEOF(PlacementOccupancyGrid::UpdateStaticEntity)
+		),
+		placementOccupancyGrid.IsCircleBlocked(edgeFootprintLocation, edgeFootprintRadius)
+	);
+#pragma endregion
+
+	ObstaclePointArray obstacle;
+	ObstaclePoint& obstaclePoint = obstacle.Emplace_GetRef();
+	obstaclePoint.m_point = ArgusMath::ToCartesianVector2(FVector2D(obstacleLocation));
+	ObstaclesContainer obstacles;
+	obstacles.Add(obstacle);
+	placementOccupancyGrid.StampObstacles(obstacles);
+
+#pragma region Test that stamped obstacle points block their cell
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s reports a blocked footprint on top of an obstacle point stamped with %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(PlacementOccupancyGrid::IsCircleBlocked),
+			ARGUS_NAMEOF(PlacementOccupancyGrid::StampObstacles)
+		),
+		placementOccupancyGrid.IsCircleBlocked(obstacleLocation, footprintRadius)
+	);
+#pragma endregion
+
+	FVector nearestLocation = FVector::ZeroVector;
+	const bool foundNearestLocation = placementOccupancyGrid.FindNearestUnblockedLocation(staticEntityLocation, footprintRadius, maxSearchDistance, nearestLocation);
+
+#pragma region Test that the nearest unblocked location is clear and within the search distance
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s finds a clear footprint within %f units of a blocked one."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(PlacementOccupancyGrid::FindNearestUnblockedLocation),
+			maxSearchDistance
+		),
+		foundNearestLocation &&
+		!placementOccupancyGrid.IsCircleBlocked(nearestLocation, footprintRadius) &&
+		FVector::Dist2D(nearestLocation, staticEntityLocation) <= maxSearchDistance
+	);
+#pragma endregion
+
+	placementOccupancyGrid.UpdateStaticEntity(staticEntityId, false, staticEntityLocation, staticEntityRadius);
+
+#pragma region Test that unstamping a static entity clears its footprint
+	TestFalse
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s no longer reports a blocked footprint once the entity is removed with %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(PlacementOccupancyGrid::IsCircleBlocked),
+			ARGUS_NAMEOF(PlacementOccupancyGrid::UpdateStaticEntity)
+		),
+		placementOccupancyGrid.IsCircleBlocked(staticEntityLocation, footprintRadius)
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+#endif //WITH_AUTOMATION_TESTS
@@ -0,0 +1,171 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusTesting.h"
+#include "ComponentDependencies/ScoutingDistanceField.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ScoutingDistanceFieldUpdateIfDirtyTest, "Argus.ECS.ScoutingDistanceField.UpdateIfDirty", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool ScoutingDistanceFieldUpdateIfDirtyTest::RunTest(const FString& Parameters)
+{
+	const int32 areasPerDimension = 4;
+	const int32 queryAreaIndex = 0;
+	const int32 farCornerAreaIndex = 15;
+	const int32 adjacentAreaIndex = 1;
+
+	ArgusTesting::StartArgusTest();
+
+	ScoutingDistanceField scoutingDistanceField;
+	scoutingDistanceField.Initialize(areasPerDimension);
+	scoutingDistanceField.UpdateIfDirty();
+
+#pragma region Test that a field with no scoutable areas has no answer
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s returns %d when no area is scoutable."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(ScoutingDistanceField::GetNearestScoutableAreaIndex),
+			-1
+		),
+		scoutingDistanceField.GetNearestScoutableAreaIndex(queryAreaIndex),
+		-1
+	);
+#pragma endregion
+
+	scoutingDistanceField.SetScoutableArea(farCornerAreaIndex, true);
+	scoutingDistanceField.UpdateIfDirty();
+
+#pragma region Test that the distance matches the ring distance to the only scoutable area
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that area %d points at area %d, %d rings away, after calling %s."),
+			ARGUS_FUNCNAME,
+			queryAreaIndex,
+			farCornerAreaIndex,
+			areasPerDimension - 1,
+			ARGUS_NAMEOF(ScoutingDistanceField::UpdateIfDirty)
+		),
+		scoutingDistanceField.GetNearestScoutableAreaIndex(queryAreaIndex) == farCornerAreaIndex &&
+		scoutingDistanceField.GetDistanceToNearestScoutableArea(queryAreaIndex) == (areasPerDimension - 1)
+	);
+#pragma endregion
+
+	scoutingDistanceField.SetScoutableArea(adjacentAreaIndex, true);
+	scoutingDistanceField.SetScoutableArea(farCornerAreaIndex, false);
+	scoutingDistanceField.UpdateIfDirty();
+
+#pragma region Test that flipping scoutable areas moves the nearest area
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that area %d points at adjacent area %d after calling %s again."),
+			ARGUS_FUNCNAME,
+			queryAreaIndex,
+			adjacentAreaIndex,
+			ARGUS_NAMEOF(ScoutingDistanceField::UpdateIfDirty)
+		),
+		scoutingDistanceField.GetNearestScoutableAreaIndex(queryAreaIndex) == adjacentAreaIndex &&
+		scoutingDistanceField.GetDistanceToNearestScoutableArea(queryAreaIndex) == 1 &&
+		scoutingDistanceField.GetNearestScoutableAreaIndex(farCornerAreaIndex) == adjacentAreaIndex
+	);
+#pragma endregion
+
+	scoutingDistanceField.SetScoutableArea(adjacentAreaIndex, true);
+
+#pragma region Test that setting an area to the value it already has does not trigger a rebuild
+	TestFalse
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s does nothing when no scoutable area changed."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(ScoutingDistanceField::UpdateIfDirty)
+		),
+		scoutingDistanceField.UpdateIfDirty()
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ScoutingDistanceFieldClaimedAreasTest, "Argus.ECS.ScoutingDistanceField.ClaimedAreas", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool ScoutingDistanceFieldClaimedAreasTest::RunTest(const FString& Parameters)
+{
+	const int32 areasPerDimension = 8;
+	const int32 numAreas = areasPerDimension * areasPerDimension;
+	const int32 queryAreaIndex = 9;
+	const int32 nearAreaIndex = 0;
+	const int32 middleAreaIndex = 27;
+	const int32 farCornerAreaIndex = numAreas - 1;
+
+	ArgusTesting::StartArgusTest();
+
+	ScoutingDistanceField scoutingDistanceField;
+	scoutingDistanceField.Initialize(areasPerDimension);
+	scoutingDistanceField.SetScoutableArea(nearAreaIndex, true);
+	scoutingDistanceField.SetScoutableArea(farCornerAreaIndex, true);
+	scoutingDistanceField.UpdateIfDirty();
+	scoutingDistanceField.SetClaimedArea(nearAreaIndex, true);
+	scoutingDistanceField.UpdateIfDirty();
+
+#pragma region Test that a claimed area is skipped by the next lookup
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that area %d points at area %d once area %d is claimed with %s."),
+			ARGUS_FUNCNAME,
+			queryAreaIndex,
+			farCornerAreaIndex,
+			nearAreaIndex,
+			ARGUS_NAMEOF(ScoutingDistanceField::SetClaimedArea)
+		),
+		scoutingDistanceField.GetNearestScoutableAreaIndex(queryAreaIndex),
+		farCornerAreaIndex
+	);
+#pragma endregion
+
+	scoutingDistanceField.SetScoutableArea(middleAreaIndex, true);
+	scoutingDistanceField.UpdateIfDirty();
+	scoutingDistanceField.SetScoutableArea(farCornerAreaIndex, false);
+	scoutingDistanceField.UpdateIfDirty();
+	scoutingDistanceField.ClearClaimedAreas();
+	scoutingDistanceField.UpdateIfDirty();
+
+	ScoutingDistanceField rebuiltScoutingDistanceField;
+	rebuiltScoutingDistanceField.Initialize(areasPerDimension);
+	rebuiltScoutingDistanceField.SetScoutableArea(nearAreaIndex, true);
+	rebuiltScoutingDistanceField.SetScoutableArea(middleAreaIndex, true);
+	rebuiltScoutingDistanceField.UpdateIfDirty();
+
+	bool doDistancesMatch = true;
+	for (int32 i = 0; i < numAreas; ++i)
+	{
+		doDistancesMatch &= scoutingDistanceField.GetDistanceToNearestScoutableArea(i) == rebuiltScoutingDistanceField.GetDistanceToNearestScoutableArea(i);
+	}
+
+#pragma region Test that partial updates end up with the same distances as a fresh field
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that adding, removing and unclaiming single areas with %s gives the same distances as a freshly built field."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(ScoutingDistanceField::UpdateIfDirty)
+		),
+		doDistancesMatch && scoutingDistanceField.GetNearestScoutableAreaIndex(queryAreaIndex) == nearAreaIndex
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+#endif //WITH_AUTOMATION_TESTS
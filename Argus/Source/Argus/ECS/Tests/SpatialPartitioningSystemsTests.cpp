@@ -0,0 +1,440 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusEntity.h"
+#include "ArgusTesting.h"
+#include "Misc/AutomationTest.h"
+#include "Systems/AvoidanceSystems.h"
+#include "Systems/CombatSystems.h"
+#include "Systems/SpatialPartitioningSystems.h"
+
+#if WITH_AUTOMATION_TESTS
+
+namespace SpatialPartitioningSystemsTests
+{
+	static constexpr float k_desiredSpeed = 1000.0f;
+	static const FVector k_targetLocation = FVector(0.0f, 100000.0f, 0.0f);
+
+	static ArgusEntity CreateGroupableEntity(const FVector& location, float sightRange)
+	{
+		ArgusEntity entity = ArgusEntity::CreateEntity();
+		entity.AddComponent<TaskComponent>();
+		entity.AddComponent<NavigationComponent>();
+		entity.AddComponent<NearbyEntitiesComponent>();
+		entity.AddComponent<AvoidanceGroupingComponent>();
+		TransformComponent* transformComponent = entity.AddComponent<TransformComponent>();
+		IdentityComponent* identityComponent = entity.AddComponent<IdentityComponent>();
+		TargetingComponent* targetingComponent = entity.AddComponent<TargetingComponent>();
+		VelocityComponent* velocityComponent = entity.AddComponent<VelocityComponent>();
+		if (!transformComponent || !identityComponent || !targetingComponent || !velocityComponent)
+		{
+			return ArgusEntity::k_emptyEntity;
+		}
+
+		transformComponent->m_location = location;
+		identityComponent->m_team = ETeam::TeamA;
+		targetingComponent->m_sightRange = sightRange;
+		targetingComponent->SetLocationTarget(k_targetLocation);
+		velocityComponent->m_desiredSpeedUnitsPerSecond = k_desiredSpeed;
+		return entity;
+	}
+
+	static bool CreateSingletonComponents()
+	{
+		ArgusEntity singletonEntity = ArgusEntity::CreateEntity(ArgusECSConstants::k_singletonEntityId);
+		return singletonEntity.GetOrAddComponent<GlobalSettingsComponent>() && singletonEntity.GetOrAddComponent<SpatialPartitioningComponent>();
+	}
+
+	static uint16 GetGroupId(ArgusEntity entity)
+	{
+		const AvoidanceGroupingComponent* avoidanceGroupingComponent = entity.GetComponent<AvoidanceGroupingComponent>();
+		return avoidanceGroupingComponent ? avoidanceGroupingComponent->m_groupId : ArgusECSConstants::k_maxEntities;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(SpatialPartitioningSystemsLargeAvoidanceGroupTest, "Argus.ECS.Systems.SpatialPartitioningSystems.LargeAvoidanceGroup", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool SpatialPartitioningSystemsLargeAvoidanceGroupTest::RunTest(const FString& Parameters)
+{
+	const int32 numEntities = 1000;
+
+	ArgusTesting::StartArgusTest();
+	if (!SpatialPartitioningSystemsTests::CreateSingletonComponents())
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	// Each entity is only within group enter range of the ones directly next to it, so the group can only be found by walking the whole chain.
+	TArray<ArgusEntity> entities;
+	entities.Reserve(numEntities);
+	float spacing = 0.0f;
+	for (int32 i = 0; i < numEntities; ++i)
+	{
+		ArgusEntity entity = SpatialPartitioningSystemsTests::CreateGroupableEntity(FVector::ZeroVector, 0.0f);
+		if (!entity)
+		{
+			ArgusTesting::EndArgusTest();
+			return false;
+		}
+
+		if (spacing == 0.0f)
+		{
+			spacing = AvoidanceSystems::GetAvoidanceRange(entity, AvoidanceRange::GroupEnter) + (2.0f * entity.GetComponent<TransformComponent>()->m_radius) - 1.0f;
+		}
+
+		// The lowest id is placed at the far end of the chain so that the leader can't come from iteration or spatial order.
+		entity.GetComponent<TransformComponent>()->m_location = FVector(spacing * static_cast<float>(numEntities - 1 - i), 0.0f, 0.0f);
+		entity.GetComponent<TargetingComponent>()->m_sightRange = spacing * 1.5f;
+		entities.Add(entity);
+	}
+
+	SpatialPartitioningSystems::RunSystems();
+
+	const uint16 lowestEntityId = entities[0].GetId();
+	const AvoidanceGroupingComponent* groupLeaderComponent = entities[0].GetComponent<AvoidanceGroupingComponent>();
+	bool areAllEntitiesInLowestIdGroup = true;
+	for (int32 i = 0; i < numEntities; ++i)
+	{
+		areAllEntitiesInLowestIdGroup &= SpatialPartitioningSystemsTests::GetGroupId(entities[i]) == lowestEntityId;
+	}
+
+#pragma region Test that a chain of entities each only linked to its neighbors forms a single group led by the lowest entity id
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s puts all %d chained entities in the group of entity %d."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(SpatialPartitioningSystems::RunSystems),
+			numEntities,
+			lowestEntityId
+		),
+		areAllEntitiesInLowestIdGroup && groupLeaderComponent->m_entityIdsInGroup.Num() == numEntities
+	);
+#pragma endregion
+
+	SpatialPartitioningSystems::RunSystems();
+
+	areAllEntitiesInLowestIdGroup = true;
+	for (int32 i = 0; i < numEntities; ++i)
+	{
+		areAllEntitiesInLowestIdGroup &= SpatialPartitioningSystemsTests::GetGroupId(entities[i]) == lowestEntityId;
+	}
+
+#pragma region Test that the group keeps the same leader on the next frame
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that calling %s again keeps entity %d as the leader of all %d entities."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(SpatialPartitioningSystems::RunSystems),
+			lowestEntityId,
+			numEntities
+		),
+		areAllEntitiesInLowestIdGroup && groupLeaderComponent->m_entityIdsInGroup.Num() == numEntities
+	);
+#pragma endregion
+
+	for (int32 i = 0; i < numEntities; ++i)
+	{
+		AvoidanceGroupingComponent* avoidanceGroupingComponent = entities[i].GetComponent<AvoidanceGroupingComponent>();
+		avoidanceGroupingComponent->m_groupId = ArgusECSConstants::k_maxEntities;
+		avoidanceGroupingComponent->m_entityIdsInGroup.Reset();
+	}
+	ArgusEntity middleEntity = entities[numEntities / 2];
+	SpatialPartitioningSystems::CalculateAdjacentEntityGroupsForEntity(middleEntity, false);
+
+	areAllEntitiesInLowestIdGroup = true;
+	for (int32 i = 0; i < numEntities; ++i)
+	{
+		areAllEntitiesInLowestIdGroup &= SpatialPartitioningSystemsTests::GetGroupId(entities[i]) == lowestEntityId;
+	}
+
+#pragma region Test that regrouping a single entity walks the whole chain and picks the same leader as the full pass
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s on entity %d puts all %d chained entities in the group of entity %d."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(SpatialPartitioningSystems::CalculateAdjacentEntityGroupsForEntity),
+			middleEntity.GetId(),
+			numEntities,
+			lowestEntityId
+		),
+		areAllEntitiesInLowestIdGroup && groupLeaderComponent->m_entityIdsInGroup.Num() == numEntities
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(SpatialPartitioningSystemsAvoidanceGroupHysteresisTest, "Argus.ECS.Systems.SpatialPartitioningSystems.AvoidanceGroupHysteresis", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool SpatialPartitioningSystemsAvoidanceGroupHysteresisTest::RunTest(const FString& Parameters)
+{
+	const float sightRange = 5000.0f;
+
+	ArgusTesting::StartArgusTest();
+	if (!SpatialPartitioningSystemsTests::CreateSingletonComponents())
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	ArgusEntity entity = SpatialPartitioningSystemsTests::CreateGroupableEntity(FVector::ZeroVector, sightRange);
+	ArgusEntity otherEntity = SpatialPartitioningSystemsTests::CreateGroupableEntity(FVector::ZeroVector, sightRange);
+	if (!entity || !otherEntity)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	TransformComponent* otherTransformComponent = otherEntity.GetComponent<TransformComponent>();
+	const float combinedRadius = entity.GetComponent<TransformComponent>()->m_radius + otherTransformComponent->m_radius;
+	const float enterDistance = AvoidanceSystems::GetAvoidanceRange(entity, AvoidanceRange::GroupEnter) + combinedRadius;
+	const float exitDistance = AvoidanceSystems::GetAvoidanceRange(entity, AvoidanceRange::GroupExit) + combinedRadius;
+	const float betweenDistance = (enterDistance + exitDistance) * 0.5f;
+
+	otherTransformComponent->m_location = FVector(betweenDistance, 0.0f, 0.0f);
+	SpatialPartitioningSystems::RunSystems();
+
+#pragma region Test that entities between group enter and group exit range do not start a group
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that two ungrouped entities %f apart stay in separate groups when %s is %f."),
+			ARGUS_FUNCNAME,
+			betweenDistance,
+			ARGUS_NAMEOF(AvoidanceRange::GroupEnter),
+			enterDistance
+		),
+		SpatialPartitioningSystemsTests::GetGroupId(entity) == entity.GetId() && SpatialPartitioningSystemsTests::GetGroupId(otherEntity) == otherEntity.GetId()
+	);
+#pragma endregion
+
+	otherTransformComponent->m_location = FVector(enterDistance - 1.0f, 0.0f, 0.0f);
+	SpatialPartitioningSystems::RunSystems();
+
+#pragma region Test that entities within group enter range form a group
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that two entities within %s of %f join the group of entity %d."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(AvoidanceRange::GroupEnter),
+			enterDistance,
+			entity.GetId()
+		),
+		SpatialPartitioningSystemsTests::GetGroupId(otherEntity),
+		entity.GetId()
+	);
+#pragma endregion
+
+	otherTransformComponent->m_location = FVector(betweenDistance, 0.0f, 0.0f);
+	SpatialPartitioningSystems::RunSystems();
+
+#pragma region Test that grouped entities stay grouped until they leave group exit range
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that two grouped entities %f apart stay grouped when %s is %f."),
+			ARGUS_FUNCNAME,
+			betweenDistance,
+			ARGUS_NAMEOF(AvoidanceRange::GroupExit),
+			exitDistance
+		),
+		SpatialPartitioningSystemsTests::GetGroupId(otherEntity),
+		entity.GetId()
+	);
+#pragma endregion
+
+	otherTransformComponent->m_location = FVector(exitDistance + 1.0f, 0.0f, 0.0f);
+	SpatialPartitioningSystems::RunSystems();
+
+#pragma region Test that grouped entities split once they leave group exit range
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that two grouped entities split once they are further apart than %s of %f."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(AvoidanceRange::GroupExit),
+			exitDistance
+		),
+		SpatialPartitioningSystemsTests::GetGroupId(otherEntity),
+		otherEntity.GetId()
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(SpatialPartitioningSystemsReduceAvoidanceGroupTest, "Argus.ECS.Systems.SpatialPartitioningSystems.ReduceAvoidanceGroup", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool SpatialPartitioningSystemsReduceAvoidanceGroupTest::RunTest(const FString& Parameters)
+{
+	const float sightRange = 5000.0f;
+	const FVector firstLocation = FVector(0.0f, 0.0f, 0.0f);
+	const FVector secondLocation = FVector(100.0f, 0.0f, 0.0f);
+	const FVector thirdLocation = FVector(100.0f, 200.0f, 30.0f);
+	const FVector expectedAverageLocation = (firstLocation + secondLocation + thirdLocation) / 3.0f;
+	const uint16 expectedNumberOfIdleEntities = 2u;
+
+	ArgusTesting::StartArgusTest();
+	if (!SpatialPartitioningSystemsTests::CreateSingletonComponents())
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	ArgusEntity firstEntity = SpatialPartitioningSystemsTests::CreateGroupableEntity(firstLocation, sightRange);
+	ArgusEntity secondEntity = SpatialPartitioningSystemsTests::CreateGroupableEntity(secondLocation, sightRange);
+	ArgusEntity thirdEntity = SpatialPartitioningSystemsTests::CreateGroupableEntity(thirdLocation, sightRange);
+	if (!firstEntity || !secondEntity || !thirdEntity)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	thirdEntity.GetComponent<TaskComponent>()->m_movementState = EMovementState::MoveToLocation;
+	SpatialPartitioningSystems::RunSystems();
+
+	const AvoidanceGroupingComponent* groupLeaderComponent = firstEntity.GetComponent<AvoidanceGroupingComponent>();
+
+#pragma region Test that the group leader holds the average location of its members
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s is (%f, %f, %f) for a group of three entities."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(AvoidanceGroupingComponent::m_groupAverageLocation),
+			expectedAverageLocation.X,
+			expectedAverageLocation.Y,
+			expectedAverageLocation.Z
+		),
+		SpatialPartitioningSystemsTests::GetGroupId(thirdEntity) == firstEntity.GetId() &&
+		groupLeaderComponent->m_groupAverageLocation.Equals(expectedAverageLocation, KINDA_SMALL_NUMBER)
+	);
+#pragma endregion
+
+#pragma region Test that the group leader counts only its idle members
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s is %d when one of three members is moving."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(AvoidanceGroupingComponent::m_numberOfIdleEntities),
+			expectedNumberOfIdleEntities
+		),
+		groupLeaderComponent->m_numberOfIdleEntities,
+		expectedNumberOfIdleEntities
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(SpatialPartitioningSystemsWakeSleepingAvoidanceGroupTest, "Argus.ECS.Systems.SpatialPartitioningSystems.WakeSleepingAvoidanceGroup", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool SpatialPartitioningSystemsWakeSleepingAvoidanceGroupTest::RunTest(const FString& Parameters)
+{
+	const float sightRange = 5000.0f;
+	const uint32 startingHealth = 100u;
+	const uint32 damageAmount = 10u;
+
+	ArgusTesting::StartArgusTest();
+	if (!SpatialPartitioningSystemsTests::CreateSingletonComponents())
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	ArgusEntity leaderEntity = SpatialPartitioningSystemsTests::CreateGroupableEntity(FVector::ZeroVector, sightRange);
+	ArgusEntity memberEntity = SpatialPartitioningSystemsTests::CreateGroupableEntity(FVector(100.0f, 0.0f, 0.0f), sightRange);
+	HealthComponent* memberHealthComponent = memberEntity ? memberEntity.AddComponent<HealthComponent>() : nullptr;
+	if (!leaderEntity || !memberHealthComponent)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	memberHealthComponent->m_currentHealth = startingHealth;
+
+	auto runUntilSettled = []()
+	{
+		for (uint16 i = 0u; i < ArgusECSConstants::k_avoidanceGroupSleepSettledFrames; ++i)
+		{
+			SpatialPartitioningSystems::RunSystems();
+		}
+	};
+
+	runUntilSettled();
+
+#pragma region Test that a group of idle entities falls asleep once every member has settled
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s is true after %d settled frames."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(AvoidanceSystems::IsInSleepingAvoidanceGroup),
+			ArgusECSConstants::k_avoidanceGroupSleepSettledFrames
+		),
+		AvoidanceSystems::IsInSleepingAvoidanceGroup(memberEntity)
+	);
+#pragma endregion
+
+	TArray<DamageEvent> damageEvents;
+	DamageEvent& damageEvent = damageEvents.AddDefaulted_GetRef();
+	damageEvent.m_victimEntityId = memberEntity.GetId();
+	damageEvent.m_damageAmount = damageAmount;
+	CombatSystems::ProcessDamageEvents(damageEvents);
+	const bool isSleepingAfterDamage = AvoidanceSystems::IsInSleepingAvoidanceGroup(memberEntity);
+	SpatialPartitioningSystems::RunSystems();
+
+#pragma region Test that damaging a member wakes its group and keeps it awake on the next frame
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s is false right after %s damages a member, and stays false after the next %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(AvoidanceSystems::IsInSleepingAvoidanceGroup),
+			ARGUS_NAMEOF(CombatSystems::ProcessDamageEvents),
+			ARGUS_NAMEOF(SpatialPartitioningSystems::RunSystems)
+		),
+		!isSleepingAfterDamage && !AvoidanceSystems::IsInSleepingAvoidanceGroup(memberEntity) && !AvoidanceSystems::IsInSleepingAvoidanceGroup(leaderEntity)
+	);
+#pragma endregion
+
+	runUntilSettled();
+	AvoidanceSystems::WakeAvoidanceGroup(leaderEntity);
+	const bool isSleepingAfterWake = AvoidanceSystems::IsInSleepingAvoidanceGroup(memberEntity);
+	SpatialPartitioningSystems::RunSystems();
+
+#pragma region Test that waking a group keeps it awake on the next frame
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s is false right after %s, and stays false after the next %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(AvoidanceSystems::IsInSleepingAvoidanceGroup),
+			ARGUS_NAMEOF(AvoidanceSystems::WakeAvoidanceGroup),
+			ARGUS_NAMEOF(SpatialPartitioningSystems::RunSystems)
+		),
+		!isSleepingAfterWake && !AvoidanceSystems::IsInSleepingAvoidanceGroup(memberEntity) && !AvoidanceSystems::IsInSleepingAvoidanceGroup(leaderEntity)
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+#endif //WITH_AUTOMATION_TESTS
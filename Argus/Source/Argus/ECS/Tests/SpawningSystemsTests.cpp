@@ -201,4 +201,99 @@ bool SpawningSystemsSpawnEntityTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(SpawningSystemsSpawnEntitiesTest, "Argus.ECS.Systems.SpawningSystems.SpawnEntities", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool SpawningSystemsSpawnEntitiesTest::RunTest(const FString& Parameters)
+{
+	const uint32			dummyRecordID = 1234u;
+	const UEntityPriority	dummyEntityPriority = UEntityPriority::HighPriority;
+	const ETeam				dummyTeam = ETeam::TeamB;
+	const TArray<FVector>	spawnLocations = { FVector(100.0f, 0.0f, 0.0f), FVector(200.0f, 0.0f, 0.0f), FVector(300.0f, 0.0f, 0.0f) };
+
+	ArgusTesting::StartArgusTest();
+	ArgusEntity singletonEntity = ArgusEntity::CreateEntity(ArgusECSConstants::k_singletonEntityId);
+	UTransformComponentData* transformComponentData = NewObject<UTransformComponentData>();
+	UArgusEntityTemplate* entityTemplate = NewObject<UArgusEntityTemplate>();
+	UArgusActorRecord* argusActorRecord = NewObject<UArgusActorRecord>();
+	if (!transformComponentData || !entityTemplate || !argusActorRecord)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	entityTemplate->m_entityPriority = dummyEntityPriority;
+	entityTemplate->m_componentData.Add(transformComponentData);
+
+	argusActorRecord->m_id = dummyRecordID;
+	argusActorRecord->m_entityTemplate.SetHardPtr(entityTemplate);
+
+	TArray<ArgusEntity> spawnedEntities;
+	SpawningSystems::SpawnEntities(argusActorRecord, dummyTeam, spawnLocations, spawnedEntities);
+
+#pragma region Test that one entity was spawned per spawn location.
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s spawns one %s per spawn location."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(SpawningSystems::SpawnEntities),
+			ARGUS_NAMEOF(ArgusEntity)
+		),
+		spawnedEntities.Num(),
+		spawnLocations.Num()
+	);
+#pragma endregion
+
+	int32 numEntitiesAtTheirSpawnLocation = 0;
+	int32 numEntitiesWaitingForActors = 0;
+	for (int32 i = 0; i < spawnedEntities.Num(); ++i)
+	{
+		const TransformComponent* transformComponent = spawnedEntities[i].GetComponent<TransformComponent>();
+		const TaskComponent* taskComponent = spawnedEntities[i].GetComponent<TaskComponent>();
+		if (transformComponent && transformComponent->m_location.Equals(spawnLocations[i]))
+		{
+			numEntitiesAtTheirSpawnLocation++;
+		}
+		if (taskComponent && taskComponent->m_baseState == EBaseState::SpawnedWaitingForActorTake && taskComponent->m_spawnedFromArgusActorRecordId == dummyRecordID)
+		{
+			numEntitiesWaitingForActors++;
+		}
+	}
+
+#pragma region Test that every spawned entity was placed at its spawn location.
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that every %s spawned by %s has the %s of its spawn location."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(ArgusEntity),
+			ARGUS_NAMEOF(SpawningSystems::SpawnEntities),
+			ARGUS_NAMEOF(m_location)
+		),
+		numEntitiesAtTheirSpawnLocation,
+		spawnLocations.Num()
+	);
+#pragma endregion
+
+#pragma region Test that every spawned entity is waiting for an actor from the spawning record.
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that every %s spawned by %s is in %s with the spawning record's ID."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(ArgusEntity),
+			ARGUS_NAMEOF(SpawningSystems::SpawnEntities),
+			ARGUS_NAMEOF(EBaseState::SpawnedWaitingForActorTake)
+		),
+		numEntitiesWaitingForActors,
+		spawnLocations.Num()
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
 #endif //WITH_AUTOMATION_TESTS
\ No newline at end of file
@@ -0,0 +1,96 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusEntity.h"
+#include "ArgusTesting.h"
+#include "Misc/AutomationTest.h"
+#include "Systems/TaskSystems.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(TaskSystemsQueueIdleEntityIfNeededTest, "Argus.ECS.Systems.TaskSystems.QueueIdleEntityIfNeeded", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool TaskSystemsQueueIdleEntityIfNeededTest::RunTest(const FString& Parameters)
+{
+	ArgusTesting::StartArgusTest();
+	ArgusEntity entity = ArgusEntity::CreateEntity();
+	TaskComponent* taskComponent = entity.AddComponent<TaskComponent>();
+	entity.AddComponent<TargetingComponent>();
+	entity.AddComponent<NearbyEntitiesComponent>();
+
+	TaskSystemsArgs components;
+	if (!taskComponent || !components.PopulateArguments(entity))
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	TArray<uint16> idleEntityIdsToDispatch;
+	TaskSystems::QueueIdleEntityIfNeeded(components, idleEntityIdsToDispatch);
+
+#pragma region Test that an entity is queued when it becomes idle
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Calling %s on an %s that just became idle, then checking that it was queued."), ARGUS_FUNCNAME, ARGUS_NAMEOF(TaskSystems::QueueIdleEntityIfNeeded), ARGUS_NAMEOF(ArgusEntity)),
+		idleEntityIdsToDispatch.Num() == 1 && idleEntityIdsToDispatch[0] == entity.GetId()
+	);
+#pragma endregion
+
+	idleEntityIdsToDispatch.Reset();
+	TaskSystems::QueueIdleEntityIfNeeded(components, idleEntityIdsToDispatch);
+
+#pragma region Test that an entity that stays idle is not queued again
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Calling %s twice on an idle %s, then checking that the second call did not queue it."), ARGUS_FUNCNAME, ARGUS_NAMEOF(TaskSystems::QueueIdleEntityIfNeeded), ARGUS_NAMEOF(ArgusEntity)),
+		idleEntityIdsToDispatch.IsEmpty()
+	);
+#pragma endregion
+
+	taskComponent->Set_m_flightState(EFlightState::Flying);
+	TaskSystems::QueueIdleEntityIfNeeded(components, idleEntityIdsToDispatch);
+
+#pragma region Test that an idle entity is queued when its flight state changes
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Changing the %s of an idle %s, then checking that %s queued it."), ARGUS_FUNCNAME, ARGUS_NAMEOF(EFlightState), ARGUS_NAMEOF(ArgusEntity), ARGUS_NAMEOF(TaskSystems::QueueIdleEntityIfNeeded)),
+		idleEntityIdsToDispatch.Num() == 1
+	);
+#pragma endregion
+
+	idleEntityIdsToDispatch.Reset();
+	int32 numUpdatesUntilQueued = 0;
+	for (int32 i = 1; i <= TaskSystems::k_updatesPerIdleRescan * 2; ++i)
+	{
+		TaskSystems::QueueIdleEntityIfNeeded(components, idleEntityIdsToDispatch);
+		if (!idleEntityIdsToDispatch.IsEmpty())
+		{
+			numUpdatesUntilQueued = i;
+			break;
+		}
+	}
+
+#pragma region Test that an idle entity is eventually rescanned without any event
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Calling %s on an idle %s without any events, then checking that it is queued within %d updates."), ARGUS_FUNCNAME, ARGUS_NAMEOF(TaskSystems::QueueIdleEntityIfNeeded), ARGUS_NAMEOF(ArgusEntity), TaskSystems::k_updatesPerIdleRescan * 2),
+		numUpdatesUntilQueued > 0
+	);
+#pragma endregion
+
+	idleEntityIdsToDispatch.Reset();
+	taskComponent->m_movementState = EMovementState::MoveToLocation;
+	taskComponent->Set_m_flightState(EFlightState::Landing);
+	TaskSystems::QueueIdleEntityIfNeeded(components, idleEntityIdsToDispatch);
+
+#pragma region Test that a busy entity is never queued
+	TestTrue
+	(
+		FString::Printf(TEXT("[%s] Changing the %s of an %s that is moving, then checking that %s did not queue it."), ARGUS_FUNCNAME, ARGUS_NAMEOF(EFlightState), ARGUS_NAMEOF(ArgusEntity), ARGUS_NAMEOF(TaskSystems::QueueIdleEntityIfNeeded)),
+		idleEntityIdsToDispatch.IsEmpty()
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+#endif //WITH_AUTOMATION_TESTS
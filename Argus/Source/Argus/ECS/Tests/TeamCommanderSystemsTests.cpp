@@ -0,0 +1,93 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusEntity.h"
+#include "ArgusTesting.h"
+#include "Misc/AutomationTest.h"
+#include "Systems/TeamCommanderSystems.h"
+
+#if WITH_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(TeamCommanderSystemsObservedAndContestedAreasTest, "Argus.ECS.Systems.TeamCommanderSystems.ObservedAndContestedAreas", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool TeamCommanderSystemsObservedAndContestedAreasTest::RunTest(const FString& Parameters)
+{
+	const int32 areasPerDimension = 3;
+	const int32 observedAreaIndex = 4;
+	const int32 previouslyRevealedAreaIndex = 5;
+	const float deltaTime = 2.0f;
+
+	ArgusTesting::StartArgusTest();
+
+	ArgusEntity teamCommanderEntity = ArgusEntity::CreateEntity();
+	TeamCommanderComponent* teamCommanderComponent = teamCommanderEntity.AddComponent<TeamCommanderComponent>();
+	if (!teamCommanderComponent)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	teamCommanderComponent->m_revealedAreas.SetNum(areasPerDimension * areasPerDimension, false);
+	teamCommanderComponent->m_influenceMap.Initialize(areasPerDimension);
+
+	teamCommanderComponent->m_revealedAreas[previouslyRevealedAreaIndex] = true;
+	teamCommanderComponent->m_influenceMap.BeginUpdate(deltaTime);
+	teamCommanderComponent->m_revealedAreas[observedAreaIndex] = true;
+	teamCommanderComponent->m_influenceMap.SetInfluence(EInfluenceLayer::ExplorationAge, observedAreaIndex, 0.0f);
+
+#pragma region Test that only areas an entity stood in during the last update count as observed
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s is true for area %d, and false for area %d which was only revealed before the last %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(TeamCommanderSystems::IsAreaObserved),
+			observedAreaIndex,
+			previouslyRevealedAreaIndex,
+			ARGUS_NAMEOF(InfluenceMap::BeginUpdate)
+		),
+		TeamCommanderSystems::IsAreaObserved(observedAreaIndex, teamCommanderComponent) &&
+		!TeamCommanderSystems::IsAreaObserved(previouslyRevealedAreaIndex, teamCommanderComponent)
+	);
+#pragma endregion
+
+	teamCommanderComponent->m_influenceMap.AddPendingFriendlyStrength(observedAreaIndex, 1.0f);
+	teamCommanderComponent->m_influenceMap.EndUpdate();
+	teamCommanderComponent->m_influenceMap.AddInfluence(EInfluenceLayer::EnemyStrength, observedAreaIndex, InfluenceMap::k_strengthStampWeight);
+
+#pragma region Test that an area is not contested while friendly strength matches enemy strength
+	TestFalse
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s is false when %s matches %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(TeamCommanderSystems::IsAreaContested),
+			ARGUS_NAMEOF(EInfluenceLayer::EnemyStrength),
+			ARGUS_NAMEOF(EInfluenceLayer::FriendlyStrength)
+		),
+		TeamCommanderSystems::IsAreaContested(observedAreaIndex, teamCommanderComponent)
+	);
+#pragma endregion
+
+	teamCommanderComponent->m_influenceMap.AddInfluence(EInfluenceLayer::EnemyStrength, observedAreaIndex, 1.0f);
+
+#pragma region Test that an area is contested once enemy strength exceeds friendly strength
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Test that %s is true when %s exceeds %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(TeamCommanderSystems::IsAreaContested),
+			ARGUS_NAMEOF(EInfluenceLayer::EnemyStrength),
+			ARGUS_NAMEOF(EInfluenceLayer::FriendlyStrength)
+		),
+		TeamCommanderSystems::IsAreaContested(observedAreaIndex, teamCommanderComponent)
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+#endif //WITH_AUTOMATION_TESTS
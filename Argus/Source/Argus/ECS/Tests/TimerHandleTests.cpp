@@ -79,7 +79,7 @@ bool TimerHandleStartTimerTest::RunTest(const FString& Parameters)
 			ARGUS_NAMEOF(TimerHandle),
 			ARGUS_NAMEOF(Timer)
 		),
-		(timerComponent->m_timers[0].m_timeRemainingSeconds == expectedTimerDurationSeconds) &&
+		(timerHandle.GetTimeRemaining(timerEntity) == expectedTimerDurationSeconds) &&
 		(timerComponent->m_timers[0].m_timerState == TimerState::Ticking)
 	);
 #pragma endregion
@@ -110,7 +110,7 @@ bool TimerHandleStartTimerTest::RunTest(const FString& Parameters)
 			ARGUS_NAMEOF(TimerHandle),
 			ARGUS_NAMEOF(Timer)
 		),
-		(timerComponent->m_timers[0].m_timeRemainingSeconds == expectedTimerDurationSeconds) &&
+		(timerHandle.GetTimeRemaining(timerEntity) == expectedTimerDurationSeconds) &&
 		(timerComponent->m_timers[0].m_timerState == TimerState::Ticking) &&
 		(timerComponent->m_timers.Num() == 1)
 	);
@@ -150,7 +150,7 @@ bool TimerHandleFinishTimerTest::RunTest(const FString& Parameters)
 			ARGUS_FUNCNAME,
 			ARGUS_NAMEOF(Timer)
 		),
-		(timerComponent->m_timers[0].m_timeRemainingSeconds == expectedTimerDurationSeconds) &&
+		(timerHandle.GetTimeRemaining(timerEntity) == expectedTimerDurationSeconds) &&
 		(timerComponent->m_timers[0].m_timerState == TimerState::Ticking)
 	);
 #pragma endregion
@@ -167,7 +167,7 @@ bool TimerHandleFinishTimerTest::RunTest(const FString& Parameters)
 			ARGUS_FUNCNAME,
 			ARGUS_NAMEOF(Timer)
 		),
-		(timerComponent->m_timers[0].m_timeRemainingSeconds == 0.0f) &&
+		(timerComponent->m_timers[0].m_expirationTick == 0u) &&
 		(timerComponent->m_timers[0].m_timerState == TimerState::NotSet)
 	);
 #pragma endregion
@@ -205,7 +205,7 @@ bool TimerHandleCancelTimerTest::RunTest(const FString& Parameters)
 			ARGUS_FUNCNAME,
 			ARGUS_NAMEOF(Timer)
 		),
-		(timerComponent->m_timers[0].m_timeRemainingSeconds == 0.0f) &&
+		(timerComponent->m_timers[0].m_expirationTick == 0u) &&
 		(timerComponent->m_timers[0].m_timerState == TimerState::NotSet)
 	);
 #pragma endregion
@@ -329,7 +329,6 @@ bool TimerHandleIsTimerCompleteTest::RunTest(const FString& Parameters)
 	);
 #pragma endregion
 
-	timerComponent->m_timers[0].m_timeRemainingSeconds = 0.0f;
 	timerComponent->m_timers[0].m_timerState = TimerState::Completed;
 
 #pragma region Test checking if an assigned timer handle is complete
@@ -1,6 +1,7 @@
 // Copyright Karazaa. This is a part of an RTS project called Argus.
 
 #include "ArgusEntity.h"
+#include "ArgusSaveGame.h"
 #include "ArgusTesting.h"
 #include "Misc/AutomationTest.h"
 #include "Systems/TimerSystems.h"
@@ -15,41 +16,39 @@ bool TimerSystemsAdvanceTimersTest::RunTest(const FString& Parameters)
 	const float timer1expectedDuration = 2.0f;
 	ArgusTesting::StartArgusTest();
 
-#pragma region Test that passing in an invalid TimerComponent errors
+#pragma region Test that passing in an invalid WorldReferenceComponent errors
 	AddExpectedErrorPlain
 	(
 		FString::Printf
 		(
 			TEXT("Passed in %s was null."),
-			ARGUS_NAMEOF(TimerComponent*)
+			ARGUS_NAMEOF(WorldReferenceComponent*)
 		)
 	);
 #pragma endregion
 
-	TimerSystems::AdvaceTimers(deltaTime, nullptr);
+	TimerSystems::AdvanceTimers(deltaTime, nullptr);
 
+	ArgusEntity singletonEntity = ArgusEntity::CreateEntity(ArgusECSConstants::k_singletonEntityId);
+	WorldReferenceComponent* worldReferenceComponent = singletonEntity.AddComponent<WorldReferenceComponent>();
 	ArgusEntity timerEntity = ArgusEntity::CreateEntity();
 	TimerComponent* timerComponent = timerEntity.AddComponent<TimerComponent>();
-	if (!timerComponent)
+	if (!worldReferenceComponent || !timerComponent)
 	{
 		ArgusTesting::EndArgusTest();
 		return false;
 	}
 
 	// Test that this doesn't cause an error when there are no timers.
-	TimerSystems::AdvaceTimers(deltaTime, timerComponent);
+	TimerSystems::AdvanceTimers(deltaTime, worldReferenceComponent);
 
-	Timer timer0, timer1, timer2;
-	timer0.m_timerState = TimerState::Ticking;
-	timer1.m_timerState = TimerState::Ticking;
-	timer2.m_timerState = TimerState::NotSet;
-	timer0.m_timeRemainingSeconds = timer0expectedDuration;
-	timer1.m_timeRemainingSeconds = timer1expectedDuration;
-	timerComponent->m_timers.Add(timer0);
-	timerComponent->m_timers.Add(timer1);
-	timerComponent->m_timers.Add(timer2);
+	TimerHandle timerHandle0, timerHandle1, timerHandle2;
+	timerHandle0.StartTimer(timerEntity, timer0expectedDuration);
+	timerHandle1.StartTimer(timerEntity, timer1expectedDuration);
+	timerHandle2.StartTimer(timerEntity, timer1expectedDuration);
+	timerHandle2.CancelTimer(timerEntity);
 
-	TimerSystems::AdvaceTimers(deltaTime, timerComponent);
+	TimerSystems::AdvanceTimers(deltaTime, worldReferenceComponent);
 
 #pragma region Test timer states after advancing 1 second
 	TestTrue
@@ -58,17 +57,17 @@ bool TimerSystemsAdvanceTimersTest::RunTest(const FString& Parameters)
 		(
 			TEXT("[%s] Checking state of timers after calling %s with a time step of %f seconds."),
 			ARGUS_FUNCNAME,
-			ARGUS_NAMEOF(TimerSystems::AdvaceTimers),
+			ARGUS_NAMEOF(TimerSystems::AdvanceTimers),
 			deltaTime
 		),
 		(timerComponent->m_timers[0].m_timerState == TimerState::Completed) &&
 		(timerComponent->m_timers[1].m_timerState == TimerState::Ticking) &&
 		(timerComponent->m_timers[2].m_timerState == TimerState::NotSet) && 
-		(timerComponent->m_timers[1].m_timeRemainingSeconds == (timer1expectedDuration - deltaTime))
+		(timerHandle1.GetTimeRemaining(timerEntity) == (timer1expectedDuration - deltaTime))
 	);
 #pragma endregion
 
-	TimerSystems::AdvaceTimers(deltaTime, timerComponent);
+	TimerSystems::AdvanceTimers(deltaTime, worldReferenceComponent);
 
 #pragma region Test timer states after advancing 2 second
 	TestTrue
@@ -77,7 +76,7 @@ bool TimerSystemsAdvanceTimersTest::RunTest(const FString& Parameters)
 		(
 			TEXT("[%s] Checking state of timers after calling %s with a time step of %f seconds."),
 			ARGUS_FUNCNAME,
-			ARGUS_NAMEOF(TimerSystems::AdvaceTimers),
+			ARGUS_NAMEOF(TimerSystems::AdvanceTimers),
 			(deltaTime * 2.0f)
 		),
 		(timerComponent->m_timers[0].m_timerState == TimerState::Completed) &&
@@ -86,8 +85,167 @@ bool TimerSystemsAdvanceTimersTest::RunTest(const FString& Parameters)
 	);
 #pragma endregion
 
+#pragma region Test that every expired or canceled timer has left the timing wheel
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Checking that the %s has no scheduled entries once every %s has expired or been canceled."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(TimingWheel),
+			ARGUS_NAMEOF(Timer)
+		),
+		worldReferenceComponent->m_timingWheel.GetNumScheduledEntries(),
+		0
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(TimerSystemsLongTimerTest, "Argus.ECS.Systems.TimerSystems.LongTimer", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool TimerSystemsLongTimerTest::RunTest(const FString& Parameters)
+{
+	const float deltaTime = 1.0f / 60.0f;
+	const float timerDuration = 90.0f;
+	const int32 numFramesBeforeExpiration = FMath::FloorToInt32(timerDuration / deltaTime) - 1;
+	ArgusTesting::StartArgusTest();
+
+	ArgusEntity singletonEntity = ArgusEntity::CreateEntity(ArgusECSConstants::k_singletonEntityId);
+	WorldReferenceComponent* worldReferenceComponent = singletonEntity.AddComponent<WorldReferenceComponent>();
+	ArgusEntity timerEntity = ArgusEntity::CreateEntity();
+	TimerComponent* timerComponent = timerEntity.AddComponent<TimerComponent>();
+	if (!worldReferenceComponent || !timerComponent)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	TimerHandle timerHandle;
+	timerHandle.StartTimer(timerEntity, timerDuration);
+	for (int32 i = 0; i < numFramesBeforeExpiration; ++i)
+	{
+		TimerSystems::AdvanceTimers(deltaTime, worldReferenceComponent);
+	}
+
+#pragma region Test that a timer spanning several wheel levels has not expired early
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Checking that a %f second %s is still ticking after %d frames."),
+			ARGUS_FUNCNAME,
+			timerDuration,
+			ARGUS_NAMEOF(Timer),
+			numFramesBeforeExpiration
+		),
+		timerHandle.IsTimerTicking(timerEntity)
+	);
+#pragma endregion
+
+	TimerSystems::AdvanceTimers(deltaTime * 4.0f, worldReferenceComponent);
+
+#pragma region Test that a timer spanning several wheel levels expires once its deadline passes
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Checking that a %f second %s has completed once its deadline has passed."),
+			ARGUS_FUNCNAME,
+			timerDuration,
+			ARGUS_NAMEOF(Timer)
+		),
+		timerHandle.IsTimerComplete(timerEntity)
+	);
+#pragma endregion
+
+	ArgusTesting::EndArgusTest();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(TimerSystemsSaveLoadTest, "Argus.ECS.Systems.TimerSystems.SaveLoad", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool TimerSystemsSaveLoadTest::RunTest(const FString& Parameters)
+{
+	const float deltaTime = 0.5f;
+	const float timerDuration = 2.0f;
+	ArgusTesting::StartArgusTest();
+
+	ArgusEntity singletonEntity = ArgusEntity::CreateEntity(ArgusECSConstants::k_singletonEntityId);
+	WorldReferenceComponent* worldReferenceComponent = singletonEntity.AddComponent<WorldReferenceComponent>();
+	ArgusEntity timerEntity = ArgusEntity::CreateEntity();
+	TimerComponent* timerComponent = timerEntity.AddComponent<TimerComponent>();
+	if (!worldReferenceComponent || !timerComponent)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+	TimerHandle timerHandle;
+	timerHandle.StartTimer(timerEntity, timerDuration);
+	TimerSystems::AdvanceTimers(deltaTime, worldReferenceComponent);
+
+	ArgusSaveSnapshot snapshot;
+	snapshot.Capture();
+	snapshot.SerializeComponentTypeCopies();
+	ArgusEntity::FlushAllEntities();
+	const bool didApply = snapshot.Apply();
+	TimerSystems::InitializeSystemsPostLoad();
+	worldReferenceComponent = singletonEntity.GetComponent<WorldReferenceComponent>();
+	if (!didApply || !worldReferenceComponent)
+	{
+		ArgusTesting::EndArgusTest();
+		return false;
+	}
+
+#pragma region Test that a loaded timer keeps its remaining time
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Checking that a %s started for %f seconds has %f seconds remaining after a save and load."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(Timer),
+			timerDuration,
+			timerDuration - deltaTime
+		),
+		timerHandle.GetTimeRemaining(timerEntity),
+		timerDuration - deltaTime
+	);
+#pragma endregion
+
+#pragma region Test that the timing wheel is rebuilt from loaded timers
+	TestEqual
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Checking that %s rescheduled the loaded %s."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(TimerSystems::InitializeSystemsPostLoad),
+			ARGUS_NAMEOF(Timer)
+		),
+		worldReferenceComponent->m_timingWheel.GetNumScheduledEntries(),
+		1
+	);
+#pragma endregion
+
+	TimerSystems::AdvanceTimers(timerDuration - deltaTime, worldReferenceComponent);
+
+#pragma region Test that a loaded timer expires at its original deadline
+	TestTrue
+	(
+		FString::Printf
+		(
+			TEXT("[%s] Checking that a loaded %s completes at its original deadline."),
+			ARGUS_FUNCNAME,
+			ARGUS_NAMEOF(Timer)
+		),
+		timerHandle.IsTimerComplete(timerEntity)
+	);
+#pragma endregion
+
 	ArgusTesting::EndArgusTest();
 	return true;
 }
 
-#endif //WITH_AUTOMATION_TESTS
\ No newline at end of file
+#endif //WITH_AUTOMATION_TESTS
@@ -0,0 +1,19 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusMetadataSaveGame.h"
+
+FSaveSlotMetadata& UArgusMetadataSaveGame::AddSaveSlot(const FString& slotName, const FString& keyframeSlotName)
+{
+	FSaveSlotMetadata& slotMetadata = m_saveSlotMetadata.Emplace_GetRef();
+	slotMetadata.m_slotName = slotName;
+	slotMetadata.m_keyframeSlotName = keyframeSlotName;
+	return slotMetadata;
+}
+
+bool UArgusMetadataSaveGame::HasDeltaSavesOfKeyframe(const FString& keyframeSlotName) const
+{
+	return m_saveSlotMetadata.ContainsByPredicate([&keyframeSlotName](const FSaveSlotMetadata& slotMetadata)
+	{
+		return slotMetadata.m_keyframeSlotName.Equals(keyframeSlotName);
+	});
+}
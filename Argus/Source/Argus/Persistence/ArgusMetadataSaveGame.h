@@ -19,6 +19,10 @@ struct FSaveSlotMetadata
 
 	UPROPERTY(SaveGame)
 	FDateTime m_saveTimestamp;
+
+	// Empty for keyframes. Deltas can only be loaded while the keyframe they were diffed against still exists.
+	UPROPERTY(SaveGame)
+	FString m_keyframeSlotName;
 };
 
 UCLASS()
@@ -26,6 +30,10 @@ class UArgusMetadataSaveGame : public USaveGame
 {
 	GENERATED_BODY()
 
+public:
+	FSaveSlotMetadata& AddSaveSlot(const FString& slotName, const FString& keyframeSlotName);
+	bool HasDeltaSavesOfKeyframe(const FString& keyframeSlotName) const;
+
 private:
 	UPROPERTY(SaveGame)
 	TArray<FSaveSlotMetadata> m_saveSlotMetadata;
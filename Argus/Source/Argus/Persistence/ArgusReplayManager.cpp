@@ -0,0 +1,374 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusReplayManager.h"
+#include "ArgusComponentRegistry.h"
+#include "ArgusEntity.h"
+#include "ArgusGameModeBase.h"
+#include "ArgusLogging.h"
+#include "ArgusSaveManager.h"
+#include "Async/ParallelFor.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryArchive.h"
+
+UArgusReplayManager* UArgusReplayManager::k_instance = nullptr;
+const FString UArgusReplayManager::k_replaySlotPrefix = TEXT("ArgusReplay");
+
+namespace
+{
+	// Goes through the same serialization path as ArgusSaveSnapshot::Capture, but folds bytes into a CRC instead of storing them.
+	class ArgusChecksumArchive : public FMemoryArchive
+	{
+	public:
+		ArgusChecksumArchive()
+		{
+			SetIsSaving(true);
+		}
+
+		virtual void Serialize(void* data, int64 num) override
+		{
+			m_checksum = FCrc::MemCrc32(data, static_cast<int32>(num), m_checksum);
+			Offset += num;
+		}
+
+		virtual FString GetArchiveName() const override { return TEXT("ArgusChecksumArchive"); }
+
+		uint32 m_checksum = 0u;
+	};
+}
+
+uint32 UArgusReplayManager::ComputeStateChecksum()
+{
+	ARGUS_TRACE(UArgusReplayManager::ComputeStateChecksum);
+
+	TArray<uint32, TInlineAllocator<ArgusComponentRegistry::k_numStaticComponentTypes + 1>> checksums;
+	checksums.SetNumZeroed(ArgusComponentRegistry::k_numStaticComponentTypes + 1);
+
+	ArgusChecksumArchive entityArchive;
+	ArgusEntity::SerializeEntityIds(entityArchive);
+	ArgusComponentRegistry::SerializeDynamicAllocComponents(entityArchive);
+	checksums[0] = entityArchive.m_checksum;
+
+	ParallelFor(ArgusComponentRegistry::k_numStaticComponentTypes, [&checksums](int32 componentTypeIndex)
+	{
+		ArgusChecksumArchive componentArchive;
+		ArgusComponentRegistry::SerializeComponentType(componentArchive, static_cast<uint32>(componentTypeIndex));
+		checksums[componentTypeIndex + 1] = componentArchive.m_checksum;
+	});
+
+	return FCrc::MemCrc32(checksums.GetData(), checksums.Num() * sizeof(uint32));
+}
+
+void UArgusReplayManager::BeginDestroy()
+{
+	k_instance = nullptr;
+	Super::BeginDestroy();
+}
+
+void UArgusReplayManager::Initialize(AArgusGameModeBase* gameMode)
+{
+	ARGUS_RETURN_ON_NULL(gameMode, ArgusPersistenceLog);
+	k_instance = this;
+	m_gameMode = gameMode;
+}
+
+void UArgusReplayManager::StartRecording()
+{
+	if (IsRecording() || IsReplaying() || HasReplayRequest())
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Warning, TEXT("[%s] Cannot start recording while another recording or replay is active."), ARGUS_FUNCNAME);
+		return;
+	}
+
+	m_hasRecordRequest = true;
+}
+
+void UArgusReplayManager::StopRecording(const TFunction<void(const FString&, bool)>& completedDelegate)
+{
+	UArgusSaveManager* saveManager = UArgusSaveManager::Get();
+	ARGUS_RETURN_ON_NULL(saveManager, ArgusPersistenceLog);
+	if (!IsRecording())
+	{
+		return;
+	}
+
+	const FString replaySlotName = FString::Printf(TEXT("%s_%s"), *k_replaySlotPrefix, *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+	ARGUS_LOG
+	(
+		ArgusPersistenceLog, Display, TEXT("[%s] Writing %d frames and %d commands to %s."),
+		ARGUS_FUNCNAME,
+		m_recording->GetNumFrames(),
+		m_recording->m_commands.Num(),
+		*replaySlotName
+	);
+
+	// SaveInternal serializes the recording before returning, so it can be released right away.
+	saveManager->SaveInternal(replaySlotName, m_recording, [replaySlotName, completedDelegate](bool didSucceed)
+	{
+		if (UArgusReplayManager* rawReplayManager = UArgusReplayManager::Get())
+		{
+			if (didSucceed)
+			{
+				rawReplayManager->m_mostRecentReplaySlotName = replaySlotName;
+			}
+		}
+
+		if (completedDelegate)
+		{
+			completedDelegate(replaySlotName, didSucceed);
+		}
+	});
+	m_recording = nullptr;
+}
+
+void UArgusReplayManager::StartReplay(const FString& replaySlotName)
+{
+	UArgusSaveManager* saveManager = UArgusSaveManager::Get();
+	ARGUS_RETURN_ON_NULL(saveManager, ArgusPersistenceLog);
+	if (IsRecording() || HasRecordRequest())
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Warning, TEXT("[%s] Cannot start a replay while recording."), ARGUS_FUNCNAME);
+		return;
+	}
+
+	if (replaySlotName.IsEmpty())
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Warning, TEXT("[%s] Could not replay because %s was empty."), ARGUS_FUNCNAME, ARGUS_NAMEOF(replaySlotName));
+		return;
+	}
+
+	saveManager->LoadInternal(replaySlotName, [replaySlotName](USaveGame* saveGame)
+	{
+		UArgusReplayManager* rawReplayManager = UArgusReplayManager::Get();
+		ARGUS_RETURN_ON_NULL(rawReplayManager, ArgusPersistenceLog);
+		rawReplayManager->OnReplayLoaded(replaySlotName, saveGame);
+	});
+}
+
+void UArgusReplayManager::StopReplay()
+{
+	m_replay = nullptr;
+	m_replayRequest = nullptr;
+}
+
+void UArgusReplayManager::RecordCommand(const ArgusReplayCommand& command)
+{
+	if (!IsRecording())
+	{
+		return;
+	}
+
+	ArgusReplayCommand& recordedCommand = m_recording->m_commands.Add_GetRef(command);
+	recordedCommand.m_frameIndex = static_cast<uint32>(m_frameIndex);
+}
+
+void UArgusReplayManager::RecordCameraTransform(const FVector& location, const FQuat& rotation)
+{
+	if (!IsRecording())
+	{
+		return;
+	}
+
+	// The camera only matters to the simulation through which entities are in view, so it is recorded only when it moves.
+	if (m_hasRecordedCameraTransform && location == m_lastRecordedCameraLocation && rotation == m_lastRecordedCameraRotation)
+	{
+		return;
+	}
+
+	ArgusReplayCommand command = ArgusReplayCommand(EArgusReplayCommandType::MoveCamera);
+	command.m_location = location;
+	command.m_rotation = rotation;
+	RecordCommand(command);
+
+	m_lastRecordedCameraLocation = location;
+	m_lastRecordedCameraRotation = rotation;
+	m_hasRecordedCameraTransform = true;
+}
+
+TConstArrayView<ArgusReplayCommand> UArgusReplayManager::GetReplayCommandsThisFrame() const
+{
+	if (!IsReplaying())
+	{
+		return TConstArrayView<ArgusReplayCommand>();
+	}
+
+	const TArray<ArgusReplayCommand>& commands = m_replay->m_commands;
+	int32 endIndex = m_nextReplayCommandIndex;
+	while (endIndex < commands.Num() && commands[endIndex].m_frameIndex == static_cast<uint32>(m_frameIndex))
+	{
+		endIndex++;
+	}
+
+	return TConstArrayView<ArgusReplayCommand>(commands.GetData() + m_nextReplayCommandIndex, endIndex - m_nextReplayCommandIndex);
+}
+
+void UArgusReplayManager::ExecuteRecordRequest()
+{
+	ARGUS_TRACE(UArgusReplayManager::ExecuteRecordRequest);
+
+	if (!HasRecordRequest())
+	{
+		return;
+	}
+	m_hasRecordRequest = false;
+
+	ArgusSaveSnapshot snapshot;
+	snapshot.Capture();
+	snapshot.SerializeComponentTypeCopies();
+
+	// The recording restores the snapshot it starts from, the same as a replay does. That way state rebuilt after a load is identical for both.
+	if (!RestoreSnapshot(snapshot) || !snapshot.Encode(nullptr))
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] Failed to capture the starting snapshot of a recording."), ARGUS_FUNCNAME);
+		return;
+	}
+
+	const WorldReferenceComponent* worldReferenceComponent = ArgusEntity::GetSingletonEntity().GetComponent<WorldReferenceComponent>();
+	ARGUS_RETURN_ON_NULL(worldReferenceComponent, ArgusPersistenceLog);
+
+	m_recording = NewObject<UArgusReplaySaveGame>(this);
+	ARGUS_RETURN_ON_NULL(m_recording, ArgusPersistenceLog);
+	m_recording->TakeEncodedSnapshot(snapshot, FString());
+	m_recording->m_randomSeed = worldReferenceComponent->m_randomStream.GetCurrentSeed();
+
+	m_frameIndex = 0;
+	m_hasRecordedCameraTransform = false;
+}
+
+void UArgusReplayManager::ExecuteReplayRequest()
+{
+	ARGUS_TRACE(UArgusReplayManager::ExecuteReplayRequest);
+
+	UArgusReplaySaveGame* replay = m_replayRequest;
+	m_replayRequest = nullptr;
+	ARGUS_RETURN_ON_NULL(replay, ArgusPersistenceLog);
+
+	ArgusSaveSnapshot snapshot;
+	if (!replay->DecodeSnapshot(nullptr, snapshot) || !RestoreSnapshot(snapshot))
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] Failed to restore the starting snapshot of a replay."), ARGUS_FUNCNAME);
+		return;
+	}
+
+	// The snapshot already carries the stream, but the seed in the header is what the recording actually drew from.
+	WorldReferenceComponent* worldReferenceComponent = ArgusEntity::GetSingletonEntity().GetComponent<WorldReferenceComponent>();
+	ARGUS_RETURN_ON_NULL(worldReferenceComponent, ArgusPersistenceLog);
+	if (worldReferenceComponent->m_randomStream.GetCurrentSeed() != replay->m_randomSeed)
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Warning, TEXT("[%s] The starting snapshot of the replay disagrees with its random seed. Using the seed."), ARGUS_FUNCNAME);
+		worldReferenceComponent->m_randomStream.Initialize(replay->m_randomSeed);
+	}
+
+	m_replay = replay;
+	m_frameIndex = 0;
+	m_nextReplayCommandIndex = 0;
+	m_divergedFrameIndex = INDEX_NONE;
+	ARGUS_LOG(ArgusPersistenceLog, Display, TEXT("[%s] Replaying %d frames and %d commands."), ARGUS_FUNCNAME, replay->GetNumFrames(), replay->m_commands.Num());
+}
+
+void UArgusReplayManager::OnReplayLoaded(const FString& replaySlotName, USaveGame* saveGame)
+{
+	UArgusReplaySaveGame* replay = Cast<UArgusReplaySaveGame>(saveGame);
+	if (!replay)
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] %s does not contain a %s."), ARGUS_FUNCNAME, *replaySlotName, ARGUS_NAMEOF(UArgusReplaySaveGame));
+		return;
+	}
+
+	if (IsRecording() || HasRecordRequest())
+	{
+		return;
+	}
+
+	m_replayRequest = replay;
+}
+
+bool UArgusReplayManager::RestoreSnapshot(const ArgusSaveSnapshot& snapshot) const
+{
+	AArgusGameModeBase* gameMode = m_gameMode.Get();
+	ARGUS_RETURN_ON_NULL_BOOL(gameMode, ArgusPersistenceLog);
+
+	gameMode->OnLoadStart();
+	ArgusEntity::FlushAllEntities();
+	if (!snapshot.Apply())
+	{
+		return false;
+	}
+
+	// Rewind snapshots were taken on a timeline the replay does not share.
+	if (UArgusSaveManager* saveManager = UArgusSaveManager::Get())
+	{
+		saveManager->ClearRewindBuffer();
+	}
+
+	gameMode->OnLoadComplete();
+	return true;
+}
+
+float UArgusReplayManager::GetFrameDeltaTime(float deltaTime) const
+{
+	if (IsReplaying() && m_replay->m_frameDeltaTimes.IsValidIndex(m_frameIndex))
+	{
+		return m_replay->m_frameDeltaTimes[m_frameIndex];
+	}
+
+	return deltaTime;
+}
+
+void UArgusReplayManager::EndFrame(float deltaTime)
+{
+	if (!IsRecording() && !IsReplaying())
+	{
+		return;
+	}
+
+	ARGUS_TRACE(UArgusReplayManager::EndFrame);
+
+	const uint32 checksum = ComputeStateChecksum();
+	if (IsRecording())
+	{
+		m_recording->m_frameDeltaTimes.Add(deltaTime);
+		m_recording->m_frameChecksums.Add(checksum);
+		m_frameIndex++;
+		return;
+	}
+
+	// Only the first divergence is reported. Every frame after it is expected to differ as well.
+	if (!HasReplayDiverged() && m_replay->m_frameChecksums.IsValidIndex(m_frameIndex) && m_replay->m_frameChecksums[m_frameIndex] != checksum)
+	{
+		m_divergedFrameIndex = m_frameIndex;
+		ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] Replay diverged from the recording on frame %d."), ARGUS_FUNCNAME, m_frameIndex);
+	}
+
+	const TArray<ArgusReplayCommand>& commands = m_replay->m_commands;
+	while (m_nextReplayCommandIndex < commands.Num() && commands[m_nextReplayCommandIndex].m_frameIndex <= static_cast<uint32>(m_frameIndex))
+	{
+		m_nextReplayCommandIndex++;
+	}
+
+	m_frameIndex++;
+	if (m_frameIndex < m_replay->GetNumFrames())
+	{
+		return;
+	}
+
+	ARGUS_LOG
+	(
+		ArgusPersistenceLog, Display, TEXT("[%s] Replay finished after %d frames. Diverged? %s"),
+		ARGUS_FUNCNAME,
+		m_frameIndex,
+		HasReplayDiverged() ? TEXT("Yes") : TEXT("No")
+	);
+	StopReplay();
+}
+
+void UArgusReplayManager::Interrupt()
+{
+	if (IsRecording())
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Warning, TEXT("[%s] ECS state was replaced mid recording. Discarding %d recorded frames."), ARGUS_FUNCNAME, m_recording->GetNumFrames());
+	}
+
+	m_recording = nullptr;
+	m_hasRecordRequest = false;
+	StopReplay();
+}
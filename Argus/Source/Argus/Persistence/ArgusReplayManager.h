@@ -0,0 +1,84 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ArgusReplaySaveGame.h"
+#include "ArgusReplayManager.generated.h"
+
+class AArgusGameModeBase;
+
+// Records the resolved player commands and deltaTime of every frame, and plays them back on top of the snapshot the recording started from.
+// Team commanders are not recorded since their commands are derived from ECS state, so a deterministic simulation reissues them on its own.
+UCLASS()
+class UArgusReplayManager : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	static UArgusReplayManager* Get() { return k_instance; }
+
+	// Checksum of all non transient component storage. Must be called between frames while the systems thread is idle.
+	static uint32 ComputeStateChecksum();
+
+	void BeginDestroy() override;
+
+	bool IsRecording() const { return m_recording != nullptr; }
+	bool IsReplaying() const { return m_replay != nullptr; }
+	bool HasRecordRequest() const { return m_hasRecordRequest; }
+	bool HasReplayRequest() const { return m_replayRequest != nullptr; }
+	bool HasReplayDiverged() const { return m_divergedFrameIndex != INDEX_NONE; }
+
+	void Initialize(AArgusGameModeBase* gameMode);
+	void StartRecording();
+	void StopRecording(const TFunction<void(const FString&, bool)>& completedDelegate = nullptr);
+	void StartReplay(const FString& replaySlotName);
+	void StopReplay();
+
+	void RecordCommand(const ArgusReplayCommand& command);
+	void RecordCameraTransform(const FVector& location, const FQuat& rotation);
+	TConstArrayView<ArgusReplayCommand> GetReplayCommandsThisFrame() const;
+
+#if !UE_BUILD_SHIPPING
+	void DrawDebugger();
+#endif //!UE_BUILD_SHIPPING
+
+private:
+	static UArgusReplayManager* k_instance;
+	static const FString k_replaySlotPrefix;
+
+	void ExecuteRecordRequest();
+	void ExecuteReplayRequest();
+	void OnReplayLoaded(const FString& replaySlotName, USaveGame* saveGame);
+	bool RestoreSnapshot(const ArgusSaveSnapshot& snapshot) const;
+
+	// Returns the recorded deltaTime while replaying, otherwise deltaTime is passed through.
+	float GetFrameDeltaTime(float deltaTime) const;
+	void EndFrame(float deltaTime);
+
+	// Stops recording without writing anything and stops any replay. Used when ECS state is replaced by something other than the simulation.
+	void Interrupt();
+
+	UPROPERTY(Transient)
+	TWeakObjectPtr<AArgusGameModeBase> m_gameMode = nullptr;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UArgusReplaySaveGame> m_recording = nullptr;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UArgusReplaySaveGame> m_replay = nullptr;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UArgusReplaySaveGame> m_replayRequest = nullptr;
+
+	FString m_mostRecentReplaySlotName;
+	FVector m_lastRecordedCameraLocation = FVector::ZeroVector;
+	FQuat m_lastRecordedCameraRotation = FQuat::Identity;
+	int32 m_frameIndex = 0;
+	int32 m_nextReplayCommandIndex = 0;
+	int32 m_divergedFrameIndex = INDEX_NONE;
+	bool m_hasRecordRequest = false;
+	bool m_hasRecordedCameraTransform = false;
+
+	friend class AArgusGameModeBase;
+};
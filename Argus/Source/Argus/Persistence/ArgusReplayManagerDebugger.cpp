@@ -0,0 +1,82 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+#include "ArgusCVars.h"
+#include "ArgusReplayManager.h"
+#include "ArgusMacros.h"
+#include "HAL/IConsoleManager.h"
+#include "imgui.h"
+
+void UArgusReplayManager::DrawDebugger()
+{
+	ARGUS_TRACE(UArgusReplayManager::DrawDebugger);
+
+	if (!ArgusCVars::CVarDrawReplayManagerDebugger.GetValueOnGameThread())
+	{
+		return;
+	}
+
+	const ImGui::FScopedContext scopedContext;
+	if (!scopedContext)
+	{
+		return;
+	}
+
+	ImGui::SetNextWindowSize(ImVec2(260, 140), ImGuiCond_FirstUseEver);
+	if (!ImGui::Begin("ReplayManager"))
+	{
+		ImGui::End();
+		return;
+	}
+
+	bool isRecording = IsRecording();
+	bool isReplaying = IsReplaying();
+	ImGui::Checkbox("Is Recording?", &isRecording);
+	ImGui::SameLine();
+	ImGui::Checkbox("Is Replaying?", &isReplaying);
+
+	if (IsRecording())
+	{
+		ImGui::Text("Recorded %d frames and %d commands", m_recording->GetNumFrames(), m_recording->m_commands.Num());
+	}
+	else if (IsReplaying())
+	{
+		ImGui::Text("Frame %d of %d", m_frameIndex, m_replay->GetNumFrames());
+	}
+	ImGui::Text("Diverged on frame: %d", m_divergedFrameIndex);
+	ImGui::Text("Most recent replay: %s", m_mostRecentReplaySlotName.IsEmpty() ? "None" : ARGUS_FSTRING_TO_CHAR(m_mostRecentReplaySlotName));
+
+	ImGui::NewLine();
+
+	if (ImGui::Button(IsRecording() ? "Stop Recording" : "Start Recording"))
+	{
+		if (IsRecording())
+		{
+			StopRecording();
+		}
+		else
+		{
+			StartRecording();
+		}
+	}
+
+	ImGui::SameLine();
+
+	if (ImGui::Button(IsReplaying() ? "Stop Replay" : "Replay Most Recent"))
+	{
+		if (IsReplaying())
+		{
+			StopReplay();
+		}
+		else
+		{
+			StartReplay(m_mostRecentReplaySlotName);
+		}
+	}
+
+	ImGui::End();
+}
+
+#endif //!UE_BUILD_SHIPPING
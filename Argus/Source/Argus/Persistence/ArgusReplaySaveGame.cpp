@@ -0,0 +1,55 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusReplaySaveGame.h"
+#include "ArgusLogging.h"
+
+FArchive& operator<<(FArchive& archive, ArgusReplayCommand& command)
+{
+	uint8 type = static_cast<uint8>(command.m_type);
+	archive << command.m_frameIndex;
+	archive << type;
+	command.m_type = static_cast<EArgusReplayCommandType>(type);
+
+	switch (command.m_type)
+	{
+		case EArgusReplayCommandType::MoveCamera:
+			archive << command.m_location;
+			archive << command.m_rotation;
+			break;
+		case EArgusReplayCommandType::MoveReticle:
+		case EArgusReplayCommandType::SetWaypoint:
+			archive << command.m_location;
+			break;
+		case EArgusReplayCommandType::SelectEntity:
+		case EArgusReplayCommandType::SelectEntities:
+			archive << command.m_entityIds;
+			archive << command.m_isAdditive;
+			break;
+		case EArgusReplayCommandType::MoveTo:
+			archive << command.m_entityIds;
+			archive << command.m_location;
+			archive << command.m_onAttackMove;
+			break;
+		case EArgusReplayCommandType::CastAbility:
+		case EArgusReplayCommandType::SetControlGroup:
+		case EArgusReplayCommandType::SelectControlGroup:
+			archive << command.m_index;
+			break;
+		default:
+			break;
+	}
+
+	return archive;
+}
+
+void UArgusReplaySaveGame::Serialize(FArchive& archive)
+{
+	ARGUS_TRACE(UArgusReplaySaveGame::Serialize);
+
+	Super::Serialize(archive);
+
+	archive << m_randomSeed;
+	archive << m_frameDeltaTimes;
+	archive << m_frameChecksums;
+	archive << m_commands;
+}
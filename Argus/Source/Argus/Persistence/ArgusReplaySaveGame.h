@@ -0,0 +1,62 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#pragma once
+
+#include "ArgusSaveGame.h"
+#include "ArgusReplaySaveGame.generated.h"
+
+enum class EArgusReplayCommandType : uint8
+{
+	MoveCamera,
+	MoveReticle,
+	InterruptReticle,
+	CastReticleAbility,
+	SelectEntity,
+	SelectEntities,
+	MoveTo,
+	SetWaypoint,
+	CastAbility,
+	ChangeActiveAbilityGroup,
+	SetControlGroup,
+	SelectControlGroup
+};
+
+// A player command after everything device dependent (mouse raycasts, marquee polygons, UI clicks) has been resolved, so it can be issued again
+// without any input.
+struct ArgusReplayCommand
+{
+	ArgusReplayCommand() = default;
+	ArgusReplayCommand(EArgusReplayCommandType type) : m_type(type) {}
+
+	uint32 m_frameIndex = 0u;
+	EArgusReplayCommandType m_type = EArgusReplayCommandType::MoveCamera;
+	TArray<uint16> m_entityIds;
+	FVector m_location = FVector::ZeroVector;
+	FQuat m_rotation = FQuat::Identity;
+	uint8 m_index = 0u;
+	bool m_isAdditive = false;
+	bool m_onAttackMove = false;
+
+	// Only the fields used by m_type are written.
+	friend FArchive& operator<<(FArchive& archive, ArgusReplayCommand& command);
+};
+
+// The starting ECS state of a recording followed by everything needed to simulate forward from it: the simulation random seed, the deltaTime of
+// every frame, the commands issued on each frame and a checksum of component storage at the end of each frame.
+UCLASS()
+class UArgusReplaySaveGame : public UArgusSaveGame
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Serialize(FArchive& archive) override;
+
+	int32 GetNumFrames() const { return m_frameDeltaTimes.Num(); }
+
+	int32 m_randomSeed = 0;
+	TArray<float> m_frameDeltaTimes;
+	TArray<uint32> m_frameChecksums;
+
+	// Sorted by m_frameIndex.
+	TArray<ArgusReplayCommand> m_commands;
+};
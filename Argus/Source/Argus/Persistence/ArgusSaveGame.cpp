@@ -1,21 +1,528 @@
 // Copyright Karazaa. This is a part of an RTS project called Argus.
 
 #include "ArgusSaveGame.h"
+#include "ArgusComponentRegistry.h"
 #include "ArgusEntity.h"
+#include "ArgusLogging.h"
+#include "Async/ParallelFor.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Systems/SpatialPartitioningSystems.h"
+#include <atomic>
 
 #if !UE_BUILD_SHIPPING
 #include "ArgusECSDebugger.h"
 #endif
 
+const FName UArgusSaveGame::k_compressionFormat = NAME_LZ4;
+
+bool ArgusSaveChunk::Encode(const ArgusSaveChunk* keyframeChunk)
+{
+	m_dirtySlotIndices.Reset();
+	m_snapshotSize = m_snapshotBytes.Num();
+	if (m_slotSizes.IsEmpty())
+	{
+		m_slotSizes.Add(m_snapshotBytes.Num());
+	}
+
+	int64 numSlotBytes = 0;
+	for (int32 slotSize : m_slotSizes)
+	{
+		numSlotBytes += slotSize;
+	}
+	if (numSlotBytes != m_snapshotSize)
+	{
+		return false;
+	}
+
+	// Keyframes carry every slot size so that deltas can find their slots again after the keyframe is read back from disk. Deltas only carry the
+	// sizes of their dirty slots, since every clean slot matches the keyframe.
+	TArray<uint8> payloadBytes;
+	FMemoryWriter payloadWriter = FMemoryWriter(payloadBytes);
+	if (!keyframeChunk)
+	{
+		payloadWriter << m_slotSizes;
+		payloadWriter.Serialize(m_snapshotBytes.GetData(), m_snapshotBytes.Num());
+		m_uncompressedSize = payloadBytes.Num();
+		return UArgusSaveGame::CompressSnapshot(payloadBytes, m_compressedBytes);
+	}
+
+	if (keyframeChunk->m_slotSizes.Num() != m_slotSizes.Num())
+	{
+		return false;
+	}
+
+	TArray<int32> dirtySlotSizes;
+	TArray<uint8> dirtySlotBytes;
+	int32 slotStart = 0;
+	int32 keyframeSlotStart = 0;
+	for (int32 i = 0; i < m_slotSizes.Num(); ++i)
+	{
+		const int32 slotSize = m_slotSizes[i];
+		const int32 keyframeSlotSize = keyframeChunk->m_slotSizes[i];
+		const bool isSlotInKeyframe = (keyframeSlotStart + keyframeSlotSize) <= keyframeChunk->m_snapshotBytes.Num();
+		const bool isSlotClean = isSlotInKeyframe && slotSize == keyframeSlotSize &&
+			(slotSize == 0 || FMemory::Memcmp(&m_snapshotBytes[slotStart], &keyframeChunk->m_snapshotBytes[keyframeSlotStart], slotSize) == 0);
+		if (!isSlotClean)
+		{
+			m_dirtySlotIndices.Add(i);
+			dirtySlotSizes.Add(slotSize);
+			dirtySlotBytes.Append(m_snapshotBytes.GetData() + slotStart, slotSize);
+		}
+
+		slotStart += slotSize;
+		keyframeSlotStart += keyframeSlotSize;
+	}
+
+	payloadWriter << dirtySlotSizes;
+	payloadWriter.Serialize(dirtySlotBytes.GetData(), dirtySlotBytes.Num());
+	m_uncompressedSize = payloadBytes.Num();
+	return UArgusSaveGame::CompressSnapshot(payloadBytes, m_compressedBytes);
+}
+
+bool ArgusSaveChunk::Decode(const ArgusSaveChunk* keyframeChunk, ArgusSaveChunk& outChunk) const
+{
+	TArray<uint8> payloadBytes;
+	if (!UArgusSaveGame::DecompressSnapshot(m_compressedBytes, m_uncompressedSize, payloadBytes))
+	{
+		return false;
+	}
+
+	FMemoryReader payloadReader = FMemoryReader(payloadBytes);
+	TArray<int32> payloadSlotSizes;
+	payloadReader << payloadSlotSizes;
+	if (payloadReader.IsError())
+	{
+		return false;
+	}
+
+	const uint8* payloadSlotBytes = payloadBytes.GetData() + payloadReader.Tell();
+	const int64 numPayloadSlotBytes = payloadBytes.Num() - payloadReader.Tell();
+	outChunk.m_snapshotBytes.Reset(m_snapshotSize);
+	if (!keyframeChunk)
+	{
+		outChunk.m_slotSizes = MoveTemp(payloadSlotSizes);
+		outChunk.m_snapshotBytes.Append(payloadSlotBytes, numPayloadSlotBytes);
+		return outChunk.m_snapshotBytes.Num() == m_snapshotSize;
+	}
+
+	if (payloadSlotSizes.Num() != m_dirtySlotIndices.Num())
+	{
+		return false;
+	}
+
+	outChunk.m_slotSizes = keyframeChunk->m_slotSizes;
+	int64 payloadOffset = 0;
+	int32 keyframeSlotStart = 0;
+	int32 dirtySlotIndex = 0;
+	for (int32 i = 0; i < keyframeChunk->m_slotSizes.Num(); ++i)
+	{
+		const int32 keyframeSlotSize = keyframeChunk->m_slotSizes[i];
+		if (m_dirtySlotIndices.IsValidIndex(dirtySlotIndex) && m_dirtySlotIndices[dirtySlotIndex] == i)
+		{
+			const int32 slotSize = payloadSlotSizes[dirtySlotIndex++];
+			if (slotSize < 0 || (payloadOffset + slotSize) > numPayloadSlotBytes)
+			{
+				return false;
+			}
+
+			outChunk.m_snapshotBytes.Append(payloadSlotBytes + payloadOffset, slotSize);
+			outChunk.m_slotSizes[i] = slotSize;
+			payloadOffset += slotSize;
+		}
+		else
+		{
+			if ((keyframeSlotStart + keyframeSlotSize) > keyframeChunk->m_snapshotBytes.Num())
+			{
+				return false;
+			}
+
+			outChunk.m_snapshotBytes.Append(keyframeChunk->m_snapshotBytes.GetData() + keyframeSlotStart, keyframeSlotSize);
+		}
+
+		keyframeSlotStart += keyframeSlotSize;
+	}
+
+	return dirtySlotIndex == m_dirtySlotIndices.Num() && outChunk.m_snapshotBytes.Num() == m_snapshotSize;
+}
+
+int32 ArgusSaveSnapshot::GetNumChunks()
+{
+	return static_cast<int32>(ArgusComponentRegistry::k_numStaticComponentTypes) + 1;
+}
+
+void ArgusSaveSnapshot::Capture(bool shouldRecordSlots)
+{
+	ARGUS_TRACE(ArgusSaveSnapshot::Capture);
+
+	m_chunks.SetNum(GetNumChunks());
+	m_componentTypeCopies.SetNum(ArgusComponentRegistry::k_numStaticComponentTypes);
+	m_shouldRecordSlots = shouldRecordSlots;
+	m_chunks[k_entityChunkIndex].m_snapshotBytes.Reset();
+	m_chunks[k_entityChunkIndex].m_slotSizes.Reset();
+
+	FMemoryWriter entityWriter = FMemoryWriter(m_chunks[k_entityChunkIndex].m_snapshotBytes);
+	ArgusEntity::SerializeEntityIds(entityWriter);
+	ArgusComponentRegistry::SerializeDynamicAllocComponents(entityWriter);
+
+#if !UE_BUILD_SHIPPING
+	ArgusECSDebugger::Serialize(entityWriter);
+#endif
+
+	ParallelFor(ArgusComponentRegistry::k_numStaticComponentTypes, [this, shouldRecordSlots](int32 componentTypeIndex)
+	{
+		ArgusSaveChunk& chunk = m_chunks[componentTypeIndex + 1];
+		chunk.m_snapshotBytes.Reset();
+		chunk.m_slotSizes.Reset();
+
+		// Bulk serialized types only take a memcpy here. Running them through an archive is left to SerializeComponentTypeCopies, off of the game thread.
+		if (ArgusComponentRegistry::CopyComponentType(static_cast<uint32>(componentTypeIndex), m_componentTypeCopies[componentTypeIndex]))
+		{
+			return;
+		}
+
+		FMemoryWriter componentWriter = FMemoryWriter(chunk.m_snapshotBytes);
+		ArgusComponentRegistry::SerializeComponentType(componentWriter, static_cast<uint32>(componentTypeIndex), shouldRecordSlots ? &chunk.m_slotSizes : nullptr);
+	});
+}
+
+void ArgusSaveSnapshot::SerializeComponentTypeCopies()
+{
+	ARGUS_TRACE(ArgusSaveSnapshot::SerializeComponentTypeCopies);
+
+	if (m_componentTypeCopies.Num() != ArgusComponentRegistry::k_numStaticComponentTypes || m_chunks.Num() != GetNumChunks())
+	{
+		return;
+	}
+
+	ParallelFor(ArgusComponentRegistry::k_numStaticComponentTypes, [this](int32 componentTypeIndex)
+	{
+		ArgusComponentTypeCopy& componentTypeCopy = m_componentTypeCopies[componentTypeIndex];
+		if (componentTypeCopy.m_componentBytes.IsEmpty())
+		{
+			return;
+		}
+
+		ArgusSaveChunk& chunk = m_chunks[componentTypeIndex + 1];
+		FMemoryWriter componentWriter = FMemoryWriter(chunk.m_snapshotBytes);
+		ArgusComponentRegistry::SerializeComponentTypeCopy(componentWriter, static_cast<uint32>(componentTypeIndex), componentTypeCopy, m_shouldRecordSlots ? &chunk.m_slotSizes : nullptr);
+
+		// Copies are as large as the component arrays themselves, so they are only kept until they have been written.
+		componentTypeCopy.m_isComponentActive.Empty();
+		componentTypeCopy.m_componentBytes.Empty();
+	});
+}
+
+bool ArgusSaveSnapshot::HasComponentTypeCopies() const
+{
+	for (const ArgusComponentTypeCopy& componentTypeCopy : m_componentTypeCopies)
+	{
+		if (!componentTypeCopy.m_componentBytes.IsEmpty())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool ArgusSaveSnapshot::Apply() const
+{
+	ARGUS_TRACE(ArgusSaveSnapshot::Apply);
+
+	if (m_chunks.Num() != GetNumChunks())
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] Snapshot has %d chunks but %d are expected."), ARGUS_FUNCNAME, m_chunks.Num(), GetNumChunks());
+		return false;
+	}
+
+	if (HasComponentTypeCopies())
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] Snapshot still has component types that were copied but never serialized. Call %s first."), ARGUS_FUNCNAME, ARGUS_NAMEOF(ArgusSaveSnapshot::SerializeComponentTypeCopies));
+		return false;
+	}
+
+	FMemoryReader entityReader = FMemoryReader(m_chunks[k_entityChunkIndex].m_snapshotBytes);
+	ArgusEntity::SerializeEntityIds(entityReader);
+	ArgusComponentRegistry::SerializeDynamicAllocComponents(entityReader);
+
+#if !UE_BUILD_SHIPPING
+	ArgusECSDebugger::Serialize(entityReader);
+#endif
+
+	std::atomic<bool> didApplyAllChunks = std::atomic<bool>(!entityReader.IsError());
+	ParallelFor(ArgusComponentRegistry::k_numStaticComponentTypes, [this, &didApplyAllChunks](int32 componentTypeIndex)
+	{
+		FMemoryReader componentReader = FMemoryReader(m_chunks[componentTypeIndex + 1].m_snapshotBytes);
+		ArgusComponentRegistry::SerializeComponentType(componentReader, static_cast<uint32>(componentTypeIndex));
+		if (componentReader.IsError())
+		{
+			didApplyAllChunks = false;
+		}
+	});
+
+	if (!didApplyAllChunks)
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] Snapshot could not be fully deserialized. It was written by an incompatible component layout."), ARGUS_FUNCNAME);
+		return false;
+	}
+
+	// Every entity may have changed team, role or lifetime at once, so the role index can't be patched per entity.
+	SpatialPartitioningSystems::RequestEntityRoleIndexRebuild();
+	return true;
+}
+
+bool ArgusSaveSnapshot::Encode(const ArgusSaveSnapshot* keyframeSnapshot)
+{
+	ARGUS_TRACE(ArgusSaveSnapshot::Encode);
+
+	SerializeComponentTypeCopies();
+	if (keyframeSnapshot && keyframeSnapshot->m_chunks.Num() != m_chunks.Num())
+	{
+		return false;
+	}
+
+	std::atomic<bool> didEncodeAllChunks = std::atomic<bool>(true);
+	ParallelFor(m_chunks.Num(), [this, keyframeSnapshot, &didEncodeAllChunks](int32 chunkIndex)
+	{
+		if (!m_chunks[chunkIndex].Encode(keyframeSnapshot ? &keyframeSnapshot->m_chunks[chunkIndex] : nullptr))
+		{
+			didEncodeAllChunks = false;
+		}
+	});
+
+	return didEncodeAllChunks;
+}
+
+bool UArgusSaveGame::CompressSnapshot(const TArray<uint8>& snapshotBytes, TArray<uint8>& outCompressedBytes)
+{
+	ARGUS_TRACE(UArgusSaveGame::CompressSnapshot);
+
+	outCompressedBytes.Reset();
+	if (snapshotBytes.IsEmpty())
+	{
+		return true;
+	}
+
+	int32 compressedSize = FCompression::CompressMemoryBound(k_compressionFormat, snapshotBytes.Num());
+	outCompressedBytes.SetNumUninitialized(compressedSize);
+	if (!FCompression::CompressMemory(k_compressionFormat, outCompressedBytes.GetData(), compressedSize, snapshotBytes.GetData(), snapshotBytes.Num()))
+	{
+		outCompressedBytes.Reset();
+		return false;
+	}
+
+	outCompressedBytes.SetNum(compressedSize, EAllowShrinking::No);
+	return true;
+}
+
+bool UArgusSaveGame::DecompressSnapshot(const TArray<uint8>& compressedBytes, int32 uncompressedSize, TArray<uint8>& outSnapshotBytes)
+{
+	ARGUS_TRACE(UArgusSaveGame::DecompressSnapshot);
+
+	outSnapshotBytes.Reset();
+	if (uncompressedSize <= 0)
+	{
+		return compressedBytes.IsEmpty();
+	}
+
+	outSnapshotBytes.SetNumUninitialized(uncompressedSize);
+	return FCompression::UncompressMemory(k_compressionFormat, outSnapshotBytes.GetData(), uncompressedSize, compressedBytes.GetData(), compressedBytes.Num());
+}
+
+void UArgusSaveGame::TakeEncodedSnapshot(ArgusSaveSnapshot& snapshot, const FString& keyframeSlotName)
+{
+	m_keyframeSlotName = keyframeSlotName;
+	m_chunks.SetNum(snapshot.m_chunks.Num());
+	for (int32 i = 0; i < m_chunks.Num(); ++i)
+	{
+		m_chunks[i].m_dirtySlotIndices = MoveTemp(snapshot.m_chunks[i].m_dirtySlotIndices);
+		m_chunks[i].m_compressedBytes = MoveTemp(snapshot.m_chunks[i].m_compressedBytes);
+		m_chunks[i].m_uncompressedSize = snapshot.m_chunks[i].m_uncompressedSize;
+		m_chunks[i].m_snapshotSize = snapshot.m_chunks[i].m_snapshotSize;
+	}
+}
+
+bool UArgusSaveGame::DecodeSnapshot(const ArgusSaveSnapshot* keyframeSnapshot, ArgusSaveSnapshot& outSnapshot) const
+{
+	ARGUS_TRACE(UArgusSaveGame::DecodeSnapshot);
+
+	if (!IsFormatVersionSupported())
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] Cannot decode %s. It was written with save format version %d and bulk component layout %u, but only version %d and layout %u are supported."), ARGUS_FUNCNAME, *GetName(), m_formatVersion, m_bulkComponentsLayoutHash, k_formatVersion, ArgusComponentRegistry::k_bulkComponentsLayoutHash);
+		return false;
+	}
+
+	if (m_chunks.Num() != ArgusSaveSnapshot::GetNumChunks())
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] Cannot decode %s. It has %d chunks but %d are expected."), ARGUS_FUNCNAME, *GetName(), m_chunks.Num(), ArgusSaveSnapshot::GetNumChunks());
+		return false;
+	}
+
+	if (!IsKeyframe() && (!keyframeSnapshot || keyframeSnapshot->m_chunks.Num() != m_chunks.Num()))
+	{
+		return false;
+	}
+
+	outSnapshot.m_chunks.SetNum(m_chunks.Num());
+	std::atomic<bool> didDecodeAllChunks = std::atomic<bool>(true);
+	ParallelFor(m_chunks.Num(), [this, keyframeSnapshot, &outSnapshot, &didDecodeAllChunks](int32 chunkIndex)
+	{
+		const ArgusSaveChunk* keyframeChunk = IsKeyframe() ? nullptr : &keyframeSnapshot->m_chunks[chunkIndex];
+		if (!m_chunks[chunkIndex].Decode(keyframeChunk, outSnapshot.m_chunks[chunkIndex]))
+		{
+			didDecodeAllChunks = false;
+		}
+	});
+
+	return didDecodeAllChunks;
+}
+
 void UArgusSaveGame::Serialize(FArchive& archive)
 {
 	ARGUS_TRACE(UArgusSaveGame::Serialize);
 
 	Super::Serialize(archive);
 
-	ArgusEntity::Serialize(archive);
+	// Saves that did not go through UArgusSaveManager's two phase save are written as keyframes.
+	if (archive.IsSaving() && m_chunks.IsEmpty())
+	{
+		ArgusSaveSnapshot snapshot;
+		snapshot.Capture(true);
+		if (snapshot.Encode(nullptr))
+		{
+			TakeEncodedSnapshot(snapshot, FString());
+		}
+	}
 
-#if !UE_BUILD_SHIPPING
-	ArgusECSDebugger::Serialize(archive);
-#endif
+	if (archive.IsSaving())
+	{
+		m_formatVersion = k_formatVersion;
+		m_bulkComponentsLayoutHash = ArgusComponentRegistry::k_bulkComponentsLayoutHash;
+	}
+
+	archive << m_formatVersion;
+	if (archive.IsLoading() && (archive.IsError() || m_formatVersion != k_formatVersion))
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] %s was written with save format version %d, but only version %d can be loaded."), ARGUS_FUNCNAME, *GetName(), m_formatVersion, k_formatVersion);
+		RejectLoad(archive);
+		return;
+	}
+
+	archive << m_bulkComponentsLayoutHash;
+	if (archive.IsLoading() && (archive.IsError() || !IsFormatVersionSupported()))
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] %s was written with bulk component layout %u, but only layout %u can be loaded."), ARGUS_FUNCNAME, *GetName(), m_bulkComponentsLayoutHash, ArgusComponentRegistry::k_bulkComponentsLayoutHash);
+		RejectLoad(archive);
+		return;
+	}
+
+	archive << m_keyframeSlotName;
+
+	int32 numChunks = m_chunks.Num();
+	archive << numChunks;
+	if (archive.IsLoading())
+	{
+		if (archive.IsError() || numChunks != ArgusSaveSnapshot::GetNumChunks())
+		{
+			ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] %s has %d chunks but %d are expected."), ARGUS_FUNCNAME, *GetName(), numChunks, ArgusSaveSnapshot::GetNumChunks());
+			RejectLoad(archive);
+			return;
+		}
+
+		m_chunks.SetNum(numChunks);
+	}
+
+	// The header lists every chunk's sizes up front, so a single chunk can be found and read without decompressing the others.
+	int64 numCompressedBytes = 0;
+	for (int32 i = 0; i < m_chunks.Num(); ++i)
+	{
+		ArgusSaveChunk& chunk = m_chunks[i];
+		int32 compressedSize = chunk.m_compressedBytes.Num();
+		archive << chunk.m_snapshotSize;
+		archive << chunk.m_uncompressedSize;
+		archive << compressedSize;
+		archive << chunk.m_dirtySlotIndices;
+		if (!archive.IsLoading())
+		{
+			continue;
+		}
+
+		numCompressedBytes += compressedSize;
+		if (archive.IsError() || !IsChunkHeaderValid(chunk, compressedSize))
+		{
+			ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] %s has an invalid header for chunk %d."), ARGUS_FUNCNAME, *GetName(), i);
+			RejectLoad(archive);
+			return;
+		}
+
+		chunk.m_compressedBytes.SetNumUninitialized(compressedSize);
+	}
+
+	// Catches headers that are individually sane but claim more bytes than the file actually has, before anything is read into them.
+	if (archive.IsLoading() && archive.TotalSize() >= 0)
+	{
+		const int64 numRemainingBytes = archive.TotalSize() - archive.Tell();
+		if (numCompressedBytes > numRemainingBytes)
+		{
+			ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] %s lists %lld compressed bytes but only %lld remain."), ARGUS_FUNCNAME, *GetName(), numCompressedBytes, numRemainingBytes);
+			RejectLoad(archive);
+			return;
+		}
+	}
+
+	for (ArgusSaveChunk& chunk : m_chunks)
+	{
+		archive.Serialize(chunk.m_compressedBytes.GetData(), chunk.m_compressedBytes.Num());
+		if (archive.IsLoading() && archive.IsError())
+		{
+			ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] %s ended before all of its compressed bytes were read."), ARGUS_FUNCNAME, *GetName());
+			RejectLoad(archive);
+			return;
+		}
+	}
+}
+
+bool UArgusSaveGame::IsChunkHeaderValid(const ArgusSaveChunk& chunk, int32 compressedSize)
+{
+	if (chunk.m_snapshotSize < 0 || chunk.m_snapshotSize > k_maxChunkBytes)
+	{
+		return false;
+	}
+
+	if (chunk.m_uncompressedSize < 0 || chunk.m_uncompressedSize > k_maxChunkBytes)
+	{
+		return false;
+	}
+
+	// An empty payload is the only one that compresses to nothing.
+	if (compressedSize < 0 || compressedSize > k_maxChunkBytes || (compressedSize == 0) != (chunk.m_uncompressedSize == 0))
+	{
+		return false;
+	}
+
+	// A chunk has a header slot plus at most one slot per entity id, and dirty slots are written in ascending order.
+	const int32 maxNumSlots = static_cast<int32>(ArgusECSConstants::k_maxEntities) + 1;
+	if (chunk.m_dirtySlotIndices.Num() > maxNumSlots)
+	{
+		return false;
+	}
+
+	for (int32 i = 0; i < chunk.m_dirtySlotIndices.Num(); ++i)
+	{
+		if (chunk.m_dirtySlotIndices[i] < 0 || chunk.m_dirtySlotIndices[i] >= maxNumSlots || (i > 0 && chunk.m_dirtySlotIndices[i] <= chunk.m_dirtySlotIndices[i - 1]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void UArgusSaveGame::RejectLoad(FArchive& archive)
+{
+	m_keyframeSlotName.Reset();
+	m_chunks.Reset();
+	archive.SetError();
 }
\ No newline at end of file
@@ -2,14 +2,93 @@
 
 #pragma once
 
+#include "ArgusComponentRegistry.h"
 #include "GameFramework/SaveGame.h"
 #include "ArgusSaveGame.generated.h"
 
+// One independently compressed section of a save. Keyframe chunks compress all of their bytes, delta chunks only compress the slots that differ
+// from the matching keyframe chunk. A slot is the header of a component type or the component of a single entity id, so an entity that changes,
+// appears or goes away only dirties its own slot instead of shifting every byte after it.
+struct ArgusSaveChunk
+{
+	bool Encode(const ArgusSaveChunk* keyframeChunk);
+	bool Decode(const ArgusSaveChunk* keyframeChunk, ArgusSaveChunk& outChunk) const;
+
+	TArray<uint8> m_snapshotBytes;
+
+	// Bytes per slot, in order. Chunks captured without slots are diffed as a single slot.
+	TArray<int32> m_slotSizes;
+	TArray<int32> m_dirtySlotIndices;
+	TArray<uint8> m_compressedBytes;
+	int32 m_uncompressedSize = 0;
+	int32 m_snapshotSize = 0;
+};
+
+// Raw ECS state split into chunks. The first chunk holds entity ids, dynamically allocated components and debugger state. Every other chunk holds
+// a single statically allocated component type, so chunks can be captured, encoded, decoded and applied in parallel.
+struct ArgusSaveSnapshot
+{
+	static constexpr int32 k_entityChunkIndex = 0;
+	static int32 GetNumChunks();
+
+	// Must be called between frames while the systems thread is idle. Slots are only worth recording for snapshots that deltas will be diffed against
+	// or encoded from, since they take an entry per entity id for every component type. Bulk serialized component types are only copied, so
+	// SerializeComponentTypeCopies has to run before the snapshot can be applied. Encode runs it on its own.
+	void Capture(bool shouldRecordSlots = false);
+	bool Apply() const;
+
+	// Safe to call from any thread.
+	void SerializeComponentTypeCopies();
+	bool HasComponentTypeCopies() const;
+	bool Encode(const ArgusSaveSnapshot* keyframeSnapshot);
+
+	TArray<ArgusSaveChunk> m_chunks;
+
+	// One entry per statically allocated component type. Only bulk serialized types hold bytes, and only between Capture and SerializeComponentTypeCopies.
+	TArray<ArgusComponentTypeCopy> m_componentTypeCopies;
+	bool m_shouldRecordSlots = false;
+};
+
 UCLASS()
 class UArgusSaveGame : public USaveGame
 {
 	GENERATED_BODY()
 
 public:
+	// Bump whenever the header or chunk layout changes. Saves written with any other version are rejected on load.
+	static constexpr int32 k_formatVersion = 3;
+
+	// Safe to call from any thread.
+	static bool CompressSnapshot(const TArray<uint8>& snapshotBytes, TArray<uint8>& outCompressedBytes);
+	static bool DecompressSnapshot(const TArray<uint8>& compressedBytes, int32 uncompressedSize, TArray<uint8>& outSnapshotBytes);
+
+	void TakeEncodedSnapshot(ArgusSaveSnapshot& snapshot, const FString& keyframeSlotName);
+	bool DecodeSnapshot(const ArgusSaveSnapshot* keyframeSnapshot, ArgusSaveSnapshot& outSnapshot) const;
+	bool IsKeyframe() const { return m_keyframeSlotName.IsEmpty(); }
+	const FString& GetKeyframeSlotName() const { return m_keyframeSlotName; }
+	bool IsFormatVersionSupported() const { return m_formatVersion == k_formatVersion && m_bulkComponentsLayoutHash == ArgusComponentRegistry::k_bulkComponentsLayoutHash; }
+
 	virtual void Serialize(FArchive& archive) override;
+
+private:
+	static const FName k_compressionFormat;
+
+	// Upper bound on any single size read from a save header. Anything larger can only come from a corrupt or hostile file.
+	static constexpr int32 k_maxChunkBytes = 256 * 1024 * 1024;
+
+	static bool IsChunkHeaderValid(const ArgusSaveChunk& chunk, int32 compressedSize);
+	void RejectLoad(FArchive& archive);
+
+	// Serialized first, so that nothing else in the header is read from a save with a different layout.
+	int32 m_formatVersion = k_formatVersion;
+
+	// Bulk serialized components are raw memory, so there is no per field fallback for reading them back with a different layout. Saves from an
+	// older layout are intentionally incompatible and are rejected up front instead of failing partway through applying them.
+	uint32 m_bulkComponentsLayoutHash = ArgusComponentRegistry::k_bulkComponentsLayoutHash;
+
+	// Empty for keyframes. Deltas can only be decoded on top of the snapshot stored in this slot.
+	FString m_keyframeSlotName;
+
+	// Only the encoded parts of each chunk are kept. m_snapshotBytes stays empty.
+	TArray<ArgusSaveChunk> m_chunks;
 };
\ No newline at end of file
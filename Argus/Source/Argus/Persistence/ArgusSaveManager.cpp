@@ -6,13 +6,19 @@
 #include "ArgusMetadataSaveGame.h"
 #include "ArgusLogging.h"
 #include "ArgusSaveGame.h"
+#include "Async/Async.h"
 #include "Kismet/GameplayStatics.h"
 #include "PlatformFeatures.h"
 #include "SaveGameSystem.h"
+#include "Tasks/Task.h"
+#include "UObject/StrongObjectPtr.h"
 
 UArgusSaveManager* UArgusSaveManager::k_instance = nullptr;
 const FString UArgusSaveManager::k_metadataSaveSlotName = TEXT("ArgusSaveMetadata");
 const FString UArgusSaveManager::k_saveSlotPrefix = TEXT("ArgusSave");
+const uint8 UArgusSaveManager::k_deltaSavesPerKeyframe = 8u;
+const uint16 UArgusSaveManager::k_framesPerRewindSnapshot = 60u;
+const int32 UArgusSaveManager::k_maxRewindSnapshots = 30;
 
 UArgusSaveManager::UArgusSaveManager()
 {
@@ -21,6 +27,7 @@ UArgusSaveManager::UArgusSaveManager()
 
 void UArgusSaveManager::BeginDestroy()
 {
+	WaitForRewindSnapshotTasks();
 	k_instance = nullptr;
 	Super::BeginDestroy();
 }
@@ -52,17 +59,81 @@ void UArgusSaveManager::Save(const TFunction<void(const FString&, bool)>& comple
 	const FString saveSlotName = GetNextSaveSlotName();
 	ARGUS_RETURN_ON_NULL_INVOKE(argusSaveGame, ArgusPersistenceLog, completedDelegate, saveSlotName, false);
 
-	SaveInternal(saveSlotName, argusSaveGame, [saveSlotName, saveLock, completedDelegate](bool didSucceed)
+	// The snapshot is the only part of the save that touches ECS state, so it is the only part done inline. Save is called between frames
+	// while the systems thread is idle. Compression, archive encoding and the disk write all happen after this returns.
+	TSharedRef<ArgusSaveSnapshot, ESPMode::ThreadSafe> snapshot = MakeShared<ArgusSaveSnapshot, ESPMode::ThreadSafe>();
+	snapshot->Capture(true);
+
+	// Most saves only store the entity slots that changed since the last keyframe. A full keyframe is written every k_deltaSavesPerKeyframe saves.
+	const bool isKeyframe = !m_keyframeSnapshot.IsValid() || m_numDeltaSavesSinceKeyframe >= k_deltaSavesPerKeyframe;
+	TSharedPtr<const ArgusSaveSnapshot, ESPMode::ThreadSafe> keyframeSnapshot = isKeyframe ? nullptr : m_keyframeSnapshot;
+
+	m_pendingSaveGame = argusSaveGame;
+	m_pendingSaveSlotName = saveSlotName;
+	m_pendingKeyframeSlotName = isKeyframe ? FString() : m_keyframeSlotName;
+	m_pendingSaveDelegate = completedDelegate;
+	m_pendingSaveLock.Emplace(saveLock);
+
+	UE::Tasks::Launch(ARGUS_NAMEOF(ArgusSaveSnapshot::Encode), [snapshot, keyframeSnapshot]()
+	{
+		const bool didEncode = snapshot->Encode(keyframeSnapshot.Get());
+		AsyncTask(ENamedThreads::GameThread, [snapshot, didEncode]()
+		{
+			UArgusSaveManager* rawSaveManager = UArgusSaveManager::Get();
+			ARGUS_RETURN_ON_NULL(rawSaveManager, ArgusPersistenceLog);
+			rawSaveManager->OnSnapshotEncoded(snapshot, didEncode);
+		});
+	});
+}
+
+void UArgusSaveManager::OnSnapshotEncoded(const TSharedRef<ArgusSaveSnapshot, ESPMode::ThreadSafe>& snapshot, bool didEncode)
+{
+	if (!m_pendingSaveLock.IsSet())
+	{
+		return;
+	}
+
+	const SaveLoadLock saveLock = m_pendingSaveLock.GetValue();
+	m_pendingSaveLock.Reset();
+
+	UArgusSaveGame* argusSaveGame = m_pendingSaveGame.Get();
+	m_pendingSaveGame = nullptr;
+	const FString saveSlotName = MoveTemp(m_pendingSaveSlotName);
+	const FString keyframeSlotName = MoveTemp(m_pendingKeyframeSlotName);
+	const TFunction<void(const FString&, bool)> completedDelegate = MoveTemp(m_pendingSaveDelegate);
+	m_pendingSaveSlotName.Reset();
+	m_pendingKeyframeSlotName.Reset();
+	m_pendingSaveDelegate = nullptr;
+
+	ARGUS_RETURN_ON_NULL_INVOKE(argusSaveGame, ArgusPersistenceLog, completedDelegate, saveSlotName, false);
+	if (!didEncode)
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] Failed to encode the ECS snapshot for %s."), ARGUS_FUNCNAME, *saveSlotName);
+		if (completedDelegate)
+		{
+			completedDelegate(saveSlotName, false);
+		}
+		return;
+	}
+
+	argusSaveGame->TakeEncodedSnapshot(*snapshot, keyframeSlotName);
+
+	SaveInternal(saveSlotName, argusSaveGame, [saveSlotName, keyframeSlotName, snapshot, saveLock, completedDelegate, isKeyframe = argusSaveGame->IsKeyframe()](bool didSucceed)
 	{
 		UArgusSaveManager* rawSaveManager = UArgusSaveManager::Get();
 		ARGUS_RETURN_ON_NULL_INVOKE(rawSaveManager, ArgusPersistenceLog, completedDelegate, saveSlotName, didSucceed);
 
+		if (didSucceed)
+		{
+			rawSaveManager->OnSnapshotWritten(saveSlotName, snapshot, isKeyframe);
+		}
+
 		if (completedDelegate)
 		{
 			completedDelegate(saveSlotName, didSucceed);
 		}
 
-		rawSaveManager->OnSaveComplete(saveSlotName, saveLock, didSucceed);
+		rawSaveManager->OnSaveComplete(saveSlotName, keyframeSlotName, saveLock, didSucceed);
 	});
 }
 
@@ -113,6 +184,21 @@ void UArgusSaveManager::DeleteSaveGame(const FString& saveSlotName, const TFunct
 	});
 }
 
+void UArgusSaveManager::Rewind(int32 numSnapshotsBack)
+{
+	if (IsLoading() || HasLoadRequest())
+	{
+		return;
+	}
+	if (numSnapshotsBack < 0 || numSnapshotsBack >= m_numRewindSnapshots)
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Warning, TEXT("[%s] Cannot rewind %d snapshots when only %d are buffered."), ARGUS_FUNCNAME, numSnapshotsBack, m_numRewindSnapshots);
+		return;
+	}
+
+	m_rewindRequest = numSnapshotsBack;
+}
+
 UArgusSaveManager::SaveLoadLock::SaveLoadLock(SaveLoadLockType lockType)
 {
 	m_lockType = lockType;
@@ -247,6 +333,112 @@ void UArgusSaveManager::ExecuteLoadRequest()
 	m_loadRequest.Value = nullptr;
 }
 
+void UArgusSaveManager::ExecuteRewindRequest()
+{
+	if (!HasRewindRequest())
+	{
+		return;
+	}
+
+	const int32 numSnapshotsBack = m_rewindRequest;
+	m_rewindRequest = INDEX_NONE;
+	if (numSnapshotsBack >= m_numRewindSnapshots)
+	{
+		return;
+	}
+
+	AArgusGameModeBase* gameMode = m_gameMode.Get();
+	ARGUS_RETURN_ON_NULL(gameMode, ArgusPersistenceLog);
+
+	const int32 snapshotIndex = (m_nextRewindSnapshotIndex - 1 - numSnapshotsBack + k_maxRewindSnapshots) % k_maxRewindSnapshots;
+
+	// A snapshot that fails to apply leaves the ECS partially deserialized, so the current state is kept to fall back on.
+	ArgusSaveSnapshot preRewindSnapshot;
+	preRewindSnapshot.Capture();
+	if (m_rewindSnapshotTasks.IsValidIndex(snapshotIndex))
+	{
+		m_rewindSnapshotTasks[snapshotIndex].Wait();
+	}
+
+	// Rewinding goes through the same teardown and post load initialization as a load from disk, minus the disk. Actors go back to
+	// UArgusActorPool and are taken again once their entities show up in view, so none are actually created.
+	const SaveLoadLock loadLock = SaveLoadLock(SaveLoadLockType::LoadLock);
+	gameMode->OnLoadStart();
+	ArgusEntity::FlushAllEntities();
+	if (m_rewindSnapshots[snapshotIndex].Apply())
+	{
+		// Snapshots newer than the restored one belong to a timeline that no longer exists.
+		m_nextRewindSnapshotIndex = (snapshotIndex + 1) % k_maxRewindSnapshots;
+		m_numRewindSnapshots -= numSnapshotsBack;
+		m_framesSinceRewindSnapshot = 0u;
+	}
+	else
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] Could not rewind %d snapshots. Restoring the state from before the rewind."), ARGUS_FUNCNAME, numSnapshotsBack);
+		ArgusEntity::FlushAllEntities();
+		preRewindSnapshot.SerializeComponentTypeCopies();
+		if (!preRewindSnapshot.Apply())
+		{
+			ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] Could not restore the state from before the rewind."), ARGUS_FUNCNAME);
+		}
+	}
+
+	// The game mode tore down its actors in OnLoadStart, so it always has to be told that loading finished.
+	OnLoadComplete();
+}
+
+void UArgusSaveManager::TickRewindBuffer()
+{
+	ARGUS_TRACE(UArgusSaveManager::TickRewindBuffer);
+
+	if (IsLoading() || HasLoadRequest())
+	{
+		return;
+	}
+
+	m_framesSinceRewindSnapshot++;
+	if (m_framesSinceRewindSnapshot < k_framesPerRewindSnapshot)
+	{
+		return;
+	}
+	m_framesSinceRewindSnapshot = 0u;
+
+	if (m_rewindSnapshots.Num() != k_maxRewindSnapshots)
+	{
+		WaitForRewindSnapshotTasks();
+		m_rewindSnapshots.SetNum(k_maxRewindSnapshots);
+		m_rewindSnapshotTasks.SetNum(k_maxRewindSnapshots);
+	}
+
+	// Only the copy of the component arrays happens on the game thread. The entry is a whole ring buffer lap old, so its last task is long done.
+	m_rewindSnapshotTasks[m_nextRewindSnapshotIndex].Wait();
+	ArgusSaveSnapshot* snapshot = &m_rewindSnapshots[m_nextRewindSnapshotIndex];
+	snapshot->Capture();
+	m_rewindSnapshotTasks[m_nextRewindSnapshotIndex] = UE::Tasks::Launch(ARGUS_NAMEOF(ArgusSaveSnapshot::SerializeComponentTypeCopies), [snapshot]()
+	{
+		snapshot->SerializeComponentTypeCopies();
+	});
+	m_nextRewindSnapshotIndex = (m_nextRewindSnapshotIndex + 1) % k_maxRewindSnapshots;
+	m_numRewindSnapshots = FMath::Min(m_numRewindSnapshots + 1, k_maxRewindSnapshots);
+}
+
+void UArgusSaveManager::ClearRewindBuffer()
+{
+	WaitForRewindSnapshotTasks();
+	m_nextRewindSnapshotIndex = 0;
+	m_numRewindSnapshots = 0;
+	m_rewindRequest = INDEX_NONE;
+	m_framesSinceRewindSnapshot = 0u;
+}
+
+void UArgusSaveManager::WaitForRewindSnapshotTasks()
+{
+	for (UE::Tasks::FTask& rewindSnapshotTask : m_rewindSnapshotTasks)
+	{
+		rewindSnapshotTask.Wait();
+	}
+}
+
 void UArgusSaveManager::LoadInternal(const FString& saveSlotName, const TFunction<void(USaveGame*)>& completedDelegate)
 {
 	ARGUS_RETURN_ON_NULL(completedDelegate, ArgusPersistenceLog);
@@ -324,14 +516,14 @@ void UArgusSaveManager::OnMetadataLoaded(USaveGame* saveGame)
 	m_saveMetadata = metadataSaveGame;
 }
 
-void UArgusSaveManager::OnSaveComplete(const FString& saveSlotName, const SaveLoadLock& saveLock, bool didSucceed)
+void UArgusSaveManager::OnSaveComplete(const FString& saveSlotName, const FString& keyframeSlotName, const SaveLoadLock& saveLock, bool didSucceed)
 {
 	if (!didSucceed)
 	{
 		return;
 	}
 
-	SaveMetadata(saveSlotName, saveLock);
+	SaveMetadata(saveSlotName, keyframeSlotName, saveLock);
 }
 
 void UArgusSaveManager::SaveMetadata(const SaveLoadLock& saveLock)
@@ -345,9 +537,9 @@ void UArgusSaveManager::SaveMetadata(const SaveLoadLock& saveLock)
 	});
 }
 
-void UArgusSaveManager::SaveMetadata(const FString& mostRecentSaveSlotName, const SaveLoadLock& saveLock)
+void UArgusSaveManager::SaveMetadata(const FString& mostRecentSaveSlotName, const FString& keyframeSlotName, const SaveLoadLock& saveLock)
 {
-	PopulateMetadata(mostRecentSaveSlotName);
+	PopulateMetadata(mostRecentSaveSlotName, keyframeSlotName);
 	SaveMetadata(saveLock);
 }
 
@@ -360,19 +552,92 @@ void UArgusSaveManager::OnCheckIfSaveExistsForLoad(const FString& saveSlotName,
 		return;
 	}
 
-	LoadInternal(saveSlotName, [completedDelegate, loadLock](USaveGame* saveGame)
+	LoadInternal(saveSlotName, [saveSlotName, completedDelegate, loadLock](USaveGame* saveGame)
 	{
 		UArgusSaveGame* argusSaveGame = Cast<UArgusSaveGame>(saveGame);
 		ARGUS_RETURN_ON_NULL_INVOKE(argusSaveGame, ArgusPersistenceLog, completedDelegate, argusSaveGame);
 		
 		UArgusSaveManager* rawSaveManager = UArgusSaveManager::Get();
 		ARGUS_RETURN_ON_NULL_INVOKE(rawSaveManager, ArgusPersistenceLog, completedDelegate, nullptr);
-		rawSaveManager->OnLoadComplete();
-		
-		completedDelegate(argusSaveGame);
+		rawSaveManager->OnSaveGameLoaded(saveSlotName, argusSaveGame, completedDelegate, loadLock);
+	});
+}
+
+void UArgusSaveManager::OnSaveGameLoaded(const FString& saveSlotName, UArgusSaveGame* argusSaveGame, const TFunction<void(UArgusSaveGame*)>& completedDelegate, const SaveLoadLock& loadLock)
+{
+	ARGUS_RETURN_ON_NULL(completedDelegate, ArgusPersistenceLog);
+	ARGUS_RETURN_ON_NULL_INVOKE(argusSaveGame, ArgusPersistenceLog, completedDelegate, nullptr);
+
+	if (!argusSaveGame->IsFormatVersionSupported())
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] Cannot load %s. It was written with an unsupported save format version or bulk component layout."), ARGUS_FUNCNAME, *saveSlotName);
+		completedDelegate(nullptr);
+		return;
+	}
+
+	if (argusSaveGame->IsKeyframe())
+	{
+		OnKeyframeLoaded(saveSlotName, argusSaveGame, argusSaveGame, completedDelegate);
+		return;
+	}
+
+	// Deltas only store the entity slots that changed since their keyframe, so the keyframe has to be loaded first.
+	const FString keyframeSlotName = argusSaveGame->GetKeyframeSlotName();
+	LoadInternal(keyframeSlotName, [keyframeSlotName, deltaSaveGame = TStrongObjectPtr<UArgusSaveGame>(argusSaveGame), completedDelegate, loadLock](USaveGame* saveGame)
+	{
+		UArgusSaveGame* keyframeSaveGame = Cast<UArgusSaveGame>(saveGame);
+		ARGUS_RETURN_ON_NULL_INVOKE(keyframeSaveGame, ArgusPersistenceLog, completedDelegate, nullptr);
+
+		UArgusSaveManager* rawSaveManager = UArgusSaveManager::Get();
+		ARGUS_RETURN_ON_NULL_INVOKE(rawSaveManager, ArgusPersistenceLog, completedDelegate, nullptr);
+		rawSaveManager->OnKeyframeLoaded(keyframeSlotName, keyframeSaveGame, deltaSaveGame.Get(), completedDelegate);
 	});
 }
 
+void UArgusSaveManager::OnKeyframeLoaded(const FString& keyframeSlotName, const UArgusSaveGame* keyframeSaveGame, UArgusSaveGame* argusSaveGame, const TFunction<void(UArgusSaveGame*)>& completedDelegate)
+{
+	ARGUS_RETURN_ON_NULL(completedDelegate, ArgusPersistenceLog);
+	ARGUS_RETURN_ON_NULL_INVOKE(keyframeSaveGame, ArgusPersistenceLog, completedDelegate, nullptr);
+	ARGUS_RETURN_ON_NULL_INVOKE(argusSaveGame, ArgusPersistenceLog, completedDelegate, nullptr);
+
+	TSharedRef<ArgusSaveSnapshot, ESPMode::ThreadSafe> keyframeSnapshot = MakeShared<ArgusSaveSnapshot, ESPMode::ThreadSafe>();
+	if (!keyframeSaveGame->IsKeyframe() || !keyframeSaveGame->DecodeSnapshot(nullptr, *keyframeSnapshot))
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] Could not read keyframe %s."), ARGUS_FUNCNAME, *keyframeSlotName);
+		completedDelegate(nullptr);
+		return;
+	}
+
+	ArgusSaveSnapshot deltaSnapshot;
+	const ArgusSaveSnapshot* snapshot = &keyframeSnapshot.Get();
+	if (argusSaveGame != keyframeSaveGame)
+	{
+		if (!argusSaveGame->DecodeSnapshot(snapshot, deltaSnapshot))
+		{
+			ARGUS_LOG(ArgusPersistenceLog, Error, TEXT("[%s] Could not apply delta on top of keyframe %s."), ARGUS_FUNCNAME, *keyframeSlotName);
+			completedDelegate(nullptr);
+			return;
+		}
+		snapshot = &deltaSnapshot;
+	}
+
+	if (!snapshot->Apply())
+	{
+		completedDelegate(nullptr);
+		return;
+	}
+
+	ClearRewindBuffer();
+
+	// The loaded keyframe is still on disk, so following saves can keep writing deltas against it.
+	m_keyframeSnapshot = keyframeSnapshot;
+	m_keyframeSlotName = keyframeSlotName;
+	m_numDeltaSavesSinceKeyframe = 0u;
+
+	OnLoadComplete();
+	completedDelegate(argusSaveGame);
+}
+
 void UArgusSaveManager::OnCheckIfSaveExistsForDelete(const FString& saveSlotName, bool doesExist, const TFunction<void(const FString&, bool)>& completedDelegate, const SaveLoadLock& loadLock)
 {
 	ARGUS_RETURN_ON_NULL(completedDelegate, ArgusPersistenceLog);
@@ -383,11 +648,25 @@ void UArgusSaveManager::OnCheckIfSaveExistsForDelete(const FString& saveSlotName
 	}
 	ARGUS_RETURN_ON_NULL_INVOKE(m_saveMetadata, ArgusPersistenceLog, completedDelegate, saveSlotName, false);
 
+	// Deltas only store the entity slots that changed since their keyframe, so deleting the keyframe would leave them unloadable.
+	if (m_saveMetadata->HasDeltaSavesOfKeyframe(saveSlotName))
+	{
+		ARGUS_LOG(ArgusPersistenceLog, Warning, TEXT("[%s] Cannot delete %s while delta saves still depend on it. Delete its deltas first."), ARGUS_FUNCNAME, *saveSlotName);
+		completedDelegate(saveSlotName, false);
+		return;
+	}
+
 	m_saveMetadata->m_saveSlotMetadata.RemoveAll([&saveSlotName](const FSaveSlotMetadata& slotMetadata)
 	{
 		return slotMetadata.m_slotName.Equals(saveSlotName);
 	});
 
+	if (saveSlotName.Equals(m_keyframeSlotName))
+	{
+		m_keyframeSnapshot.Reset();
+		m_keyframeSlotName.Reset();
+	}
+
 	DeleteInternal(saveSlotName, [completedDelegate, loadLock](const FString& saveSlotName, bool didSucceed) 
 	{
 		completedDelegate(saveSlotName, didSucceed);
@@ -400,13 +679,25 @@ void UArgusSaveManager::OnCheckIfSaveExistsForDelete(const FString& saveSlotName
 	}
 }
 
-void UArgusSaveManager::PopulateMetadata(const FString& mostRecentSaveSlotName)
+void UArgusSaveManager::OnSnapshotWritten(const FString& saveSlotName, const TSharedRef<ArgusSaveSnapshot, ESPMode::ThreadSafe>& snapshot, bool isKeyframe)
+{
+	if (!isKeyframe)
+	{
+		m_numDeltaSavesSinceKeyframe++;
+		return;
+	}
+
+	m_keyframeSnapshot = snapshot;
+	m_keyframeSlotName = saveSlotName;
+	m_numDeltaSavesSinceKeyframe = 0u;
+}
+
+void UArgusSaveManager::PopulateMetadata(const FString& mostRecentSaveSlotName, const FString& keyframeSlotName)
 {
 	ARGUS_RETURN_ON_NULL(m_saveMetadata, ArgusPersistenceLog);
 
 	m_saveMetadata->m_lastSaveSlotNumber++;
-	FSaveSlotMetadata& slotMetadata = m_saveMetadata->m_saveSlotMetadata.Emplace_GetRef();
-	slotMetadata.m_slotName = mostRecentSaveSlotName;
+	FSaveSlotMetadata& slotMetadata = m_saveMetadata->AddSaveSlot(mostRecentSaveSlotName, keyframeSlotName);
 	slotMetadata.m_saveTimestamp = FDateTime::Now();
 }
 
@@ -3,7 +3,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "ArgusSaveGame.h"
 #include "Containers/Queue.h"
+#include "Tasks/Task.h"
 #include "ArgusSaveManager.generated.h"
 
 class AArgusGameModeBase;
@@ -27,6 +29,8 @@ public:
 	bool IsSaving() const { return m_saveLockReferenceCount > 0; }
 	bool IsLoading() const { return m_loadLockReferenceCount > 0; }
 	bool HasLoadRequest() const { return !m_loadRequest.Key.IsEmpty(); }
+	bool HasRewindRequest() const { return m_rewindRequest != INDEX_NONE; }
+	int32 GetNumRewindSnapshots() const { return m_numRewindSnapshots; }
 
 	void Initialize(AArgusGameModeBase* gameMode);
 	void Save(const TFunction<void(const FString&, bool)>& completedDelegate = nullptr);
@@ -34,6 +38,9 @@ public:
 	void LoadMostRecent(const TFunction<void(UArgusSaveGame*)>& completedDelegate);
 	void DeleteSaveGame(const FString& saveSlotName, const TFunction<void(const FString&, bool)>& completedDelegate = nullptr);
 
+	// Restores the in memory snapshot taken numSnapshotsBack snapshots ago, where 0 is the most recent one. Nothing is read from disk.
+	void Rewind(int32 numSnapshotsBack);
+
 #if !UE_BUILD_SHIPPING
 	void DrawDebugger();
 #endif //!UE_BUILD_SHIPPING
@@ -65,10 +72,19 @@ private:
 	static UArgusSaveManager* k_instance;
 	static const FString k_metadataSaveSlotName;
 	static const FString k_saveSlotPrefix;
+	static const uint8 k_deltaSavesPerKeyframe;
+	static const uint16 k_framesPerRewindSnapshot;
+	static const int32 k_maxRewindSnapshots;
 
 	void DoesSaveExistInternal(const FString& saveSlotName, const TFunction<void(const FString&, bool)>& completedDelegate);
 	void SaveInternal(const FString& saveSlotName, USaveGame* saveGame, const TFunction<void(bool)>& completedDelegate);
+	void OnSnapshotEncoded(const TSharedRef<ArgusSaveSnapshot, ESPMode::ThreadSafe>& snapshot, bool didEncode);
+	void OnSnapshotWritten(const FString& saveSlotName, const TSharedRef<ArgusSaveSnapshot, ESPMode::ThreadSafe>& snapshot, bool isKeyframe);
 	void ExecuteLoadRequest();
+	void ExecuteRewindRequest();
+	void TickRewindBuffer();
+	void ClearRewindBuffer();
+	void WaitForRewindSnapshotTasks();
 	void LoadInternal(const FString& saveSlotName, const TFunction<void(USaveGame*)>& completedDelegate);
 	void OnLoadComplete() const;
 	void DeleteInternal(const FString& saveSlotName, const TFunction<void(const FString&, bool)>& completedDelegate);
@@ -76,14 +92,16 @@ private:
 	void OnCheckIfMetadataExists(bool doesExist);
 	void OnMetadataLoaded(USaveGame* saveGame);
 
-	void OnSaveComplete(const FString& saveSlotName, const SaveLoadLock& SaveLoadLock, bool didSucceed);
+	void OnSaveComplete(const FString& saveSlotName, const FString& keyframeSlotName, const SaveLoadLock& SaveLoadLock, bool didSucceed);
 	void SaveMetadata(const SaveLoadLock& SaveLoadLock);
-	void SaveMetadata(const FString& mostRecentSaveSlotName, const SaveLoadLock& SaveLoadLock);
+	void SaveMetadata(const FString& mostRecentSaveSlotName, const FString& keyframeSlotName, const SaveLoadLock& SaveLoadLock);
 
 	void OnCheckIfSaveExistsForLoad(const FString& saveSlotName, bool doesExist, const TFunction<void(UArgusSaveGame*)>& completedDelegate, const SaveLoadLock& loadLock);
+	void OnSaveGameLoaded(const FString& saveSlotName, UArgusSaveGame* argusSaveGame, const TFunction<void(UArgusSaveGame*)>& completedDelegate, const SaveLoadLock& loadLock);
+	void OnKeyframeLoaded(const FString& keyframeSlotName, const UArgusSaveGame* keyframeSaveGame, UArgusSaveGame* argusSaveGame, const TFunction<void(UArgusSaveGame*)>& completedDelegate);
 	void OnCheckIfSaveExistsForDelete(const FString& saveSlotName, bool doesExist, const TFunction<void(const FString&, bool)>& completedDelegate, const SaveLoadLock& loadLock);
 
-	void PopulateMetadata(const FString& mostRecentSaveSlotName);
+	void PopulateMetadata(const FString& mostRecentSaveSlotName, const FString& keyframeSlotName);
 
 	FString GetNextSaveSlotName() const;
 
@@ -93,8 +111,31 @@ private:
 	UPROPERTY(Transient)
 	TWeakObjectPtr<AArgusGameModeBase> m_gameMode = nullptr;
 
+	// Save game whose ECS snapshot is being encoded on a background task.
+	UPROPERTY(Transient)
+	TObjectPtr<UArgusSaveGame> m_pendingSaveGame = nullptr;
+
 	TQueue<TFunction<void(const FString&, bool)>> m_saveRequestQueue;
 	TPair<FString, TFunction<void(UArgusSaveGame*)>> m_loadRequest;
+	TFunction<void(const FString&, bool)> m_pendingSaveDelegate;
+	FString m_pendingSaveSlotName;
+	FString m_pendingKeyframeSlotName;
+	TOptional<SaveLoadLock> m_pendingSaveLock;
+
+	// Uncompressed copy of the most recent keyframe that deltas are diffed against.
+	TSharedPtr<const ArgusSaveSnapshot, ESPMode::ThreadSafe> m_keyframeSnapshot;
+	FString m_keyframeSlotName;
+	uint8 m_numDeltaSavesSinceKeyframe = 0u;
+
+	// Ring buffer of uncompressed snapshots. Entries are reused so their chunk allocations carry over between captures.
+	TArray<ArgusSaveSnapshot> m_rewindSnapshots;
+
+	// Per entry of m_rewindSnapshots, the background task serializing the component types its capture only copied.
+	TArray<UE::Tasks::FTask> m_rewindSnapshotTasks;
+	int32 m_nextRewindSnapshotIndex = 0;
+	int32 m_numRewindSnapshots = 0;
+	int32 m_rewindRequest = INDEX_NONE;
+	uint16 m_framesSinceRewindSnapshot = 0u;
 
 	FOnLoadComplete m_loadCompleted;
 
@@ -104,10 +145,12 @@ private:
 
 #if !UE_BUILD_SHIPPING
 	int16 m_debugSelectedIndex = -1;
+	int32 m_debugRewindSnapshotsBack = 0;
 #endif //!UE_BUILD_SHIPPING
 
 	friend class AArgusGameModeBase;
 	friend class AFogOfWarActor;
+	friend class UArgusReplayManager;
 	friend class AArgusDirectionalLight;
 	friend class UArgusUIBlueprintLibrary;
 };
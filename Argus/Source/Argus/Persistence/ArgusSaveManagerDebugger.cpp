@@ -45,6 +45,7 @@ void UArgusSaveManager::DrawDebugger()
 	ImGui::Checkbox("Is Saving?", &isSaving);
 	ImGui::SameLine();
 	ImGui::Checkbox("Is Loading?", &isLoading);
+	ImGui::Text("Keyframe: %s (%d deltas since)", m_keyframeSlotName.IsEmpty() ? "None" : ARGUS_FSTRING_TO_CHAR(m_keyframeSlotName), m_numDeltaSavesSinceKeyframe);
 
 	ImGui::NewLine();
 
@@ -89,6 +90,14 @@ void UArgusSaveManager::DrawDebugger()
 		}
 	}
 
+	ImGui::Text("Rewind snapshots: %d", m_numRewindSnapshots);
+	ImGui::SameLine();
+	if (ImGui::Button("Rewind") && m_numRewindSnapshots > 0)
+	{
+		Rewind(FMath::Clamp(m_debugRewindSnapshotsBack, 0, m_numRewindSnapshots - 1));
+	}
+	ImGui::SliderInt("Snapshots back", &m_debugRewindSnapshotsBack, 0, FMath::Max(m_numRewindSnapshots - 1, 0));
+
 	if (ImGui::BeginTable("CurrentSaveTable", 3, ImGuiTableFlags_NoSavedSettings | ImGuiTableFlags_SizingStretchProp | ImGuiTableFlags_BordersOuter))
 	{
 		ImGui::TableSetupColumn("Slot Name");
@@ -2,9 +2,6 @@
 // AUTOGENERATED FILE
 
 #include "ArgusStaticData.h"
-
-#if WITH_EDITOR
-#include "Engine/AssetManager.h"
 #include "RecordDatabases/AbilityRecordDatabase.h"
 #include "RecordDatabases/ArgusActorRecordDatabase.h"
 #include "RecordDatabases/FactionRecordDatabase.h"
@@ -13,6 +10,97 @@
 #include "RecordDatabases/ResourceSetRecordDatabase.h"
 #include "RecordDatabases/TeamAlignmentRecordDatabase.h"
 #include "RecordDatabases/TeamColorRecordDatabase.h"
+
+bool ArgusStaticData::AsyncPreLoadRecordOfClass(const UClass* recordClass, uint32 id, TFunction<void(const UArgusStaticRecord*)> callback)
+{
+	ARGUS_RETURN_ON_NULL_BOOL(recordClass, ArgusStaticDataLog);
+
+	if (recordClass->IsChildOf(UAbilityRecord::StaticClass()))
+	{
+		return AsyncPreLoadRecord<UAbilityRecord>(id, [callback](const UAbilityRecord* record)
+		{
+			if (callback)
+			{
+				callback(record);
+			}
+		});
+	}
+	if (recordClass->IsChildOf(UArgusActorRecord::StaticClass()))
+	{
+		return AsyncPreLoadRecord<UArgusActorRecord>(id, [callback](const UArgusActorRecord* record)
+		{
+			if (callback)
+			{
+				callback(record);
+			}
+		});
+	}
+	if (recordClass->IsChildOf(UFactionRecord::StaticClass()))
+	{
+		return AsyncPreLoadRecord<UFactionRecord>(id, [callback](const UFactionRecord* record)
+		{
+			if (callback)
+			{
+				callback(record);
+			}
+		});
+	}
+	if (recordClass->IsChildOf(UMaterialRecord::StaticClass()))
+	{
+		return AsyncPreLoadRecord<UMaterialRecord>(id, [callback](const UMaterialRecord* record)
+		{
+			if (callback)
+			{
+				callback(record);
+			}
+		});
+	}
+	if (recordClass->IsChildOf(UPlacedArgusActorTeamInfoRecord::StaticClass()))
+	{
+		return AsyncPreLoadRecord<UPlacedArgusActorTeamInfoRecord>(id, [callback](const UPlacedArgusActorTeamInfoRecord* record)
+		{
+			if (callback)
+			{
+				callback(record);
+			}
+		});
+	}
+	if (recordClass->IsChildOf(UResourceSetRecord::StaticClass()))
+	{
+		return AsyncPreLoadRecord<UResourceSetRecord>(id, [callback](const UResourceSetRecord* record)
+		{
+			if (callback)
+			{
+				callback(record);
+			}
+		});
+	}
+	if (recordClass->IsChildOf(UTeamAlignmentRecord::StaticClass()))
+	{
+		return AsyncPreLoadRecord<UTeamAlignmentRecord>(id, [callback](const UTeamAlignmentRecord* record)
+		{
+			if (callback)
+			{
+				callback(record);
+			}
+		});
+	}
+	if (recordClass->IsChildOf(UTeamColorRecord::StaticClass()))
+	{
+		return AsyncPreLoadRecord<UTeamColorRecord>(id, [callback](const UTeamColorRecord* record)
+		{
+			if (callback)
+			{
+				callback(record);
+			}
+		});
+	}
+
+	return false;
+}
+
+#if WITH_EDITOR
+#include "Engine/AssetManager.h"
  
 uint32 ArgusStaticData::AddRecordToDatabase(UArgusStaticRecord* record)
 {
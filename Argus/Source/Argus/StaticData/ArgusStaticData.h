@@ -31,6 +31,14 @@ public:
 		return false;
 	}
 
+	template<typename ArgusStaticRecord>
+	static uint32 GetNumRecords()
+	{
+		return 0u;
+	}
+
+	static bool AsyncPreLoadRecordOfClass(const UClass* recordClass, uint32 id, TFunction<void(const UArgusStaticRecord*)> callback = nullptr);
+
 #if WITH_EDITOR
 	template<typename ArgusStaticRecord>
 	static void IterateAllRecordsOfType(const TFunctionRef<void(ArgusStaticRecord*)>& function)
@@ -57,6 +65,14 @@ public:
 		return staticDatabase->AsyncPreLoadUAbilityRecord(id, callback);
 	}
 
+	template<>
+	inline uint32 GetNumRecords<UAbilityRecord>()
+	{
+		UArgusStaticDatabase* staticDatabase = UArgusStaticDatabase::GetInstance();
+		ARGUS_RETURN_ON_NULL_VALUE(staticDatabase, ArgusStaticDataLog, 0u);
+		return staticDatabase->GetNumUAbilityRecords();
+	}
+
 #if WITH_EDITOR
 	template<>
 	ARGUS_API inline void IterateAllRecordsOfType<UAbilityRecord>(const TFunctionRef<void(UAbilityRecord*)>& function)
@@ -93,6 +109,14 @@ public:
 		return staticDatabase->AsyncPreLoadUArgusActorRecord(id, callback);
 	}
 
+	template<>
+	inline uint32 GetNumRecords<UArgusActorRecord>()
+	{
+		UArgusStaticDatabase* staticDatabase = UArgusStaticDatabase::GetInstance();
+		ARGUS_RETURN_ON_NULL_VALUE(staticDatabase, ArgusStaticDataLog, 0u);
+		return staticDatabase->GetNumUArgusActorRecords();
+	}
+
 #if WITH_EDITOR
 	template<>
 	ARGUS_API inline void IterateAllRecordsOfType<UArgusActorRecord>(const TFunctionRef<void(UArgusActorRecord*)>& function)
@@ -129,6 +153,14 @@ public:
 		return staticDatabase->AsyncPreLoadUFactionRecord(id, callback);
 	}
 
+	template<>
+	inline uint32 GetNumRecords<UFactionRecord>()
+	{
+		UArgusStaticDatabase* staticDatabase = UArgusStaticDatabase::GetInstance();
+		ARGUS_RETURN_ON_NULL_VALUE(staticDatabase, ArgusStaticDataLog, 0u);
+		return staticDatabase->GetNumUFactionRecords();
+	}
+
 #if WITH_EDITOR
 	template<>
 	ARGUS_API inline void IterateAllRecordsOfType<UFactionRecord>(const TFunctionRef<void(UFactionRecord*)>& function)
@@ -165,6 +197,14 @@ public:
 		return staticDatabase->AsyncPreLoadUMaterialRecord(id, callback);
 	}
 
+	template<>
+	inline uint32 GetNumRecords<UMaterialRecord>()
+	{
+		UArgusStaticDatabase* staticDatabase = UArgusStaticDatabase::GetInstance();
+		ARGUS_RETURN_ON_NULL_VALUE(staticDatabase, ArgusStaticDataLog, 0u);
+		return staticDatabase->GetNumUMaterialRecords();
+	}
+
 #if WITH_EDITOR
 	template<>
 	ARGUS_API inline void IterateAllRecordsOfType<UMaterialRecord>(const TFunctionRef<void(UMaterialRecord*)>& function)
@@ -201,6 +241,14 @@ public:
 		return staticDatabase->AsyncPreLoadUPlacedArgusActorTeamInfoRecord(id, callback);
 	}
 
+	template<>
+	inline uint32 GetNumRecords<UPlacedArgusActorTeamInfoRecord>()
+	{
+		UArgusStaticDatabase* staticDatabase = UArgusStaticDatabase::GetInstance();
+		ARGUS_RETURN_ON_NULL_VALUE(staticDatabase, ArgusStaticDataLog, 0u);
+		return staticDatabase->GetNumUPlacedArgusActorTeamInfoRecords();
+	}
+
 #if WITH_EDITOR
 	template<>
 	ARGUS_API inline void IterateAllRecordsOfType<UPlacedArgusActorTeamInfoRecord>(const TFunctionRef<void(UPlacedArgusActorTeamInfoRecord*)>& function)
@@ -237,6 +285,14 @@ public:
 		return staticDatabase->AsyncPreLoadUResourceSetRecord(id, callback);
 	}
 
+	template<>
+	inline uint32 GetNumRecords<UResourceSetRecord>()
+	{
+		UArgusStaticDatabase* staticDatabase = UArgusStaticDatabase::GetInstance();
+		ARGUS_RETURN_ON_NULL_VALUE(staticDatabase, ArgusStaticDataLog, 0u);
+		return staticDatabase->GetNumUResourceSetRecords();
+	}
+
 #if WITH_EDITOR
 	template<>
 	ARGUS_API inline void IterateAllRecordsOfType<UResourceSetRecord>(const TFunctionRef<void(UResourceSetRecord*)>& function)
@@ -273,6 +329,14 @@ public:
 		return staticDatabase->AsyncPreLoadUTeamAlignmentRecord(id, callback);
 	}
 
+	template<>
+	inline uint32 GetNumRecords<UTeamAlignmentRecord>()
+	{
+		UArgusStaticDatabase* staticDatabase = UArgusStaticDatabase::GetInstance();
+		ARGUS_RETURN_ON_NULL_VALUE(staticDatabase, ArgusStaticDataLog, 0u);
+		return staticDatabase->GetNumUTeamAlignmentRecords();
+	}
+
 #if WITH_EDITOR
 	template<>
 	ARGUS_API inline void IterateAllRecordsOfType<UTeamAlignmentRecord>(const TFunctionRef<void(UTeamAlignmentRecord*)>& function)
@@ -309,6 +373,14 @@ public:
 		return staticDatabase->AsyncPreLoadUTeamColorRecord(id, callback);
 	}
 
+	template<>
+	inline uint32 GetNumRecords<UTeamColorRecord>()
+	{
+		UArgusStaticDatabase* staticDatabase = UArgusStaticDatabase::GetInstance();
+		ARGUS_RETURN_ON_NULL_VALUE(staticDatabase, ArgusStaticDataLog, 0u);
+		return staticDatabase->GetNumUTeamColorRecords();
+	}
+
 #if WITH_EDITOR
 	template<>
 	ARGUS_API inline void IterateAllRecordsOfType<UTeamColorRecord>(const TFunctionRef<void(UTeamColorRecord*)>& function)
@@ -0,0 +1,290 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusStaticDataPreloader.h"
+#include "ArgusEntity.h"
+#include "ArgusEntityTemplate.h"
+#include "ArgusLogging.h"
+#include "ArgusMacros.h"
+#include "ArgusStaticData.h"
+#include "ArgusStaticRecord.h"
+#include "ArgusStaticRecordReference.h"
+#include "DataComponentDefinitions/ComponentData.h"
+#include "SoftPtrLoadStore.h"
+
+TSet<const UObject*> ArgusStaticDataPreloader::s_visitedObjects;
+TSet<TPair<const UClass*, uint32>> ArgusStaticDataPreloader::s_requestedRecords;
+TArray<const UArgusStaticRecord*> ArgusStaticDataPreloader::s_preLoadedRecords;
+TFunction<void()> ArgusStaticDataPreloader::s_onCompleteCallback = nullptr;
+int32 ArgusStaticDataPreloader::s_numPendingLoads = 0;
+bool ArgusStaticDataPreloader::s_areSynchronousRecordLoadsDisallowed = false;
+
+void ArgusStaticDataPreloader::PreLoadReferencedRecords(const TArray<const UObject*>& rootObjects, TFunction<void()> onCompleteCallback)
+{
+	ARGUS_TRACE(ArgusStaticDataPreloader::PreLoadReferencedRecords);
+
+	s_visitedObjects.Reset();
+	s_requestedRecords.Reset();
+	s_preLoadedRecords.Reset();
+	s_onCompleteCallback = onCompleteCallback;
+	s_numPendingLoads = 0;
+
+	if (!ArgusEntity::GetSingletonEntity().GetComponent<AssetLoadingComponent>())
+	{
+		ARGUS_LOG(ArgusStaticDataLog, Error, TEXT("[%s] Cannot preload static data without an %s on the singleton entity."), ARGUS_FUNCNAME, ARGUS_NAMEOF(AssetLoadingComponent));
+		BeginPendingLoad();
+		CompletePendingLoad();
+		return;
+	}
+
+	// Hold a pending load open while walking the roots so that loads which complete immediately can't finish the preload early.
+	BeginPendingLoad();
+	for (int32 i = 0; i < rootObjects.Num(); ++i)
+	{
+		const UObject* rootObject = rootObjects[i];
+		if (!rootObject || s_visitedObjects.Contains(rootObject))
+		{
+			continue;
+		}
+
+		s_visitedObjects.Add(rootObject);
+		PreLoadReferencesInStruct(rootObject->GetClass(), rootObject);
+	}
+	CompletePendingLoad();
+}
+
+void ArgusStaticDataPreloader::PreLoadReferencesInObject(const UObject* object)
+{
+	if (!object || s_visitedObjects.Contains(object))
+	{
+		return;
+	}
+
+	if (const UArgusStaticRecord* record = Cast<UArgusStaticRecord>(object))
+	{
+		// Records are walked once they are registered with their database.
+		PreLoadRecord(record->GetClass(), record->m_id);
+		return;
+	}
+
+	if (const UArgusEntityTemplate* entityTemplate = Cast<UArgusEntityTemplate>(object))
+	{
+		PreLoadEntityTemplate(entityTemplate);
+		return;
+	}
+
+	if (object->IsA<UComponentData>())
+	{
+		s_visitedObjects.Add(object);
+		PreLoadReferencesInStruct(object->GetClass(), object);
+	}
+}
+
+void ArgusStaticDataPreloader::PreLoadReferencesInStruct(const UStruct* structType, const void* structData)
+{
+	if (!structType || !structData)
+	{
+		return;
+	}
+
+	for (TFieldIterator<FProperty> propertyIterator(structType); propertyIterator; ++propertyIterator)
+	{
+		const FProperty* property = *propertyIterator;
+		for (int32 i = 0; i < property->ArrayDim; ++i)
+		{
+			PreLoadReferencesInProperty(property, property->ContainerPtrToValuePtr<void>(structData, i));
+		}
+	}
+}
+
+void ArgusStaticDataPreloader::PreLoadReferencesInProperty(const FProperty* property, const void* propertyData)
+{
+	if (!property || !propertyData)
+	{
+		return;
+	}
+
+	if (const FStructProperty* structProperty = CastField<FStructProperty>(property))
+	{
+		if (!structProperty->Struct)
+		{
+			return;
+		}
+
+		if (structProperty->Struct->IsChildOf(TBaseStructure<FArgusStaticRecordReference>::Get()))
+		{
+			const FArgusStaticRecordReference* recordReference = reinterpret_cast<const FArgusStaticRecordReference*>(propertyData);
+			PreLoadRecord(recordReference->GetRecordClass(), recordReference->GetId());
+			return;
+		}
+
+		if (structProperty->Struct->IsChildOf(TBaseStructure<FSoftObjectLoadStore_UArgusEntityTemplate>::Get()))
+		{
+			const FSoftObjectLoadStore_UArgusEntityTemplate* entityTemplateLoadStore = reinterpret_cast<const FSoftObjectLoadStore_UArgusEntityTemplate*>(propertyData);
+			BeginPendingLoad();
+			const bool requested = entityTemplateLoadStore->AsyncPreLoadAndStorePtr([](UArgusEntityTemplate* entityTemplate)
+			{
+				PreLoadEntityTemplate(entityTemplate);
+				CompletePendingLoad();
+			});
+
+			if (!requested)
+			{
+				CompletePendingLoad();
+			}
+			return;
+		}
+
+		PreLoadReferencesInStruct(structProperty->Struct, propertyData);
+		return;
+	}
+
+	if (const FArrayProperty* arrayProperty = CastField<FArrayProperty>(property))
+	{
+		FScriptArrayHelper arrayHelper = FScriptArrayHelper(arrayProperty, propertyData);
+		for (int32 i = 0; i < arrayHelper.Num(); ++i)
+		{
+			PreLoadReferencesInProperty(arrayProperty->Inner, arrayHelper.GetRawPtr(i));
+		}
+		return;
+	}
+
+	if (const FMapProperty* mapProperty = CastField<FMapProperty>(property))
+	{
+		FScriptMapHelper mapHelper = FScriptMapHelper(mapProperty, propertyData);
+		for (FScriptMapHelper::FIterator mapIterator(mapHelper); mapIterator; ++mapIterator)
+		{
+			PreLoadReferencesInProperty(mapProperty->ValueProp, mapHelper.GetValuePtr(mapIterator));
+		}
+		return;
+	}
+
+	if (const FSoftObjectProperty* softObjectProperty = CastField<FSoftObjectProperty>(property))
+	{
+		if (softObjectProperty->PropertyClass && softObjectProperty->PropertyClass->IsChildOf(UArgusStaticRecord::StaticClass()))
+		{
+			PreLoadSoftRecord(softObjectProperty->GetPropertyValue(propertyData).ToSoftObjectPath());
+		}
+		return;
+	}
+
+	if (const FObjectPropertyBase* objectProperty = CastField<FObjectPropertyBase>(property))
+	{
+		PreLoadReferencesInObject(objectProperty->GetObjectPropertyValue(propertyData));
+	}
+}
+
+void ArgusStaticDataPreloader::PreLoadRecord(const UClass* recordClass, uint32 id)
+{
+	if (!recordClass || id == 0u)
+	{
+		return;
+	}
+
+	const TPair<const UClass*, uint32> recordKey = TPair<const UClass*, uint32>(recordClass, id);
+	if (s_requestedRecords.Contains(recordKey))
+	{
+		return;
+	}
+	s_requestedRecords.Add(recordKey);
+
+	BeginPendingLoad();
+	const bool requested = ArgusStaticData::AsyncPreLoadRecordOfClass(recordClass, id, [](const UArgusStaticRecord* record)
+	{
+		OnRecordPreLoaded(record);
+		CompletePendingLoad();
+	});
+
+	if (!requested)
+	{
+		CompletePendingLoad();
+	}
+}
+
+void ArgusStaticDataPreloader::PreLoadSoftRecord(const FSoftObjectPath& recordPath)
+{
+	if (recordPath.IsNull())
+	{
+		return;
+	}
+
+	if (const UArgusStaticRecord* record = Cast<UArgusStaticRecord>(recordPath.ResolveObject()))
+	{
+		PreLoadRecord(record->GetClass(), record->m_id);
+		return;
+	}
+
+	AssetLoadingComponent* assetLoadingComponent = ArgusEntity::GetSingletonEntity().GetComponent<AssetLoadingComponent>();
+	ARGUS_RETURN_ON_NULL(assetLoadingComponent, ArgusStaticDataLog);
+
+	BeginPendingLoad();
+	assetLoadingComponent->m_streamableManager.RequestAsyncLoad(recordPath, FStreamableDelegate::CreateLambda
+	(
+		[recordPath]()
+		{
+			if (const UArgusStaticRecord* record = Cast<UArgusStaticRecord>(recordPath.ResolveObject()))
+			{
+				PreLoadRecord(record->GetClass(), record->m_id);
+			}
+			CompletePendingLoad();
+		})
+	);
+}
+
+void ArgusStaticDataPreloader::PreLoadEntityTemplate(const UArgusEntityTemplate* entityTemplate)
+{
+	if (!entityTemplate || s_visitedObjects.Contains(entityTemplate))
+	{
+		return;
+	}
+	s_visitedObjects.Add(entityTemplate);
+
+	// Walking the template after its components are cached reaches the loaded component data and, through it, every referenced record.
+	BeginPendingLoad();
+	entityTemplate->AsyncLoadComponents([entityTemplate]()
+	{
+		PreLoadReferencesInStruct(entityTemplate->GetClass(), entityTemplate);
+		CompletePendingLoad();
+	});
+}
+
+void ArgusStaticDataPreloader::OnRecordPreLoaded(const UArgusStaticRecord* record)
+{
+	if (!record || s_visitedObjects.Contains(record))
+	{
+		return;
+	}
+
+	s_visitedObjects.Add(record);
+	s_preLoadedRecords.Add(record);
+	PreLoadReferencesInStruct(record->GetClass(), record);
+}
+
+void ArgusStaticDataPreloader::BeginPendingLoad()
+{
+	s_numPendingLoads++;
+}
+
+void ArgusStaticDataPreloader::CompletePendingLoad()
+{
+	s_numPendingLoads--;
+	if (s_numPendingLoads > 0)
+	{
+		return;
+	}
+
+	s_numPendingLoads = 0;
+	ARGUS_LOG(ArgusStaticDataLog, Display, TEXT("[%s] Finished preloading %d static records."), ARGUS_FUNCNAME, s_requestedRecords.Num());
+
+	s_visitedObjects.Reset();
+	s_requestedRecords.Reset();
+
+	TFunction<void()> onCompleteCallback = MoveTemp(s_onCompleteCallback);
+	s_onCompleteCallback = nullptr;
+	if (onCompleteCallback)
+	{
+		onCompleteCallback();
+	}
+
+	// The preloaded records are only handed out to the completion callback, since a later flush can unload them.
+	s_preLoadedRecords.Reset();
+}
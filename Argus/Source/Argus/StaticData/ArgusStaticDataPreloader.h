@@ -0,0 +1,39 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UArgusEntityTemplate;
+class UArgusStaticRecord;
+
+// Builds the preload manifest for a map by walking every record, entity template and component data reachable from a set of root objects,
+// and async loads all of it in bulk so that static record lookups during gameplay never have to fall back to LoadSynchronous.
+class ArgusStaticDataPreloader
+{
+public:
+	static void PreLoadReferencedRecords(const TArray<const UObject*>& rootObjects, TFunction<void()> onCompleteCallback);
+	static bool IsPreLoading() { return s_numPendingLoads > 0; }
+	static const TArray<const UArgusStaticRecord*>& GetPreLoadedRecords() { return s_preLoadedRecords; }
+
+	static void SetSynchronousRecordLoadsDisallowed(bool disallowed) { s_areSynchronousRecordLoadsDisallowed = disallowed; }
+	static bool AreSynchronousRecordLoadsDisallowed() { return s_areSynchronousRecordLoadsDisallowed; }
+
+private:
+	static void PreLoadReferencesInObject(const UObject* object);
+	static void PreLoadReferencesInStruct(const UStruct* structType, const void* structData);
+	static void PreLoadReferencesInProperty(const FProperty* property, const void* propertyData);
+	static void PreLoadRecord(const UClass* recordClass, uint32 id);
+	static void PreLoadSoftRecord(const FSoftObjectPath& recordPath);
+	static void PreLoadEntityTemplate(const UArgusEntityTemplate* entityTemplate);
+	static void OnRecordPreLoaded(const UArgusStaticRecord* record);
+	static void BeginPendingLoad();
+	static void CompletePendingLoad();
+
+	static TSet<const UObject*> s_visitedObjects;
+	static TSet<TPair<const UClass*, uint32>> s_requestedRecords;
+	static TArray<const UArgusStaticRecord*> s_preLoadedRecords;
+	static TFunction<void()> s_onCompleteCallback;
+	static int32 s_numPendingLoads;
+	static bool s_areSynchronousRecordLoadsDisallowed;
+};
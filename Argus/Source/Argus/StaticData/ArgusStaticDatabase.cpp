@@ -60,7 +60,7 @@ const bool UArgusStaticDatabase::AsyncPreLoadUAbilityRecord(uint32 id, TFunction
 		return false;
 	}
 
-	return m_UAbilityRecordDatabasePersistent->AsyncPreLoadRecord(id);
+	return m_UAbilityRecordDatabasePersistent->AsyncPreLoadRecord(id, callback);
 }
 
 void UArgusStaticDatabase::ResetLoadedUAbilityRecordPointerArray()
@@ -73,6 +73,18 @@ void UArgusStaticDatabase::ResetLoadedUAbilityRecordPointerArray()
 	m_UAbilityRecordDatabasePersistent->ResetPersistentObjectPointerArray();
 }
 
+uint32 UArgusStaticDatabase::GetNumUAbilityRecords()
+{
+	LazyLoadUAbilityRecordDatabase();
+
+	if (!m_UAbilityRecordDatabasePersistent)
+	{
+		return 0u;
+	}
+
+	return m_UAbilityRecordDatabasePersistent->GetNumRecords();
+}
+
 #if WITH_EDITOR
 uint32 UArgusStaticDatabase::AddUAbilityRecordToDatabase(UAbilityRecord* record)
 {
@@ -179,7 +191,7 @@ const bool UArgusStaticDatabase::AsyncPreLoadUArgusActorRecord(uint32 id, TFunct
 		return false;
 	}
 
-	return m_UArgusActorRecordDatabasePersistent->AsyncPreLoadRecord(id);
+	return m_UArgusActorRecordDatabasePersistent->AsyncPreLoadRecord(id, callback);
 }
 
 void UArgusStaticDatabase::ResetLoadedUArgusActorRecordPointerArray()
@@ -192,6 +204,18 @@ void UArgusStaticDatabase::ResetLoadedUArgusActorRecordPointerArray()
 	m_UArgusActorRecordDatabasePersistent->ResetPersistentObjectPointerArray();
 }
 
+uint32 UArgusStaticDatabase::GetNumUArgusActorRecords()
+{
+	LazyLoadUArgusActorRecordDatabase();
+
+	if (!m_UArgusActorRecordDatabasePersistent)
+	{
+		return 0u;
+	}
+
+	return m_UArgusActorRecordDatabasePersistent->GetNumRecords();
+}
+
 #if WITH_EDITOR
 uint32 UArgusStaticDatabase::AddUArgusActorRecordToDatabase(UArgusActorRecord* record)
 {
@@ -298,7 +322,7 @@ const bool UArgusStaticDatabase::AsyncPreLoadUFactionRecord(uint32 id, TFunction
 		return false;
 	}
 
-	return m_UFactionRecordDatabasePersistent->AsyncPreLoadRecord(id);
+	return m_UFactionRecordDatabasePersistent->AsyncPreLoadRecord(id, callback);
 }
 
 void UArgusStaticDatabase::ResetLoadedUFactionRecordPointerArray()
@@ -311,6 +335,18 @@ void UArgusStaticDatabase::ResetLoadedUFactionRecordPointerArray()
 	m_UFactionRecordDatabasePersistent->ResetPersistentObjectPointerArray();
 }
 
+uint32 UArgusStaticDatabase::GetNumUFactionRecords()
+{
+	LazyLoadUFactionRecordDatabase();
+
+	if (!m_UFactionRecordDatabasePersistent)
+	{
+		return 0u;
+	}
+
+	return m_UFactionRecordDatabasePersistent->GetNumRecords();
+}
+
 #if WITH_EDITOR
 uint32 UArgusStaticDatabase::AddUFactionRecordToDatabase(UFactionRecord* record)
 {
@@ -417,7 +453,7 @@ const bool UArgusStaticDatabase::AsyncPreLoadUMaterialRecord(uint32 id, TFunctio
 		return false;
 	}
 
-	return m_UMaterialRecordDatabasePersistent->AsyncPreLoadRecord(id);
+	return m_UMaterialRecordDatabasePersistent->AsyncPreLoadRecord(id, callback);
 }
 
 void UArgusStaticDatabase::ResetLoadedUMaterialRecordPointerArray()
@@ -430,6 +466,18 @@ void UArgusStaticDatabase::ResetLoadedUMaterialRecordPointerArray()
 	m_UMaterialRecordDatabasePersistent->ResetPersistentObjectPointerArray();
 }
 
+uint32 UArgusStaticDatabase::GetNumUMaterialRecords()
+{
+	LazyLoadUMaterialRecordDatabase();
+
+	if (!m_UMaterialRecordDatabasePersistent)
+	{
+		return 0u;
+	}
+
+	return m_UMaterialRecordDatabasePersistent->GetNumRecords();
+}
+
 #if WITH_EDITOR
 uint32 UArgusStaticDatabase::AddUMaterialRecordToDatabase(UMaterialRecord* record)
 {
@@ -536,7 +584,7 @@ const bool UArgusStaticDatabase::AsyncPreLoadUPlacedArgusActorTeamInfoRecord(uin
 		return false;
 	}
 
-	return m_UPlacedArgusActorTeamInfoRecordDatabasePersistent->AsyncPreLoadRecord(id);
+	return m_UPlacedArgusActorTeamInfoRecordDatabasePersistent->AsyncPreLoadRecord(id, callback);
 }
 
 void UArgusStaticDatabase::ResetLoadedUPlacedArgusActorTeamInfoRecordPointerArray()
@@ -549,6 +597,18 @@ void UArgusStaticDatabase::ResetLoadedUPlacedArgusActorTeamInfoRecordPointerArra
 	m_UPlacedArgusActorTeamInfoRecordDatabasePersistent->ResetPersistentObjectPointerArray();
 }
 
+uint32 UArgusStaticDatabase::GetNumUPlacedArgusActorTeamInfoRecords()
+{
+	LazyLoadUPlacedArgusActorTeamInfoRecordDatabase();
+
+	if (!m_UPlacedArgusActorTeamInfoRecordDatabasePersistent)
+	{
+		return 0u;
+	}
+
+	return m_UPlacedArgusActorTeamInfoRecordDatabasePersistent->GetNumRecords();
+}
+
 #if WITH_EDITOR
 uint32 UArgusStaticDatabase::AddUPlacedArgusActorTeamInfoRecordToDatabase(UPlacedArgusActorTeamInfoRecord* record)
 {
@@ -655,7 +715,7 @@ const bool UArgusStaticDatabase::AsyncPreLoadUResourceSetRecord(uint32 id, TFunc
 		return false;
 	}
 
-	return m_UResourceSetRecordDatabasePersistent->AsyncPreLoadRecord(id);
+	return m_UResourceSetRecordDatabasePersistent->AsyncPreLoadRecord(id, callback);
 }
 
 void UArgusStaticDatabase::ResetLoadedUResourceSetRecordPointerArray()
@@ -668,6 +728,18 @@ void UArgusStaticDatabase::ResetLoadedUResourceSetRecordPointerArray()
 	m_UResourceSetRecordDatabasePersistent->ResetPersistentObjectPointerArray();
 }
 
+uint32 UArgusStaticDatabase::GetNumUResourceSetRecords()
+{
+	LazyLoadUResourceSetRecordDatabase();
+
+	if (!m_UResourceSetRecordDatabasePersistent)
+	{
+		return 0u;
+	}
+
+	return m_UResourceSetRecordDatabasePersistent->GetNumRecords();
+}
+
 #if WITH_EDITOR
 uint32 UArgusStaticDatabase::AddUResourceSetRecordToDatabase(UResourceSetRecord* record)
 {
@@ -774,7 +846,7 @@ const bool UArgusStaticDatabase::AsyncPreLoadUTeamAlignmentRecord(uint32 id, TFu
 		return false;
 	}
 
-	return m_UTeamAlignmentRecordDatabasePersistent->AsyncPreLoadRecord(id);
+	return m_UTeamAlignmentRecordDatabasePersistent->AsyncPreLoadRecord(id, callback);
 }
 
 void UArgusStaticDatabase::ResetLoadedUTeamAlignmentRecordPointerArray()
@@ -787,6 +859,18 @@ void UArgusStaticDatabase::ResetLoadedUTeamAlignmentRecordPointerArray()
 	m_UTeamAlignmentRecordDatabasePersistent->ResetPersistentObjectPointerArray();
 }
 
+uint32 UArgusStaticDatabase::GetNumUTeamAlignmentRecords()
+{
+	LazyLoadUTeamAlignmentRecordDatabase();
+
+	if (!m_UTeamAlignmentRecordDatabasePersistent)
+	{
+		return 0u;
+	}
+
+	return m_UTeamAlignmentRecordDatabasePersistent->GetNumRecords();
+}
+
 #if WITH_EDITOR
 uint32 UArgusStaticDatabase::AddUTeamAlignmentRecordToDatabase(UTeamAlignmentRecord* record)
 {
@@ -893,7 +977,7 @@ const bool UArgusStaticDatabase::AsyncPreLoadUTeamColorRecord(uint32 id, TFuncti
 		return false;
 	}
 
-	return m_UTeamColorRecordDatabasePersistent->AsyncPreLoadRecord(id);
+	return m_UTeamColorRecordDatabasePersistent->AsyncPreLoadRecord(id, callback);
 }
 
 void UArgusStaticDatabase::ResetLoadedUTeamColorRecordPointerArray()
@@ -906,6 +990,18 @@ void UArgusStaticDatabase::ResetLoadedUTeamColorRecordPointerArray()
 	m_UTeamColorRecordDatabasePersistent->ResetPersistentObjectPointerArray();
 }
 
+uint32 UArgusStaticDatabase::GetNumUTeamColorRecords()
+{
+	LazyLoadUTeamColorRecordDatabase();
+
+	if (!m_UTeamColorRecordDatabasePersistent)
+	{
+		return 0u;
+	}
+
+	return m_UTeamColorRecordDatabasePersistent->GetNumRecords();
+}
+
 #if WITH_EDITOR
 uint32 UArgusStaticDatabase::AddUTeamColorRecordToDatabase(UTeamColorRecord* record)
 {
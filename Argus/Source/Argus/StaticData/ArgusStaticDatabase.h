@@ -42,6 +42,7 @@ public:
 	const UAbilityRecord* GetUAbilityRecord(uint32 id);
 	const bool AsyncPreLoadUAbilityRecord(uint32 id, TFunction<void(const UAbilityRecord*)> callback = nullptr);
 	void ResetLoadedUAbilityRecordPointerArray();
+	uint32 GetNumUAbilityRecords();
 #if WITH_EDITOR
 	uint32 AddUAbilityRecordToDatabase(UAbilityRecord* record);
 	void IterateAllUAbilityRecords(const TFunctionRef<void(UAbilityRecord*)>& function);
@@ -61,6 +62,7 @@ public:
 	const UArgusActorRecord* GetUArgusActorRecord(uint32 id);
 	const bool AsyncPreLoadUArgusActorRecord(uint32 id, TFunction<void(const UArgusActorRecord*)> callback = nullptr);
 	void ResetLoadedUArgusActorRecordPointerArray();
+	uint32 GetNumUArgusActorRecords();
 #if WITH_EDITOR
 	uint32 AddUArgusActorRecordToDatabase(UArgusActorRecord* record);
 	void IterateAllUArgusActorRecords(const TFunctionRef<void(UArgusActorRecord*)>& function);
@@ -80,6 +82,7 @@ public:
 	const UFactionRecord* GetUFactionRecord(uint32 id);
 	const bool AsyncPreLoadUFactionRecord(uint32 id, TFunction<void(const UFactionRecord*)> callback = nullptr);
 	void ResetLoadedUFactionRecordPointerArray();
+	uint32 GetNumUFactionRecords();
 #if WITH_EDITOR
 	uint32 AddUFactionRecordToDatabase(UFactionRecord* record);
 	void IterateAllUFactionRecords(const TFunctionRef<void(UFactionRecord*)>& function);
@@ -99,6 +102,7 @@ public:
 	const UMaterialRecord* GetUMaterialRecord(uint32 id);
 	const bool AsyncPreLoadUMaterialRecord(uint32 id, TFunction<void(const UMaterialRecord*)> callback = nullptr);
 	void ResetLoadedUMaterialRecordPointerArray();
+	uint32 GetNumUMaterialRecords();
 #if WITH_EDITOR
 	uint32 AddUMaterialRecordToDatabase(UMaterialRecord* record);
 	void IterateAllUMaterialRecords(const TFunctionRef<void(UMaterialRecord*)>& function);
@@ -118,6 +122,7 @@ public:
 	const UPlacedArgusActorTeamInfoRecord* GetUPlacedArgusActorTeamInfoRecord(uint32 id);
 	const bool AsyncPreLoadUPlacedArgusActorTeamInfoRecord(uint32 id, TFunction<void(const UPlacedArgusActorTeamInfoRecord*)> callback = nullptr);
 	void ResetLoadedUPlacedArgusActorTeamInfoRecordPointerArray();
+	uint32 GetNumUPlacedArgusActorTeamInfoRecords();
 #if WITH_EDITOR
 	uint32 AddUPlacedArgusActorTeamInfoRecordToDatabase(UPlacedArgusActorTeamInfoRecord* record);
 	void IterateAllUPlacedArgusActorTeamInfoRecords(const TFunctionRef<void(UPlacedArgusActorTeamInfoRecord*)>& function);
@@ -137,6 +142,7 @@ public:
 	const UResourceSetRecord* GetUResourceSetRecord(uint32 id);
 	const bool AsyncPreLoadUResourceSetRecord(uint32 id, TFunction<void(const UResourceSetRecord*)> callback = nullptr);
 	void ResetLoadedUResourceSetRecordPointerArray();
+	uint32 GetNumUResourceSetRecords();
 #if WITH_EDITOR
 	uint32 AddUResourceSetRecordToDatabase(UResourceSetRecord* record);
 	void IterateAllUResourceSetRecords(const TFunctionRef<void(UResourceSetRecord*)>& function);
@@ -156,6 +162,7 @@ public:
 	const UTeamAlignmentRecord* GetUTeamAlignmentRecord(uint32 id);
 	const bool AsyncPreLoadUTeamAlignmentRecord(uint32 id, TFunction<void(const UTeamAlignmentRecord*)> callback = nullptr);
 	void ResetLoadedUTeamAlignmentRecordPointerArray();
+	uint32 GetNumUTeamAlignmentRecords();
 #if WITH_EDITOR
 	uint32 AddUTeamAlignmentRecordToDatabase(UTeamAlignmentRecord* record);
 	void IterateAllUTeamAlignmentRecords(const TFunctionRef<void(UTeamAlignmentRecord*)>& function);
@@ -175,6 +182,7 @@ public:
 	const UTeamColorRecord* GetUTeamColorRecord(uint32 id);
 	const bool AsyncPreLoadUTeamColorRecord(uint32 id, TFunction<void(const UTeamColorRecord*)> callback = nullptr);
 	void ResetLoadedUTeamColorRecordPointerArray();
+	uint32 GetNumUTeamColorRecords();
 #if WITH_EDITOR
 	uint32 AddUTeamColorRecordToDatabase(UTeamColorRecord* record);
 	void IterateAllUTeamColorRecords(const TFunctionRef<void(UTeamColorRecord*)>& function);
@@ -12,6 +12,7 @@ struct FArgusStaticRecordReference
 
 	virtual ~FArgusStaticRecordReference() {}
 	uint32 GetId() const { return m_id; }
+	virtual const UClass* GetRecordClass() const { return nullptr; }
 
 #if WITH_EDITOR
 	virtual void StoreId() const {};
@@ -0,0 +1,17 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "ArgusStaticRecordTable.h"
+#include "RecordDefinitions/AbilityRecord.h"
+#include "RecordDefinitions/ResourceSetRecord.h"
+
+void ArgusStaticRecordTables::InitializeAllTables()
+{
+	ArgusStaticRecordTable<UAbilityRecord>::Initialize(ArgusStaticData::GetNumRecords<UAbilityRecord>());
+	ArgusStaticRecordTable<UResourceSetRecord>::Initialize(ArgusStaticData::GetNumRecords<UResourceSetRecord>());
+}
+
+void ArgusStaticRecordTables::ResetAllTables()
+{
+	ArgusStaticRecordTable<UAbilityRecord>::Reset();
+	ArgusStaticRecordTable<UResourceSetRecord>::Reset();
+}
@@ -0,0 +1,137 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#pragma once
+
+#include "ArgusLogging.h"
+#include "ArgusMacros.h"
+#include "ArgusStaticData.h"
+#include "CoreMinimal.h"
+
+// Flat, id indexed copy of the gameplay relevant fields of a record type. Rows are populated when a record is loaded into its database, so
+// lookups from per entity system loops are a single indexed read with no UObject, soft pointer or database indirection.
+// The UObject record stays the authoring format and is only touched on a miss. The table is sized once before gameplay and never resizes afterwards,
+// so row pointers handed out by Get stay valid while other records load.
+template<typename ArgusStaticRecord>
+class ArgusStaticRecordTable
+{
+public:
+	using FlatRecord = typename ArgusStaticRecord::FlatRecord;
+
+	static void Initialize(uint32 numRecords)
+	{
+		Reset();
+		s_flatRecords.SetNum(numRecords);
+		s_rowStates.SetNum(numRecords);
+		for (int32 i = 0; i < s_rowStates.Num(); ++i)
+		{
+			s_rowStates[i].store(ERowState::Empty);
+		}
+	}
+
+	static const FlatRecord* Get(uint32 id)
+	{
+		ARGUS_TRACE(ArgusStaticRecordTable::Get);
+
+		if (const FlatRecord* flatRecord = Find(id))
+		{
+			return flatRecord;
+		}
+
+		if (id == 0u)
+		{
+			return nullptr;
+		}
+
+		// Loading the record through its database populates its row.
+		if (!ArgusStaticData::GetRecord<ArgusStaticRecord>(id))
+		{
+			return nullptr;
+		}
+
+		return WaitForRowToPublish(id);
+	}
+
+	// Records load from async callbacks on the game thread and synchronously from the systems thread. A row is claimed before it is written and only
+	// published once the write is done, so readers never see a partially written row and two loads of the same record can't write it at the same time.
+	static void Populate(uint32 id, const FlatRecord& flatRecord)
+	{
+		if (id == 0u)
+		{
+			return;
+		}
+
+		if (static_cast<uint32>(s_flatRecords.Num()) <= id)
+		{
+			ARGUS_LOG
+			(
+				ArgusStaticDataLog, Error,
+				TEXT("[%s] Record id %d is outside of the %d rows that %s was initialized with. Its row will not be populated."),
+				ARGUS_FUNCNAME,
+				id,
+				s_flatRecords.Num(),
+				ARGUS_NAMEOF(ArgusStaticRecordTable)
+			);
+			return;
+		}
+
+		ERowState expectedRowState = ERowState::Empty;
+		if (!s_rowStates[id].compare_exchange_strong(expectedRowState, ERowState::Writing))
+		{
+			return;
+		}
+
+		s_flatRecords[id] = flatRecord;
+		s_rowStates[id].store(ERowState::Populated);
+	}
+
+	static void Reset()
+	{
+		s_flatRecords.Reset();
+		s_rowStates.Reset();
+	}
+
+private:
+	enum class ERowState : uint8
+	{
+		Empty,
+		Writing,
+		Populated
+	};
+
+	static const FlatRecord* Find(uint32 id)
+	{
+		if (static_cast<uint32>(s_flatRecords.Num()) <= id || s_rowStates[id].load() != ERowState::Populated)
+		{
+			return nullptr;
+		}
+
+		return &s_flatRecords[id];
+	}
+
+	// The record is loaded, but another thread may have claimed its row first and still be writing it. The write is a single flat struct copy, so
+	// waiting for it to publish is cheaper than going back through the record database.
+	static const FlatRecord* WaitForRowToPublish(uint32 id)
+	{
+		if (static_cast<uint32>(s_flatRecords.Num()) <= id)
+		{
+			return nullptr;
+		}
+
+		while (s_rowStates[id].load() == ERowState::Writing)
+		{
+			FPlatformProcess::Yield();
+		}
+
+		return Find(id);
+	}
+
+	static inline TArray<FlatRecord> s_flatRecords;
+	static inline TArray<std::atomic<ERowState> > s_rowStates;
+};
+
+class ArgusStaticRecordTables
+{
+public:
+	static void InitializeAllTables();
+	static void ResetAllTables();
+};
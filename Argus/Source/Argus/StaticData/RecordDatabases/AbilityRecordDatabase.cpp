@@ -4,6 +4,7 @@
 #include "RecordDatabases/AbilityRecordDatabase.h"
 #include "ArgusEntity.h"
 #include "ArgusLogging.h"
+#include "ArgusStaticDataPreloader.h"
 
 #if WITH_EDITOR
 #include "ArgusStaticData.h"
@@ -36,11 +37,26 @@ const UAbilityRecord* UAbilityRecordDatabase::GetRecord(uint32 id)
 
 	if (resized || !m_UAbilityRecordsPersistent[id])
 	{
+#if !UE_BUILD_SHIPPING
+		// Records that are still resident (for example after a save load flushes the persistent arrays) resolve without touching disk.
+		if (ArgusStaticDataPreloader::AreSynchronousRecordLoadsDisallowed() && !m_UAbilityRecords[id].Get())
+		{
+			ARGUS_LOG
+			(
+				ArgusStaticDataLog, Error,
+				TEXT("[%s] Synchronously loading %s %d during gameplay. It is missing from the preload manifest."),
+				ARGUS_FUNCNAME,
+				ARGUS_NAMEOF(UAbilityRecord),
+				id
+			);
+		}
+#endif //!UE_BUILD_SHIPPING
+
 		m_UAbilityRecordsPersistent[id] = m_UAbilityRecords[id].LoadSynchronous();
 		if (m_UAbilityRecordsPersistent[id])
 		{
-			m_UAbilityRecordsPersistent[id]->OnAsyncLoaded();
 			m_UAbilityRecordsPersistent[id]->m_id = id;
+			m_UAbilityRecordsPersistent[id]->OnAsyncLoaded();
 		}
 	}
 
@@ -67,6 +83,10 @@ const bool UAbilityRecordDatabase::AsyncPreLoadRecord(uint32 id, TFunction<void(
 
 	if (m_UAbilityRecordsPersistent[id])
 	{
+		if (callback)
+		{
+			callback(m_UAbilityRecordsPersistent[id]);
+		}
 		return true;
 	}
 
@@ -79,18 +99,24 @@ const bool UAbilityRecordDatabase::AsyncPreLoadRecord(uint32 id, TFunction<void(
 		{
 			if (static_cast<uint32>(m_UAbilityRecordsPersistent.Num()) <= id || static_cast<uint32>(m_UAbilityRecords.Num()) <= id)
 			{
+				if (callback)
+				{
+					callback(nullptr);
+				}
 				return;
 			}
 
 			m_UAbilityRecordsPersistent[id] = m_UAbilityRecords[id].Get();
 			if (m_UAbilityRecordsPersistent[id])
 			{
-				m_UAbilityRecordsPersistent[id]->OnAsyncLoaded();
 				m_UAbilityRecordsPersistent[id]->m_id = id;
-				if (callback)
-				{
-					callback(m_UAbilityRecordsPersistent[id]);
-				}
+				m_UAbilityRecordsPersistent[id]->OnAsyncLoaded();
+			}
+
+			// Always report back, even on failure, so callers waiting on a batch of loads can complete.
+			if (callback)
+			{
+				callback(m_UAbilityRecordsPersistent[id]);
 			}
 		})
 	);
@@ -134,6 +160,11 @@ void UAbilityRecordDatabase::ResetPersistentObjectPointerArray()
 	m_UAbilityRecordsPersistent.Reset();
 }
 
+uint32 UAbilityRecordDatabase::GetNumRecords() const
+{
+	return static_cast<uint32>(m_UAbilityRecords.Num());
+}
+
 #if WITH_EDITOR
 void UAbilityRecordDatabase::PreSave(FObjectPreSaveContext saveContext)
 {
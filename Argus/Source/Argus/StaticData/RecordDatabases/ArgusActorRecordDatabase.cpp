@@ -4,6 +4,7 @@
 #include "RecordDatabases/ArgusActorRecordDatabase.h"
 #include "ArgusEntity.h"
 #include "ArgusLogging.h"
+#include "ArgusStaticDataPreloader.h"
 
 #if WITH_EDITOR
 #include "ArgusStaticData.h"
@@ -36,11 +37,26 @@ const UArgusActorRecord* UArgusActorRecordDatabase::GetRecord(uint32 id)
 
 	if (resized || !m_UArgusActorRecordsPersistent[id])
 	{
+#if !UE_BUILD_SHIPPING
+		// Records that are still resident (for example after a save load flushes the persistent arrays) resolve without touching disk.
+		if (ArgusStaticDataPreloader::AreSynchronousRecordLoadsDisallowed() && !m_UArgusActorRecords[id].Get())
+		{
+			ARGUS_LOG
+			(
+				ArgusStaticDataLog, Error,
+				TEXT("[%s] Synchronously loading %s %d during gameplay. It is missing from the preload manifest."),
+				ARGUS_FUNCNAME,
+				ARGUS_NAMEOF(UArgusActorRecord),
+				id
+			);
+		}
+#endif //!UE_BUILD_SHIPPING
+
 		m_UArgusActorRecordsPersistent[id] = m_UArgusActorRecords[id].LoadSynchronous();
 		if (m_UArgusActorRecordsPersistent[id])
 		{
-			m_UArgusActorRecordsPersistent[id]->OnAsyncLoaded();
 			m_UArgusActorRecordsPersistent[id]->m_id = id;
+			m_UArgusActorRecordsPersistent[id]->OnAsyncLoaded();
 		}
 	}
 
@@ -67,6 +83,10 @@ const bool UArgusActorRecordDatabase::AsyncPreLoadRecord(uint32 id, TFunction<vo
 
 	if (m_UArgusActorRecordsPersistent[id])
 	{
+		if (callback)
+		{
+			callback(m_UArgusActorRecordsPersistent[id]);
+		}
 		return true;
 	}
 
@@ -79,18 +99,24 @@ const bool UArgusActorRecordDatabase::AsyncPreLoadRecord(uint32 id, TFunction<vo
 		{
 			if (static_cast<uint32>(m_UArgusActorRecordsPersistent.Num()) <= id || static_cast<uint32>(m_UArgusActorRecords.Num()) <= id)
 			{
+				if (callback)
+				{
+					callback(nullptr);
+				}
 				return;
 			}
 
 			m_UArgusActorRecordsPersistent[id] = m_UArgusActorRecords[id].Get();
 			if (m_UArgusActorRecordsPersistent[id])
 			{
-				m_UArgusActorRecordsPersistent[id]->OnAsyncLoaded();
 				m_UArgusActorRecordsPersistent[id]->m_id = id;
-				if (callback)
-				{
-					callback(m_UArgusActorRecordsPersistent[id]);
-				}
+				m_UArgusActorRecordsPersistent[id]->OnAsyncLoaded();
+			}
+
+			// Always report back, even on failure, so callers waiting on a batch of loads can complete.
+			if (callback)
+			{
+				callback(m_UArgusActorRecordsPersistent[id]);
 			}
 		})
 	);
@@ -134,6 +160,11 @@ void UArgusActorRecordDatabase::ResetPersistentObjectPointerArray()
 	m_UArgusActorRecordsPersistent.Reset();
 }
 
+uint32 UArgusActorRecordDatabase::GetNumRecords() const
+{
+	return static_cast<uint32>(m_UArgusActorRecords.Num());
+}
+
 #if WITH_EDITOR
 void UArgusActorRecordDatabase::PreSave(FObjectPreSaveContext saveContext)
 {
@@ -4,6 +4,7 @@
 #include "RecordDatabases/FactionRecordDatabase.h"
 #include "ArgusEntity.h"
 #include "ArgusLogging.h"
+#include "ArgusStaticDataPreloader.h"
 
 #if WITH_EDITOR
 #include "ArgusStaticData.h"
@@ -36,11 +37,26 @@ const UFactionRecord* UFactionRecordDatabase::GetRecord(uint32 id)
 
 	if (resized || !m_UFactionRecordsPersistent[id])
 	{
+#if !UE_BUILD_SHIPPING
+		// Records that are still resident (for example after a save load flushes the persistent arrays) resolve without touching disk.
+		if (ArgusStaticDataPreloader::AreSynchronousRecordLoadsDisallowed() && !m_UFactionRecords[id].Get())
+		{
+			ARGUS_LOG
+			(
+				ArgusStaticDataLog, Error,
+				TEXT("[%s] Synchronously loading %s %d during gameplay. It is missing from the preload manifest."),
+				ARGUS_FUNCNAME,
+				ARGUS_NAMEOF(UFactionRecord),
+				id
+			);
+		}
+#endif //!UE_BUILD_SHIPPING
+
 		m_UFactionRecordsPersistent[id] = m_UFactionRecords[id].LoadSynchronous();
 		if (m_UFactionRecordsPersistent[id])
 		{
-			m_UFactionRecordsPersistent[id]->OnAsyncLoaded();
 			m_UFactionRecordsPersistent[id]->m_id = id;
+			m_UFactionRecordsPersistent[id]->OnAsyncLoaded();
 		}
 	}
 
@@ -67,6 +83,10 @@ const bool UFactionRecordDatabase::AsyncPreLoadRecord(uint32 id, TFunction<void(
 
 	if (m_UFactionRecordsPersistent[id])
 	{
+		if (callback)
+		{
+			callback(m_UFactionRecordsPersistent[id]);
+		}
 		return true;
 	}
 
@@ -79,18 +99,24 @@ const bool UFactionRecordDatabase::AsyncPreLoadRecord(uint32 id, TFunction<void(
 		{
 			if (static_cast<uint32>(m_UFactionRecordsPersistent.Num()) <= id || static_cast<uint32>(m_UFactionRecords.Num()) <= id)
 			{
+				if (callback)
+				{
+					callback(nullptr);
+				}
 				return;
 			}
 
 			m_UFactionRecordsPersistent[id] = m_UFactionRecords[id].Get();
 			if (m_UFactionRecordsPersistent[id])
 			{
-				m_UFactionRecordsPersistent[id]->OnAsyncLoaded();
 				m_UFactionRecordsPersistent[id]->m_id = id;
-				if (callback)
-				{
-					callback(m_UFactionRecordsPersistent[id]);
-				}
+				m_UFactionRecordsPersistent[id]->OnAsyncLoaded();
+			}
+
+			// Always report back, even on failure, so callers waiting on a batch of loads can complete.
+			if (callback)
+			{
+				callback(m_UFactionRecordsPersistent[id]);
 			}
 		})
 	);
@@ -134,6 +160,11 @@ void UFactionRecordDatabase::ResetPersistentObjectPointerArray()
 	m_UFactionRecordsPersistent.Reset();
 }
 
+uint32 UFactionRecordDatabase::GetNumRecords() const
+{
+	return static_cast<uint32>(m_UFactionRecords.Num());
+}
+
 #if WITH_EDITOR
 void UFactionRecordDatabase::PreSave(FObjectPreSaveContext saveContext)
 {
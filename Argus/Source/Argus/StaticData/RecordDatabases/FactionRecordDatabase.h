@@ -17,6 +17,7 @@ public:
 	const bool AsyncPreLoadRecord(uint32 id, TFunction<void(const UFactionRecord*)> callback = nullptr);
 	bool ResizePersistentObjectPointerArrayToFitRecord(uint32 id);
 	void ResetPersistentObjectPointerArray();
+	uint32 GetNumRecords() const;
 
 protected:
 	UPROPERTY(EditAnywhere)
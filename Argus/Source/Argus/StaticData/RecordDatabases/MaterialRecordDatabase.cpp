@@ -4,6 +4,7 @@
 #include "RecordDatabases/MaterialRecordDatabase.h"
 #include "ArgusEntity.h"
 #include "ArgusLogging.h"
+#include "ArgusStaticDataPreloader.h"
 
 #if WITH_EDITOR
 #include "ArgusStaticData.h"
@@ -36,11 +37,26 @@ const UMaterialRecord* UMaterialRecordDatabase::GetRecord(uint32 id)
 
 	if (resized || !m_UMaterialRecordsPersistent[id])
 	{
+#if !UE_BUILD_SHIPPING
+		// Records that are still resident (for example after a save load flushes the persistent arrays) resolve without touching disk.
+		if (ArgusStaticDataPreloader::AreSynchronousRecordLoadsDisallowed() && !m_UMaterialRecords[id].Get())
+		{
+			ARGUS_LOG
+			(
+				ArgusStaticDataLog, Error,
+				TEXT("[%s] Synchronously loading %s %d during gameplay. It is missing from the preload manifest."),
+				ARGUS_FUNCNAME,
+				ARGUS_NAMEOF(UMaterialRecord),
+				id
+			);
+		}
+#endif //!UE_BUILD_SHIPPING
+
 		m_UMaterialRecordsPersistent[id] = m_UMaterialRecords[id].LoadSynchronous();
 		if (m_UMaterialRecordsPersistent[id])
 		{
-			m_UMaterialRecordsPersistent[id]->OnAsyncLoaded();
 			m_UMaterialRecordsPersistent[id]->m_id = id;
+			m_UMaterialRecordsPersistent[id]->OnAsyncLoaded();
 		}
 	}
 
@@ -67,6 +83,10 @@ const bool UMaterialRecordDatabase::AsyncPreLoadRecord(uint32 id, TFunction<void
 
 	if (m_UMaterialRecordsPersistent[id])
 	{
+		if (callback)
+		{
+			callback(m_UMaterialRecordsPersistent[id]);
+		}
 		return true;
 	}
 
@@ -79,18 +99,24 @@ const bool UMaterialRecordDatabase::AsyncPreLoadRecord(uint32 id, TFunction<void
 		{
 			if (static_cast<uint32>(m_UMaterialRecordsPersistent.Num()) <= id || static_cast<uint32>(m_UMaterialRecords.Num()) <= id)
 			{
+				if (callback)
+				{
+					callback(nullptr);
+				}
 				return;
 			}
 
 			m_UMaterialRecordsPersistent[id] = m_UMaterialRecords[id].Get();
 			if (m_UMaterialRecordsPersistent[id])
 			{
-				m_UMaterialRecordsPersistent[id]->OnAsyncLoaded();
 				m_UMaterialRecordsPersistent[id]->m_id = id;
-				if (callback)
-				{
-					callback(m_UMaterialRecordsPersistent[id]);
-				}
+				m_UMaterialRecordsPersistent[id]->OnAsyncLoaded();
+			}
+
+			// Always report back, even on failure, so callers waiting on a batch of loads can complete.
+			if (callback)
+			{
+				callback(m_UMaterialRecordsPersistent[id]);
 			}
 		})
 	);
@@ -134,6 +160,11 @@ void UMaterialRecordDatabase::ResetPersistentObjectPointerArray()
 	m_UMaterialRecordsPersistent.Reset();
 }
 
+uint32 UMaterialRecordDatabase::GetNumRecords() const
+{
+	return static_cast<uint32>(m_UMaterialRecords.Num());
+}
+
 #if WITH_EDITOR
 void UMaterialRecordDatabase::PreSave(FObjectPreSaveContext saveContext)
 {
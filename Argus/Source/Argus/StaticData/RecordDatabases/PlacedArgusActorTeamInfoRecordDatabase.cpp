@@ -4,6 +4,7 @@
 #include "RecordDatabases/PlacedArgusActorTeamInfoRecordDatabase.h"
 #include "ArgusEntity.h"
 #include "ArgusLogging.h"
+#include "ArgusStaticDataPreloader.h"
 
 #if WITH_EDITOR
 #include "ArgusStaticData.h"
@@ -36,11 +37,26 @@ const UPlacedArgusActorTeamInfoRecord* UPlacedArgusActorTeamInfoRecordDatabase::
 
 	if (resized || !m_UPlacedArgusActorTeamInfoRecordsPersistent[id])
 	{
+#if !UE_BUILD_SHIPPING
+		// Records that are still resident (for example after a save load flushes the persistent arrays) resolve without touching disk.
+		if (ArgusStaticDataPreloader::AreSynchronousRecordLoadsDisallowed() && !m_UPlacedArgusActorTeamInfoRecords[id].Get())
+		{
+			ARGUS_LOG
+			(
+				ArgusStaticDataLog, Error,
+				TEXT("[%s] Synchronously loading %s %d during gameplay. It is missing from the preload manifest."),
+				ARGUS_FUNCNAME,
+				ARGUS_NAMEOF(UPlacedArgusActorTeamInfoRecord),
+				id
+			);
+		}
+#endif //!UE_BUILD_SHIPPING
+
 		m_UPlacedArgusActorTeamInfoRecordsPersistent[id] = m_UPlacedArgusActorTeamInfoRecords[id].LoadSynchronous();
 		if (m_UPlacedArgusActorTeamInfoRecordsPersistent[id])
 		{
-			m_UPlacedArgusActorTeamInfoRecordsPersistent[id]->OnAsyncLoaded();
 			m_UPlacedArgusActorTeamInfoRecordsPersistent[id]->m_id = id;
+			m_UPlacedArgusActorTeamInfoRecordsPersistent[id]->OnAsyncLoaded();
 		}
 	}
 
@@ -67,6 +83,10 @@ const bool UPlacedArgusActorTeamInfoRecordDatabase::AsyncPreLoadRecord(uint32 id
 
 	if (m_UPlacedArgusActorTeamInfoRecordsPersistent[id])
 	{
+		if (callback)
+		{
+			callback(m_UPlacedArgusActorTeamInfoRecordsPersistent[id]);
+		}
 		return true;
 	}
 
@@ -79,18 +99,24 @@ const bool UPlacedArgusActorTeamInfoRecordDatabase::AsyncPreLoadRecord(uint32 id
 		{
 			if (static_cast<uint32>(m_UPlacedArgusActorTeamInfoRecordsPersistent.Num()) <= id || static_cast<uint32>(m_UPlacedArgusActorTeamInfoRecords.Num()) <= id)
 			{
+				if (callback)
+				{
+					callback(nullptr);
+				}
 				return;
 			}
 
 			m_UPlacedArgusActorTeamInfoRecordsPersistent[id] = m_UPlacedArgusActorTeamInfoRecords[id].Get();
 			if (m_UPlacedArgusActorTeamInfoRecordsPersistent[id])
 			{
-				m_UPlacedArgusActorTeamInfoRecordsPersistent[id]->OnAsyncLoaded();
 				m_UPlacedArgusActorTeamInfoRecordsPersistent[id]->m_id = id;
-				if (callback)
-				{
-					callback(m_UPlacedArgusActorTeamInfoRecordsPersistent[id]);
-				}
+				m_UPlacedArgusActorTeamInfoRecordsPersistent[id]->OnAsyncLoaded();
+			}
+
+			// Always report back, even on failure, so callers waiting on a batch of loads can complete.
+			if (callback)
+			{
+				callback(m_UPlacedArgusActorTeamInfoRecordsPersistent[id]);
 			}
 		})
 	);
@@ -134,6 +160,11 @@ void UPlacedArgusActorTeamInfoRecordDatabase::ResetPersistentObjectPointerArray(
 	m_UPlacedArgusActorTeamInfoRecordsPersistent.Reset();
 }
 
+uint32 UPlacedArgusActorTeamInfoRecordDatabase::GetNumRecords() const
+{
+	return static_cast<uint32>(m_UPlacedArgusActorTeamInfoRecords.Num());
+}
+
 #if WITH_EDITOR
 void UPlacedArgusActorTeamInfoRecordDatabase::PreSave(FObjectPreSaveContext saveContext)
 {
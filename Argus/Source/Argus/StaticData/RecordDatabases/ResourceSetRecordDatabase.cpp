@@ -4,6 +4,7 @@
 #include "RecordDatabases/ResourceSetRecordDatabase.h"
 #include "ArgusEntity.h"
 #include "ArgusLogging.h"
+#include "ArgusStaticDataPreloader.h"
 
 #if WITH_EDITOR
 #include "ArgusStaticData.h"
@@ -36,11 +37,26 @@ const UResourceSetRecord* UResourceSetRecordDatabase::GetRecord(uint32 id)
 
 	if (resized || !m_UResourceSetRecordsPersistent[id])
 	{
+#if !UE_BUILD_SHIPPING
+		// Records that are still resident (for example after a save load flushes the persistent arrays) resolve without touching disk.
+		if (ArgusStaticDataPreloader::AreSynchronousRecordLoadsDisallowed() && !m_UResourceSetRecords[id].Get())
+		{
+			ARGUS_LOG
+			(
+				ArgusStaticDataLog, Error,
+				TEXT("[%s] Synchronously loading %s %d during gameplay. It is missing from the preload manifest."),
+				ARGUS_FUNCNAME,
+				ARGUS_NAMEOF(UResourceSetRecord),
+				id
+			);
+		}
+#endif //!UE_BUILD_SHIPPING
+
 		m_UResourceSetRecordsPersistent[id] = m_UResourceSetRecords[id].LoadSynchronous();
 		if (m_UResourceSetRecordsPersistent[id])
 		{
-			m_UResourceSetRecordsPersistent[id]->OnAsyncLoaded();
 			m_UResourceSetRecordsPersistent[id]->m_id = id;
+			m_UResourceSetRecordsPersistent[id]->OnAsyncLoaded();
 		}
 	}
 
@@ -67,6 +83,10 @@ const bool UResourceSetRecordDatabase::AsyncPreLoadRecord(uint32 id, TFunction<v
 
 	if (m_UResourceSetRecordsPersistent[id])
 	{
+		if (callback)
+		{
+			callback(m_UResourceSetRecordsPersistent[id]);
+		}
 		return true;
 	}
 
@@ -79,18 +99,24 @@ const bool UResourceSetRecordDatabase::AsyncPreLoadRecord(uint32 id, TFunction<v
 		{
 			if (static_cast<uint32>(m_UResourceSetRecordsPersistent.Num()) <= id || static_cast<uint32>(m_UResourceSetRecords.Num()) <= id)
 			{
+				if (callback)
+				{
+					callback(nullptr);
+				}
 				return;
 			}
 
 			m_UResourceSetRecordsPersistent[id] = m_UResourceSetRecords[id].Get();
 			if (m_UResourceSetRecordsPersistent[id])
 			{
-				m_UResourceSetRecordsPersistent[id]->OnAsyncLoaded();
 				m_UResourceSetRecordsPersistent[id]->m_id = id;
-				if (callback)
-				{
-					callback(m_UResourceSetRecordsPersistent[id]);
-				}
+				m_UResourceSetRecordsPersistent[id]->OnAsyncLoaded();
+			}
+
+			// Always report back, even on failure, so callers waiting on a batch of loads can complete.
+			if (callback)
+			{
+				callback(m_UResourceSetRecordsPersistent[id]);
 			}
 		})
 	);
@@ -134,6 +160,11 @@ void UResourceSetRecordDatabase::ResetPersistentObjectPointerArray()
 	m_UResourceSetRecordsPersistent.Reset();
 }
 
+uint32 UResourceSetRecordDatabase::GetNumRecords() const
+{
+	return static_cast<uint32>(m_UResourceSetRecords.Num());
+}
+
 #if WITH_EDITOR
 void UResourceSetRecordDatabase::PreSave(FObjectPreSaveContext saveContext)
 {
@@ -4,6 +4,7 @@
 #include "RecordDatabases/TeamAlignmentRecordDatabase.h"
 #include "ArgusEntity.h"
 #include "ArgusLogging.h"
+#include "ArgusStaticDataPreloader.h"
 
 #if WITH_EDITOR
 #include "ArgusStaticData.h"
@@ -36,11 +37,26 @@ const UTeamAlignmentRecord* UTeamAlignmentRecordDatabase::GetRecord(uint32 id)
 
 	if (resized || !m_UTeamAlignmentRecordsPersistent[id])
 	{
+#if !UE_BUILD_SHIPPING
+		// Records that are still resident (for example after a save load flushes the persistent arrays) resolve without touching disk.
+		if (ArgusStaticDataPreloader::AreSynchronousRecordLoadsDisallowed() && !m_UTeamAlignmentRecords[id].Get())
+		{
+			ARGUS_LOG
+			(
+				ArgusStaticDataLog, Error,
+				TEXT("[%s] Synchronously loading %s %d during gameplay. It is missing from the preload manifest."),
+				ARGUS_FUNCNAME,
+				ARGUS_NAMEOF(UTeamAlignmentRecord),
+				id
+			);
+		}
+#endif //!UE_BUILD_SHIPPING
+
 		m_UTeamAlignmentRecordsPersistent[id] = m_UTeamAlignmentRecords[id].LoadSynchronous();
 		if (m_UTeamAlignmentRecordsPersistent[id])
 		{
-			m_UTeamAlignmentRecordsPersistent[id]->OnAsyncLoaded();
 			m_UTeamAlignmentRecordsPersistent[id]->m_id = id;
+			m_UTeamAlignmentRecordsPersistent[id]->OnAsyncLoaded();
 		}
 	}
 
@@ -67,6 +83,10 @@ const bool UTeamAlignmentRecordDatabase::AsyncPreLoadRecord(uint32 id, TFunction
 
 	if (m_UTeamAlignmentRecordsPersistent[id])
 	{
+		if (callback)
+		{
+			callback(m_UTeamAlignmentRecordsPersistent[id]);
+		}
 		return true;
 	}
 
@@ -79,18 +99,24 @@ const bool UTeamAlignmentRecordDatabase::AsyncPreLoadRecord(uint32 id, TFunction
 		{
 			if (static_cast<uint32>(m_UTeamAlignmentRecordsPersistent.Num()) <= id || static_cast<uint32>(m_UTeamAlignmentRecords.Num()) <= id)
 			{
+				if (callback)
+				{
+					callback(nullptr);
+				}
 				return;
 			}
 
 			m_UTeamAlignmentRecordsPersistent[id] = m_UTeamAlignmentRecords[id].Get();
 			if (m_UTeamAlignmentRecordsPersistent[id])
 			{
-				m_UTeamAlignmentRecordsPersistent[id]->OnAsyncLoaded();
 				m_UTeamAlignmentRecordsPersistent[id]->m_id = id;
-				if (callback)
-				{
-					callback(m_UTeamAlignmentRecordsPersistent[id]);
-				}
+				m_UTeamAlignmentRecordsPersistent[id]->OnAsyncLoaded();
+			}
+
+			// Always report back, even on failure, so callers waiting on a batch of loads can complete.
+			if (callback)
+			{
+				callback(m_UTeamAlignmentRecordsPersistent[id]);
 			}
 		})
 	);
@@ -134,6 +160,11 @@ void UTeamAlignmentRecordDatabase::ResetPersistentObjectPointerArray()
 	m_UTeamAlignmentRecordsPersistent.Reset();
 }
 
+uint32 UTeamAlignmentRecordDatabase::GetNumRecords() const
+{
+	return static_cast<uint32>(m_UTeamAlignmentRecords.Num());
+}
+
 #if WITH_EDITOR
 void UTeamAlignmentRecordDatabase::PreSave(FObjectPreSaveContext saveContext)
 {
@@ -4,6 +4,7 @@
 #include "RecordDatabases/TeamColorRecordDatabase.h"
 #include "ArgusEntity.h"
 #include "ArgusLogging.h"
+#include "ArgusStaticDataPreloader.h"
 
 #if WITH_EDITOR
 #include "ArgusStaticData.h"
@@ -36,11 +37,26 @@ const UTeamColorRecord* UTeamColorRecordDatabase::GetRecord(uint32 id)
 
 	if (resized || !m_UTeamColorRecordsPersistent[id])
 	{
+#if !UE_BUILD_SHIPPING
+		// Records that are still resident (for example after a save load flushes the persistent arrays) resolve without touching disk.
+		if (ArgusStaticDataPreloader::AreSynchronousRecordLoadsDisallowed() && !m_UTeamColorRecords[id].Get())
+		{
+			ARGUS_LOG
+			(
+				ArgusStaticDataLog, Error,
+				TEXT("[%s] Synchronously loading %s %d during gameplay. It is missing from the preload manifest."),
+				ARGUS_FUNCNAME,
+				ARGUS_NAMEOF(UTeamColorRecord),
+				id
+			);
+		}
+#endif //!UE_BUILD_SHIPPING
+
 		m_UTeamColorRecordsPersistent[id] = m_UTeamColorRecords[id].LoadSynchronous();
 		if (m_UTeamColorRecordsPersistent[id])
 		{
-			m_UTeamColorRecordsPersistent[id]->OnAsyncLoaded();
 			m_UTeamColorRecordsPersistent[id]->m_id = id;
+			m_UTeamColorRecordsPersistent[id]->OnAsyncLoaded();
 		}
 	}
 
@@ -67,6 +83,10 @@ const bool UTeamColorRecordDatabase::AsyncPreLoadRecord(uint32 id, TFunction<voi
 
 	if (m_UTeamColorRecordsPersistent[id])
 	{
+		if (callback)
+		{
+			callback(m_UTeamColorRecordsPersistent[id]);
+		}
 		return true;
 	}
 
@@ -79,18 +99,24 @@ const bool UTeamColorRecordDatabase::AsyncPreLoadRecord(uint32 id, TFunction<voi
 		{
 			if (static_cast<uint32>(m_UTeamColorRecordsPersistent.Num()) <= id || static_cast<uint32>(m_UTeamColorRecords.Num()) <= id)
 			{
+				if (callback)
+				{
+					callback(nullptr);
+				}
 				return;
 			}
 
 			m_UTeamColorRecordsPersistent[id] = m_UTeamColorRecords[id].Get();
 			if (m_UTeamColorRecordsPersistent[id])
 			{
-				m_UTeamColorRecordsPersistent[id]->OnAsyncLoaded();
 				m_UTeamColorRecordsPersistent[id]->m_id = id;
-				if (callback)
-				{
-					callback(m_UTeamColorRecordsPersistent[id]);
-				}
+				m_UTeamColorRecordsPersistent[id]->OnAsyncLoaded();
+			}
+
+			// Always report back, even on failure, so callers waiting on a batch of loads can complete.
+			if (callback)
+			{
+				callback(m_UTeamColorRecordsPersistent[id]);
 			}
 		})
 	);
@@ -134,6 +160,11 @@ void UTeamColorRecordDatabase::ResetPersistentObjectPointerArray()
 	m_UTeamColorRecordsPersistent.Reset();
 }
 
+uint32 UTeamColorRecordDatabase::GetNumRecords() const
+{
+	return static_cast<uint32>(m_UTeamColorRecords.Num());
+}
+
 #if WITH_EDITOR
 void UTeamColorRecordDatabase::PreSave(FObjectPreSaveContext saveContext)
 {
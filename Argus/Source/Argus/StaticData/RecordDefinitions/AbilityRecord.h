@@ -24,12 +24,27 @@ enum class EReticleFlags : uint8
 };
 ENUM_CLASS_FLAGS(EReticleFlags);
 
+struct AbilityRecordData
+{
+	static constexpr uint8 k_maxSpawnedEntityCategories = 8u;
+
+	FResourceSet m_requiredResourceChangeToCast;
+	FEntityCategory m_spawnedEntityCategories[k_maxSpawnedEntityCategories];
+	float m_timeToCastSeconds = 0.0f;
+	uint8 m_numSpawnedEntityCategories = 0u;
+	uint8 m_reticleFlags = 0u;
+
+	bool DoesAbilitySpawnEntityOfCategory(FEntityCategory entityCategory) const;
+};
+
 UCLASS(BlueprintType)
 class ARGUS_API UAbilityRecord : public UArgusStaticRecord
 {
 	GENERATED_BODY()
 
 public:
+	using FlatRecord = AbilityRecordData;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (TitleProperty = ""))
 	TArray<FAbilityEffect> m_abilityEffects;
 
@@ -6,12 +6,21 @@
 #include "ComponentDependencies/ResourceSet.h"
 #include "ResourceSetRecord.generated.h"
 
+struct ResourceSetRecordData
+{
+	FResourceSet m_resourceSet;
+};
+
 UCLASS(BlueprintType)
 class ARGUS_API UResourceSetRecord : public UArgusStaticRecord
 {
 	GENERATED_BODY()
 
 public:
+	using FlatRecord = ResourceSetRecordData;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
 	FResourceSet m_resourceSet;
+
+	void OnAsyncLoaded() const override;
 };
\ No newline at end of file
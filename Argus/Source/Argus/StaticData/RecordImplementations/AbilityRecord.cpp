@@ -3,10 +3,53 @@
 #include "RecordDefinitions/AbilityRecord.h"
 #include "ArgusEntityTemplate.h"
 #include "ArgusStaticData.h"
+#include "ArgusStaticRecordTable.h"
 #include "Systems/AbilitySystems.h"
 
+bool AbilityRecordData::DoesAbilitySpawnEntityOfCategory(FEntityCategory entityCategory) const
+{
+	for (uint8 i = 0u; i < m_numSpawnedEntityCategories; ++i)
+	{
+		if (m_spawnedEntityCategories[i] == entityCategory)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void UAbilityRecord::OnAsyncLoaded() const
 {
+	AbilityRecordData flatRecord;
+	flatRecord.m_requiredResourceChangeToCast = m_requiredResourceChangeToCast;
+	flatRecord.m_timeToCastSeconds = m_timeToCastSeconds;
+	flatRecord.m_reticleFlags = m_reticleFlags;
+	for (const TPair<FEntityCategory, bool>& keyValuePair : m_isEntityCategorySpawnedByAbility)
+	{
+		if (!keyValuePair.Value)
+		{
+			continue;
+		}
+
+		if (flatRecord.m_numSpawnedEntityCategories >= AbilityRecordData::k_maxSpawnedEntityCategories)
+		{
+			ARGUS_LOG
+			(
+				ArgusStaticDataLog, Warning,
+				TEXT("[%s] %s spawns more than %d entity categories. %s needs to be raised or the extra categories will be ignored by the flat table."),
+				ARGUS_FUNCNAME,
+				*GetName(),
+				AbilityRecordData::k_maxSpawnedEntityCategories,
+				ARGUS_NAMEOF(AbilityRecordData::k_maxSpawnedEntityCategories)
+			);
+			break;
+		}
+
+		flatRecord.m_spawnedEntityCategories[flatRecord.m_numSpawnedEntityCategories++] = keyValuePair.Key;
+	}
+	ArgusStaticRecordTable<UAbilityRecord>::Populate(m_id, flatRecord);
+
 	if (m_abilityIcon)
 	{
 		m_abilityIcon.AsyncPreLoadAndStorePtr();
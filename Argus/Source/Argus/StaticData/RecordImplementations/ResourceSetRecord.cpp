@@ -0,0 +1,11 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "RecordDefinitions/ResourceSetRecord.h"
+#include "ArgusStaticRecordTable.h"
+
+void UResourceSetRecord::OnAsyncLoaded() const
+{
+	ResourceSetRecordData flatRecord;
+	flatRecord.m_resourceSet = m_resourceSet;
+	ArgusStaticRecordTable<UResourceSetRecord>::Populate(m_id, flatRecord);
+}
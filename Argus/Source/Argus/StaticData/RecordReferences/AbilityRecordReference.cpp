@@ -5,6 +5,11 @@
 #include "RecordDefinitions/AbilityRecord.h"
 #include "ArgusLogging.h"
 
+const UClass* FUAbilityRecordReference::GetRecordClass() const
+{
+	return UAbilityRecord::StaticClass();
+}
+
 #if WITH_EDITOR && WITH_EDITORONLY_DATA
 void FUAbilityRecordReference::StoreId() const
 {
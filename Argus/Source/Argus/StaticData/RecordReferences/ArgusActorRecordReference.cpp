@@ -5,6 +5,11 @@
 #include "RecordDefinitions/ArgusActorRecord.h"
 #include "ArgusLogging.h"
 
+const UClass* FUArgusActorRecordReference::GetRecordClass() const
+{
+	return UArgusActorRecord::StaticClass();
+}
+
 #if WITH_EDITOR && WITH_EDITORONLY_DATA
 void FUArgusActorRecordReference::StoreId() const
 {
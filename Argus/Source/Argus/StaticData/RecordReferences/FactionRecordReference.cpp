@@ -5,6 +5,11 @@
 #include "RecordDefinitions/FactionRecord.h"
 #include "ArgusLogging.h"
 
+const UClass* FUFactionRecordReference::GetRecordClass() const
+{
+	return UFactionRecord::StaticClass();
+}
+
 #if WITH_EDITOR && WITH_EDITORONLY_DATA
 void FUFactionRecordReference::StoreId() const
 {
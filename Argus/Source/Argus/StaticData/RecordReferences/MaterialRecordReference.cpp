@@ -5,6 +5,11 @@
 #include "RecordDefinitions/MaterialRecord.h"
 #include "ArgusLogging.h"
 
+const UClass* FUMaterialRecordReference::GetRecordClass() const
+{
+	return UMaterialRecord::StaticClass();
+}
+
 #if WITH_EDITOR && WITH_EDITORONLY_DATA
 void FUMaterialRecordReference::StoreId() const
 {
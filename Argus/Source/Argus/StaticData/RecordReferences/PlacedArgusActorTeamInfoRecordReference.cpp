@@ -5,6 +5,11 @@
 #include "RecordDefinitions/PlacedArgusActorTeamInfoRecord.h"
 #include "ArgusLogging.h"
 
+const UClass* FUPlacedArgusActorTeamInfoRecordReference::GetRecordClass() const
+{
+	return UPlacedArgusActorTeamInfoRecord::StaticClass();
+}
+
 #if WITH_EDITOR && WITH_EDITORONLY_DATA
 void FUPlacedArgusActorTeamInfoRecordReference::StoreId() const
 {
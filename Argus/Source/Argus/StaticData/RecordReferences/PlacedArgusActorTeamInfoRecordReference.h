@@ -14,6 +14,8 @@ struct FUPlacedArgusActorTeamInfoRecordReference : public FArgusStaticRecordRefe
 	GENERATED_BODY();
 
 public:
+	const UClass* GetRecordClass() const override;
+
 #if WITH_EDITOR && WITH_EDITORONLY_DATA
 	void StoreId() const override;
 #endif
@@ -5,6 +5,11 @@
 #include "RecordDefinitions/ResourceSetRecord.h"
 #include "ArgusLogging.h"
 
+const UClass* FUResourceSetRecordReference::GetRecordClass() const
+{
+	return UResourceSetRecord::StaticClass();
+}
+
 #if WITH_EDITOR && WITH_EDITORONLY_DATA
 void FUResourceSetRecordReference::StoreId() const
 {
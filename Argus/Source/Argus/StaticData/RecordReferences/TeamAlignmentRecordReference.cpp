@@ -5,6 +5,11 @@
 #include "RecordDefinitions/TeamAlignmentRecord.h"
 #include "ArgusLogging.h"
 
+const UClass* FUTeamAlignmentRecordReference::GetRecordClass() const
+{
+	return UTeamAlignmentRecord::StaticClass();
+}
+
 #if WITH_EDITOR && WITH_EDITORONLY_DATA
 void FUTeamAlignmentRecordReference::StoreId() const
 {
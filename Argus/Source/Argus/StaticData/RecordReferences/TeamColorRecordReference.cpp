@@ -5,6 +5,11 @@
 #include "RecordDefinitions/TeamColorRecord.h"
 #include "ArgusLogging.h"
 
+const UClass* FUTeamColorRecordReference::GetRecordClass() const
+{
+	return UTeamColorRecord::StaticClass();
+}
+
 #if WITH_EDITOR && WITH_EDITORONLY_DATA
 void FUTeamColorRecordReference::StoreId() const
 {
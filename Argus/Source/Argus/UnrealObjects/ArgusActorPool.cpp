@@ -40,6 +40,37 @@ AArgusActor* UArgusActorPool::Take(UWorld* worldPointer, UClass* classPointer)
 	return cachedActor;
 }
 
+void UArgusActorPool::PreWarm(UWorld* worldPointer, UClass* classPointer, uint32 numActors)
+{
+	ARGUS_MEMORY_TRACE(UArgusActorPool);
+
+	if (!worldPointer || !classPointer)
+	{
+		return;
+	}
+
+	FActorArray& actorArray = m_availableObjects.FindOrAdd(classPointer);
+	const uint32 numAlreadyAvailable = static_cast<uint32>(actorArray.m_actors.Num());
+	if (numAlreadyAvailable >= numActors)
+	{
+		return;
+	}
+
+	actorArray.m_actors.Reserve(numActors);
+	for (uint32 i = numAlreadyAvailable; i < numActors; ++i)
+	{
+		AArgusActor* spawnedActor = worldPointer->SpawnActor<AArgusActor>(classPointer);
+		if (!spawnedActor)
+		{
+			return;
+		}
+
+		spawnedActor->Hide();
+		actorArray.m_actors.Add(spawnedActor);
+		m_numAvailableObjects++;
+	}
+}
+
 void UArgusActorPool::Release(AArgusActor*& actorPointer)
 {
 	ARGUS_MEMORY_TRACE(UArgusActorPool);
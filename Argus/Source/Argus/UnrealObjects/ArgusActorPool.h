@@ -26,6 +26,7 @@ public:
 	~UArgusActorPool();
 
 	AArgusActor* Take(UWorld* worldPointer, UClass* classSoftPointer);
+	void PreWarm(UWorld* worldPointer, UClass* classPointer, uint32 numActors);
 	void Release(AArgusActor*& actorPointer);
 	void Release(TObjectPtr<AArgusActor>& actorPointer);
 	void ClearPool();
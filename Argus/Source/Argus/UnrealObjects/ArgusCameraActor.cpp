@@ -10,6 +10,7 @@
 #include "Engine/World.h"
 #include "Misc/Optional.h"
 #include "Systems/FogOfWarSystems.h"
+#include "Systems/LODSystems.h"
 
 uint8 AArgusCameraActor::s_numWidgetPanningBlockers = 0u;
 FVector AArgusCameraActor::s_moveUpDir = FVector::UpVector;
@@ -324,6 +325,7 @@ void AArgusCameraActor::UpdateEntitiesInViewFrustrum(ETeam playerTeam)
 
 	QueryEntitiesInFrustrum(groundPlaneLocation, cameraFrustrumEdges, spatialPartitioningComponent->m_argusEntityKDTree, playerTeam);
 	QueryEntitiesInFrustrum(flyingPlaneLocation, cameraFrustrumEdges, spatialPartitioningComponent->m_flyingArgusEntityKDTree, playerTeam);
+	UpdateEntitySimulationLODs();
 }
 
 void AArgusCameraActor::PopulateCameraFrustrumEdges(CameraFrustrumEdges& frustrumEdgesToPopulate)
@@ -416,6 +418,25 @@ void AArgusCameraActor::QueryEntitiesInFrustrum(const FVector& planeLocation, co
 	}
 }
 
+void AArgusCameraActor::UpdateEntitySimulationLODs() const
+{
+	ARGUS_TRACE(AArgusCameraActor::UpdateEntitySimulationLODs);
+
+	const FVector cameraLocation = GetActorLocation();
+	ArgusIterators::IterateEntities([&cameraLocation](ArgusEntity entity)
+	{
+		LODComponent* lodComponent = entity.GetComponent<LODComponent>();
+		const TransformComponent* transformComponent = entity.GetComponent<TransformComponent>();
+		if (!lodComponent || !transformComponent)
+		{
+			return;
+		}
+
+		const float distanceToCameraSquared = FVector::DistSquared(cameraLocation, transformComponent->m_location);
+		lodComponent->m_simulationLOD = LODSystems::CalculateSimulationLOD(lodComponent->m_bIsInViewFrustrum, distanceToCameraSquared);
+	});
+}
+
 void AArgusCameraActor::PopulateTraceStartAndEnd(FVector& outTraceStart, FVector& outTraceEnd) const
 {
 	const FVector forwardVector = GetActorForwardVector();
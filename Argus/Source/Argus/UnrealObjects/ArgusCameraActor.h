@@ -38,6 +38,7 @@ public:
 	void UpdateCamera(const UpdateCameraPanningParameters& cameraParameters, float deltaTime, ETeam playerTeam);
 	void UpdateCameraOrbit(const float inputOrbitValue);
 	void UpdateCameraZoom(const float inputZoomValue);
+	void UpdateEntitiesInViewFrustrum(ETeam playerTeam);
 
 	const FVector GetZoomTargetTranslation() const { return m_currentZoomTranslationAmount.GetValue() * GetActorForwardVector(); }
 	const FVector& GetCameraLocationWithoutZoom() const { return m_cameraLocationWithoutZoom; }
@@ -121,10 +122,10 @@ private:
 	void UpdateCameraOrbitInternal(const float deltaTime);
 	void UpdateCameraPanning(const UpdateCameraPanningParameters& cameraParameters, const float deltaTime);
 	void UpdateCameraZoomInternal(const float deltaTime);
-	void UpdateEntitiesInViewFrustrum(ETeam playerTeam);
 
 	void PopulateCameraFrustrumEdges(CameraFrustrumEdges& frustrumEdgesToPopulate);
 	void QueryEntitiesInFrustrum(const FVector& planeLocation, const CameraFrustrumEdges& cameraFrustrumEdges, ArgusEntityKDTree& entityKDTree, ETeam playerTeam) const;
+	void UpdateEntitySimulationLODs() const;
 	
 	void PopulateTraceStartAndEnd(FVector& outTraceStart, FVector& outTraceEnd) const;
 	void TraceToGround(TOptional<FHitResult>& hitResult);
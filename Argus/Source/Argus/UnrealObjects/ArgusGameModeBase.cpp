@@ -1,12 +1,15 @@
 // Copyright Karazaa. This is a part of an RTS project called Argus.
 
 #include "ArgusGameModeBase.h"
+#include "ArgusActor.h"
 #include "ArgusEntityTemplate.h"
 #include "ArgusGameInstance.h"
 #include "ArgusGameStateBase.h"
 #include "ArgusIterators.h"
 #include "ArgusPlayerController.h"
 #include "ArgusStaticData.h"
+#include "ArgusStaticDataPreloader.h"
+#include "ArgusStaticRecordTable.h"
 #include "EngineUtils.h"
 #include "Misc/App.h"
 #include "RecordDefinitions/ArgusActorRecord.h"
@@ -28,6 +31,7 @@ AArgusGameModeBase::~AArgusGameModeBase()
 void AArgusGameModeBase::StartPlay()
 {
 	ArgusStaticData::ResetLoadedPointerArrays();
+	ArgusStaticRecordTables::InitializeAllTables();
 	ArgusEntity::FlushAllEntities();
 
 	m_argusActorPool = NewObject<UArgusActorPool>(this, FName(TEXT("ArgusActorPool")));
@@ -36,6 +40,11 @@ void AArgusGameModeBase::StartPlay()
 	{
 		m_saveManager->Initialize(this);
 	}
+	m_replayManager = NewObject<UArgusReplayManager>(this, FName(TEXT("ReplayManager")));
+	if (m_replayManager)
+	{
+		m_replayManager->Initialize(this);
+	}
 
 	UWorld* worldPointer = GetWorld();
 	ARGUS_RETURN_ON_NULL(worldPointer, ArgusUnrealObjectsLog);
@@ -55,9 +64,28 @@ void AArgusGameModeBase::StartPlay()
 		m_activePlayerController->InitializeUIWidgets();
 	}
 
-	ArgusSystemsManager::OnStartPlay(worldPointer, m_activePlayerController->GetPlayerTeam());
-	m_argusSystemsThread.Init();
-	m_argusSystemsThread.StartThread();
+	// Everything reachable from the game mode and the placed actors makes up this map's preload manifest.
+	TArray<const UObject*> preLoadRootObjects;
+	preLoadRootObjects.Add(this);
+	for (const AArgusActor* argusActor : TActorRange<AArgusActor>(worldPointer))
+	{
+		preLoadRootObjects.Add(argusActor);
+	}
+
+	TWeakObjectPtr<AArgusGameModeBase> weakThis = this;
+	ArgusStaticDataPreloader::PreLoadReferencedRecords(preLoadRootObjects, [weakThis]()
+	{
+		if (AArgusGameModeBase* gameMode = weakThis.Get())
+		{
+			gameMode->OnStaticDataPreLoaded();
+		}
+	});
+}
+
+void AArgusGameModeBase::EndPlay(const EEndPlayReason::Type endPlayReason)
+{
+	ArgusStaticDataPreloader::SetSynchronousRecordLoadsDisallowed(false);
+	Super::EndPlay(endPlayReason);
 }
 
 void AArgusGameModeBase::Tick(float deltaTime)
@@ -66,13 +94,27 @@ void AArgusGameModeBase::Tick(float deltaTime)
 
 	Super::Tick(deltaTime);
 
+	// Hold the simulation until every record the map references has finished loading.
+	if (ArgusStaticDataPreloader::IsPreLoading())
+	{
+		return;
+	}
+
 	if (m_saveManager)
 	{
 		if (m_saveManager->HasLoadRequest())
 		{
+			InterruptReplayManager();
 			m_saveManager->ExecuteLoadRequest();
 			return;
 		}
+
+		if (m_saveManager->HasRewindRequest())
+		{
+			InterruptReplayManager();
+			m_saveManager->ExecuteRewindRequest();
+			return;
+		}
 		
 		if (m_saveManager->IsLoading())
 		{
@@ -80,6 +122,24 @@ void AArgusGameModeBase::Tick(float deltaTime)
 		}
 	}
 
+	if (m_replayManager)
+	{
+		if (m_replayManager->HasRecordRequest())
+		{
+			m_replayManager->ExecuteRecordRequest();
+			return;
+		}
+
+		if (m_replayManager->HasReplayRequest())
+		{
+			m_replayManager->ExecuteReplayRequest();
+			return;
+		}
+
+		// Replays drive the simulation with the recorded deltaTime stream rather than the engine's.
+		deltaTime = m_replayManager->GetFrameDeltaTime(deltaTime);
+	}
+
 	const float unscaledDeltaTime = FApp::GetDeltaTime();
 
 	UWorld* worldPointer = GetWorld();
@@ -108,14 +168,72 @@ void AArgusGameModeBase::Tick(float deltaTime)
 
 	m_activePlayerController->CleanUpArgusPlayerInput();
 
+	if (m_replayManager)
+	{
+		m_replayManager->EndFrame(deltaTime);
+	}
+
+	if (m_saveManager)
+	{
+		m_saveManager->TickRewindBuffer();
+	}
+
 #if !UE_BUILD_SHIPPING
 	if (m_saveManager)
 	{
 		m_saveManager->DrawDebugger();
 	}
+	if (m_replayManager)
+	{
+		m_replayManager->DrawDebugger();
+	}
+#endif //!UE_BUILD_SHIPPING
+}
+
+void AArgusGameModeBase::OnStaticDataPreLoaded()
+{
+	UWorld* worldPointer = GetWorld();
+	ARGUS_RETURN_ON_NULL(worldPointer, ArgusUnrealObjectsLog);
+	ARGUS_RETURN_ON_NULL(m_activePlayerController, ArgusUnrealObjectsLog);
+
+	PreWarmActorPool(worldPointer);
+
+	ArgusSystemsManager::OnStartPlay(worldPointer, m_activePlayerController->GetPlayerTeam());
+	m_argusSystemsThread.Init();
+	m_argusSystemsThread.StartThread();
+
+#if !UE_BUILD_SHIPPING
+	ArgusStaticDataPreloader::SetSynchronousRecordLoadsDisallowed(true);
 #endif //!UE_BUILD_SHIPPING
 }
 
+void AArgusGameModeBase::PreWarmActorPool(UWorld* worldPointer)
+{
+	ARGUS_TRACE(AArgusGameModeBase::PreWarmActorPool);
+	ARGUS_RETURN_ON_NULL(m_argusActorPool, ArgusUnrealObjectsLog);
+
+	// Every actor record in this map's preload manifest can be spawned during play, so build its actors now rather than on the first wave.
+	const TArray<const UArgusStaticRecord*>& preLoadedRecords = ArgusStaticDataPreloader::GetPreLoadedRecords();
+	for (int32 i = 0; i < preLoadedRecords.Num(); ++i)
+	{
+		const UArgusActorRecord* argusActorRecord = Cast<UArgusActorRecord>(preLoadedRecords[i]);
+		if (!argusActorRecord)
+		{
+			continue;
+		}
+
+		m_argusActorPool->PreWarm(worldPointer, argusActorRecord->m_argusActorClass.LoadAndStorePtr(), m_numActorsToPreWarmPerClass);
+	}
+}
+
+void AArgusGameModeBase::InterruptReplayManager()
+{
+	if (m_replayManager)
+	{
+		m_replayManager->Interrupt();
+	}
+}
+
 void AArgusGameModeBase::ManageActorStateForEntities(const UWorld* worldPointer, float deltaTime)
 {
 	ARGUS_TRACE(AArgusGameModeBase::ManageActorStateForEntities);
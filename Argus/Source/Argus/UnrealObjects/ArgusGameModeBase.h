@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "ArgusActorPool.h"
+#include "ArgusReplayManager.h"
 #include "ArgusSaveManager.h"
 #include "ArgusSystemsManager.h"
 #include "ArgusSystemsThread.h"
@@ -20,7 +21,7 @@ class UArgusGameInstance;
 class UUserWidget;
 
 UCLASS()
-class AArgusGameModeBase : public AGameModeBase
+class ARGUS_API AArgusGameModeBase : public AGameModeBase
 {
 	GENERATED_BODY()
 	
@@ -31,8 +32,10 @@ public:
 	AArgusGameModeBase();
 	~AArgusGameModeBase();
 	virtual void StartPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type endPlayReason) override;
 
 	AArgusPlayerController* GetActivePlayerController() const { return m_activePlayerController.Get(); }
+	const UArgusEntityTemplate* GetSingletonEntityTemplate() const { return m_singletonEntityTemplate.Get(); }
 
 protected:
 	UPROPERTY(EditDefaultsOnly, Category = "EntityTemplates")
@@ -53,6 +56,9 @@ protected:
 	UPROPERTY(Transient)
 	TObjectPtr<UArgusSaveManager> m_saveManager = nullptr;
 
+	UPROPERTY(Transient)
+	TObjectPtr<UArgusReplayManager> m_replayManager = nullptr;
+
 	virtual void Tick(float deltaTime) override;
 
 private:
@@ -63,11 +69,18 @@ private:
 	void DespawnActorForEntity(ArgusEntity despawnedEntity);
 	void OnLoadStart();
 	void OnLoadComplete();
+	void OnStaticDataPreLoaded();
+	void PreWarmActorPool(UWorld* worldPointer);
+	void InterruptReplayManager();
 
 	UPROPERTY(VisibleAnywhere, Instanced)
 	TObjectPtr<UArgusActorPool> m_argusActorPool = nullptr;
 
+	UPROPERTY(EditAnywhere, Category = "EntityTemplates")
+	uint32 m_numActorsToPreWarmPerClass = 8u;
+
 	ArgusSystemsThread m_argusSystemsThread = ArgusSystemsThread();
 
 	friend class UArgusSaveManager;
+	friend class UArgusReplayManager;
 };
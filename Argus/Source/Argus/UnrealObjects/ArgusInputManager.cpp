@@ -8,6 +8,7 @@
 #include "ArgusInputActionSet.h"
 #include "ArgusLogging.h"
 #include "ArgusPlayerController.h"
+#include "ArgusReplayManager.h"
 #include "ArgusStaticData.h"
 #include "ArgusTesting.h"
 #include "EnhancedInputComponent.h"
@@ -324,6 +325,14 @@ void UArgusInputManager::ProcessPlayerInput(AArgusCameraActor* argusCamera, cons
 
 	SetReticleState();
 
+	const UArgusReplayManager* replayManager = UArgusReplayManager::Get();
+	if (replayManager && replayManager->IsReplaying())
+	{
+		m_inputEventsThisFrame.Empty();
+		ProcessReplayCommands(argusCamera, replayManager);
+		return;
+	}
+
 	const int inputsEventsThisFrameCount = m_inputEventsThisFrame.Num();
 	for (int i = 0; i < inputsEventsThisFrameCount; ++i)
 	{
@@ -337,6 +346,11 @@ void UArgusInputManager::ProcessPlayerInput(AArgusCameraActor* argusCamera, cons
 	{
 		argusCamera->UpdateCamera(updateCameraParameters, unscaledDeltaTime, m_owningPlayerController->GetPlayerTeam());
 	}
+
+	if (UArgusReplayManager* recordingReplayManager = UArgusReplayManager::Get())
+	{
+		recordingReplayManager->RecordCameraTransform(argusCamera->GetActorLocation(), argusCamera->GetActorQuat());
+	}
 }
 
 void UArgusInputManager::CleanUpInputState() const
@@ -594,15 +608,15 @@ void UArgusInputManager::ProcessInputEvent(AArgusCameraActor* argusCamera, const
 			ProcessMarqueeSelectInputEvent(argusCamera, true);
 			break;
 		case InputType::MoveTo:
-			InputInterfaceSystems::InterruptReticle();
+			ExecuteCommand(ArgusReplayCommand(EArgusReplayCommandType::InterruptReticle));
 			ProcessMoveToInputEvent(false);
 			break;
 		case InputType::AttackMoveTo:
-			InputInterfaceSystems::InterruptReticle();
+			ExecuteCommand(ArgusReplayCommand(EArgusReplayCommandType::InterruptReticle));
 			ProcessMoveToInputEvent(true);
 			break;
 		case InputType::SetWaypoint:
-			InputInterfaceSystems::InterruptReticle();
+			ExecuteCommand(ArgusReplayCommand(EArgusReplayCommandType::InterruptReticle));
 			ProcessSetWaypointInputEvent();
 			break;
 		case InputType::Zoom:
@@ -621,7 +635,7 @@ void UArgusInputManager::ProcessInputEvent(AArgusCameraActor* argusCamera, const
 			ProcessAbilityInputEvent(EAbilityIndex::Ability3);
 			break;
 		case InputType::Escape:
-			InputInterfaceSystems::InterruptReticle();
+			ExecuteCommand(ArgusReplayCommand(EArgusReplayCommandType::InterruptReticle));
 			ProcessEscapeInputEvent();
 			break;
 		case InputType::RotateCamera:
@@ -714,7 +728,7 @@ void UArgusInputManager::ProcessInputEvent(AArgusCameraActor* argusCamera, const
 			ProcessSetControlGroup(11u);
 			break;
 		case InputType::ChangeActiveAbilityGroup:
-			InputInterfaceSystems::InterruptReticle();
+			ExecuteCommand(ArgusReplayCommand(EArgusReplayCommandType::InterruptReticle));
 			ProcessChangeActiveAbilityGroup();
 			break;
 		case InputType::UserInterfaceEntityClicked:
@@ -777,14 +791,10 @@ void UArgusInputManager::ProcessSelectInputEvent(bool isAdditive)
 		return;
 	}
 
-	if (isAdditive)
-	{
-		InputInterfaceSystems::AddSelectedEntityAdditive(argusActor->GetEntity(), m_owningPlayerController->GetMoveToLocationDecalActorRecord());
-	}
-	else
-	{
-		InputInterfaceSystems::AddSelectedEntityExclusive(argusActor->GetEntity(), m_owningPlayerController->GetMoveToLocationDecalActorRecord());
-	}
+	ArgusReplayCommand command = ArgusReplayCommand(EArgusReplayCommandType::SelectEntity);
+	command.m_entityIds.Add(argusActor->GetEntity().GetId());
+	command.m_isAdditive = isAdditive;
+	ExecuteCommand(command);
 
 	if (ArgusCVars::CVarEnableVerboseArgusInputLogging.GetValueOnGameThread())
 	{
@@ -829,7 +839,7 @@ void UArgusInputManager::ProcessMarqueeSelectInputEvent(const AArgusCameraActor*
 	{
 		if (reticleComponent->IsReticleEnabled())
 		{
-			ProcessReticleAbilityForSelectedEntities(reticleComponent);
+			ExecuteCommand(ArgusReplayCommand(EArgusReplayCommandType::CastReticleAbility));
 			return;
 		}
 	}
@@ -893,14 +903,10 @@ void UArgusInputManager::ProcessMarqueeSelectInputEvent(const AArgusCameraActor*
 		);
 	}
 
-	if (!isAdditive && numFoundEntities > 0)
-	{
-		InputInterfaceSystems::AddMultipleSelectedEntitiesExclusive(entityIdsWithinBounds, m_owningPlayerController->GetMoveToLocationDecalActorRecord());
-	}
-	else
-	{
-		InputInterfaceSystems::AddMultipleSelectedEntitiesAdditive(entityIdsWithinBounds, m_owningPlayerController->GetMoveToLocationDecalActorRecord());
-	}
+	ArgusReplayCommand command = ArgusReplayCommand(EArgusReplayCommandType::SelectEntities);
+	command.m_entityIds = MoveTemp(entityIdsWithinBounds);
+	command.m_isAdditive = isAdditive;
+	ExecuteCommand(command);
 }
 
 void UArgusInputManager::PopulateMarqueeSelectPolygon(const AArgusCameraActor* argusCamera, TArray<FVector2D>& convexPolygon)
@@ -959,9 +965,6 @@ void UArgusInputManager::PopulateMarqueeSelectPolygon(const AArgusCameraActor* a
 
 void UArgusInputManager::ProcessMoveToInputEvent(bool onAttackMove)
 {
-	InputInterfaceComponent* inputInterfaceComponent = ArgusEntity::GetSingletonEntity().GetComponent<InputInterfaceComponent>();
-	ARGUS_RETURN_ON_NULL(inputInterfaceComponent, ArgusECSLog);
-
 	if (!ValidateOwningPlayerController())
 	{
 		return;
@@ -991,23 +994,15 @@ void UArgusInputManager::ProcessMoveToInputEvent(bool onAttackMove)
 		);
 	}
 
-	EMovementState inputMovementState = EMovementState::ProcessMoveToLocationCommand;
-	ArgusEntity targetEntity = ArgusEntity::k_emptyEntity;
-	ArgusEntity decalEntity = ArgusEntity::k_emptyEntity;
+	// The target entity id is only present when an actor was hit, which is what decides between a move to entity and a move to location.
+	ArgusReplayCommand command = ArgusReplayCommand(EArgusReplayCommandType::MoveTo);
+	command.m_location = targetLocation;
+	command.m_onAttackMove = onAttackMove;
 	if (AArgusActor* argusActor = Cast<AArgusActor>(hitResult.GetActor()))
 	{
-		targetEntity = argusActor->GetEntity();
-		if (targetEntity && targetEntity.GetComponent<TransformComponent>())
-		{
-			inputMovementState = EMovementState::ProcessMoveToEntityCommand;
-		}
+		command.m_entityIds.Add(argusActor->GetEntity().GetId());
 	}
-	else if (inputInterfaceComponent->m_selectedArgusEntityIds.Num() > 0)
-	{
-		decalEntity = DecalSystems::InstantiateMoveToLocationDecalEntity(m_owningPlayerController->GetMoveToLocationDecalActorRecord(), targetLocation, inputInterfaceComponent->m_selectedArgusEntityIds.Num(), ArgusECSConstants::k_maxEntities, EDecalTypePolicy::DeferredPopulation);
-	}
-
-	InputInterfaceSystems::MoveSelectedEntitiesToTarget(inputMovementState, targetEntity, targetLocation, decalEntity, onAttackMove);
+	ExecuteCommand(command);
 }
 
 void UArgusInputManager::ProcessSetWaypointInputEvent()
@@ -1041,14 +1036,9 @@ void UArgusInputManager::ProcessSetWaypointInputEvent()
 		);
 	}
 
-	const uint16 numWaypointEligibleEntities = InputInterfaceSystems::GetNumWaypointEligibleEntities();
-	if (numWaypointEligibleEntities == 0u)
-	{
-		return;
-	}
-	
-	ArgusEntity decalEntity = DecalSystems::InstantiateMoveToLocationDecalEntity(m_owningPlayerController->GetMoveToLocationDecalActorRecord(), targetLocation, numWaypointEligibleEntities, DecalSystems::GetMostRecentSelectedWaypointDecalEntityId(), EDecalTypePolicy::PopulateMoveToLocation);
-	InputInterfaceSystems::SetWaypointForSelectedEntities(targetLocation, decalEntity);
+	ArgusReplayCommand command = ArgusReplayCommand(EArgusReplayCommandType::SetWaypoint);
+	command.m_location = targetLocation;
+	ExecuteCommand(command);
 }
 
 void UArgusInputManager::ProcessZoomInputEvent(AArgusCameraActor* argusCamera, const FInputActionValue& value)
@@ -1081,7 +1071,9 @@ void UArgusInputManager::ProcessAbilityInputEvent(EAbilityIndex abilityIndex)
 		);
 	}
 
-	InputInterfaceSystems::SetAbilityStateForCastIndex(abilityIndex);
+	ArgusReplayCommand command = ArgusReplayCommand(EArgusReplayCommandType::CastAbility);
+	command.m_index = static_cast<uint8>(abilityIndex);
+	ExecuteCommand(command);
 }
 
 void UArgusInputManager::ProcessEscapeInputEvent()
@@ -1111,18 +1103,21 @@ void UArgusInputManager::ProcessControlGroup(uint8 controlGroupIndex, AArgusCame
 {
 	ARGUS_RETURN_ON_NULL(argusCamera, ArgusInputLog);
 
-	InputInterfaceSystems::SelectControlGroup(controlGroupIndex, m_owningPlayerController->GetMoveToLocationDecalActorRecord());
-	argusCamera->FocusOnArgusEntity(InputInterfaceSystems::GetASelectedEntity());
+	ArgusReplayCommand command = ArgusReplayCommand(EArgusReplayCommandType::SelectControlGroup);
+	command.m_index = controlGroupIndex;
+	ExecuteCommand(command);
 }
 
 void UArgusInputManager::ProcessSetControlGroup(uint8 controlGroupIndex)
 {
-	InputInterfaceSystems::SetControlGroup(controlGroupIndex);
+	ArgusReplayCommand command = ArgusReplayCommand(EArgusReplayCommandType::SetControlGroup);
+	command.m_index = controlGroupIndex;
+	ExecuteCommand(command);
 }
 
 void UArgusInputManager::ProcessChangeActiveAbilityGroup()
 {
-	InputInterfaceSystems::ChangeActiveAbilityGroup();
+	ExecuteCommand(ArgusReplayCommand(EArgusReplayCommandType::ChangeActiveAbilityGroup));
 }
 
 void UArgusInputManager::ProcessUserInterfaceEntityClicked(ArgusEntity entity)
@@ -1133,7 +1128,9 @@ void UArgusInputManager::ProcessUserInterfaceEntityClicked(ArgusEntity entity)
 		return;
 	}
 
-	InputInterfaceSystems::AddSelectedEntityExclusive(entity, m_owningPlayerController->GetMoveToLocationDecalActorRecord());
+	ArgusReplayCommand command = ArgusReplayCommand(EArgusReplayCommandType::SelectEntity);
+	command.m_entityIds.Add(entity.GetId());
+	ExecuteCommand(command);
 }
 
 void UArgusInputManager::ProcessUserInterfaceFocusEntityClicked(ArgusEntity entity)
@@ -1178,13 +1175,38 @@ void UArgusInputManager::SetReticleState()
 		reticleComponent->m_wasAbilityCast = false;
 	}
 
+	// Whether the reticle is blocked depends on the world as well as on where it is, so it is refreshed every frame without issuing a command.
+	UpdateReticleBlockedState(reticleComponent, abilityRecord);
+
+	// While replaying, the reticle is moved by recorded commands instead of the mouse.
+	const UArgusReplayManager* replayManager = UArgusReplayManager::Get();
+	if (replayManager && replayManager->IsReplaying())
+	{
+		return;
+	}
+
 	FHitResult hitResult;
 	if (!m_owningPlayerController->GetMouseProjectionLocation(ECC_RETICLE, hitResult))
 	{
 		return;
 	}
 
-	reticleComponent->m_reticleLocation = hitResult.Location;
+	// Only a reticle that actually moved is worth a command. Otherwise a recording would hold one for every frame the reticle is up.
+	if (hitResult.Location == reticleComponent->m_reticleLocation)
+	{
+		return;
+	}
+
+	ArgusReplayCommand command = ArgusReplayCommand(EArgusReplayCommandType::MoveReticle);
+	command.m_location = hitResult.Location;
+	ExecuteCommand(command);
+}
+
+void UArgusInputManager::UpdateReticleBlockedState(ReticleComponent* reticleComponent, const UAbilityRecord* abilityRecord)
+{
+	ARGUS_RETURN_ON_NULL(reticleComponent, ArgusInputLog);
+	ARGUS_RETURN_ON_NULL(abilityRecord, ArgusInputLog);
+
 	reticleComponent->m_isBlocked = !FogOfWarSystems::HasLocationEverBeenRevealed(reticleComponent->m_reticleLocation);
 	if (!reticleComponent->m_isBlocked)
 	{
@@ -1207,4 +1229,145 @@ void UArgusInputManager::ProcessReticleAbilityForSelectedEntities(const ReticleC
 	}
 
 	InputInterfaceSystems::SetAbilityStateForReticleAbility(reticleComponent);
+}
+
+void UArgusInputManager::ExecuteCommand(const ArgusReplayCommand& command)
+{
+	ARGUS_TRACE(UArgusInputManager::ExecuteCommand);
+
+	if (!ValidateOwningPlayerController())
+	{
+		return;
+	}
+
+	if (UArgusReplayManager* replayManager = UArgusReplayManager::Get())
+	{
+		replayManager->RecordCommand(command);
+	}
+
+	ArgusEntity singletonEntity = ArgusEntity::GetSingletonEntity();
+	const UArgusActorRecord* moveToLocationDecalActorRecord = m_owningPlayerController->GetMoveToLocationDecalActorRecord();
+	switch (command.m_type)
+	{
+		case EArgusReplayCommandType::MoveCamera:
+			if (AArgusCameraActor* argusCamera = m_owningPlayerController->GetArgusCameraActor())
+			{
+				argusCamera->SetActorLocationAndRotation(command.m_location, command.m_rotation);
+			}
+			break;
+		case EArgusReplayCommandType::MoveReticle:
+			if (ReticleComponent* reticleComponent = singletonEntity.GetComponent<ReticleComponent>())
+			{
+				reticleComponent->m_reticleLocation = command.m_location;
+				UpdateReticleBlockedState(reticleComponent, ArgusStaticData::GetRecord<UAbilityRecord>(reticleComponent->m_abilityRecordId));
+			}
+			break;
+		case EArgusReplayCommandType::InterruptReticle:
+			InputInterfaceSystems::InterruptReticle();
+			break;
+		case EArgusReplayCommandType::CastReticleAbility:
+			ProcessReticleAbilityForSelectedEntities(singletonEntity.GetComponent<ReticleComponent>());
+			break;
+		case EArgusReplayCommandType::SelectEntity:
+			if (command.m_entityIds.Num() > 0)
+			{
+				const ArgusEntity selectedEntity = ArgusEntity::RetrieveEntity(command.m_entityIds[0]);
+				if (command.m_isAdditive)
+				{
+					InputInterfaceSystems::AddSelectedEntityAdditive(selectedEntity, moveToLocationDecalActorRecord);
+				}
+				else
+				{
+					InputInterfaceSystems::AddSelectedEntityExclusive(selectedEntity, moveToLocationDecalActorRecord);
+				}
+			}
+			break;
+		case EArgusReplayCommandType::SelectEntities:
+		{
+			TArray<uint16> selectedEntityIds = command.m_entityIds;
+			if (!command.m_isAdditive && selectedEntityIds.Num() > 0)
+			{
+				InputInterfaceSystems::AddMultipleSelectedEntitiesExclusive(selectedEntityIds, moveToLocationDecalActorRecord);
+			}
+			else
+			{
+				InputInterfaceSystems::AddMultipleSelectedEntitiesAdditive(selectedEntityIds, moveToLocationDecalActorRecord);
+			}
+			break;
+		}
+		case EArgusReplayCommandType::MoveTo:
+		{
+			InputInterfaceComponent* inputInterfaceComponent = singletonEntity.GetComponent<InputInterfaceComponent>();
+			ARGUS_RETURN_ON_NULL(inputInterfaceComponent, ArgusECSLog);
+
+			EMovementState inputMovementState = EMovementState::ProcessMoveToLocationCommand;
+			ArgusEntity targetEntity = ArgusEntity::k_emptyEntity;
+			ArgusEntity decalEntity = ArgusEntity::k_emptyEntity;
+			if (command.m_entityIds.Num() > 0)
+			{
+				targetEntity = ArgusEntity::RetrieveEntity(command.m_entityIds[0]);
+				if (targetEntity && targetEntity.GetComponent<TransformComponent>())
+				{
+					inputMovementState = EMovementState::ProcessMoveToEntityCommand;
+				}
+			}
+			else if (inputInterfaceComponent->m_selectedArgusEntityIds.Num() > 0)
+			{
+				decalEntity = DecalSystems::InstantiateMoveToLocationDecalEntity(moveToLocationDecalActorRecord, command.m_location, inputInterfaceComponent->m_selectedArgusEntityIds.Num(), ArgusECSConstants::k_maxEntities, EDecalTypePolicy::DeferredPopulation);
+			}
+
+			InputInterfaceSystems::MoveSelectedEntitiesToTarget(inputMovementState, targetEntity, command.m_location, decalEntity, command.m_onAttackMove);
+			break;
+		}
+		case EArgusReplayCommandType::SetWaypoint:
+		{
+			const uint16 numWaypointEligibleEntities = InputInterfaceSystems::GetNumWaypointEligibleEntities();
+			if (numWaypointEligibleEntities == 0u)
+			{
+				break;
+			}
+
+			ArgusEntity decalEntity = DecalSystems::InstantiateMoveToLocationDecalEntity(moveToLocationDecalActorRecord, command.m_location, numWaypointEligibleEntities, DecalSystems::GetMostRecentSelectedWaypointDecalEntityId(), EDecalTypePolicy::PopulateMoveToLocation);
+			InputInterfaceSystems::SetWaypointForSelectedEntities(command.m_location, decalEntity);
+			break;
+		}
+		case EArgusReplayCommandType::CastAbility:
+			InputInterfaceSystems::SetAbilityStateForCastIndex(static_cast<EAbilityIndex>(command.m_index));
+			break;
+		case EArgusReplayCommandType::ChangeActiveAbilityGroup:
+			InputInterfaceSystems::ChangeActiveAbilityGroup();
+			break;
+		case EArgusReplayCommandType::SetControlGroup:
+			InputInterfaceSystems::SetControlGroup(command.m_index);
+			break;
+		case EArgusReplayCommandType::SelectControlGroup:
+			InputInterfaceSystems::SelectControlGroup(command.m_index, moveToLocationDecalActorRecord);
+			if (AArgusCameraActor* argusCamera = m_owningPlayerController->GetArgusCameraActor())
+			{
+				argusCamera->FocusOnArgusEntity(InputInterfaceSystems::GetASelectedEntity());
+			}
+			break;
+		default:
+			break;
+	}
+}
+
+void UArgusInputManager::ProcessReplayCommands(AArgusCameraActor* argusCamera, const UArgusReplayManager* replayManager)
+{
+	ARGUS_TRACE(UArgusInputManager::ProcessReplayCommands);
+
+	ARGUS_RETURN_ON_NULL(argusCamera, ArgusInputLog);
+	ARGUS_RETURN_ON_NULL(replayManager, ArgusInputLog);
+
+	const TConstArrayView<ArgusReplayCommand> commands = replayManager->GetReplayCommandsThisFrame();
+	for (const ArgusReplayCommand& command : commands)
+	{
+		ExecuteCommand(command);
+	}
+
+	// The camera is placed by recorded commands, but which entities are in view still has to be refreshed every frame since entities move.
+	if (ValidateOwningPlayerController())
+	{
+		argusCamera->UpdateEntitiesInViewFrustrum(m_owningPlayerController->GetPlayerTeam());
+	}
 }
\ No newline at end of file
@@ -10,9 +10,12 @@
 #include "ArgusInputManager.generated.h"
 
 class	AArgusPlayerController;
+class	UAbilityRecord;
+class	UArgusReplayManager;
 class	UArgusInputActionSet;
 class	UEnhancedInputComponent;
 class   UEnhancedPlayerInput;
+struct	ArgusReplayCommand;
 struct	FInputActionValue;
 struct	ReticleComponent;
 struct  TargetingComponent;
@@ -160,8 +163,13 @@ private:
 	void ProcessUserInterfaceFocusEntityClicked(ArgusEntity entity);
 
 	void SetReticleState();
+	void UpdateReticleBlockedState(ReticleComponent* reticleComponent, const UAbilityRecord* abilityRecord);
 	void ProcessReticleAbilityForSelectedEntities(const ReticleComponent* reticleComponent);
 
+	// Every input that changes simulation state ends up here, so it is recorded by UArgusReplayManager and can be issued again during a replay.
+	void ExecuteCommand(const ArgusReplayCommand& command);
+	void ProcessReplayCommands(AArgusCameraActor* argusCamera, const UArgusReplayManager* replayManager);
+
 	FVector m_cachedLastSelectInputWorldSpaceLocation = FVector::ZeroVector;
 	bool m_selectInputDown = false;
 	bool m_canRotateCamera = false;
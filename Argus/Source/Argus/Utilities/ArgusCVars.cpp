@@ -10,4 +10,6 @@ TAutoConsoleVariable<bool> ArgusCVars::CVarDrawECSDebugger = TAutoConsoleVariabl
 TAutoConsoleVariable<bool> ArgusCVars::CVarDrawMemoryDebugger = TAutoConsoleVariable<bool>(TEXT("Argus.Debug.Memory"), false, TEXT("Whether or not the Memory ImGui debugger should be drawn."));
 TAutoConsoleVariable<bool> ArgusCVars::CVarShowObstacleDebug = TAutoConsoleVariable<bool>(TEXT("Argus.SpatialPartitioning.ShowAvoidanceObstacleDebug"), false, TEXT(""));
 TAutoConsoleVariable<bool> ArgusCVars::CVarDrawSaveManagerDebugger = TAutoConsoleVariable<bool>(TEXT("Argus.Debug.SaveManager"), false, TEXT("Whether or not the SaveManager ImGui debugger should be drawn."));
+TAutoConsoleVariable<bool> ArgusCVars::CVarDrawReplayManagerDebugger = TAutoConsoleVariable<bool>(TEXT("Argus.Debug.ReplayManager"), false, TEXT("Whether or not the ReplayManager ImGui debugger should be drawn."));
+TAutoConsoleVariable<float> ArgusCVars::CVarTeamCommanderSlowSliceMicroseconds = TAutoConsoleVariable<float>(TEXT("Argus.TeamCommander.SlowSliceMicroseconds"), 500.0f, TEXT("Team commander update slices slower than this are counted as slow in the ECS debugger. Has no effect on how the update is split."));
 #endif //!UE_BUILD_SHIPPING
\ No newline at end of file
@@ -15,5 +15,7 @@ public:
 	static TAutoConsoleVariable<bool> CVarDrawMemoryDebugger;
 	static TAutoConsoleVariable<bool> CVarShowObstacleDebug;
 	static TAutoConsoleVariable<bool> CVarDrawSaveManagerDebugger;
+	static TAutoConsoleVariable<bool> CVarDrawReplayManagerDebugger;
+	static TAutoConsoleVariable<float> CVarTeamCommanderSlowSliceMicroseconds;
 #endif //!UE_BUILD_SHIPPING
 };
\ No newline at end of file
@@ -16,6 +16,8 @@ public class ArgusCommandlets : ModuleRules
 			"CoreUObject",
 			"Engine",
 			"UnrealEd",
+			"AssetRegistry",
+			"NavigationSystem",
             "SourceControl",
             "Argus"
 		);
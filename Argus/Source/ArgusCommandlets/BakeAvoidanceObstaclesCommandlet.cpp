@@ -0,0 +1,112 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#include "BakeAvoidanceObstaclesCommandlet.h"
+#include "ArgusBakedObstacles.h"
+#include "ArgusECSCommandletInterface.h"
+#include "ArgusGameModeBase.h"
+#include "ArgusMacros.h"
+#include "ArgusStaticData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/AssetManager.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "Misc/PackageName.h"
+#include "NavMesh/RecastNavMesh.h"
+
+DEFINE_LOG_CATEGORY_STATIC(ArgusCommandletsLog, Display, All);
+
+void UBakeAvoidanceObstaclesCommandlet::OnStart()
+{
+	TSharedPtr<FStreamableHandle> loadDatabaseHandle = UAssetManager::Get().LoadPrimaryAssetsWithType(FPrimaryAssetType(UArgusStaticDatabase::StaticClass()->GetFName()));
+	if (loadDatabaseHandle.IsValid())
+	{
+		loadDatabaseHandle->WaitUntilComplete();
+	}
+}
+
+int32 UBakeAvoidanceObstaclesCommandlet::DoWork()
+{
+	FString mapsParameter;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("Maps="), mapsParameter, false))
+	{
+		UE_LOG(ArgusCommandletsLog, Error, TEXT("[%s] No maps were passed in. Use -Maps=/Game/Maps/MapA,/Game/Maps/MapB."), ARGUS_FUNCNAME);
+		return 1;
+	}
+
+	TArray<FString> mapPackageNames;
+	mapsParameter.ParseIntoArray(mapPackageNames, TEXT(","));
+
+	int32 result = 0;
+	for (const FString& mapPackageName : mapPackageNames)
+	{
+		ArgusECSCommandletInterface::InitializeECSForCommandlet();
+		if (!BakeAvoidanceObstaclesForMap(mapPackageName))
+		{
+			result = 1;
+		}
+		ArgusECSCommandletInterface::TeardownECSForCommandlet();
+	}
+
+	return result;
+}
+
+void UBakeAvoidanceObstaclesCommandlet::OnFinish()
+{
+	ArgusECSCommandletInterface::TeardownECSForCommandlet();
+}
+
+bool UBakeAvoidanceObstaclesCommandlet::BakeAvoidanceObstaclesForMap(const FString& mapPackageName)
+{
+	UPackage* mapPackage = LoadPackage(nullptr, *mapPackageName, LOAD_None);
+	UWorld* worldPointer = mapPackage ? UWorld::FindWorldInPackage(mapPackage) : nullptr;
+	if (!worldPointer || !worldPointer->PersistentLevel)
+	{
+		UE_LOG(ArgusCommandletsLog, Error, TEXT("[%s] Could not load a %s from %s."), ARGUS_FUNCNAME, ARGUS_NAMEOF(UWorld), *mapPackageName);
+		return false;
+	}
+
+	const ARecastNavMesh* navMesh = nullptr;
+	for (const AActor* actor : worldPointer->PersistentLevel->Actors)
+	{
+		navMesh = Cast<ARecastNavMesh>(actor);
+		if (navMesh)
+		{
+			break;
+		}
+	}
+
+	if (!navMesh)
+	{
+		UE_LOG(ArgusCommandletsLog, Error, TEXT("[%s] %s has no built %s."), ARGUS_FUNCNAME, *mapPackageName, ARGUS_NAMEOF(ARecastNavMesh));
+		return false;
+	}
+
+	const AWorldSettings* worldSettings = worldPointer->GetWorldSettings();
+	const AArgusGameModeBase* gameMode = worldSettings && worldSettings->DefaultGameMode ? Cast<AArgusGameModeBase>(worldSettings->DefaultGameMode->GetDefaultObject()) : nullptr;
+	const UArgusEntityTemplate* singletonEntityTemplate = gameMode ? gameMode->GetSingletonEntityTemplate() : nullptr;
+	if (!singletonEntityTemplate)
+	{
+		UE_LOG(ArgusCommandletsLog, Error, TEXT("[%s] %s does not override its game mode with an %s that has a singleton %s."), ARGUS_FUNCNAME, *mapPackageName, ARGUS_NAMEOF(AArgusGameModeBase), ARGUS_NAMEOF(UArgusEntityTemplate));
+		return false;
+	}
+
+	UArgusBakedObstacles* bakedObstacles = UArgusBakedObstacles::LoadForWorld(worldPointer);
+	if (!bakedObstacles)
+	{
+		const FString bakedObstaclesPackageName = UArgusBakedObstacles::GetPackageNameForWorld(worldPointer);
+		UPackage* bakedObstaclesPackage = CreatePackage(*bakedObstaclesPackageName);
+		bakedObstacles = NewObject<UArgusBakedObstacles>(bakedObstaclesPackage, *FPackageName::GetShortName(bakedObstaclesPackageName), RF_Public | RF_Standalone);
+		FAssetRegistryModule::AssetCreated(bakedObstacles);
+	}
+
+	if (!ArgusECSCommandletInterface::BakeAvoidanceObstacles(singletonEntityTemplate, navMesh, bakedObstacles))
+	{
+		UE_LOG(ArgusCommandletsLog, Error, TEXT("[%s] Failed to extract obstacles from the %s in %s."), ARGUS_FUNCNAME, ARGUS_NAMEOF(ARecastNavMesh), *mapPackageName);
+		return false;
+	}
+
+	bakedObstacles->Modify(true);
+
+	UE_LOG(ArgusCommandletsLog, Display, TEXT("[%s] Baked obstacles for %s."), ARGUS_FUNCNAME, *mapPackageName);
+	return SaveDataAsset(bakedObstacles);
+}
@@ -0,0 +1,23 @@
+// Copyright Karazaa. This is a part of an RTS project called Argus.
+
+#pragma once
+
+#include "ArgusCommandlet.h"
+#include "BakeAvoidanceObstaclesCommandlet.generated.h"
+
+class UWorld;
+
+// Usage: -run=BakeAvoidanceObstacles -Maps=/Game/Maps/MapA,/Game/Maps/MapB
+UCLASS()
+class ARGUSCOMMANDLETS_API UBakeAvoidanceObstaclesCommandlet : public UArgusCommandlet
+{
+	GENERATED_BODY()
+
+protected:
+	virtual void OnStart() override;
+	virtual int32 DoWork() override;
+	virtual void OnFinish() override;
+
+private:
+	bool BakeAvoidanceObstaclesForMap(const FString& mapPackageName);
+};